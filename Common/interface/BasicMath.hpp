@@ -53,6 +53,23 @@
 
 #include "HashUtils.hpp"
 
+// SIMD implementations of the most frequently used float4 and float4x4 operations are selected at
+// compile time based on the target instruction set. Define DILIGENT_NO_SIMD_MATH to use the scalar
+// implementations only.
+#if !defined(DILIGENT_NO_SIMD_MATH)
+#    if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#        define DILIGENT_SIMD_MATH_SSE 1
+#        include <emmintrin.h>
+#        if defined(__AVX__)
+#            define DILIGENT_SIMD_MATH_AVX 1
+#            include <immintrin.h>
+#        endif
+#    elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#        define DILIGENT_SIMD_MATH_NEON 1
+#        include <arm_neon.h>
+#    endif
+#endif
+
 #ifdef _MSC_VER
 #    pragma warning(push)
 #    pragma warning(disable : 4201) // nonstandard extension used: nameless struct/union
@@ -1749,6 +1766,314 @@ Vector2<T> operator*(const Matrix2x2<T>& m, const Vector2<T>& v)
     return out;
 }
 
+// SIMD specializations of float operations. The generic templates above are the reference implementations.
+
+#if DILIGENT_SIMD_MATH_SSE
+
+template <>
+inline Matrix4x4<float> Matrix4x4<float>::Mul(const Matrix4x4<float>& m1, const Matrix4x4<float>& m2)
+{
+    Matrix4x4<float> mOut;
+#    if DILIGENT_SIMD_MATH_AVX
+    // Compute two output rows at a time. Every 128-bit lane of Rk contains row k of m2.
+    const __m256 r01 = _mm256_loadu_ps(m2.m[0]);
+    const __m256 r23 = _mm256_loadu_ps(m2.m[2]);
+    const __m256 R0  = _mm256_permute2f128_ps(r01, r01, 0x00);
+    const __m256 R1  = _mm256_permute2f128_ps(r01, r01, 0x11);
+    const __m256 R2  = _mm256_permute2f128_ps(r23, r23, 0x00);
+    const __m256 R3  = _mm256_permute2f128_ps(r23, r23, 0x11);
+    for (int i = 0; i < 4; i += 2)
+    {
+        const __m256 A = _mm256_loadu_ps(m1.m[i]);
+
+        __m256 Res = _mm256_mul_ps(_mm256_shuffle_ps(A, A, 0x00), R0);
+        Res        = _mm256_add_ps(Res, _mm256_mul_ps(_mm256_shuffle_ps(A, A, 0x55), R1));
+        Res        = _mm256_add_ps(Res, _mm256_mul_ps(_mm256_shuffle_ps(A, A, 0xAA), R2));
+        Res        = _mm256_add_ps(Res, _mm256_mul_ps(_mm256_shuffle_ps(A, A, 0xFF), R3));
+        _mm256_storeu_ps(mOut.m[i], Res);
+    }
+#    else
+    const __m128 r0 = _mm_loadu_ps(m2.m[0]);
+    const __m128 r1 = _mm_loadu_ps(m2.m[1]);
+    const __m128 r2 = _mm_loadu_ps(m2.m[2]);
+    const __m128 r3 = _mm_loadu_ps(m2.m[3]);
+    for (int i = 0; i < 4; ++i)
+    {
+        __m128 Res = _mm_mul_ps(_mm_set1_ps(m1.m[i][0]), r0);
+        Res        = _mm_add_ps(Res, _mm_mul_ps(_mm_set1_ps(m1.m[i][1]), r1));
+        Res        = _mm_add_ps(Res, _mm_mul_ps(_mm_set1_ps(m1.m[i][2]), r2));
+        Res        = _mm_add_ps(Res, _mm_mul_ps(_mm_set1_ps(m1.m[i][3]), r3));
+        _mm_storeu_ps(mOut.m[i], Res);
+    }
+#    endif
+    return mOut;
+}
+
+template <>
+inline Matrix4x4<float> Matrix4x4<float>::Transpose() const
+{
+    __m128 r0 = _mm_loadu_ps(m[0]);
+    __m128 r1 = _mm_loadu_ps(m[1]);
+    __m128 r2 = _mm_loadu_ps(m[2]);
+    __m128 r3 = _mm_loadu_ps(m[3]);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    Matrix4x4<float> mOut;
+    _mm_storeu_ps(mOut.m[0], r0);
+    _mm_storeu_ps(mOut.m[1], r1);
+    _mm_storeu_ps(mOut.m[2], r2);
+    _mm_storeu_ps(mOut.m[3], r3);
+    return mOut;
+}
+
+template <>
+inline Matrix4x4<float> Matrix4x4<float>::Inverse() const
+{
+    // The matrix is partitioned into 2x2 blocks
+    //
+    //   | A  B |
+    //   | C  D |
+    //
+    // and the inverse is computed through the block adjugates. Every __m128 holds one
+    // 2x2 matrix in row-major order.
+
+#    define SHUFFLE_2(v1, v2, x, y, z, w) _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(w, z, y, x))
+#    define SWIZZLE(v, x, y, z, w)        SHUFFLE_2(v, v, x, y, z, w)
+
+    // 2x2 matrix product m1 * m2
+    auto Mat2Mul = [](__m128 m1, __m128 m2) {
+        return _mm_add_ps(_mm_mul_ps(m1, SWIZZLE(m2, 0, 3, 0, 3)),
+                          _mm_mul_ps(SWIZZLE(m1, 1, 0, 3, 2), SWIZZLE(m2, 2, 1, 2, 1)));
+    };
+    // 2x2 matrix product adj(m1) * m2
+    auto Mat2AdjMul = [](__m128 m1, __m128 m2) {
+        return _mm_sub_ps(_mm_mul_ps(SWIZZLE(m1, 3, 3, 0, 0), m2),
+                          _mm_mul_ps(SWIZZLE(m1, 1, 1, 2, 2), SWIZZLE(m2, 2, 3, 0, 1)));
+    };
+    // 2x2 matrix product m1 * adj(m2)
+    auto Mat2MulAdj = [](__m128 m1, __m128 m2) {
+        return _mm_sub_ps(_mm_mul_ps(m1, SWIZZLE(m2, 3, 0, 3, 0)),
+                          _mm_mul_ps(SWIZZLE(m1, 1, 0, 3, 2), SWIZZLE(m2, 2, 1, 2, 1)));
+    };
+
+    const __m128 r0 = _mm_loadu_ps(m[0]);
+    const __m128 r1 = _mm_loadu_ps(m[1]);
+    const __m128 r2 = _mm_loadu_ps(m[2]);
+    const __m128 r3 = _mm_loadu_ps(m[3]);
+
+    const __m128 A = _mm_movelh_ps(r0, r1);
+    const __m128 B = _mm_movehl_ps(r1, r0);
+    const __m128 C = _mm_movelh_ps(r2, r3);
+    const __m128 D = _mm_movehl_ps(r3, r2);
+
+    // Determinants of A, B, C and D
+    const __m128 detSub = _mm_sub_ps(_mm_mul_ps(SHUFFLE_2(r0, r2, 0, 2, 0, 2), SHUFFLE_2(r1, r3, 1, 3, 1, 3)),
+                                     _mm_mul_ps(SHUFFLE_2(r0, r2, 1, 3, 1, 3), SHUFFLE_2(r1, r3, 0, 2, 0, 2)));
+
+    const __m128 detA = SWIZZLE(detSub, 0, 0, 0, 0);
+    const __m128 detB = SWIZZLE(detSub, 1, 1, 1, 1);
+    const __m128 detC = SWIZZLE(detSub, 2, 2, 2, 2);
+    const __m128 detD = SWIZZLE(detSub, 3, 3, 3, 3);
+
+    const __m128 D_C = Mat2AdjMul(D, C);
+    const __m128 A_B = Mat2AdjMul(A, B);
+
+    __m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), Mat2Mul(B, D_C));
+    __m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), Mat2Mul(C, A_B));
+    __m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), Mat2MulAdj(D, A_B));
+    __m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), Mat2MulAdj(A, D_C));
+
+    // det(M) = det(A) * det(D) + det(B) * det(C) - tr(adj(A) * B * adj(D) * C)
+    __m128 tr = _mm_mul_ps(A_B, SWIZZLE(D_C, 0, 2, 1, 3));
+    tr        = _mm_add_ps(tr, SWIZZLE(tr, 1, 0, 3, 2));
+    tr        = _mm_add_ps(tr, SWIZZLE(tr, 2, 3, 0, 1));
+
+    __m128 detM = _mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC));
+    detM        = _mm_sub_ps(detM, tr);
+
+    const __m128 rcpDetM = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), detM);
+
+    X = _mm_mul_ps(X, rcpDetM);
+    Y = _mm_mul_ps(Y, rcpDetM);
+    Z = _mm_mul_ps(Z, rcpDetM);
+    W = _mm_mul_ps(W, rcpDetM);
+
+    Matrix4x4<float> inv;
+    _mm_storeu_ps(inv.m[0], SHUFFLE_2(X, Y, 3, 1, 3, 1));
+    _mm_storeu_ps(inv.m[1], SHUFFLE_2(X, Y, 2, 0, 2, 0));
+    _mm_storeu_ps(inv.m[2], SHUFFLE_2(Z, W, 3, 1, 3, 1));
+    _mm_storeu_ps(inv.m[3], SHUFFLE_2(Z, W, 2, 0, 2, 0));
+
+#    undef SWIZZLE
+#    undef SHUFFLE_2
+
+    return inv;
+}
+
+template <>
+inline Vector4<float> Vector4<float>::operator*(const Matrix4x4<float>& m) const
+{
+    __m128 Res = _mm_mul_ps(_mm_set1_ps(x), _mm_loadu_ps(m[0]));
+    Res        = _mm_add_ps(Res, _mm_mul_ps(_mm_set1_ps(y), _mm_loadu_ps(m[1])));
+    Res        = _mm_add_ps(Res, _mm_mul_ps(_mm_set1_ps(z), _mm_loadu_ps(m[2])));
+    Res        = _mm_add_ps(Res, _mm_mul_ps(_mm_set1_ps(w), _mm_loadu_ps(m[3])));
+
+    Vector4<float> out;
+    _mm_storeu_ps(out.Data(), Res);
+    return out;
+}
+
+template <>
+inline Vector4<float> operator*(const Matrix4x4<float>& m, const Vector4<float>& v)
+{
+    const __m128 V = _mm_loadu_ps(v.Data());
+
+    __m128 p0 = _mm_mul_ps(_mm_loadu_ps(m[0]), V);
+    __m128 p1 = _mm_mul_ps(_mm_loadu_ps(m[1]), V);
+    __m128 p2 = _mm_mul_ps(_mm_loadu_ps(m[2]), V);
+    __m128 p3 = _mm_mul_ps(_mm_loadu_ps(m[3]), V);
+    _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+
+    Vector4<float> out;
+    _mm_storeu_ps(out.Data(), _mm_add_ps(_mm_add_ps(_mm_add_ps(p0, p1), p2), p3));
+    return out;
+}
+
+namespace detail
+{
+
+// Returns the dot product in all components
+inline __m128 DotSSE(const Vector4<float>& a, const Vector4<float>& b)
+{
+    __m128 p = _mm_mul_ps(_mm_loadu_ps(a.Data()), _mm_loadu_ps(b.Data()));
+    p        = _mm_add_ps(p, _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 3, 0, 1)));
+    p        = _mm_add_ps(p, _mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 0, 3, 2)));
+    return p;
+}
+
+} // namespace detail
+
+template <>
+inline float dot(const Vector4<float>& a, const Vector4<float>& b)
+{
+    return _mm_cvtss_f32(detail::DotSSE(a, b));
+}
+
+template <>
+inline Vector4<float> normalize(const Vector4<float>& a)
+{
+    Vector4<float> out;
+    _mm_storeu_ps(out.Data(), _mm_div_ps(_mm_loadu_ps(a.Data()), _mm_sqrt_ps(detail::DotSSE(a, a))));
+    return out;
+}
+
+template <>
+inline Vector3<float> cross(const Vector3<float>& a, const Vector3<float>& b)
+{
+    const __m128 A = _mm_setr_ps(a.x, a.y, a.z, 0);
+    const __m128 B = _mm_setr_ps(b.x, b.y, b.z, 0);
+
+    const __m128 A_yzx = _mm_shuffle_ps(A, A, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m128 A_zxy = _mm_shuffle_ps(A, A, _MM_SHUFFLE(3, 1, 0, 2));
+    const __m128 B_yzx = _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m128 B_zxy = _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 1, 0, 2));
+
+    float Res[4];
+    _mm_storeu_ps(Res, _mm_sub_ps(_mm_mul_ps(A_yzx, B_zxy), _mm_mul_ps(A_zxy, B_yzx)));
+    return Vector3<float>{Res[0], Res[1], Res[2]};
+}
+
+#elif DILIGENT_SIMD_MATH_NEON
+
+namespace detail
+{
+
+inline float HorizontalAddNEON(float32x4_t v)
+{
+#    if defined(__aarch64__) || defined(_M_ARM64)
+    return vaddvq_f32(v);
+#    else
+    float32x2_t s = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+    return vget_lane_f32(vpadd_f32(s, s), 0);
+#    endif
+}
+
+} // namespace detail
+
+template <>
+inline Matrix4x4<float> Matrix4x4<float>::Mul(const Matrix4x4<float>& m1, const Matrix4x4<float>& m2)
+{
+    const float32x4_t r0 = vld1q_f32(m2.m[0]);
+    const float32x4_t r1 = vld1q_f32(m2.m[1]);
+    const float32x4_t r2 = vld1q_f32(m2.m[2]);
+    const float32x4_t r3 = vld1q_f32(m2.m[3]);
+
+    Matrix4x4<float> mOut;
+    for (int i = 0; i < 4; ++i)
+    {
+        float32x4_t Res = vmulq_n_f32(r0, m1.m[i][0]);
+        Res             = vmlaq_n_f32(Res, r1, m1.m[i][1]);
+        Res             = vmlaq_n_f32(Res, r2, m1.m[i][2]);
+        Res             = vmlaq_n_f32(Res, r3, m1.m[i][3]);
+        vst1q_f32(mOut.m[i], Res);
+    }
+    return mOut;
+}
+
+template <>
+inline Matrix4x4<float> Matrix4x4<float>::Transpose() const
+{
+    // De-interleaving load puts matrix columns into the registers
+    const float32x4x4_t Cols = vld4q_f32(Data());
+
+    Matrix4x4<float> mOut;
+    vst1q_f32(mOut.m[0], Cols.val[0]);
+    vst1q_f32(mOut.m[1], Cols.val[1]);
+    vst1q_f32(mOut.m[2], Cols.val[2]);
+    vst1q_f32(mOut.m[3], Cols.val[3]);
+    return mOut;
+}
+
+template <>
+inline Vector4<float> Vector4<float>::operator*(const Matrix4x4<float>& m) const
+{
+    float32x4_t Res = vmulq_n_f32(vld1q_f32(m[0]), x);
+    Res             = vmlaq_n_f32(Res, vld1q_f32(m[1]), y);
+    Res             = vmlaq_n_f32(Res, vld1q_f32(m[2]), z);
+    Res             = vmlaq_n_f32(Res, vld1q_f32(m[3]), w);
+
+    Vector4<float> out;
+    vst1q_f32(out.Data(), Res);
+    return out;
+}
+
+template <>
+inline Vector4<float> operator*(const Matrix4x4<float>& m, const Vector4<float>& v)
+{
+    const float32x4_t V = vld1q_f32(v.Data());
+    return Vector4<float>{
+        detail::HorizontalAddNEON(vmulq_f32(vld1q_f32(m[0]), V)),
+        detail::HorizontalAddNEON(vmulq_f32(vld1q_f32(m[1]), V)),
+        detail::HorizontalAddNEON(vmulq_f32(vld1q_f32(m[2]), V)),
+        detail::HorizontalAddNEON(vmulq_f32(vld1q_f32(m[3]), V)) //
+    };
+}
+
+template <>
+inline float dot(const Vector4<float>& a, const Vector4<float>& b)
+{
+    return detail::HorizontalAddNEON(vmulq_f32(vld1q_f32(a.Data()), vld1q_f32(b.Data())));
+}
+
+template <>
+inline Vector4<float> normalize(const Vector4<float>& a)
+{
+    return a / std::sqrt(dot(a, a));
+}
+
+#endif
+
+
 // Common HLSL-compatible vector typedefs
 
 using uint  = uint32_t;
@@ -0,0 +1,114 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Batched frustum culling of axis-aligned bounding boxes stored as structure of arrays
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "AdvancedMath.hpp"
+
+namespace Diligent
+{
+
+class ThreadPool;
+
+/// Bounding boxes stored as structure of arrays.
+
+/// Every array must contain at least NumBoxes elements. Arrays do not need to be aligned.
+struct BoundBoxSoA
+{
+    const float* MinX = nullptr;
+    const float* MinY = nullptr;
+    const float* MinZ = nullptr;
+    const float* MaxX = nullptr;
+    const float* MaxY = nullptr;
+    const float* MaxZ = nullptr;
+
+    Uint32 NumBoxes = 0;
+};
+
+/// Returns the number of 32-bit words required to store the visibility mask for NumBoxes boxes.
+inline Uint32 GetBoxVisibilityMaskSize(Uint32 NumBoxes)
+{
+    return (NumBoxes + 31) / 32;
+}
+
+/// Tests all boxes against the view frustum and writes the visibility bit mask.
+
+/// \param [in]  Frustum     - View frustum.
+/// \param [in]  Boxes       - Bounding boxes to test.
+/// \param [out] pVisibility - Visibility bit mask. Bit i of word i/32 is set if box i is not
+///                            invisible. The array must contain at least
+///                            GetBoxVisibilityMaskSize(Boxes.NumBoxes) elements. Unused bits
+///                            in the last word are set to zero.
+/// \param [in]  PlaneFlags  - Frustum planes to test the boxes against.
+///
+/// \remarks    For every box, the result is identical to
+///             GetBoxVisibility(Frustum, Box, PlaneFlags) != BoxVisibility::Invisible.
+///             SIMD instructions are used to process 4 (SSE, NEON) or 8 (AVX) boxes at once.
+void GetBoxVisibilityMask(const ViewFrustumExt& Frustum,
+                          const BoundBoxSoA&    Boxes,
+                          Uint32*               pVisibility,
+                          FRUSTUM_PLANE_FLAGS   PlaneFlags = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM);
+
+/// Tests all boxes against the view frustum and writes the indices of the visible boxes.
+
+/// \param [in]  Frustum         - View frustum.
+/// \param [in]  Boxes           - Bounding boxes to test.
+/// \param [out] pVisibleIndices - Indices of the boxes that are not invisible, in ascending order.
+///                                The array must contain at least Boxes.NumBoxes elements.
+/// \param [in]  PlaneFlags      - Frustum planes to test the boxes against.
+///
+/// \return     The number of visible boxes.
+Uint32 GetVisibleBoxIndices(const ViewFrustumExt& Frustum,
+                            const BoundBoxSoA&    Boxes,
+                            Uint32*               pVisibleIndices,
+                            FRUSTUM_PLANE_FLAGS   PlaneFlags = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM);
+
+/// Multithreaded version of GetBoxVisibilityMask().
+
+/// The boxes are split into up to WorkerPool.GetNumThreads()+1 ranges that are processed
+/// in parallel by the calling thread and the pool threads. The calling thread processes
+/// the ranges that no pool thread has picked up, so the function does not wait for tasks
+/// queued behind other work and may be called from a pool thread. Small batches are
+/// processed by the calling thread only.
+void GetBoxVisibilityMaskMT(const ViewFrustumExt& Frustum,
+                            const BoundBoxSoA&    Boxes,
+                            Uint32*               pVisibility,
+                            ThreadPool&           WorkerPool,
+                            FRUSTUM_PLANE_FLAGS   PlaneFlags = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM);
+
+/// Multithreaded version of GetVisibleBoxIndices(), see GetBoxVisibilityMaskMT().
+Uint32 GetVisibleBoxIndicesMT(const ViewFrustumExt& Frustum,
+                              const BoundBoxSoA&    Boxes,
+                              Uint32*               pVisibleIndices,
+                              ThreadPool&           WorkerPool,
+                              FRUSTUM_PLANE_FLAGS   PlaneFlags = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM);
+
+} // namespace Diligent
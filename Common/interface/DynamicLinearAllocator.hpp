@@ -0,0 +1,294 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::DynamicLinearAllocator class
+
+#include <vector>
+#include <string>
+#include <cstring>
+#include <algorithm>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/MemoryAllocator.h"
+#include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "Align.hpp"
+
+namespace Diligent
+{
+
+/// Linear allocator that bump-allocates memory from a chain of pages
+
+/// Unlike LinearAllocator, the total size does not need to be known up front: when the current
+/// page is exhausted, the allocator moves to the next page, allocating a new one if necessary.
+/// Reset() recycles all pages without releasing the memory, so that an allocator that is reset
+/// every frame stops calling the raw allocator once it has reached its working set size.
+/// If trim period is not zero, every TrimPeriod resets the allocator releases the pages that
+/// were not used since the previous trim.
+class DynamicLinearAllocator
+{
+public:
+    // clang-format off
+    DynamicLinearAllocator           (const DynamicLinearAllocator&) = delete;
+    DynamicLinearAllocator& operator=(const DynamicLinearAllocator&) = delete;
+    DynamicLinearAllocator& operator=(DynamicLinearAllocator&&)      = delete;
+    // clang-format on
+
+    /// \param [in] Allocator  - Allocator that is used to allocate the pages.
+    /// \param [in] PageSize   - Default page size. Allocations that do not fit into a page of
+    ///                          this size are given a dedicated larger page.
+    /// \param [in] TrimPeriod - Number of resets after which the pages that were not used
+    ///                          during that period are released. Zero disables trimming.
+    explicit DynamicLinearAllocator(IMemoryAllocator& Allocator, size_t PageSize = 4096, Uint32 TrimPeriod = 0) noexcept :
+        // clang-format off
+        m_pAllocator{&Allocator},
+        m_PageSize  {Align(std::max(PageSize, sizeof(void*)), sizeof(void*))},
+        m_TrimPeriod{TrimPeriod}
+    // clang-format on
+    {}
+
+    DynamicLinearAllocator(DynamicLinearAllocator&& Other) noexcept :
+        // clang-format off
+        m_Pages       {std::move(Other.m_Pages)},
+        m_NumUsedPages{Other.m_NumUsedPages    },
+        m_MaxUsedPages{Other.m_MaxUsedPages    },
+        m_ResetCount  {Other.m_ResetCount      },
+        m_pAllocator  {Other.m_pAllocator      },
+        m_PageSize    {Other.m_PageSize        },
+        m_TrimPeriod  {Other.m_TrimPeriod      }
+    // clang-format on
+    {
+        Other.m_Pages.clear();
+        Other.m_NumUsedPages = 0;
+        Other.m_MaxUsedPages = 0;
+        Other.m_ResetCount   = 0;
+    }
+
+    ~DynamicLinearAllocator()
+    {
+        Free();
+    }
+
+    /// Releases all pages
+    void Free()
+    {
+        for (auto& Page : m_Pages)
+            m_pAllocator->Free(Page.pData);
+        m_Pages.clear();
+        m_NumUsedPages = 0;
+        m_MaxUsedPages = 0;
+        m_ResetCount   = 0;
+    }
+
+    /// Discards all allocations and makes all pages available for reuse.
+    /// Pointers returned by Allocate() become invalid.
+    void Reset()
+    {
+        for (Uint32 p = 0; p < m_NumUsedPages; ++p)
+            m_Pages[p].pCurrPtr = m_Pages[p].pData;
+        m_NumUsedPages = 0;
+
+        if (m_TrimPeriod != 0 && ++m_ResetCount >= m_TrimPeriod)
+        {
+            // Release the pages above the high-water mark of the last period
+            for (size_t p = m_MaxUsedPages; p < m_Pages.size(); ++p)
+                m_pAllocator->Free(m_Pages[p].pData);
+            m_Pages.erase(m_Pages.begin() + m_MaxUsedPages, m_Pages.end());
+
+            m_MaxUsedPages = 0;
+            m_ResetCount   = 0;
+        }
+    }
+
+    void* Allocate(size_t size, size_t alignment)
+    {
+        VERIFY(IsPowerOfTwo(alignment), "Alignment is not a power of two!");
+
+        if (size == 0)
+            return nullptr;
+
+        if (m_NumUsedPages > 0)
+        {
+            if (auto* Ptr = m_Pages[m_NumUsedPages - 1].Allocate(size, alignment))
+                return Ptr;
+        }
+
+        // Page memory is only guaranteed to be sizeof(void*)-aligned,
+        // so reserve extra space that may be needed for alignment
+        const auto RequiredSize = size + (alignment > sizeof(void*) ? alignment - sizeof(void*) : 0);
+
+        // Look for a recycled page that is large enough and move it right after the current one
+        auto PageIdx = m_Pages.size();
+        for (size_t p = m_NumUsedPages; p < m_Pages.size(); ++p)
+        {
+            if (m_Pages[p].Size >= RequiredSize)
+            {
+                PageIdx = p;
+                break;
+            }
+        }
+
+        if (PageIdx == m_Pages.size())
+        {
+            const auto PageSize = std::max(m_PageSize, Align(RequiredSize, sizeof(void*)));
+
+            auto* pData = reinterpret_cast<Uint8*>(m_pAllocator->Allocate(PageSize, "Memory page for dynamic linear allocator", __FILE__, __LINE__));
+            VERIFY(pData == Align(pData, sizeof(void*)), "Memory pointer must be at least sizeof(void*)-aligned");
+            m_Pages.emplace_back(pData, PageSize);
+        }
+
+        if (PageIdx != m_NumUsedPages)
+            std::swap(m_Pages[PageIdx], m_Pages[m_NumUsedPages]);
+
+        ++m_NumUsedPages;
+        m_MaxUsedPages = std::max(m_MaxUsedPages, m_NumUsedPages);
+
+        auto* Ptr = m_Pages[m_NumUsedPages - 1].Allocate(size, alignment);
+        VERIFY(Ptr != nullptr, "The page is expected to have enough space for the allocation");
+        return Ptr;
+    }
+
+    template <typename T>
+    T* Allocate(size_t count = 1)
+    {
+        return reinterpret_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    template <typename T, typename... Args>
+    T* Construct(Args&&... args)
+    {
+        T* Ptr = Allocate<T>();
+        new (Ptr) T{std::forward<Args>(args)...};
+        return Ptr;
+    }
+
+    template <typename T, typename... Args>
+    T* ConstructArray(size_t count, const Args&... args)
+    {
+        T* Ptr = Allocate<T>(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            new (Ptr + i) T{args...};
+        }
+        return Ptr;
+    }
+
+    template <typename T>
+    T* Copy(const T& Src)
+    {
+        return Construct<T>(Src);
+    }
+
+    template <typename T>
+    T* CopyArray(const T* Src, size_t count)
+    {
+        T* Dst = Allocate<T>(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            new (Dst + i) T{Src[i]};
+        }
+        return Dst;
+    }
+
+    Char* CopyString(const char* Str)
+    {
+        if (Str == nullptr)
+            return nullptr;
+
+        const auto Len = strlen(Str);
+        auto*      Dst = reinterpret_cast<Char*>(Allocate(Len + 1, 1));
+        memcpy(Dst, Str, Len + 1);
+        return Dst;
+    }
+
+    Char* CopyString(const std::string& Str)
+    {
+        return CopyString(Str.c_str());
+    }
+
+    /// Returns the number of bytes allocated since the last reset, including the alignment padding
+    size_t GetUsedSize() const
+    {
+        size_t UsedSize = 0;
+        for (Uint32 p = 0; p < m_NumUsedPages; ++p)
+            UsedSize += static_cast<size_t>(m_Pages[p].pCurrPtr - m_Pages[p].pData);
+        return UsedSize;
+    }
+
+    /// Returns the total size of all pages
+    size_t GetReservedSize() const
+    {
+        size_t ReservedSize = 0;
+        for (const auto& Page : m_Pages)
+            ReservedSize += Page.Size;
+        return ReservedSize;
+    }
+
+    size_t GetPageCount() const
+    {
+        return m_Pages.size();
+    }
+
+private:
+    struct Page
+    {
+        Page(Uint8* _pData, size_t _Size) noexcept :
+            // clang-format off
+            pData   {_pData},
+            pCurrPtr{_pData},
+            Size    {_Size }
+        // clang-format on
+        {}
+
+        void* Allocate(size_t size, size_t alignment)
+        {
+            auto* Ptr = Align(pCurrPtr, alignment);
+            if (Ptr > pData + Size || static_cast<size_t>(pData + Size - Ptr) < size)
+                return nullptr;
+
+            pCurrPtr = Ptr + size;
+            return Ptr;
+        }
+
+        Uint8* pData;
+        Uint8* pCurrPtr;
+        size_t Size;
+    };
+    std::vector<Page> m_Pages;
+
+    Uint32 m_NumUsedPages = 0; // Number of pages used since the last reset
+    Uint32 m_MaxUsedPages = 0; // Maximum number of pages used since the last trim
+    Uint32 m_ResetCount   = 0; // Number of resets since the last trim
+
+    IMemoryAllocator* const m_pAllocator;
+    const size_t            m_PageSize;
+    const Uint32            m_TrimPeriod;
+};
+
+} // namespace Diligent
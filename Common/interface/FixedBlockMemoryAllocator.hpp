@@ -30,7 +30,6 @@
 /// \file
 /// Declaration of Diligent::FixedBlockMemoryAllocator class
 
-#include <unordered_map>
 #include <mutex>
 #include <unordered_set>
 #include <vector>
@@ -53,10 +52,30 @@ inline void FillWithDebugPattern(void* ptr, Uint8 Pattern, size_t NumBytes)
 #endif
 
 /// Memory allocator that allocates memory in a fixed-size chunks
+
+/// Every thread that uses the allocator keeps a small local cache (magazine) of free blocks.
+/// Allocate() and Free() only lock the shared page pool when the magazine is empty or full, in which
+/// case a batch of blocks is moved between the magazine and the pool. The page that owns a block
+/// is found by a binary search in the list of pages sorted by their addresses.
 class FixedBlockMemoryAllocator final : public IMemoryAllocator
 {
 public:
-    FixedBlockMemoryAllocator(IMemoryAllocator& RawMemoryAllocator, size_t BlockSize, Uint32 NumBlocksInPage);
+    /// Default maximum number of free blocks that a thread keeps in its local cache
+    static constexpr Uint32 DefaultThreadCacheSize = 32;
+
+    /// Maximum allowed thread cache size
+    static constexpr Uint32 MaxThreadCacheSize = 256;
+
+    /// \param [in] RawMemoryAllocator - Allocator that is used to allocate memory pages.
+    /// \param [in] BlockSize          - Block size, in bytes.
+    /// \param [in] NumBlocksInPage    - Number of blocks in one page.
+    /// \param [in] ThreadCacheSize    - Maximum number of free blocks every thread keeps locally.
+    ///                                  Zero disables thread caches, in which case every operation
+    ///                                  locks the shared page pool.
+    FixedBlockMemoryAllocator(IMemoryAllocator& RawMemoryAllocator,
+                              size_t            BlockSize,
+                              Uint32            NumBlocksInPage,
+                              Uint32            ThreadCacheSize = DefaultThreadCacheSize);
     ~FixedBlockMemoryAllocator();
 
     /// Allocates block of memory
@@ -73,7 +92,18 @@ private:
     FixedBlockMemoryAllocator& operator = (FixedBlockMemoryAllocator&&)      = delete;
     // clang-format on
 
-    void CreateNewPage();
+    void  CreateNewPage();
+    void* AllocateFromPool();
+    void  FreeToPool(void* Ptr);
+
+    struct ThreadMagazine;
+    class ThreadMagazineCache;
+
+    ThreadMagazine* GetThreadMagazine();
+    void            ReturnMagazineBlocks(ThreadMagazine& Magazine);
+
+    // Returns the index of the page that owns the block. Must be called with the mutex locked.
+    size_t FindPage(const void* pBlock) const;
 
     // Memory page class is based on the fixed-size memory pool described in "Fast Efficient Fixed-Size Memory Pool"
     // by Ben Kenwright
@@ -92,10 +122,9 @@ private:
             m_pOwnerAllocator     {&OwnerAllocator}
         // clang-format on
         {
-            auto PageSize = OwnerAllocator.m_BlockSize * OwnerAllocator.m_NumBlocksInPage;
-            m_pPageStart  = reinterpret_cast<Uint8*>(
-                OwnerAllocator.m_RawMemoryAllocator.Allocate(PageSize, "FixedBlockMemoryAllocator page", __FILE__, __LINE__));
-            m_pNextFreeBlock = m_pPageStart;
+            const auto PageSize = OwnerAllocator.m_BlockSize * OwnerAllocator.m_NumBlocksInPage;
+            m_pPageStart        = OwnerAllocator.m_RawMemoryAllocator.Allocate(PageSize, "FixedBlockMemoryAllocator page", __FILE__, __LINE__);
+            m_pNextFreeBlock    = m_pPageStart;
             FillWithDebugPattern(m_pPageStart, NewPageMemPattern, PageSize);
         }
 
@@ -198,6 +227,7 @@ private:
             VERIFY_EXPR(m_pOwnerAllocator != nullptr);
 
             dbgVerifyAddress(p);
+            VERIFY(HasAllocations(), "The page has no allocated blocks - double freeing memory?");
             FillWithDebugPattern(p, DeallocatedBlockMemPattern, m_pOwnerAllocator->m_BlockSize);
             // Add block to the beginning of the linked list
             *reinterpret_cast<void**>(p) = m_pNextFreeBlock;
@@ -206,7 +236,9 @@ private:
         }
 
         bool HasSpace() const { return m_NumFreeBlocks > 0; }
-        bool HasAllocations() const { return m_NumFreeBlocks < m_NumInitializedBlocks; }
+        bool HasAllocations() const { return m_NumFreeBlocks < m_pOwnerAllocator->m_NumBlocksInPage; }
+
+        const void* GetPageStart() const { return m_pPageStart; }
 
     private:
         MemoryPage(const MemoryPage&) = delete;
@@ -223,14 +255,18 @@ private:
     std::vector<MemoryPage, STDAllocatorRawMem<MemoryPage>>                                          m_PagePool;
     std::unordered_set<size_t, std::hash<size_t>, std::equal_to<size_t>, STDAllocatorRawMem<size_t>> m_AvailablePages;
 
-    using AddrToPageIdMapElem = std::pair<void* const, size_t>;
-    std::unordered_map<void*, size_t, std::hash<void*>, std::equal_to<void*>, STDAllocatorRawMem<AddrToPageIdMapElem>> m_AddrToPageId;
+    // Indices of all pages sorted by the page start address
+    std::vector<size_t, STDAllocatorRawMem<size_t>> m_SortedPages;
+
+    // Magazines of all threads that use this allocator
+    std::vector<ThreadMagazine*, STDAllocatorRawMem<ThreadMagazine*>> m_Magazines;
 
     std::mutex m_Mutex;
 
     IMemoryAllocator& m_RawMemoryAllocator;
     const size_t      m_BlockSize;
     const Uint32      m_NumBlocksInPage;
+    const Uint32      m_ThreadCacheSize;
 };
 
 IMemoryAllocator& GetRawAllocator();
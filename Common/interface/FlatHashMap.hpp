@@ -0,0 +1,572 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::FlatHashMap class
+
+#include <memory>
+#include <cstring>
+#include <utility>
+#include <functional>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/Errors.hpp"
+#include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+/// Open-addressing hash map that stores its elements in a single contiguous array.
+
+/// The map uses Robin Hood hashing with linear probing and backward-shift deletion.
+/// Every slot has a one-byte probe distance in a separate metadata array, so that lookups
+/// only touch the metadata and the keys in a short run of adjacent slots.
+/// Slots do not wrap around: the table has an overflow area at the end, and the table grows
+/// when an element cannot be placed within the maximum probe distance. Insertion throws if the
+/// probe distance is exceeded in a sparse table, which only happens when many keys have the same hash.
+///
+/// Differences from std::unordered_map:
+/// - value_type is std::pair<KeyType, ValueType>; the key must not be modified through an iterator.
+/// - Insertion and rehashing move elements, so any insertion invalidates iterators, pointers and references.
+/// - Erasing an element moves the elements that follow it back by one slot. erase(iterator)
+///   returns the iterator to the next element, and elements are never visited twice.
+/// - If HasherType and KeyEqualType define is_transparent, find() and count() accept
+///   any key type that they can process (heterogeneous lookup).
+///
+/// KeyType and ValueType must be move-constructible; they do not need to be assignable.
+template <typename KeyType,
+          typename ValueType,
+          typename HasherType    = std::hash<KeyType>,
+          typename KeyEqualType  = std::equal_to<KeyType>,
+          typename AllocatorType = std::allocator<std::pair<KeyType, ValueType>>>
+class FlatHashMap
+{
+public:
+    using key_type       = KeyType;
+    using mapped_type    = ValueType;
+    using value_type     = std::pair<KeyType, ValueType>;
+    using size_type      = size_t;
+    using hasher         = HasherType;
+    using key_equal      = KeyEqualType;
+    using allocator_type = AllocatorType;
+
+    static_assert(std::is_same<typename AllocatorType::value_type, value_type>::value, "Allocator must allocate std::pair<KeyType, ValueType>");
+
+    template <bool IsConst>
+    class IteratorBase
+    {
+    public:
+        using MapType = typename std::conditional<IsConst, const FlatHashMap, FlatHashMap>::type;
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = typename FlatHashMap::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = typename std::conditional<IsConst, const value_type&, value_type&>::type;
+        using pointer           = typename std::conditional<IsConst, const value_type*, value_type*>::type;
+
+        IteratorBase() noexcept {}
+
+        IteratorBase(MapType* pMap, size_t Idx) noexcept :
+            m_pMap{pMap},
+            m_Idx{Idx}
+        {}
+
+        // Allows iterator -> const_iterator conversion
+        template <bool OtherIsConst, typename = typename std::enable_if<IsConst && !OtherIsConst>::type>
+        IteratorBase(const IteratorBase<OtherIsConst>& Other) noexcept :
+            m_pMap{Other.m_pMap},
+            m_Idx{Other.m_Idx}
+        {}
+
+        reference operator*() const
+        {
+            VERIFY_EXPR(m_pMap != nullptr && m_Idx < m_pMap->m_NumSlots && m_pMap->m_Dist[m_Idx] != 0);
+            return m_pMap->m_Slots[m_Idx];
+        }
+
+        pointer operator->() const
+        {
+            return &operator*();
+        }
+
+        IteratorBase& operator++()
+        {
+            m_Idx = m_pMap->SkipEmptySlots(m_Idx + 1);
+            return *this;
+        }
+
+        IteratorBase operator++(int)
+        {
+            auto Tmp = *this;
+            ++(*this);
+            return Tmp;
+        }
+
+        template <bool OtherIsConst>
+        bool operator==(const IteratorBase<OtherIsConst>& rhs) const
+        {
+            return m_pMap == rhs.m_pMap && m_Idx == rhs.m_Idx;
+        }
+
+        template <bool OtherIsConst>
+        bool operator!=(const IteratorBase<OtherIsConst>& rhs) const
+        {
+            return !(*this == rhs);
+        }
+
+    private:
+        friend class FlatHashMap;
+        template <bool>
+        friend class IteratorBase;
+
+        MapType* m_pMap = nullptr;
+        size_t   m_Idx  = 0;
+    };
+
+    using iterator       = IteratorBase<false>;
+    using const_iterator = IteratorBase<true>;
+
+    explicit FlatHashMap(const AllocatorType& Allocator = AllocatorType{}) :
+        m_Allocator{Allocator}
+    {}
+
+    FlatHashMap(const HasherType& Hasher, const KeyEqualType& KeyEqual, const AllocatorType& Allocator = AllocatorType{}) :
+        m_Hasher{Hasher},
+        m_KeyEqual{KeyEqual},
+        m_Allocator{Allocator}
+    {}
+
+    // clang-format off
+    FlatHashMap           (const FlatHashMap&) = delete;
+    FlatHashMap& operator=(const FlatHashMap&) = delete;
+    FlatHashMap& operator=(FlatHashMap&&)      = delete;
+    // clang-format on
+
+    FlatHashMap(FlatHashMap&& Other) :
+        m_Hasher{std::move(Other.m_Hasher)},
+        m_KeyEqual{std::move(Other.m_KeyEqual)},
+        m_Allocator{std::move(Other.m_Allocator)},
+        m_MaxLoadFactor{Other.m_MaxLoadFactor}
+    {
+        StealStorage(Other);
+    }
+
+    ~FlatHashMap()
+    {
+        clear();
+        FreeStorage();
+    }
+
+    iterator begin()
+    {
+        return iterator{this, SkipEmptySlots(0)};
+    }
+
+    iterator end()
+    {
+        return iterator{this, m_NumSlots};
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator{this, SkipEmptySlots(0)};
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator{this, m_NumSlots};
+    }
+
+    size_t size() const
+    {
+        return m_Size;
+    }
+
+    bool empty() const
+    {
+        return m_Size == 0;
+    }
+
+    /// Returns the number of elements the map can hold before it grows.
+    size_t capacity() const
+    {
+        return m_MaxSize;
+    }
+
+    float load_factor() const
+    {
+        return m_Capacity != 0 ? static_cast<float>(m_Size) / static_cast<float>(m_Capacity) : 0.f;
+    }
+
+    float max_load_factor() const
+    {
+        return m_MaxLoadFactor;
+    }
+
+    void max_load_factor(float MaxLoadFactor)
+    {
+        VERIFY(MaxLoadFactor > 0.f && MaxLoadFactor <= 0.95f, "Max load factor must be in (0, 0.95] range");
+        m_MaxLoadFactor = std::min(std::max(MaxLoadFactor, 0.05f), 0.95f);
+        m_MaxSize       = ComputeMaxSize(m_Capacity);
+        if (m_Size > m_MaxSize)
+            reserve(m_Size);
+    }
+
+    /// Makes sure that the map can hold at least Count elements without rehashing.
+    void reserve(size_t Count)
+    {
+        if (Count <= m_MaxSize)
+            return;
+
+        size_t NewCapacity = std::max(m_Capacity, size_t{MinCapacity});
+        while (ComputeMaxSize(NewCapacity) < Count)
+            NewCapacity *= 2;
+        Rehash(NewCapacity);
+    }
+
+    void clear()
+    {
+        for (size_t i = 0; i < m_NumSlots; ++i)
+        {
+            if (m_Dist[i] != 0)
+            {
+                DestroySlot(i);
+                m_Dist[i] = 0;
+            }
+        }
+        m_Size = 0;
+    }
+
+    iterator find(const KeyType& Key)
+    {
+        return iterator{this, FindSlot(Key)};
+    }
+
+    const_iterator find(const KeyType& Key) const
+    {
+        return const_iterator{this, FindSlot(Key)};
+    }
+
+    template <typename LookupKeyType, typename H = HasherType, typename E = KeyEqualType, typename = typename H::is_transparent, typename = typename E::is_transparent>
+    iterator find(const LookupKeyType& Key)
+    {
+        return iterator{this, FindSlot(Key)};
+    }
+
+    template <typename LookupKeyType, typename H = HasherType, typename E = KeyEqualType, typename = typename H::is_transparent, typename = typename E::is_transparent>
+    const_iterator find(const LookupKeyType& Key) const
+    {
+        return const_iterator{this, FindSlot(Key)};
+    }
+
+    size_t count(const KeyType& Key) const
+    {
+        return FindSlot(Key) != m_NumSlots ? 1 : 0;
+    }
+
+    template <typename LookupKeyType, typename H = HasherType, typename E = KeyEqualType, typename = typename H::is_transparent, typename = typename E::is_transparent>
+    size_t count(const LookupKeyType& Key) const
+    {
+        return FindSlot(Key) != m_NumSlots ? 1 : 0;
+    }
+
+    std::pair<iterator, bool> insert(value_type&& Value)
+    {
+        return Insert(std::move(Value), true);
+    }
+
+    std::pair<iterator, bool> insert(const value_type& Value)
+    {
+        return Insert(value_type{Value}, true);
+    }
+
+    /// Constructs the element and inserts it into the map if there is no element with the same key.
+    /// Unlike std::unordered_map, the element is always constructed, even if the key is present.
+    template <typename... ArgsType>
+    std::pair<iterator, bool> emplace(ArgsType&&... Args)
+    {
+        return Insert(value_type{std::forward<ArgsType>(Args)...}, true);
+    }
+
+    ValueType& operator[](const KeyType& Key)
+    {
+        auto Idx = FindSlot(Key);
+        if (Idx == m_NumSlots)
+            Idx = Insert(value_type{Key, ValueType{}}, false).first.m_Idx;
+        return m_Slots[Idx].second;
+    }
+
+    /// Removes the element and returns the iterator to the next element.
+    iterator erase(const_iterator It)
+    {
+        VERIFY_EXPR(It.m_pMap == this && It.m_Idx < m_NumSlots && m_Dist[It.m_Idx] != 0);
+        const auto Idx = It.m_Idx;
+        EraseSlot(Idx);
+        // An element that followed the erased one may have been shifted into its slot
+        return iterator{this, SkipEmptySlots(Idx)};
+    }
+
+    iterator erase(iterator It)
+    {
+        return erase(const_iterator{It});
+    }
+
+    size_t erase(const KeyType& Key)
+    {
+        const auto Idx = FindSlot(Key);
+        if (Idx == m_NumSlots)
+            return 0;
+
+        EraseSlot(Idx);
+        return 1;
+    }
+
+private:
+    using DistType = Uint8;
+
+    static constexpr size_t   MinCapacity    = 8;
+    static constexpr DistType MaxProbeLength = 128;
+
+    using SlotAllocatorTraits = std::allocator_traits<AllocatorType>;
+
+    template <typename LookupKeyType>
+    size_t GetHomeSlot(const LookupKeyType& Key) const
+    {
+        // Fibonacci hashing takes the top bits of the product, which makes the map robust to
+        // hash functions with poor low bits (e.g. std::hash of pointers).
+        const auto Hash = static_cast<Uint64>(m_Hasher(Key));
+        return static_cast<size_t>((Hash * Uint64{0x9E3779B97F4A7C15ull}) >> m_HashShift);
+    }
+
+    size_t SkipEmptySlots(size_t Idx) const
+    {
+        while (Idx < m_NumSlots && m_Dist[Idx] == 0)
+            ++Idx;
+        return Idx;
+    }
+
+    size_t ComputeMaxSize(size_t Capacity) const
+    {
+        return static_cast<size_t>(static_cast<float>(Capacity) * m_MaxLoadFactor);
+    }
+
+    // Slot distance is stored as (probe length + 1) so that zero indicates an empty slot.
+    // The metadata array has a zero sentinel after the last slot, which terminates all probes.
+    template <typename LookupKeyType>
+    size_t FindSlot(const LookupKeyType& Key) const
+    {
+        if (m_Size == 0)
+            return m_NumSlots;
+
+        auto     Idx  = GetHomeSlot(Key);
+        DistType Dist = 1;
+        while (m_Dist[Idx] >= Dist)
+        {
+            if (m_Dist[Idx] == Dist && m_KeyEqual(m_Slots[Idx].first, Key))
+                return Idx;
+            ++Idx;
+            ++Dist;
+        }
+        return m_NumSlots;
+    }
+
+    std::pair<iterator, bool> Insert(value_type&& Value, bool CheckExisting)
+    {
+        for (;;)
+        {
+            if (m_Size + 1 > m_MaxSize)
+            {
+                Rehash(m_Capacity != 0 ? m_Capacity * 2 : MinCapacity);
+                continue;
+            }
+
+            auto     Idx  = GetHomeSlot(Value.first);
+            DistType Dist = 1;
+            while (m_Dist[Idx] >= Dist)
+            {
+                if (CheckExisting && m_Dist[Idx] == Dist && m_KeyEqual(m_Slots[Idx].first, Value.first))
+                    return std::make_pair(iterator{this, Idx}, false);
+                ++Idx;
+                ++Dist;
+            }
+
+            // Idx is the first slot whose element is closer to its home slot than the new one would be.
+            // The new element takes this slot, and the elements up to the next empty slot move one slot forward.
+            auto EmptyIdx = Idx;
+            bool CanShift = Dist <= MaxProbeLength;
+            for (; CanShift && m_Dist[EmptyIdx] != 0; ++EmptyIdx)
+                CanShift = m_Dist[EmptyIdx] < MaxProbeLength;
+
+            if (!CanShift || EmptyIdx >= m_NumSlots)
+            {
+                // Probe sequence is too long or has reached the end of the overflow area.
+                // Growing a sparse table will not help if many keys have the same hash.
+                if (m_Size < m_Capacity / 4)
+                    LOG_ERROR_AND_THROW("Too many keys in the flat hash map have the same hash. The hash function is likely broken.");
+
+                Rehash(m_Capacity * 2);
+                continue;
+            }
+
+            for (auto i = EmptyIdx; i > Idx; --i)
+            {
+                ConstructSlot(i, std::move(m_Slots[i - 1]));
+                DestroySlot(i - 1);
+                m_Dist[i] = static_cast<DistType>(m_Dist[i - 1] + 1);
+            }
+
+            ConstructSlot(Idx, std::move(Value));
+            m_Dist[Idx] = Dist;
+            ++m_Size;
+            return std::make_pair(iterator{this, Idx}, true);
+        }
+    }
+
+    void EraseSlot(size_t Idx)
+    {
+        DestroySlot(Idx);
+        // Shift back the elements that are not in their home slots
+        for (; m_Dist[Idx + 1] > 1; ++Idx)
+        {
+            ConstructSlot(Idx, std::move(m_Slots[Idx + 1]));
+            DestroySlot(Idx + 1);
+            m_Dist[Idx] = static_cast<DistType>(m_Dist[Idx + 1] - 1);
+        }
+        m_Dist[Idx] = 0;
+        --m_Size;
+    }
+
+    void ConstructSlot(size_t Idx, value_type&& Value)
+    {
+        SlotAllocatorTraits::construct(m_Allocator, m_Slots + Idx, std::move(Value));
+    }
+
+    void DestroySlot(size_t Idx)
+    {
+        SlotAllocatorTraits::destroy(m_Allocator, m_Slots + Idx);
+    }
+
+    void Rehash(size_t NewCapacity)
+    {
+        VERIFY_EXPR(NewCapacity >= MinCapacity && (NewCapacity & (NewCapacity - 1)) == 0);
+
+        FlatHashMap NewMap{m_Hasher, m_KeyEqual, m_Allocator};
+        NewMap.m_MaxLoadFactor = m_MaxLoadFactor;
+        NewMap.AllocateStorage(NewCapacity);
+        for (size_t i = 0; i < m_NumSlots; ++i)
+        {
+            if (m_Dist[i] != 0)
+            {
+                NewMap.Insert(std::move(m_Slots[i]), false);
+                DestroySlot(i);
+                m_Dist[i] = 0;
+            }
+        }
+
+        m_Size = 0;
+        FreeStorage();
+        StealStorage(NewMap);
+    }
+
+    // The metadata is stored in the same allocation after the slots
+    static size_t GetAllocationSize(size_t NumSlots)
+    {
+        return NumSlots + (NumSlots + 1 + sizeof(value_type) - 1) / sizeof(value_type);
+    }
+
+    void AllocateStorage(size_t Capacity)
+    {
+        VERIFY_EXPR(m_Slots == nullptr);
+
+        m_Capacity  = Capacity;
+        m_NumSlots  = Capacity + std::min(Capacity, size_t{MaxProbeLength});
+        m_MaxSize   = ComputeMaxSize(Capacity);
+        m_HashShift = 64;
+        for (size_t c = Capacity; c > 1; c >>= 1)
+            --m_HashShift;
+
+        m_Slots = SlotAllocatorTraits::allocate(m_Allocator, GetAllocationSize(m_NumSlots));
+        m_Dist  = reinterpret_cast<DistType*>(m_Slots + m_NumSlots);
+        memset(m_Dist, 0, m_NumSlots + 1);
+    }
+
+    void FreeStorage()
+    {
+        VERIFY_EXPR(m_Size == 0);
+        if (m_Slots != nullptr)
+            SlotAllocatorTraits::deallocate(m_Allocator, m_Slots, GetAllocationSize(m_NumSlots));
+
+        m_Slots     = nullptr;
+        m_Dist      = const_cast<DistType*>(&EmptyDist);
+        m_Capacity  = 0;
+        m_NumSlots  = 0;
+        m_MaxSize   = 0;
+        m_HashShift = 63;
+    }
+
+    void StealStorage(FlatHashMap& Other)
+    {
+        m_Slots     = Other.m_Slots;
+        m_Dist      = Other.m_Dist;
+        m_Capacity  = Other.m_Capacity;
+        m_NumSlots  = Other.m_NumSlots;
+        m_MaxSize   = Other.m_MaxSize;
+        m_Size      = Other.m_Size;
+        m_HashShift = Other.m_HashShift;
+
+        Other.m_Size  = 0;
+        Other.m_Slots = nullptr;
+        Other.FreeStorage();
+    }
+
+    HasherType    m_Hasher;
+    KeyEqualType  m_KeyEqual;
+    AllocatorType m_Allocator;
+
+    // Zero sentinel used by the map that has no storage
+    static constexpr DistType EmptyDist = 0;
+
+    value_type* m_Slots     = nullptr;
+    DistType*   m_Dist      = const_cast<DistType*>(&EmptyDist);
+    size_t      m_Capacity  = 0; // Number of home slots, always a power of two
+    size_t      m_NumSlots  = 0; // Number of home slots plus the overflow area
+    size_t      m_MaxSize   = 0;
+    size_t      m_Size      = 0;
+    Uint32      m_HashShift = 63;
+
+    float m_MaxLoadFactor = 0.8f;
+};
+
+template <typename KeyType, typename ValueType, typename HasherType, typename KeyEqualType, typename AllocatorType>
+constexpr typename FlatHashMap<KeyType, ValueType, HasherType, KeyEqualType, AllocatorType>::DistType FlatHashMap<KeyType, ValueType, HasherType, KeyEqualType, AllocatorType>::EmptyDist;
+
+} // namespace Diligent
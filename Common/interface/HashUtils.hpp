@@ -30,8 +30,16 @@
 #include <functional>
 #include <memory>
 #include <cstring>
+#include <string>
+#include <type_traits>
 
+#if defined(_MSC_VER) && defined(_M_X64)
+#    include <intrin.h>
+#endif
+
+#include "../../Primitives/interface/BasicTypes.h"
 #include "../../Primitives/interface/Errors.hpp"
+#include "../../Primitives/interface/InternedString.h"
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 
 #define LOG_HASH_CONFLICTS 1
@@ -61,16 +69,203 @@ std::size_t ComputeHash(const ArgsType&... Args)
     return Seed;
 }
 
+namespace HashUtilsInternal
+{
+
+// Computes the full 128-bit product of A and B; A receives the low and B the high 64 bits.
+inline void Multiply128(Uint64& A, Uint64& B)
+{
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 R = static_cast<unsigned __int128>(A) * B;
+    A                         = static_cast<Uint64>(R);
+    B                         = static_cast<Uint64>(R >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    A = _umul128(A, B, &B);
+#else
+    const Uint64 HA = A >> 32, HB = B >> 32, LA = static_cast<Uint32>(A), LB = static_cast<Uint32>(B);
+    const Uint64 RH = HA * HB, RM0 = HA * LB, RM1 = HB * LA, RL = LA * LB;
+    const Uint64 T  = RL + (RM0 << 32);
+    const Uint64 Lo = T + (RM1 << 32);
+    const Uint64 Hi = RH + (RM0 >> 32) + (RM1 >> 32) + (T < RL ? 1 : 0) + (Lo < T ? 1 : 0);
+    A               = Lo;
+    B               = Hi;
+#endif
+}
+
+inline Uint64 MultiplyMix(Uint64 A, Uint64 B)
+{
+    Multiply128(A, B);
+    return A ^ B;
+}
+
+inline Uint64 Read64(const Uint8* p)
+{
+    Uint64 Val;
+    memcpy(&Val, p, sizeof(Val));
+    return Val;
+}
+
+inline Uint64 Read32(const Uint8* p)
+{
+    Uint32 Val;
+    memcpy(&Val, p, sizeof(Val));
+    return Val;
+}
+
+// clang-format off
+static constexpr Uint64 HashSecret0 = 0xa0761d6478bd642full;
+static constexpr Uint64 HashSecret1 = 0xe7037ed1a0b428dbull;
+static constexpr Uint64 HashSecret2 = 0x8ebc6af09c88c6e3ull;
+static constexpr Uint64 HashSecret3 = 0x589965cc75374cc3ull;
+// clang-format on
+
+template <typename... ArgsType>
+struct PackedSize;
+
+template <>
+struct PackedSize<>
+{
+    static constexpr size_t Value = 0;
+};
+
+template <typename FirstArgType, typename... RestArgsType>
+struct PackedSize<FirstArgType, RestArgsType...>
+{
+    static constexpr size_t Value = sizeof(FirstArgType) + PackedSize<RestArgsType...>::Value;
+};
+
+} // namespace HashUtilsInternal
+
+/// Computes a 64-bit hash of a contiguous block of memory.
+
+/// The function implements the wyhash algorithm (https://github.com/wangyi-fudan/wyhash):
+/// the data is consumed in 8-byte words that are mixed using 64x64->128-bit multiplication.
+/// Blocks longer than 48 bytes are processed in three independent lanes.
+/// The hash is not cryptographically secure and depends on the byte order of the platform.
+inline Uint64 ComputeHashRaw(const void* pData, size_t Size, Uint64 Seed = 0)
+{
+    using namespace HashUtilsInternal;
+
+    const auto* p = static_cast<const Uint8*>(pData);
+
+    Seed ^= MultiplyMix(Seed ^ HashSecret0, HashSecret1);
+
+    Uint64 A = 0;
+    Uint64 B = 0;
+    if (Size <= 16)
+    {
+        if (Size >= 4)
+        {
+            const size_t Offset = (Size >> 3) << 2;
+
+            A = (Read32(p) << 32) | Read32(p + Offset);
+            B = (Read32(p + Size - 4) << 32) | Read32(p + Size - 4 - Offset);
+        }
+        else if (Size > 0)
+        {
+            A = (Uint64{p[0]} << 16) | (Uint64{p[Size >> 1]} << 8) | Uint64{p[Size - 1]};
+        }
+    }
+    else
+    {
+        size_t Remaining = Size;
+        if (Remaining > 48)
+        {
+            Uint64 Seed1 = Seed;
+            Uint64 Seed2 = Seed;
+            do
+            {
+                Seed  = MultiplyMix(Read64(p) ^ HashSecret1, Read64(p + 8) ^ Seed);
+                Seed1 = MultiplyMix(Read64(p + 16) ^ HashSecret2, Read64(p + 24) ^ Seed1);
+                Seed2 = MultiplyMix(Read64(p + 32) ^ HashSecret3, Read64(p + 40) ^ Seed2);
+                p += 48;
+                Remaining -= 48;
+            } while (Remaining > 48);
+            Seed ^= Seed1 ^ Seed2;
+        }
+
+        while (Remaining > 16)
+        {
+            Seed = MultiplyMix(Read64(p) ^ HashSecret1, Read64(p + 8) ^ Seed);
+            p += 16;
+            Remaining -= 16;
+        }
+
+        // Last 16 bytes, possibly overlapping the previously processed ones
+        A = Read64(p + Remaining - 16);
+        B = Read64(p + Remaining - 8);
+    }
+
+    A ^= HashSecret1;
+    B ^= Seed;
+    Multiply128(A, B);
+    return MultiplyMix(A ^ HashSecret0 ^ Size, B ^ HashSecret1);
+}
+
+/// Packs values of trivially copyable types into a contiguous buffer that is hashed with a
+/// single ComputeHashRaw() call. Unlike hashing the object representation of a structure directly,
+/// the packed data never contains padding bytes.
+template <size_t Capacity>
+class HashDataPacker
+{
+public:
+    template <typename T>
+    HashDataPacker& Add(const T& Val)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be packed");
+        VERIFY(m_Size + sizeof(T) <= Capacity, "Not enough space in the hash data packer");
+        memcpy(m_Data + m_Size, &Val, sizeof(T));
+        m_Size += sizeof(T);
+        return *this;
+    }
+
+    HashDataPacker& Add(float Val)
+    {
+        // +0.0 and -0.0 compare equal and must produce the same hash
+        if (Val == 0)
+            Val = 0;
+        return Add<float>(Val);
+    }
+
+    template <typename FirstArgType, typename SecondArgType, typename... RestArgsType>
+    HashDataPacker& Add(const FirstArgType& FirstArg, const SecondArgType& SecondArg, const RestArgsType&... RestArgs)
+    {
+        Add(FirstArg);
+        return Add(SecondArg, RestArgs...);
+    }
+
+    size_t GetSize() const
+    {
+        return m_Size;
+    }
+
+    std::size_t GetHash() const
+    {
+        return static_cast<std::size_t>(ComputeHashRaw(m_Data, m_Size));
+    }
+
+private:
+    Uint8  m_Data[Capacity > 0 ? Capacity : 1];
+    size_t m_Size = 0;
+};
+
+/// Computes the hash of the arguments by packing them into a contiguous buffer and hashing it with ComputeHashRaw().
+/// All arguments must be of trivially copyable types.
+template <typename... ArgsType>
+std::size_t ComputeHashPacked(const ArgsType&... Args)
+{
+    HashDataPacker<HashUtilsInternal::PackedSize<ArgsType...>::Value> Packer;
+    Packer.Add(Args...);
+    return Packer.GetHash();
+}
+
 template <typename CharType>
 struct CStringHash
 {
     size_t operator()(const CharType* str) const
     {
-        // http://www.cse.yorku.ca/~oz/hash.html
-        std::size_t Seed = 0;
-        while (size_t Ch = *(str++))
-            Seed = Seed * 65599 + Ch;
-        return Seed;
+        const auto Len = std::char_traits<CharType>::length(str);
+        return static_cast<size_t>(ComputeHashRaw(str, Len * sizeof(CharType)));
     }
 };
 
@@ -118,6 +313,15 @@ public:
         }
     }
 
+    // Interned strings are never released, so the key references the string
+    // without making a copy and uses its precomputed hash.
+    explicit HashMapStringKey(const InternedString& _Str) :
+        Str{_Str.Str},
+        Ownership_Hash{_Str.Hash & HashMask}
+    {
+        VERIFY(Str, "String pointer must not be null");
+    }
+
     // Make this constructor explicit to avoid unintentional string copies
     explicit HashMapStringKey(const String& Str) :
         HashMapStringKey{Str.c_str(), true}
@@ -0,0 +1,130 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Defines Diligent::InternedStringPool class
+
+#include <deque>
+#include <vector>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/MemoryAllocator.h"
+#include "../../Primitives/interface/InternedString.h"
+#include "StringPool.hpp"
+#include "FlatHashMap.hpp"
+#include "LockHelper.hpp"
+
+namespace Diligent
+{
+
+/// Thread-safe append-only string interning pool.
+
+/// The pool stores a single copy of every unique string and returns a handle that
+/// contains a stable pointer to the string and its precomputed hash. Strings are
+/// never removed from the pool, so handles remain valid until the pool is destroyed.
+/// Handles obtained from the same pool for equal strings always reference the same
+/// InternedString object, which allows comparing strings by pointer.
+class InternedStringPool
+{
+public:
+    static constexpr size_t DefaultPageSize = 4096;
+
+    explicit InternedStringPool(IMemoryAllocator& Allocator, size_t PageSize = DefaultPageSize);
+    InternedStringPool();
+
+    // clang-format off
+    InternedStringPool           (const InternedStringPool&)  = delete;
+    InternedStringPool           (      InternedStringPool&&) = delete;
+    InternedStringPool& operator=(const InternedStringPool&)  = delete;
+    InternedStringPool& operator=(      InternedStringPool&&) = delete;
+    // clang-format on
+
+    ~InternedStringPool();
+
+    /// Returns the handle of the string, adding the string to the pool if necessary.
+    const InternedString& Intern(const Char* Str);
+
+    /// Returns the handle of the first Length characters of Str. The characters
+    /// do not need to be null-terminated.
+    const InternedString& Intern(const Char* Str, size_t Length);
+
+    /// Returns the handle of the string if it has already been added to the pool,
+    /// and null otherwise.
+    const InternedString* Find(const Char* Str) const;
+
+    /// Returns the number of unique strings in the pool.
+    size_t GetStringCount() const;
+
+    /// Returns the global string pool.
+    static InternedStringPool& GetGlobalPool();
+
+private:
+    struct KeyHasher
+    {
+        size_t operator()(const InternedString& Key) const
+        {
+            return Key.Hash;
+        }
+    };
+
+    struct KeyEqual
+    {
+        bool operator()(const InternedString& Key1, const InternedString& Key2) const
+        {
+            return Key1.Hash == Key2.Hash &&
+                Key1.Length == Key2.Length &&
+                (Key1.Str == Key2.Str || memcmp(Key1.Str, Key2.Str, Key1.Length * sizeof(Char)) == 0);
+        }
+    };
+
+    static InternedString MakeKey(const Char* Str, size_t Length);
+
+    Char* AllocateString(size_t Length);
+
+    mutable ThreadingTools::LockFlag m_LockFlag;
+
+    IMemoryAllocator& m_Allocator;
+    const size_t      m_PageSize;
+
+    std::vector<StringPool> m_Pages;
+
+    // std::deque never relocates its elements when new elements are appended
+    std::deque<InternedString> m_Strings;
+
+    FlatHashMap<InternedString, const InternedString*, KeyHasher, KeyEqual> m_Index;
+};
+
+/// Interns the string in the global string pool, see Diligent::InternedStringPool.
+inline const InternedString& InternString(const Char* Str)
+{
+    return InternedStringPool::GetGlobalPool().Intern(Str);
+}
+
+} // namespace Diligent
@@ -27,6 +27,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "../../Platforms/interface/Atomics.hpp"
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 
@@ -39,23 +41,28 @@ public:
     enum
     {
         LOCK_FLAG_UNLOCKED = 0,
-        LOCK_FLAG_LOCKED   = 1
+        LOCK_FLAG_LOCKED   = 1,
+
+        // The flag is locked and there may be threads blocked waiting for it
+        LOCK_FLAG_LOCKED_CONTENDED = 2
     };
     LockFlag(Atomics::Long InitFlag = LOCK_FLAG_UNLOCKED) noexcept
     {
-        //m_Flag.store(InitFlag);
-        m_Flag = InitFlag;
+        m_Flag.store(static_cast<int>(InitFlag));
     }
 
-    operator Atomics::Long() const { return m_Flag; }
+    operator Atomics::Long() const { return m_Flag.load(); }
 
 private:
     friend class LockHelper;
-    Atomics::AtomicLong m_Flag;
+    // 32-bit flag is required to use it as a futex on Linux
+    std::atomic<int> m_Flag;
 };
 
-// Spinlock implementation. This kind of lock should be used in scenarios
-// where simultaneous access is uncommon but possible.
+// Adaptive lock implementation. The lock first spins with a bounded exponential
+// backoff, and then puts the thread to sleep (futex wait on Linux and Android,
+// yielding the thread on other platforms). This kind of lock should be used in
+// scenarios where simultaneous access is uncommon but possible.
 class LockHelper
 {
 public:
@@ -86,9 +93,8 @@ public:
 
     static bool UnsafeTryLock(LockFlag& LockFlag) noexcept
     {
-        return Atomics::AtomicCompareExchange(LockFlag.m_Flag,
-                                              static_cast<Atomics::Long>(LockFlag::LOCK_FLAG_LOCKED),
-                                              static_cast<Atomics::Long>(LockFlag::LOCK_FLAG_UNLOCKED)) == LockFlag::LOCK_FLAG_UNLOCKED;
+        int Expected = LockFlag::LOCK_FLAG_UNLOCKED;
+        return LockFlag.m_Flag.compare_exchange_strong(Expected, LockFlag::LOCK_FLAG_LOCKED, std::memory_order_acquire, std::memory_order_relaxed);
     }
 
     bool TryLock(LockFlag& LockFlag) noexcept
@@ -102,41 +108,26 @@ public:
             return false;
     }
 
+    // Maximum number of spin iterations before the thread is put to sleep
     static constexpr const int DefaultSpinCountToYield = 256;
 
     static void UnsafeLock(LockFlag& LockFlag, int SpinCountToYield = DefaultSpinCountToYield) noexcept
     {
-        int SpinCount = 0;
-        while (!UnsafeTryLock(LockFlag))
-        {
-            ++SpinCount;
-            if (SpinCount == SpinCountToYield)
-            {
-                SpinCount = 0;
-                YieldThread();
-            }
-        }
+        if (!UnsafeTryLock(LockFlag))
+            LockContended(LockFlag, SpinCountToYield);
     }
 
     void Lock(LockFlag& LockFlag, int SpinCountToYield = DefaultSpinCountToYield) noexcept
     {
         VERIFY(m_pLockFlag == NULL, "Object already locked");
-        // Wait for the flag to become unlocked and lock it
-        int SpinCount = 0;
-        while (!TryLock(LockFlag))
-        {
-            ++SpinCount;
-            if (SpinCount == SpinCountToYield)
-            {
-                SpinCount = 0;
-                YieldThread();
-            }
-        }
+        UnsafeLock(LockFlag, SpinCountToYield);
+        m_pLockFlag = &LockFlag;
     }
 
     static void UnsafeUnlock(LockFlag& LockFlag) noexcept
     {
-        LockFlag.m_Flag = LockFlag::LOCK_FLAG_UNLOCKED;
+        if (LockFlag.m_Flag.exchange(LockFlag::LOCK_FLAG_UNLOCKED, std::memory_order_release) == LockFlag::LOCK_FLAG_LOCKED_CONTENDED)
+            WakeWaiter(LockFlag);
     }
 
     void Unlock() noexcept
@@ -146,7 +137,15 @@ public:
         m_pLockFlag = NULL;
     }
 
+    /// Returns the total number of times a thread failed to acquire a lock on the first attempt
+    static Atomics::Int64 GetContentionCount() noexcept;
+
+    /// Returns the total number of times a thread was put to sleep waiting for a lock
+    static Atomics::Int64 GetWaitCount() noexcept;
+
 private:
+    static void LockContended(LockFlag& LockFlag, int SpinCountToYield) noexcept;
+    static void WakeWaiter(LockFlag& LockFlag) noexcept;
     static void YieldThread() noexcept;
 
     LockFlag* m_pLockFlag = nullptr;
@@ -0,0 +1,91 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::ThreadPool class
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+#include "../../Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Fixed-size pool of worker threads that execute tasks in FIFO order.
+
+/// Tasks are executed in the order they were enqueued, but may complete in any order.
+/// The destructor executes all pending tasks and joins the worker threads.
+class ThreadPool
+{
+public:
+    using TaskType = std::function<void()>;
+
+    /// Creates the pool with the given number of worker threads.
+    /// If NumThreads is 0, one thread per hardware thread, less one, is created,
+    /// but at least one thread.
+    explicit ThreadPool(Uint32 NumThreads = 0);
+    ~ThreadPool();
+
+    // clang-format off
+    ThreadPool           (const ThreadPool&)  = delete;
+    ThreadPool           (      ThreadPool&&) = delete;
+    ThreadPool& operator=(const ThreadPool&)  = delete;
+    ThreadPool& operator=(      ThreadPool&&) = delete;
+    // clang-format on
+
+    /// Adds the task to the queue. The task must not throw exceptions.
+    void EnqueueTask(TaskType&& Task);
+
+    /// Blocks until the queue is empty and all worker threads are idle.
+    void WaitForAllTasks();
+
+    Uint32 GetNumThreads() const { return static_cast<Uint32>(m_Threads.size()); }
+
+    /// Returns the number of tasks that have been enqueued, but not yet completed.
+    size_t GetNumPendingTasks();
+
+private:
+    void WorkerThreadFunc();
+
+    std::vector<std::thread> m_Threads;
+
+    std::mutex              m_Mtx;
+    std::condition_variable m_TaskAvailableCV;
+    std::condition_variable m_TasksCompletedCV;
+    std::deque<TaskType>    m_Tasks;
+    size_t                  m_NumRunningTasks = 0;
+    bool                    m_Stop            = false;
+};
+
+} // namespace Diligent
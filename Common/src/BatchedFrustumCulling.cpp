@@ -0,0 +1,492 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+
+#include "BatchedFrustumCulling.hpp"
+#include "ThreadPool.hpp"
+#include "../../Platforms/interface/PlatformMisc.hpp"
+#include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Minimum number of 32-box mask words processed by one task
+static constexpr Uint32 MinWordsPerThread = 128;
+
+struct CullingPlane
+{
+    Plane3D Plane;
+
+    // Signs of the normal components that define the farthest box corner
+    bool PositiveX = false;
+    bool PositiveY = false;
+    bool PositiveZ = false;
+};
+
+struct CullingParams
+{
+    CullingParams(const ViewFrustumExt& _Frustum, FRUSTUM_PLANE_FLAGS _PlaneFlags) :
+        Frustum{_Frustum},
+        PlaneFlags{_PlaneFlags}
+    {
+        for (Uint32 plane_idx = 0; plane_idx < ViewFrustum::NUM_PLANES; ++plane_idx)
+        {
+            if ((PlaneFlags & (1 << plane_idx)) == 0)
+                continue;
+
+            auto& CullPlane     = Planes[NumPlanes++];
+            CullPlane.Plane     = Frustum.GetPlane(static_cast<ViewFrustum::PLANE_IDX>(plane_idx));
+            CullPlane.PositiveX = CullPlane.Plane.Normal.x > 0;
+            CullPlane.PositiveY = CullPlane.Plane.Normal.y > 0;
+            CullPlane.PositiveZ = CullPlane.Plane.Normal.z > 0;
+        }
+
+        // See GetBoxVisibility(const ViewFrustumExt&, ...). All frustum corners are outside of the
+        // box min plane when the plane coordinate is not less than the maximum corner coordinate,
+        // and outside of the box max plane when the coordinate is not greater than the minimum one.
+        TestCorners = (PlaneFlags & FRUSTUM_PLANE_FLAG_FULL_FRUSTUM) == FRUSTUM_PLANE_FLAG_FULL_FRUSTUM;
+        if (TestCorners)
+        {
+            CornersMin = Frustum.FrustumCorners[0];
+            CornersMax = Frustum.FrustumCorners[0];
+            for (int iCorner = 1; iCorner < 8; ++iCorner)
+            {
+                CornersMin = std::min(CornersMin, Frustum.FrustumCorners[iCorner]);
+                CornersMax = std::max(CornersMax, Frustum.FrustumCorners[iCorner]);
+            }
+        }
+    }
+
+    const ViewFrustumExt&     Frustum;
+    const FRUSTUM_PLANE_FLAGS PlaneFlags;
+
+    CullingPlane Planes[ViewFrustum::NUM_PLANES];
+    Uint32       NumPlanes = 0;
+
+    bool   TestCorners = false;
+    float3 CornersMin;
+    float3 CornersMax;
+};
+
+inline bool IsBoxVisibleScalar(const CullingParams& Params, const BoundBoxSoA& Boxes, Uint32 i)
+{
+    BoundBox Box;
+    Box.Min = float3{Boxes.MinX[i], Boxes.MinY[i], Boxes.MinZ[i]};
+    Box.Max = float3{Boxes.MaxX[i], Boxes.MaxY[i], Boxes.MaxZ[i]};
+    return GetBoxVisibility(Params.Frustum, Box, Params.PlaneFlags) != BoxVisibility::Invisible;
+}
+
+#if DILIGENT_SIMD_MATH_SSE
+
+// The operations are performed in exactly the same order as in GetBoxVisibilityAgainstPlane()
+// so that the results are bitwise identical to the scalar version.
+inline Uint32 GetVisibilityBits4(const CullingParams& Params, const BoundBoxSoA& Boxes, Uint32 i)
+{
+    const __m128 MinX = _mm_loadu_ps(Boxes.MinX + i);
+    const __m128 MinY = _mm_loadu_ps(Boxes.MinY + i);
+    const __m128 MinZ = _mm_loadu_ps(Boxes.MinZ + i);
+    const __m128 MaxX = _mm_loadu_ps(Boxes.MaxX + i);
+    const __m128 MaxY = _mm_loadu_ps(Boxes.MaxY + i);
+    const __m128 MaxZ = _mm_loadu_ps(Boxes.MaxZ + i);
+    const __m128 Zero = _mm_setzero_ps();
+
+    __m128 Invisible = _mm_setzero_ps();
+    __m128 Inside    = _mm_castsi128_ps(_mm_set1_epi32(-1));
+    for (Uint32 p = 0; p < Params.NumPlanes; ++p)
+    {
+        const auto&  CullPlane = Params.Planes[p];
+        const __m128 Nx        = _mm_set1_ps(CullPlane.Plane.Normal.x);
+        const __m128 Ny        = _mm_set1_ps(CullPlane.Plane.Normal.y);
+        const __m128 Nz        = _mm_set1_ps(CullPlane.Plane.Normal.z);
+        const __m128 D         = _mm_set1_ps(CullPlane.Plane.Distance);
+
+        const __m128 DMax = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(CullPlane.PositiveX ? MaxX : MinX, Nx),
+                                                             _mm_mul_ps(CullPlane.PositiveY ? MaxY : MinY, Ny)),
+                                                  _mm_mul_ps(CullPlane.PositiveZ ? MaxZ : MinZ, Nz)),
+                                       D);
+        const __m128 DMin = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(CullPlane.PositiveX ? MinX : MaxX, Nx),
+                                                             _mm_mul_ps(CullPlane.PositiveY ? MinY : MaxY, Ny)),
+                                                  _mm_mul_ps(CullPlane.PositiveZ ? MinZ : MaxZ, Nz)),
+                                       D);
+
+        Invisible = _mm_or_ps(Invisible, _mm_cmplt_ps(DMax, Zero));
+        Inside    = _mm_and_ps(Inside, _mm_cmpgt_ps(DMin, Zero));
+    }
+
+    if (Params.TestCorners)
+    {
+        __m128 Outside = _mm_cmpnlt_ps(MinX, _mm_set1_ps(Params.CornersMax.x));
+        Outside        = _mm_or_ps(Outside, _mm_cmpnlt_ps(MinY, _mm_set1_ps(Params.CornersMax.y)));
+        Outside        = _mm_or_ps(Outside, _mm_cmpnlt_ps(MinZ, _mm_set1_ps(Params.CornersMax.z)));
+        Outside        = _mm_or_ps(Outside, _mm_cmpngt_ps(MaxX, _mm_set1_ps(Params.CornersMin.x)));
+        Outside        = _mm_or_ps(Outside, _mm_cmpngt_ps(MaxY, _mm_set1_ps(Params.CornersMin.y)));
+        Outside        = _mm_or_ps(Outside, _mm_cmpngt_ps(MaxZ, _mm_set1_ps(Params.CornersMin.z)));
+        // Corners are only tested for the boxes that intersect the frustum
+        Invisible = _mm_or_ps(Invisible, _mm_andnot_ps(Inside, Outside));
+    }
+
+    return static_cast<Uint32>(~_mm_movemask_ps(Invisible)) & 0xFu;
+}
+
+#    if DILIGENT_SIMD_MATH_AVX
+inline Uint32 GetVisibilityBits8(const CullingParams& Params, const BoundBoxSoA& Boxes, Uint32 i)
+{
+    const __m256 MinX = _mm256_loadu_ps(Boxes.MinX + i);
+    const __m256 MinY = _mm256_loadu_ps(Boxes.MinY + i);
+    const __m256 MinZ = _mm256_loadu_ps(Boxes.MinZ + i);
+    const __m256 MaxX = _mm256_loadu_ps(Boxes.MaxX + i);
+    const __m256 MaxY = _mm256_loadu_ps(Boxes.MaxY + i);
+    const __m256 MaxZ = _mm256_loadu_ps(Boxes.MaxZ + i);
+    const __m256 Zero = _mm256_setzero_ps();
+
+    __m256 Invisible = _mm256_setzero_ps();
+    __m256 Inside    = _mm256_cmp_ps(Zero, Zero, _CMP_EQ_OQ);
+    for (Uint32 p = 0; p < Params.NumPlanes; ++p)
+    {
+        const auto&  CullPlane = Params.Planes[p];
+        const __m256 Nx        = _mm256_set1_ps(CullPlane.Plane.Normal.x);
+        const __m256 Ny        = _mm256_set1_ps(CullPlane.Plane.Normal.y);
+        const __m256 Nz        = _mm256_set1_ps(CullPlane.Plane.Normal.z);
+        const __m256 D         = _mm256_set1_ps(CullPlane.Plane.Distance);
+
+        const __m256 DMax = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(CullPlane.PositiveX ? MaxX : MinX, Nx),
+                                                                      _mm256_mul_ps(CullPlane.PositiveY ? MaxY : MinY, Ny)),
+                                                        _mm256_mul_ps(CullPlane.PositiveZ ? MaxZ : MinZ, Nz)),
+                                          D);
+        const __m256 DMin = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(CullPlane.PositiveX ? MinX : MaxX, Nx),
+                                                                      _mm256_mul_ps(CullPlane.PositiveY ? MinY : MaxY, Ny)),
+                                                        _mm256_mul_ps(CullPlane.PositiveZ ? MinZ : MaxZ, Nz)),
+                                          D);
+
+        Invisible = _mm256_or_ps(Invisible, _mm256_cmp_ps(DMax, Zero, _CMP_LT_OQ));
+        Inside    = _mm256_and_ps(Inside, _mm256_cmp_ps(DMin, Zero, _CMP_GT_OQ));
+    }
+
+    if (Params.TestCorners)
+    {
+        __m256 Outside = _mm256_cmp_ps(MinX, _mm256_set1_ps(Params.CornersMax.x), _CMP_NLT_UQ);
+        Outside        = _mm256_or_ps(Outside, _mm256_cmp_ps(MinY, _mm256_set1_ps(Params.CornersMax.y), _CMP_NLT_UQ));
+        Outside        = _mm256_or_ps(Outside, _mm256_cmp_ps(MinZ, _mm256_set1_ps(Params.CornersMax.z), _CMP_NLT_UQ));
+        Outside        = _mm256_or_ps(Outside, _mm256_cmp_ps(MaxX, _mm256_set1_ps(Params.CornersMin.x), _CMP_NGT_UQ));
+        Outside        = _mm256_or_ps(Outside, _mm256_cmp_ps(MaxY, _mm256_set1_ps(Params.CornersMin.y), _CMP_NGT_UQ));
+        Outside        = _mm256_or_ps(Outside, _mm256_cmp_ps(MaxZ, _mm256_set1_ps(Params.CornersMin.z), _CMP_NGT_UQ));
+        Invisible      = _mm256_or_ps(Invisible, _mm256_andnot_ps(Inside, Outside));
+    }
+
+    return static_cast<Uint32>(~_mm256_movemask_ps(Invisible)) & 0xFFu;
+}
+#    endif
+
+#elif DILIGENT_SIMD_MATH_NEON
+
+inline Uint32 GetVisibilityBits4(const CullingParams& Params, const BoundBoxSoA& Boxes, Uint32 i)
+{
+    const float32x4_t MinX = vld1q_f32(Boxes.MinX + i);
+    const float32x4_t MinY = vld1q_f32(Boxes.MinY + i);
+    const float32x4_t MinZ = vld1q_f32(Boxes.MinZ + i);
+    const float32x4_t MaxX = vld1q_f32(Boxes.MaxX + i);
+    const float32x4_t MaxY = vld1q_f32(Boxes.MaxY + i);
+    const float32x4_t MaxZ = vld1q_f32(Boxes.MaxZ + i);
+    const float32x4_t Zero = vdupq_n_f32(0);
+
+    uint32x4_t Invisible = vdupq_n_u32(0);
+    uint32x4_t Inside    = vdupq_n_u32(~0u);
+    for (Uint32 p = 0; p < Params.NumPlanes; ++p)
+    {
+        const auto&       CullPlane = Params.Planes[p];
+        const float32x4_t Nx        = vdupq_n_f32(CullPlane.Plane.Normal.x);
+        const float32x4_t Ny        = vdupq_n_f32(CullPlane.Plane.Normal.y);
+        const float32x4_t Nz        = vdupq_n_f32(CullPlane.Plane.Normal.z);
+        const float32x4_t D         = vdupq_n_f32(CullPlane.Plane.Distance);
+
+        // Separate multiplies and adds (no vmlaq/vfmaq) to match the scalar rounding
+        const float32x4_t DMax = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(CullPlane.PositiveX ? MaxX : MinX, Nx),
+                                                               vmulq_f32(CullPlane.PositiveY ? MaxY : MinY, Ny)),
+                                                     vmulq_f32(CullPlane.PositiveZ ? MaxZ : MinZ, Nz)),
+                                           D);
+        const float32x4_t DMin = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(CullPlane.PositiveX ? MinX : MaxX, Nx),
+                                                               vmulq_f32(CullPlane.PositiveY ? MinY : MaxY, Ny)),
+                                                     vmulq_f32(CullPlane.PositiveZ ? MinZ : MaxZ, Nz)),
+                                           D);
+
+        Invisible = vorrq_u32(Invisible, vcltq_f32(DMax, Zero));
+        Inside    = vandq_u32(Inside, vcgtq_f32(DMin, Zero));
+    }
+
+    if (Params.TestCorners)
+    {
+        // Boxes are outside if !(Min < CornersMax) or !(Max > CornersMin) for any axis,
+        // which treats NaNs the same way as the scalar version
+        uint32x4_t CornersInside = vcltq_f32(MinX, vdupq_n_f32(Params.CornersMax.x));
+        CornersInside            = vandq_u32(CornersInside, vcltq_f32(MinY, vdupq_n_f32(Params.CornersMax.y)));
+        CornersInside            = vandq_u32(CornersInside, vcltq_f32(MinZ, vdupq_n_f32(Params.CornersMax.z)));
+        CornersInside            = vandq_u32(CornersInside, vcgtq_f32(MaxX, vdupq_n_f32(Params.CornersMin.x)));
+        CornersInside            = vandq_u32(CornersInside, vcgtq_f32(MaxY, vdupq_n_f32(Params.CornersMin.y)));
+        CornersInside            = vandq_u32(CornersInside, vcgtq_f32(MaxZ, vdupq_n_f32(Params.CornersMin.z)));
+        Invisible                = vorrq_u32(Invisible, vbicq_u32(vmvnq_u32(CornersInside), Inside));
+    }
+
+    // clang-format off
+    alignas(16) Uint32 Lanes[4];
+    vst1q_u32(Lanes, Invisible);
+    return (Lanes[0] ? 0u : 1u) |
+           (Lanes[1] ? 0u : 2u) |
+           (Lanes[2] ? 0u : 4u) |
+           (Lanes[3] ? 0u : 8u);
+    // clang-format on
+}
+
+#endif
+
+// Returns the visibility bits of up to 32 boxes starting at FirstBox
+inline Uint32 GetVisibilityWord(const CullingParams& Params, const BoundBoxSoA& Boxes, Uint32 FirstBox)
+{
+    const Uint32 Count = std::min(Boxes.NumBoxes - FirstBox, Uint32{32});
+
+    Uint32 Bits = 0;
+    Uint32 i    = 0;
+#if DILIGENT_SIMD_MATH_AVX
+    for (; i + 8 <= Count; i += 8)
+        Bits |= GetVisibilityBits8(Params, Boxes, FirstBox + i) << i;
+#endif
+#if DILIGENT_SIMD_MATH_SSE || DILIGENT_SIMD_MATH_NEON
+    for (; i + 4 <= Count; i += 4)
+        Bits |= GetVisibilityBits4(Params, Boxes, FirstBox + i) << i;
+#endif
+    for (; i < Count; ++i)
+    {
+        if (IsBoxVisibleScalar(Params, Boxes, FirstBox + i))
+            Bits |= 1u << i;
+    }
+
+    return Bits;
+}
+
+void ComputeVisibilityMask(const CullingParams& Params, const BoundBoxSoA& Boxes, Uint32 FirstWord, Uint32 EndWord, Uint32* pVisibility)
+{
+    for (Uint32 w = FirstWord; w < EndWord; ++w)
+        pVisibility[w] = GetVisibilityWord(Params, Boxes, w * 32);
+}
+
+Uint32 CollectVisibleIndices(const CullingParams& Params, const BoundBoxSoA& Boxes, Uint32 FirstWord, Uint32 EndWord, Uint32* pVisibleIndices)
+{
+    Uint32 NumVisible = 0;
+    for (Uint32 w = FirstWord; w < EndWord; ++w)
+    {
+        auto Bits = GetVisibilityWord(Params, Boxes, w * 32);
+        while (Bits != 0)
+        {
+            pVisibleIndices[NumVisible++] = w * 32 + PlatformMisc::GetLSB(Bits);
+            Bits &= Bits - 1;
+        }
+    }
+    return NumVisible;
+}
+
+bool ValidateBoxes(const BoundBoxSoA& Boxes)
+{
+    if (Boxes.NumBoxes == 0)
+        return false;
+
+    DEV_CHECK_ERR(Boxes.MinX != nullptr && Boxes.MinY != nullptr && Boxes.MinZ != nullptr &&
+                      Boxes.MaxX != nullptr && Boxes.MaxY != nullptr && Boxes.MaxZ != nullptr,
+                  "All box coordinate arrays must not be null");
+    return true;
+}
+
+Uint32 GetNumCullingRanges(Uint32 NumWords, Uint32 MaxRanges)
+{
+    return std::max(std::min(MaxRanges, NumWords / MinWordsPerThread), Uint32{1});
+}
+
+// Runs ProcessRange(r) for every r in [0, NumRanges) on the pool threads and the calling thread.
+// Ranges are claimed through an atomic counter, so the calling thread processes all ranges that the
+// pool threads have not started yet, and the function never waits for a task that is still queued.
+// Such a task holds a reference to the shared state only, finds no ranges left and returns.
+void ProcessRangesInParallel(ThreadPool& WorkerPool, Uint32 NumRanges, const std::function<void(Uint32)>& ProcessRange)
+{
+    struct SharedState
+    {
+        explicit SharedState(Uint32 _NumRanges) :
+            NumRanges{_NumRanges}
+        {}
+
+        const Uint32            NumRanges;
+        std::atomic<Uint32>     NextRange{0};
+        Uint32                  NumCompletedRanges = 0;
+        std::mutex              Mtx;
+        std::condition_variable RangesCompletedCV;
+
+        // Only dereferenced for the claimed ranges, all of which complete before
+        // ProcessRangesInParallel() returns.
+        const std::function<void(Uint32)>* pProcessRange = nullptr;
+
+        void ProcessRanges()
+        {
+            for (Uint32 Range = NextRange.fetch_add(1); Range < NumRanges; Range = NextRange.fetch_add(1))
+            {
+                (*pProcessRange)(Range);
+
+                std::lock_guard<std::mutex> Lock{Mtx};
+                if (++NumCompletedRanges == NumRanges)
+                    RangesCompletedCV.notify_one();
+            }
+        }
+    };
+
+    auto pState           = std::make_shared<SharedState>(NumRanges);
+    pState->pProcessRange = &ProcessRange;
+
+    const auto NumTasks = std::min(NumRanges - 1, WorkerPool.GetNumThreads());
+    for (Uint32 t = 0; t < NumTasks; ++t)
+    {
+        WorkerPool.EnqueueTask(
+            [pState]() //
+            {
+                pState->ProcessRanges();
+            });
+    }
+
+    pState->ProcessRanges();
+
+    std::unique_lock<std::mutex> Lock{pState->Mtx};
+    pState->RangesCompletedCV.wait(Lock, [&]() { return pState->NumCompletedRanges == NumRanges; });
+}
+
+} // namespace
+
+void GetBoxVisibilityMask(const ViewFrustumExt& Frustum,
+                          const BoundBoxSoA&    Boxes,
+                          Uint32*               pVisibility,
+                          FRUSTUM_PLANE_FLAGS   PlaneFlags)
+{
+    if (!ValidateBoxes(Boxes))
+        return;
+
+    VERIFY_EXPR(pVisibility != nullptr);
+    CullingParams Params{Frustum, PlaneFlags};
+    ComputeVisibilityMask(Params, Boxes, 0, GetBoxVisibilityMaskSize(Boxes.NumBoxes), pVisibility);
+}
+
+Uint32 GetVisibleBoxIndices(const ViewFrustumExt& Frustum,
+                            const BoundBoxSoA&    Boxes,
+                            Uint32*               pVisibleIndices,
+                            FRUSTUM_PLANE_FLAGS   PlaneFlags)
+{
+    if (!ValidateBoxes(Boxes))
+        return 0;
+
+    VERIFY_EXPR(pVisibleIndices != nullptr);
+    CullingParams Params{Frustum, PlaneFlags};
+    return CollectVisibleIndices(Params, Boxes, 0, GetBoxVisibilityMaskSize(Boxes.NumBoxes), pVisibleIndices);
+}
+
+void GetBoxVisibilityMaskMT(const ViewFrustumExt& Frustum,
+                            const BoundBoxSoA&    Boxes,
+                            Uint32*               pVisibility,
+                            ThreadPool&           WorkerPool,
+                            FRUSTUM_PLANE_FLAGS   PlaneFlags)
+{
+    if (!ValidateBoxes(Boxes))
+        return;
+
+    VERIFY_EXPR(pVisibility != nullptr);
+    CullingParams Params{Frustum, PlaneFlags};
+
+    // Ranges are split at word boundaries so that tasks never write to the same word
+    const auto NumWords  = GetBoxVisibilityMaskSize(Boxes.NumBoxes);
+    const auto NumRanges = GetNumCullingRanges(NumWords, WorkerPool.GetNumThreads() + 1);
+    if (NumRanges == 1)
+    {
+        ComputeVisibilityMask(Params, Boxes, 0, NumWords, pVisibility);
+        return;
+    }
+
+    const auto WordsPerRange = (NumWords + NumRanges - 1) / NumRanges;
+    ProcessRangesInParallel(WorkerPool, NumRanges,
+                            [&](Uint32 Range) //
+                            {
+                                const auto FirstWord = std::min(Range * WordsPerRange, NumWords);
+                                const auto EndWord   = std::min(FirstWord + WordsPerRange, NumWords);
+                                ComputeVisibilityMask(Params, Boxes, FirstWord, EndWord, pVisibility);
+                            });
+}
+
+Uint32 GetVisibleBoxIndicesMT(const ViewFrustumExt& Frustum,
+                              const BoundBoxSoA&    Boxes,
+                              Uint32*               pVisibleIndices,
+                              ThreadPool&           WorkerPool,
+                              FRUSTUM_PLANE_FLAGS   PlaneFlags)
+{
+    if (!ValidateBoxes(Boxes))
+        return 0;
+
+    VERIFY_EXPR(pVisibleIndices != nullptr);
+    CullingParams Params{Frustum, PlaneFlags};
+
+    const auto NumWords  = GetBoxVisibilityMaskSize(Boxes.NumBoxes);
+    const auto NumRanges = GetNumCullingRanges(NumWords, WorkerPool.GetNumThreads() + 1);
+    if (NumRanges == 1)
+        return CollectVisibleIndices(Params, Boxes, 0, NumWords, pVisibleIndices);
+
+    const auto WordsPerRange = (NumWords + NumRanges - 1) / NumRanges;
+
+    // Every range writes its indices starting at the index of the first box in the range,
+    // which guarantees that the output does not overlap. The ranges are compacted afterwards.
+    std::vector<Uint32> RangeCounts(NumRanges);
+    ProcessRangesInParallel(WorkerPool, NumRanges,
+                            [&](Uint32 Range) //
+                            {
+                                const auto FirstWord = std::min(Range * WordsPerRange, NumWords);
+                                const auto EndWord   = std::min(FirstWord + WordsPerRange, NumWords);
+                                RangeCounts[Range]   = CollectVisibleIndices(Params, Boxes, FirstWord, EndWord, pVisibleIndices + FirstWord * 32);
+                            });
+
+    Uint32 NumVisible = RangeCounts[0];
+    for (Uint32 r = 1; r < NumRanges; ++r)
+    {
+        const auto FirstBox = std::min(r * WordsPerRange, NumWords) * 32;
+        if (RangeCounts[r] != 0 && FirstBox != NumVisible)
+            memmove(pVisibleIndices + NumVisible, pVisibleIndices + FirstBox, RangeCounts[r] * sizeof(Uint32));
+        NumVisible += RangeCounts[r];
+    }
+
+    return NumVisible;
+}
+
+} // namespace Diligent
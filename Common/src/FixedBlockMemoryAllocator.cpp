@@ -27,6 +27,7 @@
 
 #include "pch.h"
 #include <algorithm>
+#include <atomic>
 #include "FixedBlockMemoryAllocator.hpp"
 #include "Align.hpp"
 
@@ -38,19 +39,122 @@ static size_t AdjustBlockSize(size_t BlockSize)
     return Align(std::max(BlockSize, size_t{1}), sizeof(void*));
 }
 
+// Magazine is a bounded stack of free blocks that is only accessed by the thread that owns it.
+// Magazines are allocated from the heap rather than from the raw allocator because
+// they may outlive the allocator they cache blocks for.
+struct FixedBlockMemoryAllocator::ThreadMagazine
+{
+    explicit ThreadMagazine(FixedBlockMemoryAllocator* _pOwner) :
+        pOwner{_pOwner}
+    {}
+
+    // Allocator that the magazine belongs to. Set to null when the allocator is destroyed,
+    // after which the magazine is only referenced by its thread.
+    std::atomic<FixedBlockMemoryAllocator*> pOwner;
+
+    Uint32 NumBlocks = 0;
+    void*  Blocks[MaxThreadCacheSize];
+};
+
+// Mutex that serializes releasing magazines by exiting threads and by destroyed allocators
+static std::mutex& GetMagazineOwnershipMutex()
+{
+    static std::mutex OwnershipMtx;
+    return OwnershipMtx;
+}
+
+// Magazines of all allocators used by one thread
+class FixedBlockMemoryAllocator::ThreadMagazineCache
+{
+public:
+    ThreadMagazineCache() {}
+
+    // clang-format off
+    ThreadMagazineCache             (const ThreadMagazineCache&) = delete;
+    ThreadMagazineCache& operator = (const ThreadMagazineCache&) = delete;
+    // clang-format on
+
+    ~ThreadMagazineCache()
+    {
+        for (auto* pMagazine : m_Magazines)
+        {
+            {
+                std::lock_guard<std::mutex> OwnershipLock{GetMagazineOwnershipMutex()};
+                if (auto* pOwner = pMagazine->pOwner.load(std::memory_order_acquire))
+                {
+                    // The allocator is still alive and will not be destroyed while we hold the lock
+                    std::lock_guard<std::mutex> Lock{pOwner->m_Mutex};
+                    pOwner->ReturnMagazineBlocks(*pMagazine);
+                    pOwner->m_Magazines.erase(std::find(pOwner->m_Magazines.begin(), pOwner->m_Magazines.end(), pMagazine));
+                }
+            }
+            delete pMagazine;
+        }
+    }
+
+    ThreadMagazine* Find(const FixedBlockMemoryAllocator* pAllocator)
+    {
+        if (m_pLastUsed != nullptr && m_pLastUsed->pOwner.load(std::memory_order_relaxed) == pAllocator)
+            return m_pLastUsed;
+
+        m_pLastUsed = nullptr;
+        for (size_t i = 0; i < m_Magazines.size();)
+        {
+            auto* pMagazine = m_Magazines[i];
+            auto* pOwner    = pMagazine->pOwner.load(std::memory_order_acquire);
+            if (pOwner == pAllocator)
+            {
+                m_pLastUsed = pMagazine;
+                break;
+            }
+            else if (pOwner == nullptr)
+            {
+                // The allocator has been destroyed and no longer references the magazine
+                delete pMagazine;
+                m_Magazines[i] = m_Magazines.back();
+                m_Magazines.pop_back();
+            }
+            else
+            {
+                ++i;
+            }
+        }
+        return m_pLastUsed;
+    }
+
+    void Add(ThreadMagazine* pMagazine)
+    {
+        m_Magazines.push_back(pMagazine);
+        m_pLastUsed = pMagazine;
+    }
+
+private:
+    std::vector<ThreadMagazine*> m_Magazines;
+    ThreadMagazine*              m_pLastUsed = nullptr;
+};
+
 FixedBlockMemoryAllocator::FixedBlockMemoryAllocator(IMemoryAllocator& RawMemoryAllocator,
                                                      size_t            BlockSize,
-                                                     Uint32            NumBlocksInPage) :
+                                                     Uint32            NumBlocksInPage,
+                                                     Uint32            ThreadCacheSize) :
     // clang-format off
     m_PagePool          (STD_ALLOCATOR_RAW_MEM(MemoryPage, RawMemoryAllocator, "Allocator for vector<MemoryPage>")),
     m_AvailablePages    (STD_ALLOCATOR_RAW_MEM(size_t, RawMemoryAllocator, "Allocator for unordered_set<size_t>") ),
-    m_AddrToPageId      (STD_ALLOCATOR_RAW_MEM(AddrToPageIdMapElem, RawMemoryAllocator, "Allocator for unordered_map<void*, size_t>")),
+    m_SortedPages       (STD_ALLOCATOR_RAW_MEM(size_t, RawMemoryAllocator, "Allocator for vector<size_t>")),
+    m_Magazines         (STD_ALLOCATOR_RAW_MEM(ThreadMagazine*, RawMemoryAllocator, "Allocator for vector<ThreadMagazine*>")),
     m_RawMemoryAllocator{RawMemoryAllocator        },
     m_BlockSize         {AdjustBlockSize(BlockSize)},
-    m_NumBlocksInPage   {NumBlocksInPage           }
+    m_NumBlocksInPage   {std::max(NumBlocksInPage, Uint32{1})},
+    m_ThreadCacheSize   {std::min(ThreadCacheSize, Uint32{MaxThreadCacheSize})}
 // clang-format on
 {
     VERIFY_EXPR(BlockSize > 0);
+    VERIFY_EXPR(NumBlocksInPage > 0);
+    VERIFY(ThreadCacheSize <= MaxThreadCacheSize, "Thread cache size (", ThreadCacheSize, ") exceeds the maximum allowed value (", Uint32{MaxThreadCacheSize}, ")");
+
+    // Make sure that the mutex is constructed before, and is thus destroyed after,
+    // any allocator with static storage duration
+    GetMagazineOwnershipMutex();
 
     // Allocate one page
     CreateNewPage();
@@ -58,6 +162,19 @@ FixedBlockMemoryAllocator::FixedBlockMemoryAllocator(IMemoryAllocator& RawMemory
 
 FixedBlockMemoryAllocator::~FixedBlockMemoryAllocator()
 {
+    {
+        // Take back all blocks from thread magazines. Threads that still hold the magazines
+        // will see that the owner is null and will release them.
+        std::lock_guard<std::mutex> OwnershipLock{GetMagazineOwnershipMutex()};
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+        for (auto* pMagazine : m_Magazines)
+        {
+            ReturnMagazineBlocks(*pMagazine);
+            pMagazine->pOwner.store(nullptr, std::memory_order_release);
+        }
+        m_Magazines.clear();
+    }
+
 #ifdef DILIGENT_DEBUG
     for (size_t p = 0; p < m_PagePool.size(); ++p)
     {
@@ -70,19 +187,35 @@ FixedBlockMemoryAllocator::~FixedBlockMemoryAllocator()
 void FixedBlockMemoryAllocator::CreateNewPage()
 {
     m_PagePool.emplace_back(*this);
-    m_AvailablePages.insert(m_PagePool.size() - 1);
-    m_AddrToPageId.reserve(m_PagePool.size() * m_NumBlocksInPage);
+    const auto NewPageId = m_PagePool.size() - 1;
+    m_AvailablePages.insert(NewPageId);
+
+    const auto* pNewPageStart = m_PagePool[NewPageId].GetPageStart();
+    auto        InsertPos     = std::lower_bound(m_SortedPages.begin(), m_SortedPages.end(), pNewPageStart,
+                                      [this](size_t PageId, const void* pPageStart) //
+                                      {
+                                          return m_PagePool[PageId].GetPageStart() < pPageStart;
+                                      });
+    m_SortedPages.insert(InsertPos, NewPageId);
 }
 
-void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+size_t FixedBlockMemoryAllocator::FindPage(const void* pBlock) const
 {
-    VERIFY_EXPR(Size > 0);
-
-    Size = AdjustBlockSize(Size);
-    VERIFY(m_BlockSize == Size, "Requested size (", Size, ") does not match the block size (", m_BlockSize, ")");
-
-    std::lock_guard<std::mutex> LockGuard(m_Mutex);
+    // Find the first page that starts after the block; the block belongs to the page before it
+    auto It = std::upper_bound(m_SortedPages.begin(), m_SortedPages.end(), pBlock,
+                               [this](const void* pAddr, size_t PageId) //
+                               {
+                                   return pAddr < m_PagePool[PageId].GetPageStart();
+                               });
+    VERIFY(It != m_SortedPages.begin(), "Block does not belong to this allocator");
+    const auto PageId = *(It - 1);
+    VERIFY(reinterpret_cast<const Uint8*>(pBlock) < reinterpret_cast<const Uint8*>(m_PagePool[PageId].GetPageStart()) + m_BlockSize * m_NumBlocksInPage,
+           "Block does not belong to this allocator");
+    return PageId;
+}
 
+void* FixedBlockMemoryAllocator::AllocateFromPool()
+{
     if (m_AvailablePages.empty())
     {
         CreateNewPage();
@@ -91,7 +224,6 @@ void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescriptio
     auto  PageId = *m_AvailablePages.begin();
     auto& Page   = m_PagePool[PageId];
     auto* Ptr    = Page.Allocate();
-    m_AddrToPageId.insert(std::make_pair(Ptr, PageId));
     if (!Page.HasSpace())
     {
         m_AvailablePages.erase(m_AvailablePages.begin());
@@ -100,29 +232,109 @@ void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescriptio
     return Ptr;
 }
 
-void FixedBlockMemoryAllocator::Free(void* Ptr)
+void FixedBlockMemoryAllocator::FreeToPool(void* Ptr)
 {
-    std::lock_guard<std::mutex> LockGuard(m_Mutex);
-    auto                        PageIdIt = m_AddrToPageId.find(Ptr);
-    if (PageIdIt != m_AddrToPageId.end())
+    auto PageId = FindPage(Ptr);
+    VERIFY_EXPR(PageId >= 0 && PageId < m_PagePool.size());
+    m_PagePool[PageId].DeAllocate(Ptr);
+    m_AvailablePages.insert(PageId);
+    if (m_AvailablePages.size() > 1 && !m_PagePool[PageId].HasAllocations())
     {
-        auto PageId = PageIdIt->second;
-        VERIFY_EXPR(PageId >= 0 && PageId < m_PagePool.size());
-        m_PagePool[PageId].DeAllocate(Ptr);
-        m_AvailablePages.insert(PageId);
-        m_AddrToPageId.erase(PageIdIt);
-        if (m_AvailablePages.size() > 1 && !m_PagePool[PageId].HasAllocations())
+        // In current implementation pages are never released!
+        // Note that if we delete a page, all indices past it will be invalid
+
+        //m_PagePool.erase(m_PagePool.begin() + PageId);
+        //m_AvailablePages.erase(PageId);
+    }
+}
+
+void FixedBlockMemoryAllocator::ReturnMagazineBlocks(ThreadMagazine& Magazine)
+{
+    for (Uint32 i = 0; i < Magazine.NumBlocks; ++i)
+        FreeToPool(Magazine.Blocks[i]);
+    Magazine.NumBlocks = 0;
+}
+
+FixedBlockMemoryAllocator::ThreadMagazine* FixedBlockMemoryAllocator::GetThreadMagazine()
+{
+    if (m_ThreadCacheSize == 0)
+        return nullptr;
+
+    static thread_local ThreadMagazineCache MagazineCache;
+
+    auto* pMagazine = MagazineCache.Find(this);
+    if (pMagazine == nullptr)
+    {
+        pMagazine = new ThreadMagazine{this};
         {
-            // In current implementation pages are never released!
-            // Note that if we delete a page, all indices past it will be invalid
+            std::lock_guard<std::mutex> LockGuard(m_Mutex);
+            m_Magazines.push_back(pMagazine);
+        }
+        MagazineCache.Add(pMagazine);
+    }
+
+    return pMagazine;
+}
+
+void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    VERIFY_EXPR(Size > 0);
 
-            //m_PagePool.erase(m_PagePool.begin() + PageId);
-            //m_AvailablePages.erase(PageId);
+    Size = AdjustBlockSize(Size);
+    VERIFY(m_BlockSize == Size, "Requested size (", Size, ") does not match the block size (", m_BlockSize, ")");
+
+    void* Ptr = nullptr;
+    if (auto* pMagazine = GetThreadMagazine())
+    {
+        if (pMagazine->NumBlocks == 0)
+        {
+            // Only fill half of the magazine so that subsequent Free() calls do not immediately spill it
+            const auto NumBlocksToFetch = std::max(m_ThreadCacheSize / 2, Uint32{1});
+
+            std::lock_guard<std::mutex> LockGuard(m_Mutex);
+            while (pMagazine->NumBlocks < NumBlocksToFetch)
+                pMagazine->Blocks[pMagazine->NumBlocks++] = AllocateFromPool();
+        }
+        Ptr = pMagazine->Blocks[--pMagazine->NumBlocks];
+    }
+    else
+    {
+        std::lock_guard<std::mutex> LockGuard(m_Mutex);
+        Ptr = AllocateFromPool();
+    }
+
+    FillWithDebugPattern(Ptr, MemoryPage::AllocatedBlockMemPattern, m_BlockSize);
+    return Ptr;
+}
+
+void FixedBlockMemoryAllocator::Free(void* Ptr)
+{
+    if (auto* pMagazine = GetThreadMagazine())
+    {
+#ifdef DILIGENT_DEBUG
+        for (Uint32 i = 0; i < pMagazine->NumBlocks; ++i)
+            VERIFY(pMagazine->Blocks[i] != Ptr, "The block is already in the thread cache - double freeing memory?");
+#endif
+        FillWithDebugPattern(Ptr, MemoryPage::DeallocatedBlockMemPattern, m_BlockSize);
+
+        if (pMagazine->NumBlocks == m_ThreadCacheSize)
+        {
+            // Return the older half of the magazine to the pool and keep the recently freed blocks
+            const auto NumBlocksToReturn = std::max(m_ThreadCacheSize / 2, Uint32{1});
+            {
+                std::lock_guard<std::mutex> LockGuard(m_Mutex);
+                for (Uint32 i = 0; i < NumBlocksToReturn; ++i)
+                    FreeToPool(pMagazine->Blocks[i]);
+            }
+            pMagazine->NumBlocks -= NumBlocksToReturn;
+            std::copy(pMagazine->Blocks + NumBlocksToReturn, pMagazine->Blocks + NumBlocksToReturn + pMagazine->NumBlocks, pMagazine->Blocks);
         }
+        pMagazine->Blocks[pMagazine->NumBlocks++] = Ptr;
     }
     else
     {
-        UNEXPECTED("Address not found in the allocations list - double freeing memory?");
+        std::lock_guard<std::mutex> LockGuard(m_Mutex);
+        FreeToPool(Ptr);
     }
 }
 
@@ -0,0 +1,134 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include <algorithm>
+
+#include "InternedStringPool.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+InternedStringPool::InternedStringPool(IMemoryAllocator& Allocator, size_t PageSize) :
+    m_Allocator{Allocator},
+    m_PageSize{PageSize}
+{
+    VERIFY_EXPR(m_PageSize > 0);
+}
+
+InternedStringPool::InternedStringPool() :
+    InternedStringPool{DefaultRawMemoryAllocator::GetAllocator()}
+{
+}
+
+InternedStringPool::~InternedStringPool()
+{
+}
+
+InternedString InternedStringPool::MakeKey(const Char* Str, size_t Length)
+{
+    InternedString Key;
+    Key.Str    = Str;
+    Key.Hash   = static_cast<size_t>(ComputeHashRaw(Str, Length * sizeof(Char)));
+    Key.Length = static_cast<Uint32>(Length);
+    return Key;
+}
+
+Char* InternedStringPool::AllocateString(size_t Length)
+{
+    if (m_Pages.empty() || m_Pages.back().GetRemainingSize() < Length + 1)
+    {
+        m_Pages.emplace_back();
+        m_Pages.back().Reserve(std::max(m_PageSize, Length + 1), m_Allocator);
+    }
+
+    auto* Str = m_Pages.back().Allocate(Length + 1);
+    return Str;
+}
+
+const InternedString& InternedStringPool::Intern(const Char* Str)
+{
+    VERIFY(Str != nullptr, "String must not be null");
+    return Intern(Str, strlen(Str));
+}
+
+const InternedString& InternedStringPool::Intern(const Char* Str, size_t Length)
+{
+    VERIFY(Str != nullptr || Length == 0, "String must not be null");
+    VERIFY(Length <= UINT32_MAX, "String is too long");
+
+    // Compute the hash outside of the lock
+    const auto Key = MakeKey(Str, Length);
+
+    ThreadingTools::LockHelper Lock{m_LockFlag};
+
+    auto It = m_Index.find(Key);
+    if (It != m_Index.end())
+        return *It->second;
+
+    auto* StrCopy = AllocateString(Length);
+    if (Length != 0)
+        memcpy(StrCopy, Str, Length * sizeof(Char));
+    StrCopy[Length] = 0;
+
+    m_Strings.emplace_back(Key);
+    auto& NewStr = m_Strings.back();
+    NewStr.Str   = StrCopy;
+    m_Index.emplace(NewStr, &NewStr);
+
+    return NewStr;
+}
+
+const InternedString* InternedStringPool::Find(const Char* Str) const
+{
+    VERIFY(Str != nullptr, "String must not be null");
+
+    const auto Key = MakeKey(Str, strlen(Str));
+
+    ThreadingTools::LockHelper Lock{m_LockFlag};
+
+    auto It = m_Index.find(Key);
+    return It != m_Index.end() ? It->second : nullptr;
+}
+
+size_t InternedStringPool::GetStringCount() const
+{
+    ThreadingTools::LockHelper Lock{m_LockFlag};
+    return m_Strings.size();
+}
+
+InternedStringPool& InternedStringPool::GetGlobalPool()
+{
+    static InternedStringPool GlobalPool;
+    return GlobalPool;
+}
+
+} // namespace Diligent
@@ -26,14 +26,106 @@
  */
 
 #include <thread>
+#include <algorithm>
 #include "LockHelper.hpp"
 
+#if PLATFORM_LINUX || PLATFORM_ANDROID
+#    include <unistd.h>
+#    include <sys/syscall.h>
+#    include <linux/futex.h>
+#    define USE_FUTEX 1
+#else
+#    define USE_FUTEX 0
+#endif
+
+#if defined(_M_IX86) || defined(_M_X64)
+#    include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+#    include <immintrin.h>
+#endif
+
 namespace ThreadingTools
 {
 
+static std::atomic<Atomics::Int64> g_ContentionCount{0};
+static std::atomic<Atomics::Int64> g_WaitCount{0};
+
+static inline void Pause() noexcept
+{
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    _mm_pause();
+#elif defined(_M_ARM) || defined(_M_ARM64)
+    __yield();
+#elif defined(__arm__) || defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+#if USE_FUTEX
+static_assert(sizeof(std::atomic<int>) == sizeof(int), "futex requires std::atomic<int> to have the same layout as int");
+
+static void FutexWait(std::atomic<int>& Flag, int ExpectedValue) noexcept
+{
+    // The call returns immediately if the flag value is not equal to ExpectedValue
+    syscall(SYS_futex, reinterpret_cast<int*>(&Flag), FUTEX_WAIT_PRIVATE, ExpectedValue, nullptr, nullptr, 0);
+}
+
+static void FutexWakeOne(std::atomic<int>& Flag) noexcept
+{
+    syscall(SYS_futex, reinterpret_cast<int*>(&Flag), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+}
+#endif
+
+void LockHelper::LockContended(LockFlag& LockFlag, int SpinCountToYield) noexcept
+{
+    g_ContentionCount.fetch_add(1, std::memory_order_relaxed);
+
+    // Spin with exponential backoff, only trying to acquire the lock when it looks free
+    constexpr int MaxBackoff = 64;
+    for (int SpinCount = 0, Backoff = 1; SpinCount < SpinCountToYield; SpinCount += Backoff, Backoff = std::min(Backoff * 2, MaxBackoff))
+    {
+        for (int i = 0; i < Backoff; ++i)
+            Pause();
+
+        if (LockFlag.m_Flag.load(std::memory_order_relaxed) == LockFlag::LOCK_FLAG_UNLOCKED && UnsafeTryLock(LockFlag))
+            return;
+    }
+
+    // Mark the flag as contended so that the thread that unlocks it wakes up one of the waiters.
+    // The thread that acquires the lock here keeps the contended state as there may be other waiters.
+    while (LockFlag.m_Flag.exchange(LockFlag::LOCK_FLAG_LOCKED_CONTENDED, std::memory_order_acquire) != LockFlag::LOCK_FLAG_UNLOCKED)
+    {
+        g_WaitCount.fetch_add(1, std::memory_order_relaxed);
+#if USE_FUTEX
+        FutexWait(LockFlag.m_Flag, LockFlag::LOCK_FLAG_LOCKED_CONTENDED);
+#else
+        YieldThread();
+#endif
+    }
+}
+
+void LockHelper::WakeWaiter(LockFlag& LockFlag) noexcept
+{
+#if USE_FUTEX
+    FutexWakeOne(LockFlag.m_Flag);
+#else
+    (void)LockFlag;
+#endif
+}
+
 void LockHelper::YieldThread() noexcept
 {
     std::this_thread::yield();
 }
 
+Atomics::Int64 LockHelper::GetContentionCount() noexcept
+{
+    return g_ContentionCount.load();
+}
+
+Atomics::Int64 LockHelper::GetWaitCount() noexcept
+{
+    return g_WaitCount.load();
+}
+
 } // namespace ThreadingTools
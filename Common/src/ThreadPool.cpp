@@ -0,0 +1,112 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include <algorithm>
+
+#include "ThreadPool.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+ThreadPool::ThreadPool(Uint32 NumThreads)
+{
+    if (NumThreads == 0)
+    {
+        const auto NumHWThreads = std::thread::hardware_concurrency();
+        NumThreads              = std::max(NumHWThreads, 2u) - 1u;
+    }
+
+    m_Threads.reserve(NumThreads);
+    for (Uint32 i = 0; i < NumThreads; ++i)
+        m_Threads.emplace_back(&ThreadPool::WorkerThreadFunc, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        m_Stop = true;
+    }
+    m_TaskAvailableCV.notify_all();
+
+    for (auto& Thread : m_Threads)
+        Thread.join();
+
+    VERIFY(m_Tasks.empty(), "All tasks must be executed by the worker threads before they exit");
+}
+
+void ThreadPool::EnqueueTask(TaskType&& Task)
+{
+    VERIFY_EXPR(Task);
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        VERIFY(!m_Stop, "Enqueueing a task to a thread pool that is being destroyed");
+        m_Tasks.emplace_back(std::move(Task));
+    }
+    m_TaskAvailableCV.notify_one();
+}
+
+void ThreadPool::WaitForAllTasks()
+{
+    std::unique_lock<std::mutex> Lock{m_Mtx};
+    m_TasksCompletedCV.wait(Lock, [this] { return m_Tasks.empty() && m_NumRunningTasks == 0; });
+}
+
+size_t ThreadPool::GetNumPendingTasks()
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    return m_Tasks.size() + m_NumRunningTasks;
+}
+
+void ThreadPool::WorkerThreadFunc()
+{
+    std::unique_lock<std::mutex> Lock{m_Mtx};
+    for (;;)
+    {
+        // Pending tasks are executed even when the pool is stopping
+        m_TaskAvailableCV.wait(Lock, [this] { return !m_Tasks.empty() || m_Stop; });
+        if (m_Tasks.empty())
+            break;
+
+        auto Task = std::move(m_Tasks.front());
+        m_Tasks.pop_front();
+        ++m_NumRunningTasks;
+
+        Lock.unlock();
+        Task();
+        Lock.lock();
+
+        --m_NumRunningTasks;
+        if (m_Tasks.empty() && m_NumRunningTasks == 0)
+            m_TasksCompletedCV.notify_all();
+    }
+}
+
+} // namespace Diligent
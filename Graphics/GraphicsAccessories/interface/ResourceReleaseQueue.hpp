@@ -35,9 +35,12 @@
 
 #include <mutex>
 #include <deque>
+#include <atomic>
 
 #include "../../../Primitives/interface/MemoryAllocator.h"
 #include "../../../Common/interface/STDAllocator.hpp"
+#include "../../../Common/interface/FixedBlockMemoryAllocator.hpp"
+#include "../../../Common/interface/DefaultRawMemoryAllocator.hpp"
 #include "../../../Platforms/interface/Atomics.hpp"
 #include "../../../Platforms/Basic/interface/DebugUtilities.hpp"
 
@@ -85,7 +88,7 @@ public:
 
             virtual void Release() override final
             {
-                delete this;
+                DestroyStaleResource(this);
             }
 
         private:
@@ -112,7 +115,7 @@ public:
             {
                 if (Atomics::AtomicDecrement(m_RefCounter) == 0)
                 {
-                    delete this;
+                    DestroyStaleResource(this);
                 }
             }
 
@@ -123,8 +126,8 @@ public:
 
         return DynamicStaleResourceWrapper{
             NumReferences == 1 ?
-                static_cast<StaleResourceBase*>(new SpecificStaleResource{std::move(Resource)}) :
-                static_cast<StaleResourceBase*>(new SpecificSharedStaleResource{std::move(Resource), NumReferences})};
+                static_cast<StaleResourceBase*>(new (AllocateStaleResource(sizeof(SpecificStaleResource))) SpecificStaleResource{std::move(Resource)}) :
+                static_cast<StaleResourceBase*>(new (AllocateStaleResource(sizeof(SpecificSharedStaleResource))) SpecificSharedStaleResource{std::move(Resource), NumReferences})};
     }
 
     DynamicStaleResourceWrapper(DynamicStaleResourceWrapper&& rhs) noexcept :
@@ -166,6 +169,55 @@ private:
         m_pStaleResource(pStaleResource)
     {}
 
+    // Stale resources are allocated from fixed-block pools of several size classes rather than
+    // from the heap. Pools keep per-thread caches of free blocks, so releasing resources from
+    // multiple threads does not serialize on the allocator. Larger objects fall back to the heap.
+    static size_t GetStaleResourceBlockSize(size_t Size)
+    {
+        // clang-format off
+        return Size <=  32 ?  32 :
+               Size <=  64 ?  64 :
+               Size <= 128 ? 128 :
+                               0;
+        // clang-format on
+    }
+
+    static FixedBlockMemoryAllocator* GetStaleResourcePool(size_t BlockSize)
+    {
+        static FixedBlockMemoryAllocator Pools[] = //
+            {
+                {DefaultRawMemoryAllocator::GetAllocator(), 32, 256},
+                {DefaultRawMemoryAllocator::GetAllocator(), 64, 128},
+                {DefaultRawMemoryAllocator::GetAllocator(), 128, 64} //
+            };
+        switch (BlockSize)
+        {
+            case 32: return &Pools[0];
+            case 64: return &Pools[1];
+            case 128: return &Pools[2];
+            default: return nullptr;
+        }
+    }
+
+    static void* AllocateStaleResource(size_t Size)
+    {
+        const auto BlockSize = GetStaleResourceBlockSize(Size);
+        if (auto* pPool = GetStaleResourcePool(BlockSize))
+            return pPool->Allocate(BlockSize, "Stale resource", __FILE__, __LINE__);
+        else
+            return ::operator new(Size);
+    }
+
+    template <typename StaleResourceType>
+    static void DestroyStaleResource(StaleResourceType* pStaleResource)
+    {
+        pStaleResource->~StaleResourceType();
+        if (auto* pPool = GetStaleResourcePool(GetStaleResourceBlockSize(sizeof(StaleResourceType))))
+            pPool->Free(pStaleResource);
+        else
+            ::operator delete(pStaleResource);
+    }
+
     StaleResourceBase* m_pStaleResource;
 };
 
@@ -378,4 +430,254 @@ private:
     std::deque<ReleaseQueueElemType, STDAllocatorRawMem<ReleaseQueueElemType>> m_StaleResources;
 };
 
+/// Resource release queue that allows releasing resources from multiple threads without locking
+
+/// The queue has the same interface and semantics as ResourceReleaseQueue, but
+/// SafeReleaseResource() and DiscardResource() push resources into lock-free lists
+/// (multiple producers). DiscardStaleResources() and Purge() (the consumer) take the lists
+/// in a single atomic exchange and process the resources in batch. Consumer methods are
+/// serialized with a mutex that producers never acquire.
+/// List nodes are allocated from a fixed-block allocator that keeps per-thread caches of
+/// free blocks.
+///
+/// \tparam ResourceWrapperType -  Type of the resource wrapper used by the release queue.
+template <typename ResourceWrapperType>
+class MPSCResourceReleaseQueue
+{
+public:
+    // clang-format off
+    MPSCResourceReleaseQueue(IMemoryAllocator& Allocator) :
+        m_NodeAllocator {Allocator, sizeof(Node), 128},
+        m_ReleaseQueue  (STD_ALLOCATOR_RAW_MEM(ReleaseQueueElemType, Allocator, "Allocator for deque<ReleaseQueueElemType>")),
+        m_StaleResources(STD_ALLOCATOR_RAW_MEM(ReleaseQueueElemType, Allocator, "Allocator for deque<ReleaseQueueElemType>"))
+    {}
+
+    MPSCResourceReleaseQueue             (const MPSCResourceReleaseQueue&) = delete;
+    MPSCResourceReleaseQueue             (MPSCResourceReleaseQueue&&)      = delete;
+    MPSCResourceReleaseQueue& operator = (const MPSCResourceReleaseQueue&) = delete;
+    MPSCResourceReleaseQueue& operator = (MPSCResourceReleaseQueue&&)      = delete;
+    // clang-format on
+
+    ~MPSCResourceReleaseQueue()
+    {
+        DEV_CHECK_ERR(GetStaleResourceCount() == 0, "Not all stale objects were destroyed");
+        DEV_CHECK_ERR(GetPendingReleaseResourceCount() == 0, "Release queue is not empty");
+
+        // Destroy the remaining resources and return the nodes to the allocator
+        std::lock_guard<std::mutex> ConsumerLock(m_ConsumerMutex);
+        DrainList(m_StaleList, m_StaleResources, m_NumPushedStaleResources);
+        DrainList(m_ReleaseList, m_ReleaseQueue, m_NumPushedReleaseResources);
+    }
+
+    /// Creates a resource wrapper for the specific resource type
+    /// \param [in] Resource      - Resource to be released
+    /// \param [in] NumReferences - Number of references to the resource
+    template <typename ResourceType, typename = typename std::enable_if<std::is_object<ResourceType>::value>::type>
+    static ResourceWrapperType CreateWrapper(ResourceType&& Resource, Atomics::Long NumReferences)
+    {
+        return ResourceWrapperType::Create(std::move(Resource), NumReferences);
+    }
+
+    /// Moves a resource to the stale resources queue
+    /// \param [in] Resource              - Resource to be released
+    /// \param [in] NextCommandListNumber - Number of the command list that will be submitted to the queue next
+    template <typename ResourceType, typename = typename std::enable_if<std::is_object<ResourceType>::value>::type>
+    void SafeReleaseResource(ResourceType&& Resource, Uint64 NextCommandListNumber)
+    {
+        SafeReleaseResource(CreateWrapper(std::move(Resource), 1), NextCommandListNumber);
+    }
+
+    /// Moves a resource wrapper to the stale resources queue
+    /// \param [in] Wrapper               - Resource wrapper containing the resource to be released
+    /// \param [in] NextCommandListNumber - Number of the command list that will be submitted to the queue next
+    void SafeReleaseResource(ResourceWrapperType&& Wrapper, Uint64 NextCommandListNumber)
+    {
+        Push(m_StaleList, m_NumPushedStaleResources, CreateNode(NextCommandListNumber, std::move(Wrapper)));
+    }
+
+    /// Moves a copy of the resource wrapper to the stale resources queue
+    /// \param [in] Wrapper               - Resource wrapper containing the resource to be released
+    /// \param [in] NextCommandListNumber - Number of the command list that will be submitted to the queue next
+    void SafeReleaseResource(const ResourceWrapperType& Wrapper, Uint64 NextCommandListNumber)
+    {
+        Push(m_StaleList, m_NumPushedStaleResources, CreateNode(NextCommandListNumber, Wrapper));
+    }
+
+    /// Adds a resource directly to the release queue
+    /// \param [in] Resource    - Resource to be released.
+    /// \param [in] FenceValue  - Fence value indicating when the resource was used last time.
+    template <typename ResourceType, typename = typename std::enable_if<std::is_object<ResourceType>::value>::type>
+    void DiscardResource(ResourceType&& Resource, Uint64 FenceValue)
+    {
+        DiscardResource(CreateWrapper(std::move(Resource), 1), FenceValue);
+    }
+
+    /// Adds a resource wrapper directly to the release queue
+    /// \param [in] Wrapper     - Resource wrapper containing the resource to be released.
+    /// \param [in] FenceValue  - Fence value indicating when the resource was used last time.
+    void DiscardResource(ResourceWrapperType&& Wrapper, Uint64 FenceValue)
+    {
+        Push(m_ReleaseList, m_NumPushedReleaseResources, CreateNode(FenceValue, std::move(Wrapper)));
+    }
+
+    /// Adds a copy of the resource wrapper directly to the release queue
+    /// \param [in] Wrapper     - Resource wrapper containing the resource to be released.
+    /// \param [in] FenceValue  - Fence value indicating when the resource was used last time.
+    void DiscardResource(const ResourceWrapperType& Wrapper, Uint64 FenceValue)
+    {
+        Push(m_ReleaseList, m_NumPushedReleaseResources, CreateNode(FenceValue, Wrapper));
+    }
+
+    /// Adds multiple resources directly to the release queue
+    /// \param [in] FenceValue  - Fence value indicating when the resource was used last time.
+    /// \param [in] Iterator    - Iterator that returns resources to be relased.
+    template <typename ResourceType, typename IteratorType>
+    void DiscardResources(Uint64 FenceValue, IteratorType Iterator)
+    {
+        ResourceType Resource;
+        while (Iterator(Resource))
+        {
+            DiscardResource(CreateWrapper(std::move(Resource), 1), FenceValue);
+        }
+    }
+
+    /// Moves stale objects to the release queue
+    /// \param [in] SubmittedCmdBuffNumber - number of the last submitted command list.
+    ///                                      All resources in the stale object list whose command list number is
+    ///                                      less than or equal to this value are moved to the release queue.
+    /// \param [in] FenceValue             - Fence value associated with the resources moved to the release queue.
+    ///                                      A resource will be destroyed by Purge() method when completed fence value
+    ///                                      is greater or equal to the fence value associated with the resource
+    void DiscardStaleResources(Uint64 SubmittedCmdBuffNumber, Uint64 FenceValue)
+    {
+        std::lock_guard<std::mutex> ConsumerLock(m_ConsumerMutex);
+
+        DrainList(m_StaleList, m_StaleResources, m_NumPushedStaleResources);
+        DrainList(m_ReleaseList, m_ReleaseQueue, m_NumPushedReleaseResources);
+
+        // Only discard these stale objects that were released before CmdBuffNumber
+        // was executed
+        while (!m_StaleResources.empty())
+        {
+            auto& FirstStaleObj = m_StaleResources.front();
+            if (FirstStaleObj.first <= SubmittedCmdBuffNumber)
+            {
+                m_ReleaseQueue.emplace_back(FenceValue, std::move(FirstStaleObj.second));
+                m_StaleResources.pop_front();
+            }
+            else
+                break;
+        }
+    }
+
+    /// Removes all objects from the release queue whose fence value is
+    /// less than or equal to CompletedFenceValue
+    /// \param [in] CompletedFenceValue  -  Value of the fence that has been completed by the GPU
+    void Purge(Uint64 CompletedFenceValue)
+    {
+        std::lock_guard<std::mutex> ConsumerLock(m_ConsumerMutex);
+
+        DrainList(m_ReleaseList, m_ReleaseQueue, m_NumPushedReleaseResources);
+
+        while (!m_ReleaseQueue.empty())
+        {
+            auto& FirstObj = m_ReleaseQueue.front();
+            if (FirstObj.first <= CompletedFenceValue)
+                m_ReleaseQueue.pop_front();
+            else
+                break;
+        }
+    }
+
+    /// Returns the number of stale resources
+    size_t GetStaleResourceCount() const
+    {
+        std::lock_guard<std::mutex> ConsumerLock(m_ConsumerMutex);
+        return m_StaleResources.size() + m_NumPushedStaleResources.load();
+    }
+
+    /// Returns the number of resources pending release
+    size_t GetPendingReleaseResourceCount() const
+    {
+        std::lock_guard<std::mutex> ConsumerLock(m_ConsumerMutex);
+        return m_ReleaseQueue.size() + m_NumPushedReleaseResources.load();
+    }
+
+private:
+    struct Node
+    {
+        template <typename WrapperType>
+        Node(Uint64 _Value, WrapperType&& _Wrapper) :
+            Value{_Value},
+            Wrapper{std::forward<WrapperType>(_Wrapper)}
+        {}
+
+        Node*               pNext = nullptr;
+        const Uint64        Value; // Command list number or fence value
+        ResourceWrapperType Wrapper;
+    };
+
+    template <typename WrapperType>
+    Node* CreateNode(Uint64 Value, WrapperType&& Wrapper)
+    {
+        void* pMem = m_NodeAllocator.Allocate(sizeof(Node), "Resource release queue node", __FILE__, __LINE__);
+        return new (pMem) Node{Value, std::forward<WrapperType>(Wrapper)};
+    }
+
+    static void Push(std::atomic<Node*>& Head, std::atomic<size_t>& Counter, Node* pNode)
+    {
+        // The counter must be incremented before the node is published. Otherwise the consumer
+        // may drain the node and decrement the counter first, which would make it underflow.
+        Counter.fetch_add(1);
+
+        // Nodes are only removed by exchanging the entire list, so the push is not prone to the ABA problem
+        pNode->pNext = Head.load(std::memory_order_relaxed);
+        while (!Head.compare_exchange_weak(pNode->pNext, pNode, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    template <typename QueueType>
+    void DrainList(std::atomic<Node*>& Head, QueueType& Queue, std::atomic<size_t>& Counter)
+    {
+        auto* pNode = Head.exchange(nullptr, std::memory_order_acquire);
+
+        // The list is in the reverse order of the pushes
+        Node* pReversed = nullptr;
+        while (pNode != nullptr)
+        {
+            auto* pNext  = pNode->pNext;
+            pNode->pNext = pReversed;
+            pReversed    = pNode;
+            pNode        = pNext;
+        }
+
+        size_t NumNodes = 0;
+        while (pReversed != nullptr)
+        {
+            auto* pNext = pReversed->pNext;
+            Queue.emplace_back(pReversed->Value, std::move(pReversed->Wrapper));
+            pReversed->~Node();
+            m_NodeAllocator.Free(pReversed);
+            pReversed = pNext;
+            ++NumNodes;
+        }
+        Counter.fetch_sub(NumNodes);
+    }
+
+    FixedBlockMemoryAllocator m_NodeAllocator;
+
+    // Lists of resources pushed by producers since the last time they were drained
+    std::atomic<Node*>  m_StaleList{nullptr};
+    std::atomic<Node*>  m_ReleaseList{nullptr};
+    std::atomic<size_t> m_NumPushedStaleResources{0};
+    std::atomic<size_t> m_NumPushedReleaseResources{0};
+
+    // The following members are only accessed by the consumer
+    mutable std::mutex m_ConsumerMutex;
+    using ReleaseQueueElemType = std::pair<Uint64, ResourceWrapperType>;
+    std::deque<ReleaseQueueElemType, STDAllocatorRawMem<ReleaseQueueElemType>> m_ReleaseQueue;
+    std::deque<ReleaseQueueElemType, STDAllocatorRawMem<ReleaseQueueElemType>> m_StaleResources;
+};
+
 } // namespace Diligent
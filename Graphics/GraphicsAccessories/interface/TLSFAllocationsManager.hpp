@@ -0,0 +1,692 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+// Helper class that handles free memory block management to accommodate variable-size allocation
+// requests in constant time using two-level segregated fit (TLSF) algorithm.
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <algorithm>
+
+#include "../../../Primitives/interface/BasicTypes.h"
+#include "../../../Primitives/interface/MemoryAllocator.h"
+#include "../../../Platforms/interface/PlatformMisc.hpp"
+#include "../../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "../../../Common/interface/Align.hpp"
+#include "../../../Common/interface/STDAllocator.hpp"
+#include "VariableSizeAllocationsManager.hpp"
+
+namespace Diligent
+{
+// The class is a drop-in replacement for VariableSizeAllocationsManager that performs
+// allocation and deallocation in O(1) time. Like VariableSizeAllocationsManager, it only keeps
+// track of free blocks and does not record allocation sizes.
+//
+// Free blocks are segregated into size classes. The first level splits the size range into
+// power-of-two classes, and the second level linearly subdivides every first-level class into
+// SLCount sub-classes. Every class keeps an intrusive doubly-linked list of its free blocks, and
+// two bitmaps track non-empty classes, so that a suitable block is found with two bit scans.
+//
+//     FL bitmap      SL bitmaps              Free lists
+//
+//      FL=0  0 ----> 0 0 0 ... 0
+//      FL=1  1 ----> 0 0 1 ... 0  --> [34, 35):   {Offset=0, Size=34}
+//      FL=2  1 ----> 1 0 0 ... 1  --> [64, 66):   {Offset=96, Size=65} <-> {Offset=300, Size=64}
+//                                 --> [126, 128): {Offset=400, Size=127}
+//       ...
+//
+// Block records are kept in a pool and are recycled, and two open-addressing hash tables map
+// start and end offsets of free blocks to their records. This enables coalescing released
+// space with adjacent free blocks without any per-operation heap allocations.
+//
+// Unlike VariableSizeAllocationsManager that always uses the smallest suitable block (best fit),
+// the class uses the first block from the smallest non-empty class that is guaranteed to be
+// large enough (good fit). The request's own class is only scanned if no such block exists.
+class TLSFAllocationsManager
+{
+public:
+    using OffsetType = VariableSizeAllocationsManager::OffsetType;
+    using Allocation = VariableSizeAllocationsManager::Allocation;
+
+private:
+    static constexpr Uint32 InvalidIndex = ~Uint32{0};
+
+    // Every first-level class is subdivided into 2^SLIndexBits second-level classes
+    static constexpr Uint32 SLIndexBits = 5;
+    static constexpr Uint32 SLCount     = 1u << SLIndexBits;
+
+    // Blocks smaller than SmallBlockSize all belong to the first first-level class
+    // that is subdivided with the granularity of 1
+    static constexpr OffsetType SmallBlockSize = OffsetType{1} << SLIndexBits;
+
+    static constexpr Uint32 FLCount = sizeof(OffsetType) * 8 - SLIndexBits + 1;
+    static_assert(FLCount <= 64, "First-level bitmap is too small");
+
+    struct FreeBlockInfo
+    {
+        OffsetType Offset = 0;
+
+        // Block size. Zero size indicates that the record is not used.
+        OffsetType Size = 0;
+
+        // Links in the free list of the block's size class.
+        // Unused records are linked into the list of available records through NextFree.
+        Uint32 PrevFree = InvalidIndex;
+        Uint32 NextFree = InvalidIndex;
+    };
+
+    // Linear-probing hash table that maps block offsets to block record indices
+    class OffsetToBlockMap
+    {
+    public:
+        OffsetToBlockMap(IMemoryAllocator& Allocator) :
+            m_Slots(STD_ALLOCATOR_RAW_MEM(Slot, Allocator, "Allocator for vector<Slot>"))
+        {
+            m_Slots.resize(size_t{1} << m_Log2Capacity);
+        }
+
+        // clang-format off
+        OffsetToBlockMap(OffsetToBlockMap&& rhs) noexcept :
+            m_Slots       {std::move(rhs.m_Slots)},
+            m_Count       {rhs.m_Count           },
+            m_Log2Capacity{rhs.m_Log2Capacity    }
+        {
+            rhs.m_Count = 0;
+        }
+
+        OffsetToBlockMap& operator = (OffsetToBlockMap&& rhs) = default;
+        OffsetToBlockMap             (const OffsetToBlockMap&) = delete;
+        OffsetToBlockMap& operator = (const OffsetToBlockMap&) = delete;
+        // clang-format on
+
+        Uint32 Find(OffsetType Key) const
+        {
+            const auto Mask = m_Slots.size() - 1;
+            for (auto i = GetHomeSlot(Key);; i = (i + 1) & Mask)
+            {
+                const auto& Slot = m_Slots[i];
+                if (Slot.Key == Key)
+                    return Slot.BlockIdx;
+                if (Slot.Key == InvalidKey)
+                    return InvalidIndex;
+            }
+        }
+
+        void Insert(OffsetType Key, Uint32 BlockIdx)
+        {
+            VERIFY_EXPR(Key != InvalidKey && BlockIdx != InvalidIndex);
+            // Keep the load factor below 1/2
+            if ((m_Count + 1) * 2 > m_Slots.size())
+                Grow();
+
+            const auto Mask = m_Slots.size() - 1;
+            auto       i    = GetHomeSlot(Key);
+            while (m_Slots[i].Key != InvalidKey)
+            {
+                VERIFY(m_Slots[i].Key != Key, "Offset ", Key, " is already in the map");
+                i = (i + 1) & Mask;
+            }
+            m_Slots[i].Key      = Key;
+            m_Slots[i].BlockIdx = BlockIdx;
+            ++m_Count;
+        }
+
+        void Erase(OffsetType Key)
+        {
+            const auto Mask = m_Slots.size() - 1;
+
+            auto i = GetHomeSlot(Key);
+            while (m_Slots[i].Key != Key)
+            {
+                VERIFY(m_Slots[i].Key != InvalidKey, "Offset ", Key, " is not found in the map");
+                i = (i + 1) & Mask;
+            }
+
+            // Shift back the elements that follow the erased one in the same probe sequence
+            // so that no tombstones are required
+            for (auto j = (i + 1) & Mask; m_Slots[j].Key != InvalidKey; j = (j + 1) & Mask)
+            {
+                const auto k = GetHomeSlot(m_Slots[j].Key);
+                // Element at j can only be moved to i if its home slot k is not cyclically in (i, j]
+                const bool StaysInPlace = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+                if (!StaysInPlace)
+                {
+                    m_Slots[i] = m_Slots[j];
+                    i          = j;
+                }
+            }
+            m_Slots[i] = Slot{};
+            --m_Count;
+        }
+
+        size_t GetCount() const { return m_Count; }
+
+    private:
+        static constexpr OffsetType InvalidKey = Allocation::InvalidOffset;
+
+        struct Slot
+        {
+            OffsetType Key      = InvalidKey;
+            Uint32     BlockIdx = InvalidIndex;
+        };
+
+        size_t GetHomeSlot(OffsetType Key) const
+        {
+            // Fibonacci hashing scatters aligned offsets that differ in high bits only
+            return static_cast<size_t>((Uint64{Key} * Uint64{0x9E3779B97F4A7C15}) >> (64 - m_Log2Capacity));
+        }
+
+        void Grow()
+        {
+            decltype(m_Slots) OldSlots{m_Slots.get_allocator()};
+            OldSlots.swap(m_Slots);
+
+            ++m_Log2Capacity;
+            m_Slots.resize(size_t{1} << m_Log2Capacity);
+            m_Count = 0;
+            for (const auto& Slot : OldSlots)
+            {
+                if (Slot.Key != InvalidKey)
+                    Insert(Slot.Key, Slot.BlockIdx);
+            }
+        }
+
+        std::vector<Slot, STDAllocatorRawMem<Slot>> m_Slots;
+
+        size_t m_Count        = 0;
+        Uint32 m_Log2Capacity = 4;
+    };
+
+public:
+    TLSFAllocationsManager(OffsetType MaxSize, IMemoryAllocator& Allocator) :
+        m_Blocks(STD_ALLOCATOR_RAW_MEM(FreeBlockInfo, Allocator, "Allocator for vector<FreeBlockInfo>")),
+        m_BlocksByOffset{Allocator},
+        m_BlocksByEnd{Allocator},
+        m_MaxSize{MaxSize},
+        m_FreeSize{MaxSize}
+    {
+        for (auto& FLHeads : m_FreeListHeads)
+            FLHeads.fill(Uint32{InvalidIndex});
+
+        if (m_MaxSize > 0)
+        {
+            // Insert single maximum-size block
+            auto BlockIdx             = AcquireBlockRecord();
+            m_Blocks[BlockIdx].Offset = 0;
+            m_Blocks[BlockIdx].Size   = m_MaxSize;
+            InsertFreeBlock(BlockIdx);
+        }
+        ResetCurrAlignment();
+
+#ifdef DILIGENT_DEBUG
+        DbgVerifyList();
+#endif
+    }
+
+    ~TLSFAllocationsManager()
+    {
+#ifdef DILIGENT_DEBUG
+        if (m_MaxSize > 0)
+        {
+            VERIFY(m_NumFreeBlocks == 1, "Single free block is expected");
+            VERIFY(m_BlocksByOffset.Find(0) != InvalidIndex, "Head chunk offset is expected to be 0");
+            VERIFY(m_BlocksByEnd.Find(m_MaxSize) == m_BlocksByOffset.Find(0), "Head chunk size is expected to be ", m_MaxSize);
+        }
+#endif
+    }
+
+    // clang-format off
+    TLSFAllocationsManager(TLSFAllocationsManager&& rhs) noexcept :
+        m_Blocks            {std::move(rhs.m_Blocks)        },
+        m_BlocksByOffset    {std::move(rhs.m_BlocksByOffset)},
+        m_BlocksByEnd       {std::move(rhs.m_BlocksByEnd)   },
+        m_FreeListHeads     {rhs.m_FreeListHeads            },
+        m_SLBitmaps         {rhs.m_SLBitmaps                },
+        m_FLBitmap          {rhs.m_FLBitmap                 },
+        m_FirstUnusedRecord {rhs.m_FirstUnusedRecord        },
+        m_NumFreeBlocks     {rhs.m_NumFreeBlocks            },
+        m_MaxSize           {rhs.m_MaxSize                  },
+        m_FreeSize          {rhs.m_FreeSize                 },
+        m_CurrAlignment     {rhs.m_CurrAlignment            }
+    {
+        // clang-format on
+        rhs.m_FLBitmap          = 0;
+        rhs.m_FirstUnusedRecord = InvalidIndex;
+        rhs.m_NumFreeBlocks     = 0;
+        rhs.m_MaxSize           = 0;
+        rhs.m_FreeSize          = 0;
+        rhs.m_CurrAlignment     = 0;
+    }
+
+    // clang-format off
+    TLSFAllocationsManager& operator = (TLSFAllocationsManager&& rhs) = default;
+    TLSFAllocationsManager             (const TLSFAllocationsManager&) = delete;
+    TLSFAllocationsManager& operator = (const TLSFAllocationsManager&) = delete;
+    // clang-format on
+
+    Allocation Allocate(OffsetType Size, OffsetType Alignment)
+    {
+        VERIFY_EXPR(Size > 0);
+        VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be power of 2");
+        Size = Align(Size, Alignment);
+        if (m_FreeSize < Size)
+            return Allocation::InvalidAllocation();
+
+        auto AlignmentReserve = (Alignment > m_CurrAlignment) ? Alignment - m_CurrAlignment : 0;
+
+        auto BlockIdx = FindFreeBlock(Size + AlignmentReserve);
+        if (BlockIdx == InvalidIndex)
+            return Allocation::InvalidAllocation();
+
+        const auto Offset    = m_Blocks[BlockIdx].Offset;
+        const auto BlockSize = m_Blocks[BlockIdx].Size;
+        VERIFY_EXPR(Size + AlignmentReserve <= BlockSize);
+
+        //        Offset                             |
+        //        |<------------BlockSize----------->|
+        //        |<------Size------>|<---NewSize--->|
+        //        |                  |
+        //      Offset              NewOffset
+        //
+        VERIFY_EXPR(Offset % m_CurrAlignment == 0);
+        auto AlignedOffset = Align(Offset, Alignment);
+        auto AdjustedSize  = Size + (AlignedOffset - Offset);
+        VERIFY_EXPR(AdjustedSize <= Size + AlignmentReserve);
+        auto NewOffset = Offset + AdjustedSize;
+        auto NewSize   = BlockSize - AdjustedSize;
+
+        RemoveFreeBlock(BlockIdx);
+        if (NewSize > 0)
+        {
+            // Reuse the record for the remaining part of the block
+            m_Blocks[BlockIdx].Offset = NewOffset;
+            m_Blocks[BlockIdx].Size   = NewSize;
+            InsertFreeBlock(BlockIdx);
+        }
+        else
+        {
+            ReleaseBlockRecord(BlockIdx);
+        }
+
+        m_FreeSize -= AdjustedSize;
+
+        if ((Size & (m_CurrAlignment - 1)) != 0)
+        {
+            if (IsPowerOfTwo(Size))
+            {
+                VERIFY_EXPR(Size >= Alignment && Size < m_CurrAlignment);
+                m_CurrAlignment = Size;
+            }
+            else
+            {
+                m_CurrAlignment = std::min(m_CurrAlignment, Alignment);
+            }
+        }
+
+#ifdef DILIGENT_DEBUG
+        DbgVerifyList();
+#endif
+        return Allocation{Offset, AdjustedSize};
+    }
+
+    void Free(Allocation&& allocation)
+    {
+        Free(allocation.UnalignedOffset, allocation.Size);
+        allocation = Allocation{};
+    }
+
+    void Free(OffsetType Offset, OffsetType Size)
+    {
+        VERIFY_EXPR(Size > 0 && Offset + Size <= m_MaxSize);
+#ifdef DILIGENT_DEBUG
+        for (const auto& Block : m_Blocks)
+        {
+            // Block being deallocated must not overlap with any free block
+            VERIFY(Block.Size == 0 || Offset + Size <= Block.Offset || Offset >= Block.Offset + Block.Size,
+                   "Block [", Offset, ", ", Offset + Size, ") overlaps with free block [", Block.Offset, ", ", Block.Offset + Block.Size, ")");
+        }
+#endif
+
+        auto NewOffset = Offset;
+        auto NewSize   = Size;
+
+        // Free block that ends where the released block starts
+        const auto PrevBlockIdx = m_BlocksByEnd.Find(Offset);
+        // Free block that starts where the released block ends
+        const auto NextBlockIdx = m_BlocksByOffset.Find(Offset + Size);
+
+        auto MergedBlockIdx = InvalidIndex;
+        if (PrevBlockIdx != InvalidIndex)
+        {
+            //  PrevBlock.Offset             Offset
+            //       |                          |
+            //       |<-----PrevBlock.Size----->|<------Size-------->|
+            //
+            NewOffset = m_Blocks[PrevBlockIdx].Offset;
+            NewSize += m_Blocks[PrevBlockIdx].Size;
+            RemoveFreeBlock(PrevBlockIdx);
+            MergedBlockIdx = PrevBlockIdx;
+        }
+
+        if (NextBlockIdx != InvalidIndex)
+        {
+            //                   Offset            NextBlock.Offset
+            //                     |                    |
+            //      ~ ~ ~ ~ ~ ~ ~  |<------Size-------->|<-----NextBlock.Size----->|
+            //
+            NewSize += m_Blocks[NextBlockIdx].Size;
+            RemoveFreeBlock(NextBlockIdx);
+            if (MergedBlockIdx == InvalidIndex)
+                MergedBlockIdx = NextBlockIdx;
+            else
+                ReleaseBlockRecord(NextBlockIdx);
+        }
+
+        if (MergedBlockIdx == InvalidIndex)
+            MergedBlockIdx = AcquireBlockRecord();
+
+        m_Blocks[MergedBlockIdx].Offset = NewOffset;
+        m_Blocks[MergedBlockIdx].Size   = NewSize;
+        InsertFreeBlock(MergedBlockIdx);
+
+        m_FreeSize += Size;
+        if (IsEmpty())
+        {
+            // Reset current alignment
+            VERIFY_EXPR(GetNumFreeBlocks() == 1);
+            ResetCurrAlignment();
+        }
+
+#ifdef DILIGENT_DEBUG
+        DbgVerifyList();
+#endif
+    }
+
+    // clang-format off
+    bool IsFull() const{ return m_FreeSize==0; };
+    bool IsEmpty()const{ return m_FreeSize==m_MaxSize; };
+    OffsetType GetMaxSize() const{return m_MaxSize;}
+    OffsetType GetFreeSize()const{return m_FreeSize;}
+    OffsetType GetUsedSize()const{return m_MaxSize - m_FreeSize;}
+    // clang-format on
+
+    size_t GetNumFreeBlocks() const
+    {
+        return m_NumFreeBlocks;
+    }
+
+    void Extend(size_t ExtraSize)
+    {
+        size_t NewBlockOffset = m_MaxSize;
+        size_t NewBlockSize   = ExtraSize;
+
+        auto BlockIdx = m_BlocksByEnd.Find(m_MaxSize);
+        if (BlockIdx != InvalidIndex)
+        {
+            // Extend the last block
+            NewBlockOffset = m_Blocks[BlockIdx].Offset;
+            NewBlockSize += m_Blocks[BlockIdx].Size;
+            RemoveFreeBlock(BlockIdx);
+        }
+        else
+        {
+            BlockIdx = AcquireBlockRecord();
+        }
+
+        m_Blocks[BlockIdx].Offset = NewBlockOffset;
+        m_Blocks[BlockIdx].Size   = NewBlockSize;
+        InsertFreeBlock(BlockIdx);
+
+        m_MaxSize += ExtraSize;
+        m_FreeSize += ExtraSize;
+
+#ifdef DILIGENT_DEBUG
+        DbgVerifyList();
+#endif
+    }
+
+private:
+    // Returns the class that Size belongs to
+    static void MappingInsert(OffsetType Size, Uint32& FL, Uint32& SL)
+    {
+        if (Size < SmallBlockSize)
+        {
+            FL = 0;
+            SL = static_cast<Uint32>(Size);
+        }
+        else
+        {
+            const auto MSB = PlatformMisc::GetMSB(Uint64{Size});
+            FL             = MSB - SLIndexBits + 1;
+            SL             = static_cast<Uint32>(Size >> (MSB - SLIndexBits)) - SLCount;
+        }
+        VERIFY_EXPR(FL < FLCount && SL < SLCount);
+    }
+
+    // Returns the smallest class whose blocks are all at least Size bytes large
+    static void MappingSearch(OffsetType Size, Uint32& FL, Uint32& SL)
+    {
+        if (Size >= SmallBlockSize)
+        {
+            const auto MSB = PlatformMisc::GetMSB(Uint64{Size});
+            Size += (OffsetType{1} << (MSB - SLIndexBits)) - 1;
+        }
+        MappingInsert(Size, FL, SL);
+    }
+
+    Uint32 FindFreeBlock(OffsetType Size) const
+    {
+        Uint32 FL = 0, SL = 0;
+        MappingSearch(Size, FL, SL);
+
+        auto SLMap = m_SLBitmaps[FL] & (~Uint32{0} << SL);
+        if (SLMap == 0)
+        {
+            const auto FLMap = (FL + 1 < FLCount) ? m_FLBitmap & (~Uint64{0} << (FL + 1)) : Uint64{0};
+            if (FLMap != 0)
+            {
+                FL    = PlatformMisc::GetLSB(FLMap);
+                SLMap = m_SLBitmaps[FL];
+                VERIFY_EXPR(SLMap != 0);
+            }
+        }
+        if (SLMap != 0)
+        {
+            SL = PlatformMisc::GetLSB(SLMap);
+            VERIFY_EXPR(m_FreeListHeads[FL][SL] != InvalidIndex && m_Blocks[m_FreeListHeads[FL][SL]].Size >= Size);
+            return m_FreeListHeads[FL][SL];
+        }
+
+        // All blocks in the classes above the one Size belongs to are too small.
+        // The only blocks that may still be large enough are in Size's own class.
+        MappingInsert(Size, FL, SL);
+        for (auto BlockIdx = m_FreeListHeads[FL][SL]; BlockIdx != InvalidIndex; BlockIdx = m_Blocks[BlockIdx].NextFree)
+        {
+            if (m_Blocks[BlockIdx].Size >= Size)
+                return BlockIdx;
+        }
+
+        return InvalidIndex;
+    }
+
+    void InsertFreeBlock(Uint32 BlockIdx)
+    {
+        auto& Block = m_Blocks[BlockIdx];
+        VERIFY_EXPR(Block.Size > 0);
+
+        Uint32 FL = 0, SL = 0;
+        MappingInsert(Block.Size, FL, SL);
+
+        auto& Head     = m_FreeListHeads[FL][SL];
+        Block.PrevFree = InvalidIndex;
+        Block.NextFree = Head;
+        if (Head != InvalidIndex)
+            m_Blocks[Head].PrevFree = BlockIdx;
+        Head = BlockIdx;
+
+        m_SLBitmaps[FL] |= Uint32{1} << SL;
+        m_FLBitmap |= Uint64{1} << FL;
+
+        m_BlocksByOffset.Insert(Block.Offset, BlockIdx);
+        m_BlocksByEnd.Insert(Block.Offset + Block.Size, BlockIdx);
+        ++m_NumFreeBlocks;
+    }
+
+    void RemoveFreeBlock(Uint32 BlockIdx)
+    {
+        auto& Block = m_Blocks[BlockIdx];
+
+        Uint32 FL = 0, SL = 0;
+        MappingInsert(Block.Size, FL, SL);
+
+        if (Block.PrevFree != InvalidIndex)
+        {
+            m_Blocks[Block.PrevFree].NextFree = Block.NextFree;
+        }
+        else
+        {
+            VERIFY_EXPR(m_FreeListHeads[FL][SL] == BlockIdx);
+            m_FreeListHeads[FL][SL] = Block.NextFree;
+            if (Block.NextFree == InvalidIndex)
+            {
+                m_SLBitmaps[FL] &= ~(Uint32{1} << SL);
+                if (m_SLBitmaps[FL] == 0)
+                    m_FLBitmap &= ~(Uint64{1} << FL);
+            }
+        }
+
+        if (Block.NextFree != InvalidIndex)
+            m_Blocks[Block.NextFree].PrevFree = Block.PrevFree;
+
+        Block.PrevFree = InvalidIndex;
+        Block.NextFree = InvalidIndex;
+
+        m_BlocksByOffset.Erase(Block.Offset);
+        m_BlocksByEnd.Erase(Block.Offset + Block.Size);
+        VERIFY_EXPR(m_NumFreeBlocks > 0);
+        --m_NumFreeBlocks;
+    }
+
+    Uint32 AcquireBlockRecord()
+    {
+        if (m_FirstUnusedRecord == InvalidIndex)
+        {
+            m_Blocks.emplace_back();
+            return static_cast<Uint32>(m_Blocks.size() - 1);
+        }
+
+        auto BlockIdx       = m_FirstUnusedRecord;
+        m_FirstUnusedRecord = m_Blocks[BlockIdx].NextFree;
+        m_Blocks[BlockIdx]  = FreeBlockInfo{};
+        return BlockIdx;
+    }
+
+    void ReleaseBlockRecord(Uint32 BlockIdx)
+    {
+        auto& Block         = m_Blocks[BlockIdx];
+        Block.Offset        = 0;
+        Block.Size          = 0;
+        Block.PrevFree      = InvalidIndex;
+        Block.NextFree      = m_FirstUnusedRecord;
+        m_FirstUnusedRecord = BlockIdx;
+    }
+
+    void ResetCurrAlignment()
+    {
+        for (m_CurrAlignment = 1; m_CurrAlignment * 2 <= m_MaxSize; m_CurrAlignment *= 2)
+        {}
+    }
+
+#ifdef DILIGENT_DEBUG
+    void DbgVerifyList()
+    {
+        OffsetType TotalFreeSize  = 0;
+        size_t     TotalNumBlocks = 0;
+
+        VERIFY_EXPR(IsPowerOfTwo(m_CurrAlignment));
+        for (Uint32 FL = 0; FL < FLCount; ++FL)
+        {
+            VERIFY_EXPR(((m_FLBitmap >> FL) & 0x01) == (m_SLBitmaps[FL] != 0 ? 1 : 0));
+            for (Uint32 SL = 0; SL < SLCount; ++SL)
+            {
+                VERIFY_EXPR(((m_SLBitmaps[FL] >> SL) & 0x01) == (m_FreeListHeads[FL][SL] != InvalidIndex ? 1 : 0));
+
+                auto PrevBlockIdx = InvalidIndex;
+                for (auto BlockIdx = m_FreeListHeads[FL][SL]; BlockIdx != InvalidIndex; BlockIdx = m_Blocks[BlockIdx].NextFree)
+                {
+                    const auto& Block = m_Blocks[BlockIdx];
+                    VERIFY_EXPR(Block.PrevFree == PrevBlockIdx);
+                    VERIFY_EXPR(Block.Size > 0 && Block.Offset + Block.Size <= m_MaxSize);
+                    VERIFY((Block.Offset & (m_CurrAlignment - 1)) == 0, "Block offset (", Block.Offset, ") is not ", m_CurrAlignment, "-aligned");
+                    if (Block.Offset + Block.Size < m_MaxSize)
+                        VERIFY((Block.Size & (m_CurrAlignment - 1)) == 0, "All block sizes except for the last one must be ", m_CurrAlignment, "-aligned");
+
+                    Uint32 BlockFL = 0, BlockSL = 0;
+                    MappingInsert(Block.Size, BlockFL, BlockSL);
+                    VERIFY(BlockFL == FL && BlockSL == SL, "Block is in the wrong free list");
+
+                    VERIFY_EXPR(m_BlocksByOffset.Find(Block.Offset) == BlockIdx);
+                    VERIFY_EXPR(m_BlocksByEnd.Find(Block.Offset + Block.Size) == BlockIdx);
+                    VERIFY(m_BlocksByEnd.Find(Block.Offset) == InvalidIndex, "Unmerged adjacent blocks detected");
+
+                    TotalFreeSize += Block.Size;
+                    ++TotalNumBlocks;
+                    PrevBlockIdx = BlockIdx;
+                }
+            }
+        }
+
+        VERIFY_EXPR(TotalNumBlocks == m_NumFreeBlocks);
+        VERIFY_EXPR(m_BlocksByOffset.GetCount() == m_NumFreeBlocks);
+        VERIFY_EXPR(m_BlocksByEnd.GetCount() == m_NumFreeBlocks);
+        VERIFY_EXPR(TotalFreeSize == m_FreeSize);
+    }
+#endif
+
+    // Block records. Only records with non-zero size describe free blocks.
+    std::vector<FreeBlockInfo, STDAllocatorRawMem<FreeBlockInfo>> m_Blocks;
+
+    // Free block start offset -> block record index
+    OffsetToBlockMap m_BlocksByOffset;
+    // Free block end offset -> block record index
+    OffsetToBlockMap m_BlocksByEnd;
+
+    std::array<std::array<Uint32, SLCount>, FLCount> m_FreeListHeads;
+    std::array<Uint32, FLCount>                      m_SLBitmaps = {};
+
+    Uint64 m_FLBitmap          = 0;
+    Uint32 m_FirstUnusedRecord = InvalidIndex;
+    size_t m_NumFreeBlocks     = 0;
+
+    OffsetType m_MaxSize       = 0;
+    OffsetType m_FreeSize      = 0;
+    OffsetType m_CurrAlignment = 0;
+    // When adding new members, do not forget to update move ctor
+};
+} // namespace Diligent
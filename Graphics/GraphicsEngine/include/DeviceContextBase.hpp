@@ -243,6 +243,8 @@ protected:
     // clang-format off
     bool DvpVerifyDrawArguments               (const DrawAttribs&                Attribs)const;
     bool DvpVerifyDrawIndexedArguments        (const DrawIndexedAttribs&         Attribs)const;
+    bool DvpVerifyMultiDrawArguments          (const MultiDrawAttribs&           Attribs)const;
+    bool DvpVerifyMultiDrawIndexedArguments   (const MultiDrawIndexedAttribs&    Attribs)const;
     bool DvpVerifyDrawMeshArguments           (const DrawMeshAttribs&            Attribs)const;
     bool DvpVerifyDrawIndirectArguments       (const DrawIndirectAttribs&        Attribs, const IBuffer* pAttribsBuffer)const;
     bool DvpVerifyDrawIndexedIndirectArguments(const DrawIndexedIndirectAttribs& Attribs, const IBuffer* pAttribsBuffer)const;
@@ -258,6 +260,8 @@ protected:
 #else
     bool DvpVerifyDrawArguments               (const DrawAttribs&                Attribs)const {return true;}
     bool DvpVerifyDrawIndexedArguments        (const DrawIndexedAttribs&         Attribs)const {return true;}
+    bool DvpVerifyMultiDrawArguments          (const MultiDrawAttribs&           Attribs)const {return true;}
+    bool DvpVerifyMultiDrawIndexedArguments   (const MultiDrawIndexedAttribs&    Attribs)const {return true;}
     bool DvpVerifyDrawMeshArguments           (const DrawMeshAttribs&            Attribs)const {return true;}
     bool DvpVerifyDrawIndirectArguments       (const DrawIndirectAttribs&        Attribs, const IBuffer* pAttribsBuffer)const {return true;}
     bool DvpVerifyDrawIndexedIndirectArguments(const DrawIndexedIndirectAttribs& Attribs, const IBuffer* pAttribsBuffer)const {return true;}
@@ -946,6 +950,8 @@ inline void DeviceContextBase<BaseInterface, ImplementationTraits>::BeginRenderP
     VERIFY(m_pBoundFramebuffer == nullptr, "Attempting to begin render pass while another framebuffer ('", m_pBoundFramebuffer->GetDesc().Name, "') is bound.");
     VERIFY(Attribs.pRenderPass != nullptr, "Render pass must not be null");
     VERIFY(Attribs.pFramebuffer != nullptr, "Framebuffer must not be null");
+    DEV_CHECK_ERR(Attribs.SubpassContents == SUBPASS_CONTENTS_INLINE || m_pDevice->GetDeviceCaps().IsVulkanDevice(),
+                  "Secondary command lists are only supported in Vulkan backend");
 #ifdef DILIGENT_DEBUG
     {
         const auto& RPDesc = Attribs.pRenderPass->GetDesc();
@@ -1511,6 +1517,86 @@ inline bool DeviceContextBase<BaseInterface, ImplementationTraits>::
     return true;
 }
 
+template <typename BaseInterface, typename ImplementationTraits>
+inline bool DeviceContextBase<BaseInterface, ImplementationTraits>::
+    DvpVerifyMultiDrawArguments(const MultiDrawAttribs& Attribs) const
+{
+    if ((Attribs.Flags & DRAW_FLAG_VERIFY_DRAW_ATTRIBS) == 0)
+        return true;
+
+    if (!m_pPipelineState)
+    {
+        LOG_ERROR_MESSAGE("MultiDraw command arguments are invalid: no pipeline state is bound.");
+        return false;
+    }
+
+    if (m_pPipelineState->GetDesc().PipelineType != PIPELINE_TYPE_GRAPHICS)
+    {
+        LOG_ERROR_MESSAGE("MultiDraw command arguments are invalid: pipeline state '", m_pPipelineState->GetDesc().Name, "' is not a graphics pipeline.");
+        return false;
+    }
+
+    if (Attribs.DrawCount != 0 && Attribs.pDrawItems == nullptr)
+    {
+        LOG_ERROR_MESSAGE("MultiDraw command arguments are invalid: DrawCount is ", Attribs.DrawCount, ", but pDrawItems is null.");
+        return false;
+    }
+
+    if (Attribs.DrawCount == 0)
+    {
+        LOG_WARNING_MESSAGE("MultiDraw command arguments are invalid: number of draws is zero.");
+    }
+
+    return true;
+}
+
+template <typename BaseInterface, typename ImplementationTraits>
+inline bool DeviceContextBase<BaseInterface, ImplementationTraits>::
+    DvpVerifyMultiDrawIndexedArguments(const MultiDrawIndexedAttribs& Attribs) const
+{
+    if ((Attribs.Flags & DRAW_FLAG_VERIFY_DRAW_ATTRIBS) == 0)
+        return true;
+
+    if (!m_pPipelineState)
+    {
+        LOG_ERROR_MESSAGE("MultiDrawIndexed command arguments are invalid: no pipeline state is bound.");
+        return false;
+    }
+
+    if (m_pPipelineState->GetDesc().PipelineType != PIPELINE_TYPE_GRAPHICS)
+    {
+        LOG_ERROR_MESSAGE("MultiDrawIndexed command arguments are invalid: pipeline state '",
+                          m_pPipelineState->GetDesc().Name, "' is not a graphics pipeline.");
+        return false;
+    }
+
+    if (Attribs.IndexType != VT_UINT16 && Attribs.IndexType != VT_UINT32)
+    {
+        LOG_ERROR_MESSAGE("MultiDrawIndexed command arguments are invalid: IndexType (",
+                          GetValueTypeString(Attribs.IndexType), ") must be VT_UINT16 or VT_UINT32.");
+        return false;
+    }
+
+    if (!m_pIndexBuffer)
+    {
+        LOG_ERROR_MESSAGE("MultiDrawIndexed command arguments are invalid: no index buffer is bound.");
+        return false;
+    }
+
+    if (Attribs.DrawCount != 0 && Attribs.pDrawItems == nullptr)
+    {
+        LOG_ERROR_MESSAGE("MultiDrawIndexed command arguments are invalid: DrawCount is ", Attribs.DrawCount, ", but pDrawItems is null.");
+        return false;
+    }
+
+    if (Attribs.DrawCount == 0)
+    {
+        LOG_WARNING_MESSAGE("MultiDrawIndexed command arguments are invalid: number of draws is zero.");
+    }
+
+    return true;
+}
+
 template <typename BaseInterface, typename ImplementationTraits>
 inline bool DeviceContextBase<BaseInterface, ImplementationTraits>::
     DvpVerifyDrawMeshArguments(const DrawMeshAttribs& Attribs) const
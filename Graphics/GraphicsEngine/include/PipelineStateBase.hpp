@@ -160,6 +160,21 @@ public:
         return *m_pGraphicsPipelineDesc;
     }
 
+    /// Implementation of IPipelineState::GetStaticVariableByInternedName().
+    /// Backends that do not provide the optimized lookup fall back to the name-based search.
+    virtual IShaderResourceVariable* DILIGENT_CALL_TYPE GetStaticVariableByInternedName(SHADER_TYPE           ShaderType,
+                                                                                        const InternedString& Name) override
+    {
+        return this->GetStaticVariableByName(ShaderType, Name.Str);
+    }
+
+    /// Implementation of IPipelineState::GetStatus().
+    /// Pipelines in backends that do not support asynchronous creation are always ready.
+    virtual PIPELINE_STATE_STATUS DILIGENT_CALL_TYPE GetStatus(bool WaitForCompletion) override
+    {
+        return PIPELINE_STATE_STATUS_READY;
+    }
+
 protected:
     Int8 GetStaticVariableCountHelper(SHADER_TYPE ShaderType, const std::array<Int8, MAX_SHADERS_IN_PIPELINE>& ResourceLayoutIndex) const
     {
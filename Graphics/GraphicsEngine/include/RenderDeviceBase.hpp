@@ -54,16 +54,16 @@ struct hash<Diligent::SamplerDesc>
     {
         // Sampler name is ignored in comparison operator
         // and should not be hashed
-        return Diligent::ComputeHash( // SamDesc.Name,
-            static_cast<int>(SamDesc.MinFilter),
-            static_cast<int>(SamDesc.MagFilter),
-            static_cast<int>(SamDesc.MipFilter),
-            static_cast<int>(SamDesc.AddressU),
-            static_cast<int>(SamDesc.AddressV),
-            static_cast<int>(SamDesc.AddressW),
+        return Diligent::ComputeHashPacked( // SamDesc.Name,
+            SamDesc.MinFilter,
+            SamDesc.MagFilter,
+            SamDesc.MipFilter,
+            SamDesc.AddressU,
+            SamDesc.AddressV,
+            SamDesc.AddressW,
             SamDesc.MipLODBias,
             SamDesc.MaxAnisotropy,
-            static_cast<int>(SamDesc.ComparisonFunc),
+            SamDesc.ComparisonFunc,
             SamDesc.BorderColor[0],
             SamDesc.BorderColor[1],
             SamDesc.BorderColor[2],
@@ -78,10 +78,10 @@ struct hash<Diligent::StencilOpDesc>
 {
     size_t operator()(const Diligent::StencilOpDesc& StOpDesc) const
     {
-        return Diligent::ComputeHash(static_cast<int>(StOpDesc.StencilFailOp),
-                                     static_cast<int>(StOpDesc.StencilDepthFailOp),
-                                     static_cast<int>(StOpDesc.StencilPassOp),
-                                     static_cast<int>(StOpDesc.StencilFunc));
+        return Diligent::ComputeHashPacked(StOpDesc.StencilFailOp,
+                                           StOpDesc.StencilDepthFailOp,
+                                           StOpDesc.StencilPassOp,
+                                           StOpDesc.StencilFunc);
     }
 };
 
@@ -91,14 +91,22 @@ struct hash<Diligent::DepthStencilStateDesc>
 {
     size_t operator()(const Diligent::DepthStencilStateDesc& DepthStencilDesc) const
     {
-        return Diligent::ComputeHash(DepthStencilDesc.DepthEnable,
-                                     DepthStencilDesc.DepthWriteEnable,
-                                     static_cast<int>(DepthStencilDesc.DepthFunc),
-                                     DepthStencilDesc.StencilEnable,
-                                     DepthStencilDesc.StencilReadMask,
-                                     DepthStencilDesc.StencilWriteMask,
-                                     DepthStencilDesc.FrontFace,
-                                     DepthStencilDesc.BackFace);
+        const auto& FrontFace = DepthStencilDesc.FrontFace;
+        const auto& BackFace  = DepthStencilDesc.BackFace;
+        return Diligent::ComputeHashPacked(DepthStencilDesc.DepthEnable,
+                                           DepthStencilDesc.DepthWriteEnable,
+                                           DepthStencilDesc.DepthFunc,
+                                           DepthStencilDesc.StencilEnable,
+                                           DepthStencilDesc.StencilReadMask,
+                                           DepthStencilDesc.StencilWriteMask,
+                                           FrontFace.StencilFailOp,
+                                           FrontFace.StencilDepthFailOp,
+                                           FrontFace.StencilPassOp,
+                                           FrontFace.StencilFunc,
+                                           BackFace.StencilFailOp,
+                                           BackFace.StencilDepthFailOp,
+                                           BackFace.StencilPassOp,
+                                           BackFace.StencilFunc);
     }
 };
 
@@ -108,15 +116,15 @@ struct hash<Diligent::RasterizerStateDesc>
 {
     size_t operator()(const Diligent::RasterizerStateDesc& RasterizerDesc) const
     {
-        return Diligent::ComputeHash(static_cast<int>(RasterizerDesc.FillMode),
-                                     static_cast<int>(RasterizerDesc.CullMode),
-                                     RasterizerDesc.FrontCounterClockwise,
-                                     RasterizerDesc.DepthBias,
-                                     RasterizerDesc.DepthBiasClamp,
-                                     RasterizerDesc.SlopeScaledDepthBias,
-                                     RasterizerDesc.DepthClipEnable,
-                                     RasterizerDesc.ScissorEnable,
-                                     RasterizerDesc.AntialiasedLineEnable);
+        return Diligent::ComputeHashPacked(RasterizerDesc.FillMode,
+                                           RasterizerDesc.CullMode,
+                                           RasterizerDesc.FrontCounterClockwise,
+                                           RasterizerDesc.DepthBias,
+                                           RasterizerDesc.DepthBiasClamp,
+                                           RasterizerDesc.SlopeScaledDepthBias,
+                                           RasterizerDesc.DepthClipEnable,
+                                           RasterizerDesc.ScissorEnable,
+                                           RasterizerDesc.AntialiasedLineEnable);
     }
 };
 
@@ -126,24 +134,22 @@ struct hash<Diligent::BlendStateDesc>
 {
     size_t operator()(const Diligent::BlendStateDesc& BSDesc) const
     {
-        std::size_t Seed = 0;
+        Diligent::HashDataPacker<sizeof(BSDesc)> Packer;
         for (size_t i = 0; i < Diligent::MAX_RENDER_TARGETS; ++i)
         {
             const auto& rt = BSDesc.RenderTargets[i];
-            Diligent::HashCombine(Seed,
-                                  rt.BlendEnable,
-                                  static_cast<int>(rt.SrcBlend),
-                                  static_cast<int>(rt.DestBlend),
-                                  static_cast<int>(rt.BlendOp),
-                                  static_cast<int>(rt.SrcBlendAlpha),
-                                  static_cast<int>(rt.DestBlendAlpha),
-                                  static_cast<int>(rt.BlendOpAlpha),
-                                  rt.RenderTargetWriteMask);
+            Packer.Add(rt.BlendEnable,
+                       rt.SrcBlend,
+                       rt.DestBlend,
+                       rt.BlendOp,
+                       rt.SrcBlendAlpha,
+                       rt.DestBlendAlpha,
+                       rt.BlendOpAlpha,
+                       rt.RenderTargetWriteMask);
         }
-        Diligent::HashCombine(Seed,
-                              BSDesc.AlphaToCoverageEnable,
-                              BSDesc.IndependentBlendEnable);
-        return Seed;
+        Packer.Add(BSDesc.AlphaToCoverageEnable,
+                   BSDesc.IndependentBlendEnable);
+        return Packer.GetHash();
     }
 };
 
@@ -154,18 +160,15 @@ struct hash<Diligent::TextureViewDesc>
 {
     size_t operator()(const Diligent::TextureViewDesc& TexViewDesc) const
     {
-        std::size_t Seed = 0;
-        Diligent::HashCombine(Seed,
-                              static_cast<Diligent::Int32>(TexViewDesc.ViewType),
-                              static_cast<Diligent::Int32>(TexViewDesc.TextureDim),
-                              static_cast<Diligent::Int32>(TexViewDesc.Format),
-                              TexViewDesc.MostDetailedMip,
-                              TexViewDesc.NumMipLevels,
-                              TexViewDesc.FirstArraySlice,
-                              TexViewDesc.NumArraySlices,
-                              static_cast<Diligent::Uint32>(TexViewDesc.AccessFlags),
-                              static_cast<Diligent::Uint32>(TexViewDesc.Flags));
-        return Seed;
+        return Diligent::ComputeHashPacked(TexViewDesc.ViewType,
+                                           TexViewDesc.TextureDim,
+                                           TexViewDesc.Format,
+                                           TexViewDesc.MostDetailedMip,
+                                           TexViewDesc.NumMipLevels,
+                                           TexViewDesc.FirstArraySlice,
+                                           TexViewDesc.NumArraySlices,
+                                           TexViewDesc.AccessFlags,
+                                           TexViewDesc.Flags);
     }
 };
 } // namespace std
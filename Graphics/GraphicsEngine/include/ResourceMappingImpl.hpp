@@ -32,8 +32,8 @@
 
 #include "ResourceMapping.h"
 #include "ObjectBase.hpp"
-#include <unordered_map>
 #include "HashUtils.hpp"
+#include "FlatHashMap.hpp"
 #include "STDAllocator.hpp"
 
 namespace Diligent
@@ -46,6 +46,12 @@ struct ResMappingHashKey
     {
     }
 
+    ResMappingHashKey(const InternedString& Str, Uint32 ArrInd) :
+        StrKey{Str},
+        ArrayIndex{ArrInd}
+    {
+    }
+
     ResMappingHashKey(ResMappingHashKey&& rhs) :
         StrKey{std::move(rhs.StrKey)},
         ArrayIndex{rhs.ArrayIndex}
@@ -60,7 +66,7 @@ struct ResMappingHashKey
     {
         if (Hash == 0)
         {
-            Hash = ComputeHash(StrKey.GetHash(), ArrayIndex);
+            Hash = ComputeHashPacked(StrKey.GetHash(), ArrayIndex);
         }
 
         return Hash;
@@ -104,7 +110,7 @@ public:
     /// \param RawMemAllocator - raw memory allocator that is used by the m_HashTable member
     ResourceMappingImpl(IReferenceCounters* pRefCounters, IMemoryAllocator& RawMemAllocator) :
         TObjectBase(pRefCounters),
-        m_HashTable(STD_ALLOCATOR_RAW_MEM(HashTableElem, RawMemAllocator, "Allocator for unordered_map< ResMappingHashKey, RefCntAutoPtr<IDeviceObject> >"))
+        m_HashTable(STD_ALLOCATOR_RAW_MEM(HashTableElem, RawMemAllocator, "Allocator for FlatHashMap< ResMappingHashKey, RefCntAutoPtr<IDeviceObject> >"))
     {}
 
     ~ResourceMappingImpl();
@@ -131,14 +137,21 @@ public:
                                                 IDeviceObject** ppResource,
                                                 Uint32          ArrayIndex) override final;
 
+    /// Implementation of IResourceMapping::GetResourceByInternedName()
+    virtual void DILIGENT_CALL_TYPE GetResourceByInternedName(const InternedString& Name,
+                                                              IDeviceObject**       ppResource,
+                                                              Uint32                ArrayIndex) override final;
+
     /// Returns number of resources in the resource mapping.
     virtual size_t DILIGENT_CALL_TYPE GetSize() override final;
 
 private:
     ThreadingTools::LockHelper Lock();
 
-    ThreadingTools::LockFlag                                                                                                                                               m_LockFlag;
-    typedef std::pair<const ResMappingHashKey, RefCntAutoPtr<IDeviceObject>>                                                                                               HashTableElem;
-    std::unordered_map<ResMappingHashKey, RefCntAutoPtr<IDeviceObject>, std::hash<ResMappingHashKey>, std::equal_to<ResMappingHashKey>, STDAllocatorRawMem<HashTableElem>> m_HashTable;
+    void FindResource(const ResMappingHashKey& Key, IDeviceObject** ppResource);
+
+    ThreadingTools::LockFlag                                                                                                                                        m_LockFlag;
+    typedef std::pair<ResMappingHashKey, RefCntAutoPtr<IDeviceObject>>                                                                                              HashTableElem;
+    FlatHashMap<ResMappingHashKey, RefCntAutoPtr<IDeviceObject>, std::hash<ResMappingHashKey>, std::equal_to<ResMappingHashKey>, STDAllocatorRawMem<HashTableElem>> m_HashTable;
 };
 } // namespace Diligent
@@ -73,6 +73,14 @@ public:
         return m_pPSO;
     }
 
+    /// Implementation of IShaderResourceBinding::GetVariableByInternedName().
+    /// Backends that do not provide the optimized lookup fall back to the name-based search.
+    virtual IShaderResourceVariable* DILIGENT_CALL_TYPE GetVariableByInternedName(SHADER_TYPE           ShaderType,
+                                                                                  const InternedString& Name) override
+    {
+        return this->GetVariableByName(ShaderType, Name.Str);
+    }
+
     template <typename PSOType>
     PSOType* GetPipelineState()
     {
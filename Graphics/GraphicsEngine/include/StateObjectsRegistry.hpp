@@ -31,8 +31,8 @@
 /// Implementation of the Diligent::StateObjectsRegistry template class
 
 #include "DeviceObject.h"
-#include <unordered_map>
 #include "STDAllocator.hpp"
+#include "FlatHashMap.hpp"
 
 namespace Diligent
 {
@@ -66,7 +66,7 @@ public:
     static constexpr int DeletedObjectsToPurge = 32;
 
     StateObjectsRegistry(IMemoryAllocator& RawAllocator, const Char* RegistryName) :
-        m_DescToObjHashMap(STD_ALLOCATOR_RAW_MEM(HashMapElem, RawAllocator, "Allocator for unordered_map<ResourceDescType, RefCntWeakPtr<IDeviceObject> >")),
+        m_DescToObjHashMap(STD_ALLOCATOR_RAW_MEM(HashMapElem, RawAllocator, "Allocator for FlatHashMap<ResourceDescType, RefCntWeakPtr<IDeviceObject> >")),
         m_RegistryName{RegistryName}
     {}
 
@@ -167,8 +167,6 @@ public:
         auto   It               = m_DescToObjHashMap.begin();
         while (It != m_DescToObjHashMap.end())
         {
-            auto NextIt = It;
-            ++NextIt;
             // Note that IsValid() is not a thread-safe function in the sense that it
             // can give false positive results. The only thread-safe way to check if the
             // object is alive is to lock the weak pointer, but that requires thread
@@ -179,11 +177,13 @@ public:
             // pointer as it will definitiely be removed next time.
             if (!It->second.IsValid())
             {
-                m_DescToObjHashMap.erase(It);
+                It = m_DescToObjHashMap.erase(It);
                 ++NumPurgedObjects;
             }
-
-            It = NextIt;
+            else
+            {
+                ++It;
+            }
         }
         LOG_INFO_MESSAGE("Purged ", NumPurgedObjects, " deleted objects from the ", m_RegistryName, " registry");
     }
@@ -204,8 +204,8 @@ private:
     Atomics::AtomicLong m_NumDeletedObjects;
 
     /// Hash map that stores weak pointers to the referenced objects
-    typedef std::pair<const ResourceDescType, RefCntWeakPtr<IDeviceObject>>                                                                                           HashMapElem;
-    std::unordered_map<ResourceDescType, RefCntWeakPtr<IDeviceObject>, std::hash<ResourceDescType>, std::equal_to<ResourceDescType>, STDAllocatorRawMem<HashMapElem>> m_DescToObjHashMap;
+    typedef std::pair<ResourceDescType, RefCntWeakPtr<IDeviceObject>>                                                                                          HashMapElem;
+    FlatHashMap<ResourceDescType, RefCntWeakPtr<IDeviceObject>, std::hash<ResourceDescType>, std::equal_to<ResourceDescType>, STDAllocatorRawMem<HashMapElem>> m_DescToObjHashMap;
 
     /// Registry name used for debug output
     const String m_RegistryName;
@@ -282,6 +282,133 @@ struct DrawIndexedAttribs
 typedef struct DrawIndexedAttribs DrawIndexedAttribs;
 
 
+/// Defines a single draw of the multi-draw command.
+
+/// This structure is used by Diligent::MultiDrawAttribs.
+struct MultiDrawItem
+{
+    /// The number of vertices to draw.
+    Uint32 NumVertices         DEFAULT_INITIALIZER(0);
+
+    /// LOCATION (or INDEX, but NOT the byte offset) of the first vertex in the
+    /// vertex buffer to start reading vertices from.
+    Uint32 StartVertexLocation DEFAULT_INITIALIZER(0);
+};
+typedef struct MultiDrawItem MultiDrawItem;
+
+
+/// Defines the multi-draw command attributes.
+
+/// This structure is used by IDeviceContext::MultiDraw().
+struct MultiDrawAttribs
+{
+    /// The number of draws in pDrawItems array.
+    Uint32               DrawCount             DEFAULT_INITIALIZER(0);
+
+    /// A pointer to the array of DrawCount draw items.
+    const MultiDrawItem* pDrawItems            DEFAULT_INITIALIZER(nullptr);
+
+    /// Additional flags, see Diligent::DRAW_FLAGS.
+    DRAW_FLAGS           Flags                 DEFAULT_INITIALIZER(DRAW_FLAG_NONE);
+
+    /// Number of instances to draw for every draw item. If more than one instance is specified,
+    /// instanced draw calls will be performed.
+    Uint32               NumInstances          DEFAULT_INITIALIZER(1);
+
+    /// LOCATION (or INDEX, but NOT the byte offset) in the vertex buffer to start
+    /// reading instance data from.
+    Uint32               FirstInstanceLocation DEFAULT_INITIALIZER(0);
+
+
+#if DILIGENT_CPP_INTERFACE
+    /// Initializes the structure members with default values.
+    MultiDrawAttribs()noexcept{}
+
+    /// Initializes the structure with user-specified values.
+    MultiDrawAttribs(Uint32               _DrawCount,
+                     const MultiDrawItem* _pDrawItems,
+                     DRAW_FLAGS           _Flags,
+                     Uint32               _NumInstances          = 1,
+                     Uint32               _FirstInstanceLocation = 0)noexcept : 
+        DrawCount            {_DrawCount            },
+        pDrawItems           {_pDrawItems           },
+        Flags                {_Flags                },
+        NumInstances         {_NumInstances         },
+        FirstInstanceLocation{_FirstInstanceLocation}
+    {}
+#endif
+};
+typedef struct MultiDrawAttribs MultiDrawAttribs;
+
+
+/// Defines a single draw of the indexed multi-draw command.
+
+/// This structure is used by Diligent::MultiDrawIndexedAttribs.
+struct MultiDrawIndexedItem
+{
+    /// The number of indices to draw.
+    Uint32 NumIndices         DEFAULT_INITIALIZER(0);
+
+    /// LOCATION (NOT the byte offset) of the first index in
+    /// the index buffer to start reading indices from.
+    Uint32 FirstIndexLocation DEFAULT_INITIALIZER(0);
+
+    /// A constant which is added to each index before accessing the vertex buffer.
+    Uint32 BaseVertex         DEFAULT_INITIALIZER(0);
+};
+typedef struct MultiDrawIndexedItem MultiDrawIndexedItem;
+
+
+/// Defines the indexed multi-draw command attributes.
+
+/// This structure is used by IDeviceContext::MultiDrawIndexed().
+struct MultiDrawIndexedAttribs
+{
+    /// The number of draws in pDrawItems array.
+    Uint32                      DrawCount             DEFAULT_INITIALIZER(0);
+
+    /// A pointer to the array of DrawCount draw items.
+    const MultiDrawIndexedItem* pDrawItems            DEFAULT_INITIALIZER(nullptr);
+
+    /// The type of elements in the index buffer.
+    /// Allowed values: VT_UINT16 and VT_UINT32.
+    VALUE_TYPE                  IndexType             DEFAULT_INITIALIZER(VT_UNDEFINED);
+
+    /// Additional flags, see Diligent::DRAW_FLAGS.
+    DRAW_FLAGS                  Flags                 DEFAULT_INITIALIZER(DRAW_FLAG_NONE);
+
+    /// Number of instances to draw for every draw item. If more than one instance is specified,
+    /// instanced draw calls will be performed.
+    Uint32                      NumInstances          DEFAULT_INITIALIZER(1);
+
+    /// LOCATION (or INDEX, but NOT the byte offset) in the vertex
+    /// buffer to start reading instance data from.
+    Uint32                      FirstInstanceLocation DEFAULT_INITIALIZER(0);
+
+
+#if DILIGENT_CPP_INTERFACE
+    /// Initializes the structure members with default values.
+    MultiDrawIndexedAttribs()noexcept{}
+
+    /// Initializes the structure members with user-specified values.
+    MultiDrawIndexedAttribs(Uint32                      _DrawCount,
+                            const MultiDrawIndexedItem* _pDrawItems,
+                            VALUE_TYPE                  _IndexType,
+                            DRAW_FLAGS                  _Flags,
+                            Uint32                      _NumInstances          = 1,
+                            Uint32                      _FirstInstanceLocation = 0)noexcept : 
+        DrawCount            {_DrawCount            },
+        pDrawItems           {_pDrawItems           },
+        IndexType            {_IndexType            },
+        Flags                {_Flags                },
+        NumInstances         {_NumInstances         },
+        FirstInstanceLocation{_FirstInstanceLocation}
+    {}
+#endif
+};
+typedef struct MultiDrawIndexedAttribs MultiDrawIndexedAttribs;
+
+
 /// Defines the indirect draw command attributes.
 
 /// This structure is used by IDeviceContext::DrawIndirect().
@@ -679,6 +806,24 @@ struct CopyTextureAttribs
 typedef struct CopyTextureAttribs CopyTextureAttribs;
 
 
+/// Defines how the commands of render pass subpasses are provided.
+
+/// This enumeration is used by BeginRenderPassAttribs structure.
+DILIGENT_TYPED_ENUM(SUBPASS_CONTENTS, Uint8)
+{
+    /// Subpass commands are recorded directly in the device context that began the render pass.
+    SUBPASS_CONTENTS_INLINE = 0,
+
+    /// Subpass commands are recorded by deferred contexts into secondary command lists
+    /// that are executed by the device context that began the render pass.
+    /// No commands other than execution of secondary command lists are allowed in the subpass.
+    ///
+    /// \note This mode is only supported in Vulkan backend, see IDeviceContextVk::BeginSecondaryCommandList()
+    ///       and IDeviceContextVk::ExecuteSecondaryCommandLists().
+    SUBPASS_CONTENTS_SECONDARY_COMMAND_LISTS
+};
+
+
 /// BeginRenderPass command attributes.
 
 /// This structure is used by IDeviceContext::BeginRenderPass().
@@ -713,6 +858,9 @@ struct BeginRenderPassAttribs
     /// internal state variables are not updated and it is the application responsibility to set them
     /// manually to match the actual states.
     RESOURCE_STATE_TRANSITION_MODE StateTransitionMode DEFAULT_INITIALIZER(RESOURCE_STATE_TRANSITION_MODE_NONE);
+
+    /// Defines how the commands of all subpasses of the render pass are provided, see Diligent::SUBPASS_CONTENTS.
+    SUBPASS_CONTENTS SubpassContents DEFAULT_INITIALIZER(SUBPASS_CONTENTS_INLINE);
 };
 typedef struct BeginRenderPassAttribs BeginRenderPassAttribs;
 
@@ -1014,6 +1162,31 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
                                      const DrawIndexedAttribs REF Attribs) PURE;
 
 
+    /// Executes a sequence of draw commands that share the same pipeline, resource and vertex buffer state.
+
+    /// \param [in] Attribs - Multi-draw command attributes, see Diligent::MultiDrawAttribs for details.
+    ///
+    /// \remarks  The draw state is committed once for the entire sequence, which makes the method
+    ///           considerably cheaper than issuing the same number of IDeviceContext::Draw() calls.
+    ///           If Diligent::DRAW_FLAG_VERIFY_STATES flag is set, the method reads the state of vertex
+    ///           buffers, so no other threads are allowed to alter the states of the same resources.
+    VIRTUAL void METHOD(MultiDraw)(THIS_
+                                   const MultiDrawAttribs REF Attribs) PURE;
+
+
+    /// Executes a sequence of indexed draw commands that share the same pipeline, resource,
+    /// vertex and index buffer state.
+
+    /// \param [in] Attribs - Multi-draw command attributes, see Diligent::MultiDrawIndexedAttribs for details.
+    ///
+    /// \remarks  The draw state is committed once for the entire sequence, which makes the method
+    ///           considerably cheaper than issuing the same number of IDeviceContext::DrawIndexed() calls.
+    ///           If Diligent::DRAW_FLAG_VERIFY_STATES flag is set, the method reads the state of vertex/index
+    ///           buffers, so no other threads are allowed to alter the states of the same resources.
+    VIRTUAL void METHOD(MultiDrawIndexed)(THIS_
+                                          const MultiDrawIndexedAttribs REF Attribs) PURE;
+
+
     /// Executes an indirect draw command.
 
     /// \param [in] Attribs        - Structure describing the command attributes, see Diligent::DrawIndirectAttribs for details.
@@ -1513,6 +1686,8 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContext_SetRenderTargets(This, ...)          CALL_IFACE_METHOD(DeviceContext, SetRenderTargets,          This, __VA_ARGS__)
 #    define IDeviceContext_Draw(This, ...)                      CALL_IFACE_METHOD(DeviceContext, Draw,                      This, __VA_ARGS__)
 #    define IDeviceContext_DrawIndexed(This, ...)               CALL_IFACE_METHOD(DeviceContext, DrawIndexed,               This, __VA_ARGS__)
+#    define IDeviceContext_MultiDraw(This, ...)                 CALL_IFACE_METHOD(DeviceContext, MultiDraw,                 This, __VA_ARGS__)
+#    define IDeviceContext_MultiDrawIndexed(This, ...)          CALL_IFACE_METHOD(DeviceContext, MultiDrawIndexed,          This, __VA_ARGS__)
 #    define IDeviceContext_DrawIndirect(This, ...)              CALL_IFACE_METHOD(DeviceContext, DrawIndirect,              This, __VA_ARGS__)
 #    define IDeviceContext_DrawIndexedIndirect(This, ...)       CALL_IFACE_METHOD(DeviceContext, DrawIndexedIndirect,       This, __VA_ARGS__)
 #    define IDeviceContext_DispatchCompute(This, ...)           CALL_IFACE_METHOD(DeviceContext, DispatchCompute,           This, __VA_ARGS__)
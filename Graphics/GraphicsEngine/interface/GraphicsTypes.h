@@ -1899,6 +1899,21 @@ struct EngineGLCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
 
     /// Setting this to true is typically needed for testing purposes only.
     bool ForceNonSeparablePrograms DEFAULT_INITIALIZER(false);
+
+    /// Size of the persistently mapped ring buffer that the immediate context uses
+    /// to suballocate memory for dynamic uniform buffers.
+
+    /// The ring buffer requires GL 4.4 or GL_ARB_buffer_storage extension. When it is
+    /// not available or the size is zero, every dynamic buffer keeps its own storage.
+    Uint32 DynamicHeapSize DEFAULT_INITIALIZER(4 << 20);
+
+    /// Directory where linked program binaries are cached between runs.
+
+    /// When the directory is set and the driver supports at least one program binary
+    /// format, programs are retrieved with glGetProgramBinary() after linking and are
+    /// loaded with glProgramBinary() next time the same shaders are used. Entries the
+    /// driver rejects (e.g. after a driver update) are silently recompiled.
+    const Char* ProgramCacheDirectory DEFAULT_INITIALIZER(nullptr);
 };
 typedef struct EngineGLCreateInfo EngineGLCreateInfo;
 
@@ -2212,6 +2227,12 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// pages when resources are released
     Uint32 HostVisibleMemoryReserveSize     DEFAULT_INITIALIZER(256 << 20);
 
+    /// Whether memory pages should be suballocated with the TLSF (two-level segregated fit)
+    /// allocator. Allocation and release take constant time regardless of the number of free
+    /// blocks in a page, at the cost of slightly higher fragmentation than the default
+    /// best-fit allocator.
+    Bool   UseTLSFMemoryAllocator           DEFAULT_INITIALIZER(False);
+
     /// Page size of the upload heap that is allocated by immediate/deferred
     /// contexts from the global memory manager to perform lock-free dynamic
     /// suballocations.
@@ -2244,6 +2265,33 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// Path to DirectX Shader Compiler, which is required to use Shader Model 6.0+
     /// features when compiling shaders from HLSL.
     const char* pDxCompilerPath DEFAULT_INITIALIZER(nullptr);
+
+    /// Pipeline cache data previously retrieved with IRenderDeviceVk::GetPipelineCacheData().
+
+    /// The data is used to initialize the pipeline cache that the device uses to create
+    /// all pipelines. If the data was produced by a different device or driver version,
+    /// it is ignored and an empty cache is created. The engine does not keep the pointer
+    /// after the device has been created.
+    const void* pPipelineCacheData      DEFAULT_INITIALIZER(nullptr);
+
+    /// Size of the pipeline cache data, in bytes.
+    size_t      PipelineCacheDataSize   DEFAULT_INITIALIZER(0);
+
+    /// Maximum total size, in bytes, of SPIR-V bytecode kept in the in-memory tier of the shader
+    /// compilation cache. Shaders created from identical sources with identical macros are compiled
+    /// only once. If both the memory size is 0 and the cache directory is null, the cache is disabled,
+    /// which is the default.
+    Uint32      SPIRVCacheMemorySize    DEFAULT_INITIALIZER(0);
+
+    /// Optional directory where compiled SPIR-V bytecode is stored to be reused by subsequent runs.
+    /// The directory is created if it does not exist. The engine does not keep the pointer
+    /// after the device has been created.
+    const char* SPIRVCacheDirectory     DEFAULT_INITIALIZER(nullptr);
+
+    /// The number of worker threads used to create pipeline states with
+    /// PSO_CREATE_FLAG_ASYNCHRONOUS flag. If 0, one thread per hardware thread, less one,
+    /// is used. The threads are started when the first asynchronous pipeline is created.
+    Uint32      NumAsyncPipelineThreads DEFAULT_INITIALIZER(0);
 };
 typedef struct EngineVkCreateInfo EngineVkCreateInfo;
 
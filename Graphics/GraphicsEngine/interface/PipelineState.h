@@ -277,10 +277,38 @@ DILIGENT_TYPED_ENUM(PSO_CREATE_FLAGS, Uint32)
     /// that is not found in any of the designated shader stages.
     /// Use this flag to silence these warnings.
     PSO_CREATE_FLAG_IGNORE_MISSING_IMMUTABLE_SAMPLERS = 0x02,
+
+    /// Create the pipeline asynchronously.
+
+    /// The pipeline state object is returned immediately and the expensive part of the
+    /// initialization (shader module and pipeline creation) is performed by the worker threads
+    /// owned by the render device. Use IPipelineState::GetStatus() to check if the
+    /// pipeline is ready. Static variables can be accessed and shader resource binding objects
+    /// can be created right away, but the pipeline must not be bound to the context until it
+    /// is ready; otherwise the context waits for the pipeline to be created.
+    /// In OpenGL, separable programs are linked in the background by the driver when
+    /// GL_KHR_parallel_shader_compile is supported, and IPipelineState::GetStatus() must be
+    /// called from the thread that owns the GL context.
+    /// Backends that do not support asynchronous creation ignore this flag.
+    PSO_CREATE_FLAG_ASYNCHRONOUS                      = 0x04,
 };
 DEFINE_FLAG_ENUM_OPERATORS(PSO_CREATE_FLAGS);
 
 
+/// Pipeline state status, see IPipelineState::GetStatus().
+DILIGENT_TYPED_ENUM(PIPELINE_STATE_STATUS, Uint8)
+{
+    /// The pipeline is being created asynchronously.
+    PIPELINE_STATE_STATUS_COMPILING = 0,
+
+    /// The pipeline is ready to be used.
+    PIPELINE_STATE_STATUS_READY,
+
+    /// Asynchronous pipeline creation failed. The pipeline can't be used.
+    PIPELINE_STATE_STATUS_FAILED
+};
+
+
 /// Pipeline state creation attributes
 struct PipelineStateCreateInfo
 {
@@ -398,6 +426,19 @@ DILIGENT_BEGIN_INTERFACE(IPipelineState, IDeviceObject)
                                                                      const Char* Name) PURE;
 
 
+    /// Returns static shader resource variable using the interned variable name.
+    /// If the variable is not found, returns nullptr.
+
+    /// \param [in] ShaderType - Type of the shader to look up the variable.
+    ///                          Must be one of Diligent::SHADER_TYPE.
+    /// \param [in] Name       - Interned variable name, see Diligent::InternedStringPool.
+    /// \remark The method does not increment the reference counter
+    ///         of the returned interface.
+    VIRTUAL IShaderResourceVariable* METHOD(GetStaticVariableByInternedName)(THIS_
+                                                                             SHADER_TYPE                ShaderType,
+                                                                             const InternedString REF Name) PURE;
+
+
     /// Returns static shader resource variable by its index.
 
     /// \param [in] ShaderType - Type of the shader to look up the variable. 
@@ -441,6 +482,16 @@ DILIGENT_BEGIN_INTERFACE(IPipelineState, IDeviceObject)
     ///             into account vertex shader input layout, number of outputs, etc.
     VIRTUAL bool METHOD(IsCompatibleWith)(THIS_
                                           const struct IPipelineState* pPSO) CONST PURE;
+
+
+    /// Returns the pipeline state status, see Diligent::PIPELINE_STATE_STATUS.
+
+    /// \param [in] WaitForCompletion - if true, the method blocks until asynchronous
+    ///                                 pipeline creation is complete.
+    /// \return     The status of the pipeline. Pipelines that were created synchronously
+    ///             are always in PIPELINE_STATE_STATUS_READY state.
+    VIRTUAL PIPELINE_STATE_STATUS METHOD(GetStatus)(THIS_
+                                                    bool WaitForCompletion DEFAULT_VALUE(false)) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -452,13 +503,15 @@ DILIGENT_END_INTERFACE
 
 #    define IPipelineState_GetDesc(This) (const struct PipelineStateDesc*)IDeviceObject_GetDesc(This)
 
-#    define IPipelineState_GetGraphicsPipelineDesc(This)          CALL_IFACE_METHOD(PipelineState, GetGraphicsPipelineDesc,     This)
-#    define IPipelineState_BindStaticResources(This, ...)         CALL_IFACE_METHOD(PipelineState, BindStaticResources,         This, __VA_ARGS__)
-#    define IPipelineState_GetStaticVariableCount(This, ...)      CALL_IFACE_METHOD(PipelineState, GetStaticVariableCount,      This, __VA_ARGS__)
-#    define IPipelineState_GetStaticVariableByName(This, ...)     CALL_IFACE_METHOD(PipelineState, GetStaticVariableByName,     This, __VA_ARGS__)
-#    define IPipelineState_GetStaticVariableByIndex(This, ...)    CALL_IFACE_METHOD(PipelineState, GetStaticVariableByIndex,    This, __VA_ARGS__)
-#    define IPipelineState_CreateShaderResourceBinding(This, ...) CALL_IFACE_METHOD(PipelineState, CreateShaderResourceBinding, This, __VA_ARGS__)
-#    define IPipelineState_IsCompatibleWith(This, ...)            CALL_IFACE_METHOD(PipelineState, IsCompatibleWith,            This, __VA_ARGS__)
+#    define IPipelineState_GetGraphicsPipelineDesc(This)              CALL_IFACE_METHOD(PipelineState, GetGraphicsPipelineDesc,         This)
+#    define IPipelineState_BindStaticResources(This, ...)             CALL_IFACE_METHOD(PipelineState, BindStaticResources,             This, __VA_ARGS__)
+#    define IPipelineState_GetStaticVariableCount(This, ...)          CALL_IFACE_METHOD(PipelineState, GetStaticVariableCount,          This, __VA_ARGS__)
+#    define IPipelineState_GetStaticVariableByName(This, ...)         CALL_IFACE_METHOD(PipelineState, GetStaticVariableByName,         This, __VA_ARGS__)
+#    define IPipelineState_GetStaticVariableByInternedName(This, ...) CALL_IFACE_METHOD(PipelineState, GetStaticVariableByInternedName, This, __VA_ARGS__)
+#    define IPipelineState_GetStaticVariableByIndex(This, ...)        CALL_IFACE_METHOD(PipelineState, GetStaticVariableByIndex,        This, __VA_ARGS__)
+#    define IPipelineState_CreateShaderResourceBinding(This, ...)     CALL_IFACE_METHOD(PipelineState, CreateShaderResourceBinding,     This, __VA_ARGS__)
+#    define IPipelineState_IsCompatibleWith(This, ...)                CALL_IFACE_METHOD(PipelineState, IsCompatibleWith,                This, __VA_ARGS__)
+#    define IPipelineState_GetStatus(This, ...)                       CALL_IFACE_METHOD(PipelineState, GetStatus,                       This, __VA_ARGS__)
 
 // clang-format on
 
@@ -30,6 +30,7 @@
 /// \file
 /// Definition of the Diligent::IResourceMapping interface and related data structures
 
+#include "../../../Primitives/interface/InternedString.h"
 #include "DeviceObject.h"
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
@@ -164,6 +165,24 @@ DILIGENT_BEGIN_INTERFACE(IResourceMapping, IObject)
                                      IDeviceObject** ppResource,
                                      Uint32          ArrayIndex DEFAULT_VALUE(0)) PURE;
 
+    /// Finds a resource in the mapping using the interned resource name.
+
+    /// \param [in] Name - Interned resource name, see Diligent::InternedStringPool.
+    /// \param [in] ArrayIndex - for arrays, index of the array element.
+    /// \param [out] ppResource - Address of the memory location where the pointer
+    ///                           to the object with the given name will be written.
+    ///                           If no object is found, nullptr will be written.
+    /// \remarks The method increases the reference counter
+    ///          of the returned object, so Release() must be called.
+    ///
+    /// \remarks Resource names are interned in the global string pool when resources are added
+    ///          to the mapping. If the name was interned in the same pool, the lookup does not
+    ///          compare or rehash strings.
+    VIRTUAL void METHOD(GetResourceByInternedName)(THIS_
+                                                   const InternedString REF Name,
+                                                   IDeviceObject**          ppResource,
+                                                   Uint32                   ArrayIndex DEFAULT_VALUE(0)) PURE;
+
     /// Returns the size of the resource mapping, i.e. the number of objects.
     VIRTUAL size_t METHOD(GetSize)(THIS) PURE;
 };
@@ -175,11 +194,12 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define IResourceMapping_AddResource(This, ...)          CALL_IFACE_METHOD(ResourceMapping, AddResource,          This, __VA_ARGS__)
-#    define IResourceMapping_AddResourceArray(This, ...)     CALL_IFACE_METHOD(ResourceMapping, AddResourceArray,     This, __VA_ARGS__)
-#    define IResourceMapping_RemoveResourceByName(This, ...) CALL_IFACE_METHOD(ResourceMapping, RemoveResourceByName, This, __VA_ARGS__)
-#    define IResourceMapping_GetResource(This, ...)          CALL_IFACE_METHOD(ResourceMapping, GetResource,          This, __VA_ARGS__)
-#    define IResourceMapping_GetSize(This)                   CALL_IFACE_METHOD(ResourceMapping, GetSize,              This)
+#    define IResourceMapping_AddResource(This, ...)               CALL_IFACE_METHOD(ResourceMapping, AddResource,               This, __VA_ARGS__)
+#    define IResourceMapping_AddResourceArray(This, ...)          CALL_IFACE_METHOD(ResourceMapping, AddResourceArray,          This, __VA_ARGS__)
+#    define IResourceMapping_RemoveResourceByName(This, ...)      CALL_IFACE_METHOD(ResourceMapping, RemoveResourceByName,      This, __VA_ARGS__)
+#    define IResourceMapping_GetResource(This, ...)               CALL_IFACE_METHOD(ResourceMapping, GetResource,               This, __VA_ARGS__)
+#    define IResourceMapping_GetResourceByInternedName(This, ...) CALL_IFACE_METHOD(ResourceMapping, GetResourceByInternedName, This, __VA_ARGS__)
+#    define IResourceMapping_GetSize(This)                        CALL_IFACE_METHOD(ResourceMapping, GetSize,                   This)
 
 // clang-format on
 
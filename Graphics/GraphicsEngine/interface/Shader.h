@@ -319,6 +319,9 @@ struct ShaderCreateInfo
     /// The buffer contains two null-terminated strings. The first one is the compiler
     /// output message. The second one is the full shader source code including definitions added
     /// by the engine. Data blob object must be released by the client.
+    /// In Vulkan, if the SPIR-V bytecode is found in the shader compilation cache
+    /// (see EngineVkCreateInfo::SPIRVCacheMemorySize), the compiler does not run
+    /// and null is written to this address.
     IDataBlob** ppCompilerOutput DEFAULT_INITIALIZER(nullptr);
 };
 typedef struct ShaderCreateInfo ShaderCreateInfo;
@@ -85,6 +85,19 @@ DILIGENT_BEGIN_INTERFACE(IShaderResourceBinding, IObject)
                                                                SHADER_TYPE ShaderType,
                                                                const char* Name) PURE;
 
+    /// Returns variable using the interned variable name
+
+    /// \param [in] ShaderType - Type of the shader to look up the variable.
+    ///                          Must be one of Diligent::SHADER_TYPE.
+    /// \param [in] Name       - Interned variable name, see Diligent::InternedStringPool.
+    ///
+    /// \note  The method avoids string comparisons by using the precomputed name hash.
+    ///        Backends that do not implement the optimized lookup fall back to
+    ///        IShaderResourceBinding::GetVariableByName().
+    VIRTUAL IShaderResourceVariable* METHOD(GetVariableByInternedName)(THIS_
+                                                                       SHADER_TYPE                ShaderType,
+                                                                       const InternedString REF Name) PURE;
+
     /// Returns the total variable count for the specific shader stage.
 
     /// \param [in] ShaderType - Type of the shader.
@@ -140,6 +153,7 @@ DILIGENT_END_INTERFACE
 #    define IShaderResourceBinding_GetPipelineState(This)               CALL_IFACE_METHOD(ShaderResourceBinding, GetPipelineState,          This)
 #    define IShaderResourceBinding_BindResources(This, ...)             CALL_IFACE_METHOD(ShaderResourceBinding, BindResources,             This, __VA_ARGS__)
 #    define IShaderResourceBinding_GetVariableByName(This, ...)         CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableByName,         This, __VA_ARGS__)
+#    define IShaderResourceBinding_GetVariableByInternedName(This, ...) CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableByInternedName, This, __VA_ARGS__)
 #    define IShaderResourceBinding_GetVariableCount(This, ...)          CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableCount,          This, __VA_ARGS__)
 #    define IShaderResourceBinding_GetVariableByIndex(This, ...)        CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableByIndex,        This, __VA_ARGS__)
 #    define IShaderResourceBinding_InitializeStaticResources(This, ...) CALL_IFACE_METHOD(ShaderResourceBinding, InitializeStaticResources, This, __VA_ARGS__)
@@ -28,6 +28,7 @@
 #include "pch.h"
 #include "ResourceMappingImpl.hpp"
 #include "DeviceObjectBase.hpp"
+#include "InternedStringPool.hpp"
 
 using namespace std;
 
@@ -49,6 +50,10 @@ void ResourceMappingImpl::AddResourceArray(const Char* Name, Uint32 StartIndex,
     if (Name == nullptr || *Name == 0)
         return;
 
+    // Interned strings are never released, so the keys can reference the
+    // pooled string without making a copy
+    const auto& InternedName = InternString(Name);
+
     auto LockHelper = Lock();
     for (Uint32 Elem = 0; Elem < NumElements; ++Elem)
     {
@@ -57,7 +62,7 @@ void ResourceMappingImpl::AddResourceArray(const Char* Name, Uint32 StartIndex,
         // Try to construct new element in place
         auto Elems =
             m_HashTable.emplace(
-                make_pair(Diligent::ResMappingHashKey(Name, true, StartIndex + Elem), // Make a copy of the source string
+                make_pair(Diligent::ResMappingHashKey(InternedName, StartIndex + Elem),
                           Diligent::RefCntAutoPtr<IDeviceObject>(pObject)));
         // If there is already element with the same name, replace it
         if (!Elems.second && Elems.first->second != pObject)
@@ -101,14 +106,38 @@ void ResourceMappingImpl::GetResource(const Char* Name, IDeviceObject** ppResour
     if (!ppResource)
         return;
 
+    // Find an object with the requested name
+    // Name will be implicitly converted to HashMapStringKey without making a copy
+    FindResource(ResMappingHashKey(Name, false, ArrayIndex), ppResource);
+}
+
+void ResourceMappingImpl::GetResourceByInternedName(const InternedString& Name, IDeviceObject** ppResource, Uint32 ArrayIndex)
+{
+    VERIFY(ppResource, "Null pointer provided");
+    if (!ppResource)
+        return;
+
+    // Always clear the output, even if the name is empty and nothing is found
+    VERIFY(*ppResource == nullptr, "Overwriting reference to existing object may cause memory leaks");
+    *ppResource = nullptr;
+
+    VERIFY(Name.Str, "Name is null");
+    if (Name.Length == 0)
+        return;
+
+    // If the name was interned in the global pool, the key string pointer matches
+    // the pointer stored in the hash table and no string comparison is performed
+    FindResource(ResMappingHashKey(Name, ArrayIndex), ppResource);
+}
+
+void ResourceMappingImpl::FindResource(const ResMappingHashKey& Key, IDeviceObject** ppResource)
+{
     VERIFY(*ppResource == nullptr, "Overwriting reference to existing object may cause memory leaks");
     *ppResource = nullptr;
 
     auto LockHelper = Lock();
 
-    // Find an object with the requested name
-    // Name will be implicitly converted to HashMapStringKey without making a copy
-    auto It = m_HashTable.find(ResMappingHashKey(Name, false, ArrayIndex));
+    auto It = m_HashTable.find(Key);
     if (It != m_HashTable.end())
     {
         *ppResource = It->second.RawPtr();
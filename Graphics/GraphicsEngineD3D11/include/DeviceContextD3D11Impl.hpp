@@ -138,6 +138,12 @@ public:
     virtual void DILIGENT_CALL_TYPE Draw(const DrawAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexed() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE DrawIndexed(const DrawIndexedAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::MultiDraw() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE MultiDraw(const MultiDrawAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::MultiDrawIndexed() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndirect() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE DrawIndirect(const DrawIndirectAttribs& Attribs, IBuffer* pAttribsBuffer) override final;
     /// Implementation of IDeviceContext::DrawIndexedIndirect() in Direct3D11 backend.
@@ -860,6 +860,48 @@ void DeviceContextD3D11Impl::DrawIndexed(const DrawIndexedAttribs& Attribs)
         m_pd3d11DeviceContext->DrawIndexed(Attribs.NumIndices, Attribs.FirstIndexLocation, Attribs.BaseVertex);
 }
 
+void DeviceContextD3D11Impl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    if (!DvpVerifyMultiDrawArguments(Attribs))
+        return;
+
+    if (Attribs.DrawCount == 0)
+        return;
+
+    PrepareForDraw(Attribs.Flags);
+
+    const bool IsInstanced = Attribs.NumInstances > 1 || Attribs.FirstInstanceLocation != 0;
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        const auto& Item = Attribs.pDrawItems[i];
+        if (IsInstanced)
+            m_pd3d11DeviceContext->DrawInstanced(Item.NumVertices, Attribs.NumInstances, Item.StartVertexLocation, Attribs.FirstInstanceLocation);
+        else
+            m_pd3d11DeviceContext->Draw(Item.NumVertices, Item.StartVertexLocation);
+    }
+}
+
+void DeviceContextD3D11Impl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    if (!DvpVerifyMultiDrawIndexedArguments(Attribs))
+        return;
+
+    if (Attribs.DrawCount == 0)
+        return;
+
+    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+
+    const bool IsInstanced = Attribs.NumInstances > 1 || Attribs.FirstInstanceLocation != 0;
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        const auto& Item = Attribs.pDrawItems[i];
+        if (IsInstanced)
+            m_pd3d11DeviceContext->DrawIndexedInstanced(Item.NumIndices, Attribs.NumInstances, Item.FirstIndexLocation, Item.BaseVertex, Attribs.FirstInstanceLocation);
+        else
+            m_pd3d11DeviceContext->DrawIndexed(Item.NumIndices, Item.FirstIndexLocation, Item.BaseVertex);
+    }
+}
+
 void DeviceContextD3D11Impl::DrawIndirect(const DrawIndirectAttribs& Attribs, IBuffer* pAttribsBuffer)
 {
     if (!DvpVerifyDrawIndirectArguments(Attribs, pAttribsBuffer))
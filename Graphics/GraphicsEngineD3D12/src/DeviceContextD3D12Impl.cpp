@@ -519,6 +519,42 @@ void DeviceContextD3D12Impl::DrawIndexed(const DrawIndexedAttribs& Attribs)
     ++m_State.NumCommands;
 }
 
+void DeviceContextD3D12Impl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    if (!DvpVerifyMultiDrawArguments(Attribs))
+        return;
+
+    if (Attribs.DrawCount == 0)
+        return;
+
+    auto& GraphCtx = GetCmdContext().AsGraphicsContext();
+    PrepareForDraw(GraphCtx, Attribs.Flags);
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        const auto& Item = Attribs.pDrawItems[i];
+        GraphCtx.Draw(Item.NumVertices, Attribs.NumInstances, Item.StartVertexLocation, Attribs.FirstInstanceLocation);
+    }
+    m_State.NumCommands += Attribs.DrawCount;
+}
+
+void DeviceContextD3D12Impl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    if (!DvpVerifyMultiDrawIndexedArguments(Attribs))
+        return;
+
+    if (Attribs.DrawCount == 0)
+        return;
+
+    auto& GraphCtx = GetCmdContext().AsGraphicsContext();
+    PrepareForIndexedDraw(GraphCtx, Attribs.Flags, Attribs.IndexType);
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        const auto& Item = Attribs.pDrawItems[i];
+        GraphCtx.DrawIndexed(Item.NumIndices, Attribs.NumInstances, Item.FirstIndexLocation, Item.BaseVertex, Attribs.FirstInstanceLocation);
+    }
+    m_State.NumCommands += Attribs.DrawCount;
+}
+
 void DeviceContextD3D12Impl::PrepareDrawIndirectBuffer(GraphicsContext&               GraphCtx,
                                                        IBuffer*                       pAttribsBuffer,
                                                        RESOURCE_STATE_TRANSITION_MODE BufferStateTransitionMode,
@@ -35,6 +35,7 @@
 #include <vector>
 #include <atomic>
 #include "VariableSizeAllocationsManager.hpp"
+#include "TLSFAllocationsManager.hpp"
 #include "RingBuffer.hpp"
 
 namespace Diligent
@@ -95,11 +96,14 @@ private:
 };
 
 
+// AllocationsMgrType is the type of the manager that suballocates master blocks from the
+// buffer. It must be either VariableSizeAllocationsManager or TLSFAllocationsManager.
+template <typename AllocationsMgrType = VariableSizeAllocationsManager>
 class MasterBlockListBasedManager
 {
 public:
-    using OffsetType  = VariableSizeAllocationsManager::OffsetType;
-    using MasterBlock = VariableSizeAllocationsManager::Allocation;
+    using OffsetType  = typename AllocationsMgrType::OffsetType;
+    using MasterBlock = typename AllocationsMgrType::Allocation;
 
     MasterBlockListBasedManager(IMemoryAllocator& Allocator,
                                 Uint32            Size) :
@@ -196,8 +200,8 @@ protected:
     }
 
 private:
-    std::mutex                     m_AllocationsMgrMtx;
-    VariableSizeAllocationsManager m_AllocationsMgr;
+    std::mutex         m_AllocationsMgrMtx;
+    AllocationsMgrType m_AllocationsMgr;
 
 #ifdef DILIGENT_DEVELOPMENT
     std::atomic_int32_t m_MasterBlockCounter;
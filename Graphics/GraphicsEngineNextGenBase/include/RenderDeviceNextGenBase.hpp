@@ -230,7 +230,7 @@ public:
         return CmdBuffInfo;
     }
 
-    ResourceReleaseQueue<DynamicStaleResourceWrapper>& GetReleaseQueue(Uint32 QueueIndex)
+    MPSCResourceReleaseQueue<DynamicStaleResourceWrapper>& GetReleaseQueue(Uint32 QueueIndex)
     {
         VERIFY_EXPR(QueueIndex < m_CmdQueueCount);
         return m_CommandQueues[QueueIndex].ReleaseQueue;
@@ -314,10 +314,10 @@ protected:
         CommandQueue& operator = (      CommandQueue&&) = delete;
         // clang-format on
 
-        std::mutex                                        Mtx;
-        Atomics::AtomicInt64                              NextCmdBufferNumber;
-        RefCntAutoPtr<CommandQueueType>                   CmdQueue;
-        ResourceReleaseQueue<DynamicStaleResourceWrapper> ReleaseQueue;
+        std::mutex                                            Mtx;
+        Atomics::AtomicInt64                                  NextCmdBufferNumber;
+        RefCntAutoPtr<CommandQueueType>                       CmdQueue;
+        MPSCResourceReleaseQueue<DynamicStaleResourceWrapper> ReleaseQueue;
     };
     const size_t  m_CmdQueueCount = 0;
     CommandQueue* m_CommandQueues = nullptr;
@@ -76,7 +76,9 @@ public:
 
     void BufferMemoryBarrier(Uint32 RequiredBarriers, class GLContextState& GLContextState);
 
-    const GLObjectWrappers::GLBufferObj& GetGLHandle() { return m_GlBuffer; }
+    /// Returns the GL buffer that currently holds the buffer contents. For dynamic buffers
+    /// suballocated from the context's ring buffer, this is the ring buffer.
+    const GLObjectWrappers::GLBufferObj& GetGLHandle() { return m_pDynamicGLBuffer != nullptr ? *m_pDynamicGLBuffer : m_GlBuffer; }
 
     /// Implementation of IBufferGL::GetGLBufferHandle().
     virtual GLuint DILIGENT_CALL_TYPE GetGLBufferHandle() override final { return GetGLHandle(); }
@@ -96,6 +98,12 @@ private:
     GLObjectWrappers::GLBufferObj m_GlBuffer;
     const Uint32                  m_BindTarget;
     const GLenum                  m_GLUsageHint;
+
+    // Dynamic allocation in the device context's persistently mapped ring buffer.
+    // When m_pDynamicGLBuffer is null, the contents live in m_GlBuffer.
+    const GLObjectWrappers::GLBufferObj* m_pDynamicGLBuffer = nullptr;
+    Uint32                               m_DynamicOffset    = 0;
+    Uint64                               m_DynamicFrame     = 0;
 };
 
 } // namespace Diligent
@@ -28,6 +28,8 @@
 #pragma once
 
 #include <vector>
+#include <memory>
+#include <utility>
 
 #include "DeviceContextGL.h"
 #include "DeviceContextBase.hpp"
@@ -40,6 +42,7 @@
 #include "FramebufferGLImpl.hpp"
 #include "RenderPassGLImpl.hpp"
 #include "PipelineStateGLImpl.hpp"
+#include "GLDynamicRingBuffer.hpp"
 
 namespace Diligent
 {
@@ -61,7 +64,11 @@ class DeviceContextGLImpl final : public DeviceContextBase<IDeviceContextGL, Dev
 public:
     using TDeviceContextBase = DeviceContextBase<IDeviceContextGL, DeviceContextGLImplTraits>;
 
-    DeviceContextGLImpl(IReferenceCounters* pRefCounters, RenderDeviceGLImpl* pDeviceGL, bool bIsDeferred);
+    DeviceContextGLImpl(IReferenceCounters*       pRefCounters,
+                        RenderDeviceGLImpl*       pDeviceGL,
+                        bool                      bIsDeferred,
+                        const EngineGLCreateInfo& EngineCI);
+    ~DeviceContextGLImpl();
 
     /// Queries the specific interface, see IObject::QueryInterface() for details.
     virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override final;
@@ -131,6 +138,10 @@ public:
     virtual void DILIGENT_CALL_TYPE Draw               (const DrawAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexed() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE DrawIndexed        (const DrawIndexedAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDraw() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE MultiDraw          (const MultiDrawAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDrawIndexed() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE MultiDrawIndexed   (const MultiDrawIndexedAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndirect() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE DrawIndirect       (const DrawIndirectAttribs& Attribs, IBuffer* pAttribsBuffer) override final;
     /// Implementation of IDeviceContext::DrawIndexedIndirect() in OpenGL backend.
@@ -254,6 +265,9 @@ public:
 
     virtual void DILIGENT_CALL_TYPE SetSwapChain(ISwapChainGL* pSwapChain) override final;
 
+    /// Implementation of IDeviceContextGL::GetBindingStatistics().
+    virtual void DILIGENT_CALL_TYPE GetBindingStatistics(BindingStatisticsGL& LastFrameStats, BindingStatisticsGL& TotalStats) const override final;
+
     virtual void ResetRenderTargets() override final;
 
 
@@ -269,6 +283,11 @@ private:
     __forceinline void PrepareForIndexedDraw(VALUE_TYPE IndexType, Uint32 FirstIndexLocation, GLenum& GLIndexType, Uint32& FirstIndexByteOffset);
     __forceinline void PrepareForIndirectDraw(IBuffer* pAttribsBuffer);
     __forceinline void PostDraw();
+    __forceinline void BindDynamicUniformBuffers();
+
+    // Detaches the buffers from their ring buffer allocations. If PreserveContents is true,
+    // the contents are copied to the buffers' own storage first.
+    void ReleaseRingAllocations(bool PreserveContents);
 
     void BeginSubpass();
     void EndSubpass();
@@ -278,6 +297,28 @@ private:
     std::vector<class TextureBaseGL*> m_BoundWritableTextures;
     std::vector<class BufferGLImpl*>  m_BoundWritableBuffers;
 
+    // Persistently mapped ring buffer that dynamic uniform buffers are suballocated from.
+    // Null if persistent mapping is not supported.
+    std::unique_ptr<GLDynamicRingBuffer> m_pDynamicRingBuffer;
+
+    // Uniform buffer slots of the committed resources that are suballocated from the ring buffer.
+    // The allocation changes every time the buffer is mapped, so they are rebound before every draw.
+    std::vector<std::pair<Uint32, RefCntAutoPtr<BufferGLImpl>>> m_BoundDynamicUniformBuffers;
+
+    // Buffers that have been suballocated from the ring buffer in the current frame. The space
+    // is recycled after the frame is finished, so FinishFrame() moves the last contents of every
+    // buffer to its own storage. This keeps buffers that are mapped once and then used in
+    // later frames valid.
+    std::vector<RefCntAutoPtr<BufferGLImpl>> m_RingAllocatedBuffers;
+
+    // Scratch arrays used to commit the resources to the context state in batches
+    std::vector<const GLObjectWrappers::GLBufferObj*>  m_UBsToBind;
+    std::vector<GLintptr>                              m_UBOffsetsToBind;
+    std::vector<GLsizeiptr>                            m_UBSizesToBind;
+    std::vector<const GLObjectWrappers::GLTextureObj*> m_TexturesToBind;
+    std::vector<GLenum>                                m_TexTargetsToBind;
+    std::vector<const GLObjectWrappers::GLSamplerObj*> m_SamplersToBind;
+
     RefCntAutoPtr<ISwapChainGL> m_pSwapChain;
 
     bool m_IsDefaultFBOBound = false;
@@ -285,6 +326,12 @@ private:
     GLObjectWrappers::GLFrameBufferObj m_DefaultFBO;
 
     std::vector<OptimizedClearValue> m_AttachmentClearValues;
+
+    // Scratch arrays of glMultiDraw* arguments
+    std::vector<GLint>   m_MultiDrawFirsts;
+    std::vector<GLsizei> m_MultiDrawCounts;
+    std::vector<GLvoid*> m_MultiDrawIndexOffsets;
+    std::vector<GLint>   m_MultiDrawBaseVertices;
 };
 
 } // namespace Diligent
@@ -31,6 +31,7 @@
 #include "TextureView.h"
 #include "LockHelper.hpp"
 #include "HashUtils.hpp"
+#include "FlatHashMap.hpp"
 #include "GLObjectWrapper.hpp"
 
 namespace Diligent
@@ -91,8 +92,11 @@ private:
 
 
     friend class RenderDeviceGLImpl;
-    ThreadingTools::LockFlag                                                                 m_CacheLockFlag;
-    std::unordered_map<FBOCacheKey, GLObjectWrappers::GLFrameBufferObj, FBOCacheKeyHashFunc> m_Cache;
+    ThreadingTools::LockFlag m_CacheLockFlag;
+
+    // FBOs are allocated separately for the same reason as in VAOCache: FlatHashMap moves
+    // its elements, while the reference returned by GetFBO() is used after the lock is released.
+    FlatHashMap<FBOCacheKey, std::unique_ptr<GLObjectWrappers::GLFrameBufferObj>, FBOCacheKeyHashFunc> m_Cache;
 
     // Multimap that sets up correspondence between unique texture id and all
     // FBOs it is used in
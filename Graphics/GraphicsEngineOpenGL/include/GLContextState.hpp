@@ -28,6 +28,7 @@
 #pragma once
 
 #include "GraphicsTypes.h"
+#include "DeviceContextGL.h"
 #include "GLObjectWrapper.hpp"
 #include "UniqueIdentifier.hpp"
 #include "GLContext.hpp"
@@ -39,6 +40,7 @@ class GLContextState
 {
 public:
     GLContextState(class RenderDeviceGLImpl* pDeviceGL);
+    ~GLContextState();
 
     // clang-format off
 
@@ -48,13 +50,22 @@ public:
     void BindFBO           (const GLObjectWrappers::GLFrameBufferObj& FBO);
     void SetActiveTexture  (Int32 Index);
     void BindTexture       (Int32 Index, GLenum BindTarget, const GLObjectWrappers::GLTextureObj& Tex);
-    void BindUniformBuffer (Int32 Index,       const GLObjectWrappers::GLBufferObj& Buff);
+    void BindUniformBuffer (Int32 Index,       const GLObjectWrappers::GLBufferObj& Buff, GLintptr Offset = 0, GLsizeiptr Size = 0);
     void BindBuffer        (GLenum BindTarget, const GLObjectWrappers::GLBufferObj& Buff, bool ResetVAO);
     void BindSampler       (Uint32 Index,      const GLObjectWrappers::GLSamplerObj& GLSampler);
     void BindImage         (Uint32 Index, class TextureViewGLImpl* pTexView, GLint MipLevel, GLboolean IsLayered, GLint Layer, GLenum Access, GLenum Format);
     void BindImage         (Uint32 Index, class BufferViewGLImpl* pBuffView, GLenum Access, GLenum Format);
     void BindStorageBlock  (Int32 Index, const GLObjectWrappers::GLBufferObj& Buff, GLintptr Offset, GLsizeiptr Size);
 
+    // Batched versions of BindTexture, BindSampler and BindUniformBuffer that update slots [First, First + Count).
+    // Null entries leave the corresponding slot intact. Slots that already hold the object are filtered out,
+    // and every contiguous range of the remaining slots is committed with a single ARB_multi_bind call.
+    // When multi-bind is not supported, the slots are bound one by one.
+    void BindTextures      (Uint32 First, Uint32 Count, const GLenum* BindTargets, const GLObjectWrappers::GLTextureObj* const* ppTextures);
+    void BindSamplers      (Uint32 First, Uint32 Count, const GLObjectWrappers::GLSamplerObj* const* ppSamplers);
+    // If pOffsets is null, whole buffers are bound. Otherwise, both pOffsets and pSizes must provide Count values.
+    void BindUniformBuffers(Uint32 First, Uint32 Count, const GLObjectWrappers::GLBufferObj* const* ppBuffers, const GLintptr* pOffsets = nullptr, const GLsizeiptr* pSizes = nullptr);
+
     void EnsureMemoryBarrier(Uint32 RequiredBarriers, class AsyncWritableResource *pRes = nullptr);
     void SetPendingMemoryBarriers(Uint32 PendingBarriers);
     
@@ -88,6 +99,9 @@ public:
     void SetNumPatchVertices(Int32 NumVertices);
     void Invalidate();
 
+    // Makes the statistics of the current frame available through GetFrameStatistics() and resets the counters
+    void FinishFrame();
+
     void InvalidateVAO()
     {
         m_VAOId = -1;
@@ -111,9 +125,36 @@ public:
         GLint m_iMaxCombinedTexUnits      = 0;
         GLint m_iMaxDrawBuffers           = 0;
         GLint m_iMaxUniformBufferBindings = 0;
+        bool  IsMultiBindSupported        = false;
+
+        bool  IsVertexAttribBindingSupported   = false;
+        GLint m_iMaxVertexAttribBindings       = 0;
+        GLint m_iMaxVertexAttribRelativeOffset = 0;
     };
     const ContextCaps& GetContextCaps() { return m_Caps; }
 
+    // Object binding statistics, see BindingStatisticsGL
+    struct Statistics : BindingStatisticsGL
+    {
+        Statistics& operator+=(const Statistics& rhs)
+        {
+            NumGLCalls += rhs.NumGLCalls;
+            NumFilteredCalls += rhs.NumFilteredCalls;
+            NumMultiBindCalls += rhs.NumMultiBindCalls;
+            NumMultiBoundSlots += rhs.NumMultiBoundSlots;
+            return *this;
+        }
+    };
+    // Returns the statistics of the last finished frame
+    const Statistics& GetFrameStatistics() const { return m_LastFrameStats; }
+    // Returns the statistics accumulated since the context state was created, including the current frame
+    Statistics GetTotalStatistics() const
+    {
+        auto TotalStats = m_TotalStats;
+        TotalStats += m_FrameStats;
+        return TotalStats;
+    }
+
 private:
     // It is unsafe to use GL handle to keep track of bound objects
     // When an object is released, GL is free to reuse its handle for
@@ -128,7 +169,6 @@ private:
     UniqueIdentifier              m_FBOId        = -1;
     std::vector<UniqueIdentifier> m_BoundTextures;
     std::vector<UniqueIdentifier> m_BoundSamplers;
-    std::vector<UniqueIdentifier> m_BoundUniformBuffers;
 
     struct BoundImageInfo
     {
@@ -175,12 +215,12 @@ private:
     };
     std::vector<BoundImageInfo> m_BoundImages;
 
-    struct BoundSSBOInfo
+    struct BoundBufferInfo
     {
-        BoundSSBOInfo() {}
-        BoundSSBOInfo(UniqueIdentifier _BufferID,
-                      GLintptr         _Offset,
-                      GLsizeiptr       _Size) :
+        BoundBufferInfo() {}
+        BoundBufferInfo(UniqueIdentifier _BufferID,
+                        GLintptr         _Offset,
+                        GLsizeiptr       _Size) :
             // clang-format off
             BufferID{_BufferID},
             Offset  {_Offset},
@@ -191,7 +231,7 @@ private:
         GLintptr         Offset   = 0;
         GLsizeiptr       Size     = 0;
 
-        bool operator==(const BoundSSBOInfo& rhs) const
+        bool operator==(const BoundBufferInfo& rhs) const
         {
             // clang-format off
             return BufferID == rhs.BufferID &&
@@ -200,10 +240,22 @@ private:
             // clang-format on
         }
     };
-    std::vector<BoundSSBOInfo> m_BoundStorageBlocks;
+    // Size is zero when the whole buffer is bound
+    std::vector<BoundBufferInfo> m_BoundUniformBuffers;
+    std::vector<BoundBufferInfo> m_BoundStorageBlocks;
 
     Uint32 m_PendingMemoryBarriers = 0;
 
+    template <typename ObjectType, typename UpdateSlotType, typename BindRangeType>
+    void CommitMultiBind(Uint32 Count, const ObjectType* const* ppObjects, UpdateSlotType UpdateSlot, BindRangeType BindRange);
+
+    // Scratch array of GL handles passed to multi-bind functions
+    std::vector<GLuint> m_MultiBindHandles;
+
+    Statistics m_FrameStats;
+    Statistics m_LastFrameStats;
+    Statistics m_TotalStats;
+
     class EnableStateHelper
     {
     public:
@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::GLDynamicRingBuffer class
+
+#include <deque>
+#include <utility>
+
+#include "RingBuffer.hpp"
+#include "GLObjectWrapper.hpp"
+
+namespace Diligent
+{
+
+class GLContextState;
+
+/// Persistently mapped ring buffer that the device context uses to suballocate
+/// memory for dynamic uniform buffers.
+
+/// The storage is created once with glBufferStorage() and stays mapped with
+/// GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT for the lifetime of the object, so
+/// mapping a dynamic buffer is reduced to a pointer bump. Memory allocated in a
+/// frame is protected by a fence inserted by FinishFrame() and is recycled once
+/// the fence is signaled.
+class GLDynamicRingBuffer
+{
+public:
+    static constexpr Uint32 InvalidOffset = ~Uint32{0};
+
+    GLDynamicRingBuffer(GLContextState& CtxState, Uint32 Size);
+    ~GLDynamicRingBuffer();
+
+    // clang-format off
+    GLDynamicRingBuffer             (const GLDynamicRingBuffer&)  = delete;
+    GLDynamicRingBuffer             (      GLDynamicRingBuffer&&) = delete;
+    GLDynamicRingBuffer& operator = (const GLDynamicRingBuffer&)  = delete;
+    GLDynamicRingBuffer& operator = (      GLDynamicRingBuffer&&) = delete;
+    // clang-format on
+
+    /// Allocates Size bytes aligned by the uniform buffer offset alignment.
+
+    /// If there is not enough space, waits for the oldest frames to complete.
+    /// Returns InvalidOffset if the allocations made in the current frame alone
+    /// exhaust the buffer.
+    Uint32 Allocate(Uint32 Size);
+
+    /// Inserts a fence that protects the memory allocated in the current frame
+    /// and releases the memory of the frames that have completed.
+    void FinishFrame();
+
+    Uint8* GetCPUAddress(Uint32 Offset) const
+    {
+        VERIFY_EXPR(Offset < m_Size);
+        return m_pMappedData + Offset;
+    }
+
+    const GLObjectWrappers::GLBufferObj& GetGLBuffer() const { return m_GLBuffer; }
+
+    /// Returns the number of the frame that new allocations belong to.
+    Uint64 GetCurrentFrame() const { return m_CurrentFrame; }
+
+private:
+    void ReleaseCompletedFrames(bool WaitForOldestFrame);
+
+    GLObjectWrappers::GLBufferObj m_GLBuffer;
+
+    const Uint32 m_Size;
+    Uint32       m_Alignment   = 256;
+    Uint8*       m_pMappedData = nullptr;
+
+    RingBuffer m_RingBuffer;
+
+    Uint64 m_CurrentFrame            = 1;
+    Uint32 m_NumCurrFrameAllocations = 0;
+
+    std::deque<std::pair<Uint64, GLObjectWrappers::GLSyncObj>> m_PendingFrames;
+
+    size_t m_MaxUsedSize = 0;
+    Uint32 m_NumWaits    = 0;
+};
+
+} // namespace Diligent
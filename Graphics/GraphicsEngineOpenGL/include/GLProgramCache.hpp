@@ -0,0 +1,112 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::GLProgramCache class
+
+#include "RenderDeviceGL.h"
+#include "GLObjectWrapper.hpp"
+
+namespace Diligent
+{
+
+class GLContextState;
+class GLProgramResources;
+class ShaderGLImpl;
+
+/// On-disk cache of linked program binaries.
+
+/// After a program is linked, its binary is retrieved with glGetProgramBinary() and
+/// is stored in the cache directory together with the reflected program resources.
+/// Next time a program is created from the same shaders, the binary is loaded with
+/// glProgramBinary(), which skips both compilation and linking. The binary format is
+/// driver-specific, so the driver may reject an entry at any time. In this case the
+/// caller falls back to compiling and linking the program from the sources.
+class GLProgramCache
+{
+public:
+    /// First binding assigned to each resource type when the program is created.
+    /// Bindings are baked into the cached entry, so they are part of the key.
+    struct ResourceBindings
+    {
+        Uint32 UniformBuffers = 0;
+        Uint32 Samplers       = 0;
+        Uint32 Images         = 0;
+        Uint32 StorageBuffers = 0;
+    };
+
+    explicit GLProgramCache(const Char* Directory);
+    ~GLProgramCache();
+
+    // clang-format off
+    GLProgramCache             (const GLProgramCache&)  = delete;
+    GLProgramCache             (      GLProgramCache&&) = delete;
+    GLProgramCache& operator = (const GLProgramCache&)  = delete;
+    GLProgramCache& operator = (      GLProgramCache&&) = delete;
+    // clang-format on
+
+    /// Computes the key of the program linked from the given shaders.
+    Uint64 ComputeKey(ShaderGLImpl* const*    ppShaders,
+                      Uint32                  NumShaders,
+                      bool                    IsSeparableProgram,
+                      const ResourceBindings& Bindings) const;
+
+    /// Loads the program from the cache.
+
+    /// On success, Resources are initialized, Bindings are advanced past the resources
+    /// of the program, and the program is written to pProgram. If pProgram is null, only
+    /// the resources are restored. Returns false if there is no valid entry for the key
+    /// or if the driver rejects the binary.
+    bool Load(Uint64                          Key,
+              bool                            IsSeparableProgram,
+              GLContextState&                 State,
+              GLProgramResources&             Resources,
+              ResourceBindings&               Bindings,
+              GLObjectWrappers::GLProgramObj* pProgram);
+
+    /// Stores the linked program and its resources in the cache.
+
+    /// Bindings must contain the values after the program resources have been loaded.
+    void Store(Uint64                                Key,
+               const GLObjectWrappers::GLProgramObj& Program,
+               const GLProgramResources&             Resources,
+               const ResourceBindings&               Bindings);
+
+    const ProgramCacheStatisticsGL& GetStatistics() const { return m_Stats; }
+
+private:
+    String GetEntryPath(Uint64 Key) const;
+
+    String m_Directory;
+    Uint64 m_DriverHash = 0;
+
+    ProgramCacheStatisticsGL m_Stats;
+};
+
+} // namespace Diligent
@@ -195,7 +195,8 @@ public:
             return ComputeHash(UBIndex, GLResourceAttribs::GetHash());
         }
 
-        const GLuint UBIndex;
+        // Updated by ResolveLocations()
+        GLuint UBIndex;
     };
     static_assert((sizeof(UniformBufferInfo) % sizeof(void*)) == 0, "sizeof(UniformBufferInfo) must be multiple of sizeof(void*)");
 
@@ -240,7 +241,8 @@ public:
             return ComputeHash(Location, SamplerType, GLResourceAttribs::GetHash());
         }
 
-        const GLint  Location;
+        // Updated by ResolveLocations()
+        GLint        Location;
         const GLenum SamplerType;
     };
     static_assert((sizeof(SamplerInfo) % sizeof(void*)) == 0, "sizeof(SamplerInfo) must be multiple of sizeof(void*)");
@@ -286,7 +288,8 @@ public:
             return ComputeHash(Location, ImageType, GLResourceAttribs::GetHash());
         }
 
-        const GLint  Location;
+        // Updated by ResolveLocations()
+        GLint        Location;
         const GLenum ImageType;
     };
     static_assert((sizeof(ImageInfo) % sizeof(void*)) == 0, "sizeof(ImageInfo) must be multiple of sizeof(void*)");
@@ -328,7 +331,8 @@ public:
             return ComputeHash(SBIndex, GLResourceAttribs::GetHash());
         }
 
-        const GLint SBIndex;
+        // Updated by ResolveLocations()
+        GLint SBIndex;
     };
     static_assert((sizeof(StorageBlockInfo) % sizeof(void*)) == 0, "sizeof(StorageBlockInfo) must be multiple of sizeof(void*)");
 
@@ -489,6 +493,36 @@ public:
                         Uint32                               NumAllowedTypes,
                         ResourceCounters&                    Counters) const;
 
+    /// Initializes the resources of a separable program linked from a single shader without
+    /// querying the program. ShaderResources must have been loaded from the shader's own
+    /// separable program with all bindings starting at zero. The bindings are offset by the
+    /// current values of the binding counters, which are then advanced past the resources.
+    /// Once the program is linked, the uniform block indices and uniform locations need to be
+    /// queried with ResolveLocations(), and the bindings need to be assigned with ApplyBindings().
+    void InitFromShader(const GLProgramResources& ShaderResources,
+                        Uint32&                   UniformBufferBinding,
+                        Uint32&                   SamplerBinding,
+                        Uint32&                   ImageBinding,
+                        Uint32&                   StorageBufferBinding);
+
+    /// Queries uniform block indices, sampler and image uniform locations and storage block
+    /// indices from the linked program by resource names. The driver may assign different
+    /// indices and locations to the same resources in different programs, so the values
+    /// copied from the shader's program by InitFromShader() cannot be used with another program.
+    void ResolveLocations(const GLObjectWrappers::GLProgramObj& GLProgram);
+
+    /// Appends the description of all resources to Data so that it can later be restored by Deserialize().
+    void Serialize(std::vector<Uint8>& Data) const;
+
+    /// Restores the resources from the data produced by Serialize().
+    /// Returns false if the data is malformed, in which case the object is left unchanged.
+    bool Deserialize(const Uint8* pData, size_t Size);
+
+    /// Assigns the bindings stored in the resource descriptions to the program.
+    /// This is required for programs loaded with glProgramBinary() that does not
+    /// preserve uniform values and uniform block bindings.
+    void ApplyBindings(const GLObjectWrappers::GLProgramObj& GLProgram, class GLContextState& State) const;
+
 
 private:
     void AllocateResources(std::vector<UniformBufferInfo>& UniformBlocks,
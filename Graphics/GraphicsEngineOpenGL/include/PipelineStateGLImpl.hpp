@@ -84,6 +84,10 @@ public:
     /// Implementation of IPipelineState::IsCompatibleWith() in OpenGL backend.
     virtual bool DILIGENT_CALL_TYPE IsCompatibleWith(const IPipelineState* pPSO) const override final;
 
+    /// Implementation of IPipelineState::GetStatus() in OpenGL backend.
+    /// Must be called from the thread that owns the GL context.
+    virtual PIPELINE_STATE_STATUS DILIGENT_CALL_TYPE GetStatus(bool WaitForCompletion) override final;
+
     void CommitProgram(GLContextState& State);
 
     void InitializeSRBResourceCache(GLProgramResourceCache& ResourceCache) const;
@@ -112,7 +116,11 @@ private:
     void Initialize(const PSOCreateInfoType& CreateInfo, const std::vector<GLPipelineShaderStageInfo>& ShaderStages);
 
     void InitResourceLayouts(const std::vector<GLPipelineShaderStageInfo>& ShaderStages,
-                             LinearAllocator&                              MemPool);
+                             LinearAllocator&                              MemPool,
+                             bool                                          IsAsynchronous);
+
+    // Checks the link status of the programs linked in the background and assigns their bindings
+    void FinalizePrograms();
 
     void Destruct();
 
@@ -145,6 +153,25 @@ private:
     Uint32 m_TotalImageBindings         = 0;
     Uint32 m_TotalStorageBufferBindings = 0;
 
+    // Programs that are being linked in the background when the pipeline is created
+    // asynchronously and the driver supports parallel shader compilation.
+    struct PendingProgram
+    {
+        PendingProgram(Uint32 _ProgramIndex, Uint64 _CacheKey, const GLProgramCache::ResourceBindings& _Bindings) :
+            ProgramIndex{_ProgramIndex},
+            CacheKey{_CacheKey},
+            Bindings{_Bindings}
+        {}
+
+        const Uint32 ProgramIndex;
+        const Uint64 CacheKey;
+        // Bindings after the program resources, see GLProgramCache::Store()
+        const GLProgramCache::ResourceBindings Bindings;
+    };
+    std::vector<PendingProgram> m_PendingPrograms;
+
+    PIPELINE_STATE_STATUS m_Status = PIPELINE_STATE_STATUS_READY;
+
     using SamplerPtr                = RefCntAutoPtr<ISampler>;
     SamplerPtr* m_ImmutableSamplers = nullptr; // [m_Desc.ResourceLayout.NumImmutableSamplers]
 };
@@ -34,6 +34,7 @@
 #include "BaseInterfacesGL.h"
 #include "FBOCache.hpp"
 #include "TexRegionRender.hpp"
+#include "GLProgramCache.hpp"
 
 namespace Diligent
 {
@@ -133,6 +134,12 @@ public:
                                                        RESOURCE_STATE     InitialState,
                                                        ITexture**         ppTexture) override final;
 
+    /// Implementation of IRenderDeviceGL::SetProgramCacheDirectory().
+    virtual void DILIGENT_CALL_TYPE SetProgramCacheDirectory(const Char* Directory) override final;
+
+    /// Implementation of IRenderDeviceGL::GetProgramCacheStatistics().
+    virtual void DILIGENT_CALL_TYPE GetProgramCacheStatistics(ProgramCacheStatisticsGL& Stats) const override final;
+
     /// Implementation of IRenderDevice::ReleaseStaleResources() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE ReleaseStaleResources(bool ForceRelease = false) override final {}
 
@@ -151,6 +158,13 @@ public:
 
     void InitTexRegionRender();
 
+    /// Returns the program binary cache or null if it is disabled.
+    GLProgramCache* GetProgramCache() { return m_pProgramCache.get(); }
+
+    /// Returns true if the driver compiles and links programs in the background
+    /// (GL_KHR_parallel_shader_compile or GL_ARB_parallel_shader_compile).
+    bool IsParallelShaderCompileSupported() const { return m_IsParallelShaderCompileSupported; }
+
 protected:
     friend class DeviceContextGLImpl;
     friend class TextureBaseGL;
@@ -174,6 +188,8 @@ protected:
 
     std::unique_ptr<TexRegionRender> m_pTexRegionRender;
 
+    std::unique_ptr<GLProgramCache> m_pProgramCache;
+
 private:
     template <typename PSOCreateInfoType>
     void CreatePipelineState(const PSOCreateInfoType& PSOCreateInfo, IPipelineState** ppPipelineState, bool bIsDeviceInternal);
@@ -183,6 +199,8 @@ private:
     void         FlagSupportedTexFormats();
 
     int m_ShowDebugGLOutput = 1;
+
+    bool m_IsParallelShaderCompileSupported = false;
 };
 
 } // namespace Diligent
@@ -92,11 +92,33 @@ public:
     /// Implementation of IShader::GetResource() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE GetResourceDesc(Uint32 Index, ShaderResourceDesc& ResourceDesc) const override final;
 
-    static GLObjectWrappers::GLProgramObj LinkProgram(ShaderGLImpl** ppShaders, Uint32 NumShaders, bool IsSeparableProgram);
+    /// Links the program from the shaders. If WaitForLink is false, the link status is not checked,
+    /// so that the call does not block when the driver links programs in the background.
+    static GLObjectWrappers::GLProgramObj LinkProgram(ShaderGLImpl** ppShaders, Uint32 NumShaders, bool IsSeparableProgram, bool WaitForLink = true);
+
+    /// Returns true if the program has been linked successfully and logs the info log otherwise.
+    /// Blocks until the link is complete.
+    static bool GetLinkStatus(const GLObjectWrappers::GLProgramObj& GLProg);
+
+    /// Resources of the separable program of this shader. Only available if the device supports separable programs.
+    const GLProgramResources& GetResources() const { return m_Resources; }
+
+    /// Hash of the full GLSL source string that is used as part of the program cache key.
+    Uint64 GetSourceHash() const { return m_SourceHash; }
 
 private:
+    void Compile(IDataBlob** ppCompilerOutput);
+
+    // When the shader resources are restored from the program cache, the shader
+    // is only compiled when it needs to be linked into a new program.
+    const GLObjectWrappers::GLShaderObj& GetCompiledShader();
+
     GLObjectWrappers::GLShaderObj m_GLShaderObj;
     GLProgramResources            m_Resources;
+
+    String m_GLSLSource;
+    Uint64 m_SourceHash = 0;
+    bool   m_IsCompiled = false;
 };
 
 } // namespace Diligent
@@ -28,11 +28,14 @@
 #pragma once
 
 #include <cstring>
+#include <unordered_map>
+#include <memory>
 #include "GraphicsTypes.h"
 #include "Buffer.h"
 #include "InputLayout.h"
 #include "LockHelper.hpp"
 #include "HashUtils.hpp"
+#include "FlatHashMap.hpp"
 #include "DeviceContextBase.hpp"
 #include "BaseInterfacesGL.h"
 
@@ -62,7 +65,20 @@ public:
     void OnDestroyBuffer(IBuffer* pBuffer);
     void OnDestroyPSO(IPipelineState* pPSO);
 
+    // Detaches destroyed buffers from the layout VAOs, so that their storage can be released.
+    // VAOs are not shared between GL contexts, so this is done by the context that owns the cache
+    // rather than in OnDestroyBuffer(), which may be called when any context is current.
+    void UnbindDestroyedBuffers(class GLContextState& GLState);
+
 private:
+    // Returns the VAO shared by all pipelines with the same input layout, or null if the layout
+    // cannot be expressed with separate attribute formats and buffer bindings.
+    const GLObjectWrappers::GLVertexArrayObj* GetLayoutVAO(class PipelineStateGLImpl*           pPSOGL,
+                                                           class BufferGLImpl*                  pIndexBufferGL,
+                                                           VertexStreamInfo<class BufferGLImpl> VertexStreams[],
+                                                           Uint32                               NumVertexStreams,
+                                                           class GLContextState&                GLState);
+
     // This structure is used as the key to find VAO
     struct VAOCacheKey
     {
@@ -109,29 +125,99 @@ private:
         {
             if (Key.Hash == 0)
             {
-                std::size_t Seed = 0;
-                HashCombine(Seed, Key.PSOUId, Key.IndexBufferUId, Key.NumUsedSlots);
+                HashDataPacker<sizeof(VAOCacheKey)> Packer;
+                Packer.Add(Key.PSOUId, Key.IndexBufferUId, Key.NumUsedSlots);
                 for (Uint32 slot = 0; slot < Key.NumUsedSlots; ++slot)
                 {
                     auto& CurrStream = Key.Streams[slot];
-                    HashCombine(Seed, CurrStream.BufferUId);
-                    HashCombine(Seed, CurrStream.Offset);
-                    HashCombine(Seed, CurrStream.Stride);
+                    Packer.Add(CurrStream.BufferUId, CurrStream.Offset, CurrStream.Stride);
                 }
-                Key.Hash = Seed;
+                Key.Hash = Packer.GetHash();
             }
             return Key.Hash;
         }
     };
 
 
+    // When ARB_vertex_attrib_binding is supported, the VAO only stores the vertex format, which is
+    // defined by the input layout alone. Vertex buffers are bound to the VAO at draw time, so the
+    // number of VAOs does not depend on the number of buffers.
+    struct LayoutVAOKey
+    {
+        Uint32 NumElements = 0;
+        // All members are 32-bit so that the structure has no padding and can be compared with memcmp
+        struct ElementAttribs
+        {
+            Uint32 InputIndex;
+            Uint32 BufferSlot;
+            Uint32 NumComponents;
+            Uint32 ValueType;
+            Uint32 IsNormalized;
+            Uint32 RelativeOffset;
+            Uint32 Divisor;
+        } Elements[MAX_LAYOUT_ELEMENTS];
+
+        mutable size_t Hash = 0;
+
+        bool operator==(const LayoutVAOKey& Key) const
+        {
+            return NumElements == Key.NumElements &&
+                std::memcmp(Elements, Key.Elements, sizeof(ElementAttribs) * NumElements) == 0;
+        }
+    };
+
+    struct LayoutVAOKeyHashFunc
+    {
+        std::size_t operator()(const LayoutVAOKey& Key) const
+        {
+            if (Key.Hash == 0)
+            {
+                HashDataPacker<sizeof(LayoutVAOKey)> Packer;
+                Packer.Add(Key.NumElements);
+                for (Uint32 elem = 0; elem < Key.NumElements; ++elem)
+                {
+                    const auto& Elem = Key.Elements[elem];
+                    Packer.Add(Elem.InputIndex, Elem.BufferSlot, Elem.NumComponents, Elem.ValueType,
+                               Elem.IsNormalized, Elem.RelativeOffset, Elem.Divisor);
+                }
+                Key.Hash = Packer.GetHash();
+            }
+            return Key.Hash;
+        }
+    };
+
+    struct LayoutVAO
+    {
+        GLObjectWrappers::GLVertexArrayObj VAO{true};
+
+        // Buffers currently bound to the VAO. Unique IDs are used for the same reason as in VAOCacheKey.
+        // Slots of destroyed buffers are marked with DestroyedBufferUId until they are unbound.
+        static constexpr UniqueIdentifier DestroyedBufferUId = -2;
+        struct BoundBufferInfo
+        {
+            UniqueIdentifier BufferUId = -1;
+            GLintptr         Offset    = 0;
+            GLsizei          Stride    = 0;
+        } VertexBuffers[MAX_BUFFER_SLOTS];
+        UniqueIdentifier IndexBufferUId = -1;
+    };
+
     friend class RenderDeviceGLImpl;
-    ThreadingTools::LockFlag                                                                 m_CacheLockFlag;
-    std::unordered_map<VAOCacheKey, GLObjectWrappers::GLVertexArrayObj, VAOCacheKeyHashFunc> m_Cache;
+    ThreadingTools::LockFlag m_CacheLockFlag;
+
+    // FlatHashMap moves its elements on insertion and erasure, so VAOs are allocated separately:
+    // the reference returned by GetVAO() must stay valid after the lock is released, while
+    // other threads add VAOs to the cache or remove the VAOs of destroyed buffers and pipelines.
+    FlatHashMap<VAOCacheKey, std::unique_ptr<GLObjectWrappers::GLVertexArrayObj>, VAOCacheKeyHashFunc> m_Cache;
 
     std::unordered_multimap<const IPipelineState*, VAOCacheKey> m_PSOToKey;
     std::unordered_multimap<const IBuffer*, VAOCacheKey>        m_BuffToKey;
 
+    // Layout VAOs are not tied to any pipeline, so they live as long as the cache. They keep
+    // the last buffers used with them bound until the buffers are destroyed.
+    std::unordered_map<LayoutVAOKey, LayoutVAO, LayoutVAOKeyHashFunc> m_LayoutCache;
+    bool                                                              m_HasDestroyedLayoutBuffers = false;
+
     // Any draw command fails if no VAO is bound. We will use this empty
     // VAO for draw commands with null input layout, such as these that
     // only use VertexID as input.
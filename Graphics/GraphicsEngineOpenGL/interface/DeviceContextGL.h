@@ -40,6 +40,27 @@ struct ISwapChainGL;
 static const INTERFACE_ID IID_DeviceContextGL =
     {0x3464fdf1, 0xc548, 0x4935, {0x96, 0xc3, 0xb4, 0x54, 0xc9, 0xdf, 0x6f, 0x6a}};
 
+/// Object binding statistics of an OpenGL device context.
+
+/// Only program, pipeline, VAO, FBO, texture, sampler, image and uniform/storage buffer
+/// bindings are counted; render states are not.
+struct BindingStatisticsGL
+{
+    /// The number of binding calls issued to GL
+    Uint64 NumGLCalls DEFAULT_INITIALIZER(0);
+
+    /// The number of binding calls that were not issued because the object was already bound
+    Uint64 NumFilteredCalls DEFAULT_INITIALIZER(0);
+
+    /// The number of glBindTextures, glBindSamplers, glBindBuffersBase and glBindBuffersRange
+    /// calls (included in NumGLCalls)
+    Uint64 NumMultiBindCalls DEFAULT_INITIALIZER(0);
+
+    /// The number of slots updated by multi-bind calls
+    Uint64 NumMultiBoundSlots DEFAULT_INITIALIZER(0);
+};
+typedef struct BindingStatisticsGL BindingStatisticsGL;
+
 #define DILIGENT_INTERFACE_NAME IDeviceContextGL
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -65,6 +86,15 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContextGL, IDeviceContext)
     /// to obtain the default FBO handle.
     VIRTUAL void METHOD(SetSwapChain)(THIS_
                                       struct ISwapChainGL* pSwapChain) PURE;
+
+    /// Returns object binding statistics of the context.
+
+    /// \param [out] LastFrameStats - Statistics of the last frame finished by IDeviceContext::FinishFrame().
+    /// \param [out] TotalStats     - Statistics accumulated since the context was created,
+    ///                               including the current frame.
+    VIRTUAL void METHOD(GetBindingStatistics)(THIS_
+                                              BindingStatisticsGL REF LastFrameStats,
+                                              BindingStatisticsGL REF TotalStats) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -76,6 +106,7 @@ DILIGENT_END_INTERFACE
 
 #    define IDeviceContextGL_UpdateCurrentGLContext(This) CALL_IFACE_METHOD(DeviceContextGL, UpdateCurrentGLContext, This)
 #    define IDeviceContextGL_SetSwapChain(This, ...)      CALL_IFACE_METHOD(DeviceContextGL, SetSwapChain,           This, __VA_ARGS__)
+#    define IDeviceContextGL_GetBindingStatistics(This, ...) CALL_IFACE_METHOD(DeviceContextGL, GetBindingStatistics,  This, __VA_ARGS__)
 
 // clang-format on
 
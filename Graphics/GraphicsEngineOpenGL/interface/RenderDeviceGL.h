@@ -39,6 +39,24 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static const INTERFACE_ID IID_RenderDeviceGL =
     {0xb4b395b9, 0xac99, 0x4e8a, {0xb7, 0xe1, 0x9d, 0xca, 0xd, 0x48, 0x56, 0x18}};
 
+/// Statistics of the program binary cache, see EngineGLCreateInfo::ProgramCacheDirectory
+struct ProgramCacheStatisticsGL
+{
+    /// The number of programs that have been loaded from the cache
+    Uint32 NumHits DEFAULT_INITIALIZER(0);
+
+    /// The number of programs that have not been found in the cache or
+    /// whose cache entries are corrupted
+    Uint32 NumMisses DEFAULT_INITIALIZER(0);
+
+    /// The number of program binaries that have been rejected by the driver
+    Uint32 NumRejected DEFAULT_INITIALIZER(0);
+
+    /// The number of programs that have been stored in the cache
+    Uint32 NumStored DEFAULT_INITIALIZER(0);
+};
+typedef struct ProgramCacheStatisticsGL ProgramCacheStatisticsGL;
+
 #define DILIGENT_INTERFACE_NAME IRenderDeviceGL
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -113,6 +131,23 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceGL, IRenderDevice)
                                             const TextureDesc REF TexDesc,
                                             RESOURCE_STATE        InitialState,
                                             ITexture**            ppTexture) PURE;
+
+    /// Sets the directory of the program binary cache.
+
+    /// \param [in] Directory - Cache directory. If the directory does not exist, it is created.
+    ///                         If this parameter is null or an empty string, the cache is disabled.
+    ///
+    /// \remarks This method replaces the directory set by EngineGLCreateInfo::ProgramCacheDirectory
+    ///          and resets the cache statistics. It must not be called while shaders or pipeline
+    ///          states are being created, including the pipelines that are created asynchronously.
+    VIRTUAL void METHOD(SetProgramCacheDirectory)(THIS_
+                                                  const Char* Directory) PURE;
+
+    /// Returns the statistics of the program binary cache.
+
+    /// \param [out] Stats - Cache statistics. If the cache is disabled, all values are zero.
+    VIRTUAL void METHOD(GetProgramCacheStatistics)(THIS_
+                                                   ProgramCacheStatisticsGL REF Stats) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -125,6 +160,8 @@ DILIGENT_END_INTERFACE
 #    define IRenderDeviceGL_CreateTextureFromGLHandle(This, ...)CALL_IFACE_METHOD(RenderDeviceGL, CreateTextureFromGLHandle, This, __VA_ARGS__)
 #    define IRenderDeviceGL_CreateBufferFromGLHandle(This, ...) CALL_IFACE_METHOD(RenderDeviceGL, CreateBufferFromGLHandle,  This, __VA_ARGS__)
 #    define IRenderDeviceGL_CreateDummyTexture(This, ...)       CALL_IFACE_METHOD(RenderDeviceGL, CreateDummyTexture,        This, __VA_ARGS__)
+#    define IRenderDeviceGL_SetProgramCacheDirectory(This, ...) CALL_IFACE_METHOD(RenderDeviceGL, SetProgramCacheDirectory,  This, __VA_ARGS__)
+#    define IRenderDeviceGL_GetProgramCacheStatistics(This, ...)CALL_IFACE_METHOD(RenderDeviceGL, GetProgramCacheStatistics, This, __VA_ARGS__)
 
 // clang-format on
 
@@ -255,9 +255,9 @@ void BufferGLImpl::CopyData(GLContextState& CtxState, BufferGLImpl& SrcBufferGL,
     // the purposes of copying or staging data without disturbing OpenGL state or needing to keep track of
     // what was bound to the target before your copy.
     constexpr bool ResetVAO = false; // No need to reset VAO for READ/WRITE targets
-    CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, m_GlBuffer, ResetVAO);
-    CtxState.BindBuffer(GL_COPY_READ_BUFFER, SrcBufferGL.m_GlBuffer, ResetVAO);
-    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, SrcOffset, DstOffset, Size);
+    CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, GetGLHandle(), ResetVAO);
+    CtxState.BindBuffer(GL_COPY_READ_BUFFER, SrcBufferGL.GetGLHandle(), ResetVAO);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, SrcBufferGL.m_DynamicOffset + SrcOffset, m_DynamicOffset + DstOffset, Size);
     CHECK_GL_ERROR("glCopyBufferSubData() failed");
     CtxState.BindBuffer(GL_COPY_READ_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
     CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
@@ -56,7 +56,17 @@ using namespace std;
 namespace Diligent
 {
 
-DeviceContextGLImpl::DeviceContextGLImpl(IReferenceCounters* pRefCounters, class RenderDeviceGLImpl* pDeviceGL, bool bIsDeferred) :
+static bool IsDynamicRingBufferCompatible(const BufferDesc& Desc)
+{
+    // Vertex and index buffers are bound through VAOs that reference the entire buffer,
+    // so only uniform buffers can be suballocated from the ring buffer.
+    return Desc.Usage == USAGE_DYNAMIC && Desc.BindFlags == BIND_UNIFORM_BUFFER;
+}
+
+DeviceContextGLImpl::DeviceContextGLImpl(IReferenceCounters*       pRefCounters,
+                                         RenderDeviceGLImpl*       pDeviceGL,
+                                         bool                      bIsDeferred,
+                                         const EngineGLCreateInfo& EngineCI) :
     // clang-format off
     TDeviceContextBase
     {
@@ -71,6 +81,33 @@ DeviceContextGLImpl::DeviceContextGLImpl(IReferenceCounters* pRefCounters, class
 {
     m_BoundWritableTextures.reserve(16);
     m_BoundWritableBuffers.reserve(16);
+
+#if GL_ARB_buffer_storage
+    const auto& DeviceCaps = pDeviceGL->GetDeviceCaps();
+    if (EngineCI.DynamicHeapSize > 0 && DeviceCaps.DevType == RENDER_DEVICE_TYPE_GL)
+    {
+        const bool IsGL44OrAbove = (DeviceCaps.MajorVersion >= 5) || (DeviceCaps.MajorVersion == 4 && DeviceCaps.MinorVersion >= 4);
+        if (IsGL44OrAbove || pDeviceGL->CheckExtension("GL_ARB_buffer_storage"))
+        {
+            try
+            {
+                m_pDynamicRingBuffer.reset(new GLDynamicRingBuffer{m_ContextState, EngineCI.DynamicHeapSize});
+            }
+            catch (const std::runtime_error&)
+            {
+                LOG_WARNING_MESSAGE("Failed to create the dynamic ring buffer. Dynamic buffers will use their own storage.");
+            }
+        }
+    }
+#else
+    (void)EngineCI;
+#endif
+}
+
+DeviceContextGLImpl::~DeviceContextGLImpl()
+{
+    // Buffers may outlive the context, so they must not keep pointers to its ring buffer
+    ReleaseRingAllocations(false);
 }
 
 IMPLEMENT_QUERY_INTERFACE(DeviceContextGLImpl, IID_DeviceContextGL, TDeviceContextBase)
@@ -82,6 +119,17 @@ void DeviceContextGLImpl::SetPipelineState(IPipelineState* pPipelineState)
     if (PipelineStateGLImpl::IsSameObject(m_pPipelineState, pPipelineStateGLImpl))
         return;
 
+    // Wait for the programs if they are being linked in the background
+    if (pPipelineStateGLImpl->GetStatus(true) != PIPELINE_STATE_STATUS_READY)
+    {
+        LOG_ERROR_MESSAGE("Pipeline state '", pPipelineStateGLImpl->GetDesc().Name, "' can't be bound because its creation failed. "
+                                                                                    "Draw and dispatch commands will be ignored until another pipeline state is bound.");
+        // Do not leave the previous pipeline bound: the draw commands intended for the failed
+        // pipeline would otherwise silently be executed with it.
+        m_pPipelineState = nullptr;
+        return;
+    }
+
     TDeviceContextBase::SetPipelineState(pPipelineStateGLImpl, 0 /*Dummy*/);
 
     const auto& Desc = pPipelineStateGLImpl->GetDesc();
@@ -214,6 +262,7 @@ void DeviceContextGLImpl::InvalidateState()
     m_ContextState.Invalidate();
     m_BoundWritableTextures.clear();
     m_BoundWritableBuffers.clear();
+    m_BoundDynamicUniformBuffers.clear();
     m_IsDefaultFBOBound = false;
 }
 
@@ -654,6 +703,10 @@ void DeviceContextGLImpl::BindProgramResources(Uint32& NewMemoryBarriers, IShade
     VERIFY_EXPR(m_BoundWritableTextures.empty());
     VERIFY_EXPR(m_BoundWritableBuffers.empty());
 
+    // Uniform buffers, textures and samplers are collected first and then committed to
+    // the context state in batches. Null entries leave the corresponding slots intact.
+    m_BoundDynamicUniformBuffers.clear();
+    m_UBsToBind.assign(ResourceCache.GetUBCount(), nullptr);
     for (Uint32 ub = 0; ub < ResourceCache.GetUBCount(); ++ub)
     {
         const auto& UB = ResourceCache.GetConstUB(ub);
@@ -666,10 +719,24 @@ void DeviceContextGLImpl::BindProgramResources(Uint32& NewMemoryBarriers, IShade
                                     // will reflect data written by shaders prior to the barrier
             m_ContextState);
 
-        m_ContextState.BindUniformBuffer(ub, pBufferGL->m_GlBuffer);
-        //glBindBufferRange(GL_UNIFORM_BUFFER, it->Index, pBufferGL->m_GlBuffer, 0, pBufferGL->GetDesc().uiSizeInBytes);
+        if (m_pDynamicRingBuffer && IsDynamicRingBufferCompatible(pBufferGL->GetDesc()))
+        {
+            // Will be bound by BindDynamicUniformBuffers()
+            m_BoundDynamicUniformBuffers.emplace_back(ub, pBufferGL);
+        }
+        else
+        {
+            m_UBsToBind[ub] = &pBufferGL->m_GlBuffer;
+        }
     }
+    m_ContextState.BindUniformBuffers(0, static_cast<Uint32>(m_UBsToBind.size()), m_UBsToBind.data());
+
+    // Use default texture sampling parameters when no sampler is assigned
+    static const GLObjectWrappers::GLSamplerObj NullSampler{false};
 
+    m_TexturesToBind.assign(ResourceCache.GetSamplerCount(), nullptr);
+    m_TexTargetsToBind.resize(ResourceCache.GetSamplerCount());
+    m_SamplersToBind.assign(ResourceCache.GetSamplerCount(), nullptr);
     for (Uint32 s = 0; s < ResourceCache.GetSamplerCount(); ++s)
     {
         const auto& Sam = ResourceCache.GetConstSampler(s);
@@ -682,7 +749,8 @@ void DeviceContextGLImpl::BindProgramResources(Uint32& NewMemoryBarriers, IShade
             auto* pTexViewGL = Sam.pView.RawPtr<TextureViewGLImpl>();
             auto* pTextureGL = ValidatedCast<TextureBaseGL>(Sam.pTexture);
             VERIFY_EXPR(pTextureGL == pTexViewGL->GetTexture());
-            m_ContextState.BindTexture(s, pTexViewGL->GetBindTarget(), pTexViewGL->GetHandle());
+            m_TexturesToBind[s]   = &pTexViewGL->GetHandle();
+            m_TexTargetsToBind[s] = pTexViewGL->GetBindTarget();
 
             pTextureGL->TextureMemoryBarrier(
                 GL_TEXTURE_FETCH_BARRIER_BIT, // Texture fetches from shaders, including fetches from buffer object
@@ -690,14 +758,7 @@ void DeviceContextGLImpl::BindProgramResources(Uint32& NewMemoryBarriers, IShade
                                               // written by shaders prior to the barrier
                 m_ContextState);
 
-            if (Sam.pSampler)
-            {
-                m_ContextState.BindSampler(s, Sam.pSampler->GetHandle());
-            }
-            else
-            {
-                m_ContextState.BindSampler(s, GLObjectWrappers::GLSamplerObj(false));
-            }
+            m_SamplersToBind[s] = Sam.pSampler ? &Sam.pSampler->GetHandle() : &NullSampler;
         }
         else if (Sam.pBuffer != nullptr)
         {
@@ -705,8 +766,9 @@ void DeviceContextGLImpl::BindProgramResources(Uint32& NewMemoryBarriers, IShade
             auto* pBufferGL  = ValidatedCast<BufferGLImpl>(Sam.pBuffer);
             VERIFY_EXPR(pBufferGL == pBufViewGL->GetBuffer());
 
-            m_ContextState.BindTexture(s, GL_TEXTURE_BUFFER, pBufViewGL->GetTexBufferHandle());
-            m_ContextState.BindSampler(s, GLObjectWrappers::GLSamplerObj(false)); // Use default texture sampling parameters
+            m_TexturesToBind[s]   = &pBufViewGL->GetTexBufferHandle();
+            m_TexTargetsToBind[s] = GL_TEXTURE_BUFFER;
+            m_SamplersToBind[s]   = &NullSampler;
 
             pBufferGL->BufferMemoryBarrier(
                 GL_TEXTURE_FETCH_BARRIER_BIT, // Texture fetches from shaders, including fetches from buffer object
@@ -715,6 +777,8 @@ void DeviceContextGLImpl::BindProgramResources(Uint32& NewMemoryBarriers, IShade
                 m_ContextState);
         }
     }
+    m_ContextState.BindTextures(0, static_cast<Uint32>(m_TexturesToBind.size()), m_TexTargetsToBind.data(), m_TexturesToBind.data());
+    m_ContextState.BindSamplers(0, static_cast<Uint32>(m_SamplersToBind.size()), m_SamplersToBind.data());
 
 #if GL_ARB_shader_image_load_store
     for (Uint32 img = 0; img < ResourceCache.GetImageCount(); ++img)
@@ -884,6 +948,38 @@ void DeviceContextGLImpl::BindProgramResources(Uint32& NewMemoryBarriers, IShade
 #endif
 }
 
+void DeviceContextGLImpl::BindDynamicUniformBuffers()
+{
+    if (m_BoundDynamicUniformBuffers.empty())
+        return;
+
+    // The slots are sorted in ascending order by BindProgramResources()
+    const Uint32 FirstSlot = m_BoundDynamicUniformBuffers.front().first;
+    const Uint32 NumSlots  = m_BoundDynamicUniformBuffers.back().first - FirstSlot + 1;
+    m_UBsToBind.assign(NumSlots, nullptr);
+    m_UBOffsetsToBind.resize(NumSlots);
+    m_UBSizesToBind.resize(NumSlots);
+    for (const auto& SlotAndBuffer : m_BoundDynamicUniformBuffers)
+    {
+        const auto* pBufferGL = SlotAndBuffer.second.RawPtr();
+        const auto  Idx       = SlotAndBuffer.first - FirstSlot;
+        if (pBufferGL->m_pDynamicGLBuffer != nullptr)
+        {
+            // Allocations of the previous frames are released by FinishFrame()
+            VERIFY_EXPR(pBufferGL->m_DynamicFrame == m_pDynamicRingBuffer->GetCurrentFrame());
+            m_UBsToBind[Idx]       = pBufferGL->m_pDynamicGLBuffer;
+            m_UBOffsetsToBind[Idx] = pBufferGL->m_DynamicOffset;
+        }
+        else
+        {
+            m_UBsToBind[Idx]       = &pBufferGL->m_GlBuffer;
+            m_UBOffsetsToBind[Idx] = 0;
+        }
+        m_UBSizesToBind[Idx] = pBufferGL->GetDesc().uiSizeInBytes;
+    }
+    m_ContextState.BindUniformBuffers(FirstSlot, NumSlots, m_UBsToBind.data(), m_UBOffsetsToBind.data(), m_UBSizesToBind.data());
+}
+
 void DeviceContextGLImpl::PrepareForDraw(DRAW_FLAGS Flags, bool IsIndexed, GLenum& GlTopology)
 {
 #ifdef DILIGENT_DEVELOPMENT
@@ -894,6 +990,7 @@ void DeviceContextGLImpl::PrepareForDraw(DRAW_FLAGS Flags, bool IsIndexed, GLenu
     // The program might have changed since the last SetPipelineState call if a shader was
     // created after the call (GLProgramResources needs to bind a program to load uniforms).
     m_pPipelineState->CommitProgram(m_ContextState);
+    BindDynamicUniformBuffers();
 
     auto        CurrNativeGLContext = m_pDevice->m_GLContext.GetCurrentNativeGLContext();
     const auto& PipelineDesc        = m_pPipelineState->GetGraphicsPipelineDesc();
@@ -952,25 +1049,70 @@ void DeviceContextGLImpl::PostDraw()
     m_CommitedResourcesTentativeBarriers = 0;
 }
 
-void DeviceContextGLImpl::Draw(const DrawAttribs& Attribs)
+static void DrawArraysGL(GLenum GlTopology, Uint32 NumVertices, Uint32 NumInstances, Uint32 StartVertexLocation, Uint32 FirstInstanceLocation)
 {
-    if (!DvpVerifyDrawArguments(Attribs))
-        return;
+    if (NumInstances > 1 || FirstInstanceLocation != 0)
+    {
+        if (FirstInstanceLocation != 0)
+            glDrawArraysInstancedBaseInstance(GlTopology, StartVertexLocation, NumVertices, NumInstances, FirstInstanceLocation);
+        else
+            glDrawArraysInstanced(GlTopology, StartVertexLocation, NumVertices, NumInstances);
+    }
+    else
+    {
+        glDrawArrays(GlTopology, StartVertexLocation, NumVertices);
+    }
+}
 
-    GLenum GlTopology;
-    PrepareForDraw(Attribs.Flags, false, GlTopology);
+static void DrawElementsGL(GLenum GlTopology,
+                           Uint32 NumIndices,
+                           GLenum GLIndexType,
+                           Uint32 FirstIndexByteOffset,
+                           Uint32 NumInstances,
+                           Uint32 BaseVertex,
+                           Uint32 FirstInstanceLocation)
+{
+    // NOTE: Base Vertex and Base Instance versions are not supported even in OpenGL ES 3.1
+    // This functionality can be emulated by adjusting stream offsets. This, however may cause
+    // errors in case instance data is read from the same stream as vertex data. Thus handling
+    // such cases is left to the application
 
-    if (Attribs.NumInstances > 1 || Attribs.FirstInstanceLocation != 0)
+    auto* pIndices = reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset));
+    if (NumInstances > 1 || FirstInstanceLocation != 0)
     {
-        if (Attribs.FirstInstanceLocation != 0)
-            glDrawArraysInstancedBaseInstance(GlTopology, Attribs.StartVertexLocation, Attribs.NumVertices, Attribs.NumInstances, Attribs.FirstInstanceLocation);
+        if (BaseVertex > 0)
+        {
+            if (FirstInstanceLocation != 0)
+                glDrawElementsInstancedBaseVertexBaseInstance(GlTopology, NumIndices, GLIndexType, pIndices, NumInstances, BaseVertex, FirstInstanceLocation);
+            else
+                glDrawElementsInstancedBaseVertex(GlTopology, NumIndices, GLIndexType, pIndices, NumInstances, BaseVertex);
+        }
         else
-            glDrawArraysInstanced(GlTopology, Attribs.StartVertexLocation, Attribs.NumVertices, Attribs.NumInstances);
+        {
+            if (FirstInstanceLocation != 0)
+                glDrawElementsInstancedBaseInstance(GlTopology, NumIndices, GLIndexType, pIndices, NumInstances, FirstInstanceLocation);
+            else
+                glDrawElementsInstanced(GlTopology, NumIndices, GLIndexType, pIndices, NumInstances);
+        }
     }
     else
     {
-        glDrawArrays(GlTopology, Attribs.StartVertexLocation, Attribs.NumVertices);
+        if (BaseVertex > 0)
+            glDrawElementsBaseVertex(GlTopology, NumIndices, GLIndexType, pIndices, BaseVertex);
+        else
+            glDrawElements(GlTopology, NumIndices, GLIndexType, pIndices);
     }
+}
+
+void DeviceContextGLImpl::Draw(const DrawAttribs& Attribs)
+{
+    if (!DvpVerifyDrawArguments(Attribs) || !m_pPipelineState)
+        return;
+
+    GLenum GlTopology;
+    PrepareForDraw(Attribs.Flags, false, GlTopology);
+
+    DrawArraysGL(GlTopology, Attribs.NumVertices, Attribs.NumInstances, Attribs.StartVertexLocation, Attribs.FirstInstanceLocation);
     DEV_CHECK_GL_ERROR("OpenGL draw command failed");
 
     PostDraw();
@@ -978,7 +1120,7 @@ void DeviceContextGLImpl::Draw(const DrawAttribs& Attribs)
 
 void DeviceContextGLImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 {
-    if (!DvpVerifyDrawIndexedArguments(Attribs))
+    if (!DvpVerifyDrawIndexedArguments(Attribs) || !m_pPipelineState)
         return;
 
     GLenum GlTopology;
@@ -987,36 +1129,92 @@ void DeviceContextGLImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
     Uint32 FirstIndexByteOffset;
     PrepareForIndexedDraw(Attribs.IndexType, Attribs.FirstIndexLocation, GLIndexType, FirstIndexByteOffset);
 
-    // NOTE: Base Vertex and Base Instance versions are not supported even in OpenGL ES 3.1
-    // This functionality can be emulated by adjusting stream offsets. This, however may cause
-    // errors in case instance data is read from the same stream as vertex data. Thus handling
-    // such cases is left to the application
+    DrawElementsGL(GlTopology, Attribs.NumIndices, GLIndexType, FirstIndexByteOffset, Attribs.NumInstances, Attribs.BaseVertex, Attribs.FirstInstanceLocation);
+    DEV_CHECK_GL_ERROR("OpenGL draw command failed");
+
+    PostDraw();
+}
+
+void DeviceContextGLImpl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    if (!DvpVerifyMultiDrawArguments(Attribs) || !m_pPipelineState)
+        return;
+
+    if (Attribs.DrawCount == 0)
+        return;
 
-    if (Attribs.NumInstances > 1 || Attribs.FirstInstanceLocation != 0)
+    GLenum GlTopology;
+    PrepareForDraw(Attribs.Flags, false, GlTopology);
+
+#if GL_VERSION_1_4
+    if (Attribs.NumInstances == 1 && Attribs.FirstInstanceLocation == 0)
     {
-        if (Attribs.BaseVertex > 0)
+        m_MultiDrawFirsts.resize(Attribs.DrawCount);
+        m_MultiDrawCounts.resize(Attribs.DrawCount);
+        for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
         {
-            if (Attribs.FirstInstanceLocation != 0)
-                glDrawElementsInstancedBaseVertexBaseInstance(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.NumInstances, Attribs.BaseVertex, Attribs.FirstInstanceLocation);
-            else
-                glDrawElementsInstancedBaseVertex(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.NumInstances, Attribs.BaseVertex);
+            const auto& Item     = Attribs.pDrawItems[i];
+            m_MultiDrawFirsts[i] = static_cast<GLint>(Item.StartVertexLocation);
+            m_MultiDrawCounts[i] = static_cast<GLsizei>(Item.NumVertices);
         }
-        else
+        glMultiDrawArrays(GlTopology, m_MultiDrawFirsts.data(), m_MultiDrawCounts.data(), static_cast<GLsizei>(Attribs.DrawCount));
+    }
+    else
+#endif
+    {
+        for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
         {
-            if (Attribs.FirstInstanceLocation != 0)
-                glDrawElementsInstancedBaseInstance(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.NumInstances, Attribs.FirstInstanceLocation);
-            else
-                glDrawElementsInstanced(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.NumInstances);
+            const auto& Item = Attribs.pDrawItems[i];
+            DrawArraysGL(GlTopology, Item.NumVertices, Attribs.NumInstances, Item.StartVertexLocation, Attribs.FirstInstanceLocation);
+        }
+    }
+    DEV_CHECK_GL_ERROR("OpenGL multi-draw command failed");
+
+    PostDraw();
+}
+
+void DeviceContextGLImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    if (!DvpVerifyMultiDrawIndexedArguments(Attribs) || !m_pPipelineState)
+        return;
+
+    if (Attribs.DrawCount == 0)
+        return;
+
+    GLenum GlTopology;
+    PrepareForDraw(Attribs.Flags, true, GlTopology);
+    GLenum GLIndexType;
+    Uint32 FirstIndexByteOffset;
+    PrepareForIndexedDraw(Attribs.IndexType, 0, GLIndexType, FirstIndexByteOffset);
+    const auto IndexSize = static_cast<Uint32>(GetValueSize(Attribs.IndexType));
+
+#if GL_ARB_draw_elements_base_vertex
+    if (Attribs.NumInstances == 1 && Attribs.FirstInstanceLocation == 0)
+    {
+        m_MultiDrawCounts.resize(Attribs.DrawCount);
+        m_MultiDrawIndexOffsets.resize(Attribs.DrawCount);
+        m_MultiDrawBaseVertices.resize(Attribs.DrawCount);
+        for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+        {
+            const auto& Item           = Attribs.pDrawItems[i];
+            m_MultiDrawCounts[i]       = static_cast<GLsizei>(Item.NumIndices);
+            m_MultiDrawIndexOffsets[i] = reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset + Item.FirstIndexLocation * IndexSize));
+            m_MultiDrawBaseVertices[i] = static_cast<GLint>(Item.BaseVertex);
         }
+        glMultiDrawElementsBaseVertex(GlTopology, m_MultiDrawCounts.data(), GLIndexType, m_MultiDrawIndexOffsets.data(),
+                                      static_cast<GLsizei>(Attribs.DrawCount), m_MultiDrawBaseVertices.data());
     }
     else
+#endif
     {
-        if (Attribs.BaseVertex > 0)
-            glDrawElementsBaseVertex(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.BaseVertex);
-        else
-            glDrawElements(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)));
+        for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+        {
+            const auto& Item = Attribs.pDrawItems[i];
+            DrawElementsGL(GlTopology, Item.NumIndices, GLIndexType, FirstIndexByteOffset + Item.FirstIndexLocation * IndexSize,
+                           Attribs.NumInstances, Item.BaseVertex, Attribs.FirstInstanceLocation);
+        }
     }
-    DEV_CHECK_GL_ERROR("OpenGL draw command failed");
+    DEV_CHECK_GL_ERROR("OpenGL multi-draw command failed");
 
     PostDraw();
 }
@@ -1042,7 +1240,7 @@ void DeviceContextGLImpl::PrepareForIndirectDraw(IBuffer* pAttribsBuffer)
 
 void DeviceContextGLImpl::DrawIndirect(const DrawIndirectAttribs& Attribs, IBuffer* pAttribsBuffer)
 {
-    if (!DvpVerifyDrawIndirectArguments(Attribs, pAttribsBuffer))
+    if (!DvpVerifyDrawIndirectArguments(Attribs, pAttribsBuffer) || !m_pPipelineState)
         return;
 
 #if GL_ARB_draw_indirect
@@ -1073,7 +1271,7 @@ void DeviceContextGLImpl::DrawIndirect(const DrawIndirectAttribs& Attribs, IBuff
 
 void DeviceContextGLImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs, IBuffer* pAttribsBuffer)
 {
-    if (!DvpVerifyDrawIndexedIndirectArguments(Attribs, pAttribsBuffer))
+    if (!DvpVerifyDrawIndexedIndirectArguments(Attribs, pAttribsBuffer) || !m_pPipelineState)
         return;
 
 #if GL_ARB_draw_indirect
@@ -1119,13 +1317,14 @@ void DeviceContextGLImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attrib
 
 void DeviceContextGLImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 {
-    if (!DvpVerifyDispatchArguments(Attribs))
+    if (!DvpVerifyDispatchArguments(Attribs) || !m_pPipelineState)
         return;
 
 #if GL_ARB_compute_shader
     // The program might have changed since the last SetPipelineState call if a shader was
     // created after the call (GLProgramResources needs to bind a program to load uniforms).
     m_pPipelineState->CommitProgram(m_ContextState);
+    BindDynamicUniformBuffers();
     glDispatchCompute(Attribs.ThreadGroupCountX, Attribs.ThreadGroupCountY, Attribs.ThreadGroupCountZ);
     DEV_CHECK_GL_ERROR("glDispatchCompute() failed");
 
@@ -1137,13 +1336,14 @@ void DeviceContextGLImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 
 void DeviceContextGLImpl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs, IBuffer* pAttribsBuffer)
 {
-    if (!DvpVerifyDispatchIndirectArguments(Attribs, pAttribsBuffer))
+    if (!DvpVerifyDispatchIndirectArguments(Attribs, pAttribsBuffer) || !m_pPipelineState)
         return;
 
 #if GL_ARB_compute_shader
     // The program might have changed since the last SetPipelineState call if a shader was
     // created after the call (GLProgramResources needs to bind a program to load uniforms).
     m_pPipelineState->CommitProgram(m_ContextState);
+    BindDynamicUniformBuffers();
 
     auto* pBufferGL = ValidatedCast<BufferGLImpl>(pAttribsBuffer);
     pBufferGL->BufferMemoryBarrier(
@@ -1272,8 +1472,55 @@ void DeviceContextGLImpl::Flush()
     glFlush();
 }
 
+void DeviceContextGLImpl::GetBindingStatistics(BindingStatisticsGL& LastFrameStats, BindingStatisticsGL& TotalStats) const
+{
+    LastFrameStats = m_ContextState.GetFrameStatistics();
+    TotalStats     = m_ContextState.GetTotalStatistics();
+}
+
+void DeviceContextGLImpl::ReleaseRingAllocations(bool PreserveContents)
+{
+    bool ContentsCopied = false;
+    for (auto& pBufferGL : m_RingAllocatedBuffers)
+    {
+        if (pBufferGL->m_pDynamicGLBuffer == nullptr)
+            continue;
+
+        if (PreserveContents)
+        {
+            constexpr bool ResetVAO = false; // No need to reset VAO for READ/WRITE targets
+            m_ContextState.BindBuffer(GL_COPY_READ_BUFFER, *pBufferGL->m_pDynamicGLBuffer, ResetVAO);
+            m_ContextState.BindBuffer(GL_COPY_WRITE_BUFFER, pBufferGL->m_GlBuffer, ResetVAO);
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, pBufferGL->m_DynamicOffset, 0, pBufferGL->GetDesc().uiSizeInBytes);
+            DEV_CHECK_GL_ERROR("Failed to copy dynamic buffer '", pBufferGL->GetDesc().Name, "' from the ring buffer");
+            ContentsCopied = true;
+        }
+        pBufferGL->m_pDynamicGLBuffer = nullptr;
+        pBufferGL->m_DynamicOffset    = 0;
+    }
+    m_RingAllocatedBuffers.clear();
+
+    if (ContentsCopied)
+    {
+        constexpr bool ResetVAO = false;
+        m_ContextState.BindBuffer(GL_COPY_READ_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
+        m_ContextState.BindBuffer(GL_COPY_WRITE_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
+    }
+}
+
 void DeviceContextGLImpl::FinishFrame()
 {
+    if (m_pDynamicRingBuffer)
+    {
+        // The copies must be issued before the fence that releases the frame's allocations
+        ReleaseRingAllocations(true);
+        m_pDynamicRingBuffer->FinishFrame();
+    }
+
+    auto CurrNativeGLContext = m_pDevice->m_GLContext.GetCurrentNativeGLContext();
+    m_pDevice->GetVAOCache(CurrNativeGLContext).UnbindDestroyedBuffers(m_ContextState);
+
+    m_ContextState.FinishFrame();
 }
 
 void DeviceContextGLImpl::FinishCommandList(class ICommandList** ppCommandList)
@@ -1457,6 +1704,41 @@ void DeviceContextGLImpl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAG
 {
     TDeviceContextBase::MapBuffer(pBuffer, MapType, MapFlags, pMappedData);
     auto* pBufferGL = ValidatedCast<BufferGLImpl>(pBuffer);
+
+    const auto& BuffDesc = pBufferGL->GetDesc();
+    if (m_pDynamicRingBuffer && MapType == MAP_WRITE && IsDynamicRingBufferCompatible(BuffDesc))
+    {
+        // Allocations made in previous frames may have been recycled, so
+        // MAP_FLAG_NO_OVERWRITE can only reuse the allocation from this frame.
+        const auto CurrentFrame = m_pDynamicRingBuffer->GetCurrentFrame();
+        if ((MapFlags & MAP_FLAG_DISCARD) != 0 || pBufferGL->m_pDynamicGLBuffer == nullptr || pBufferGL->m_DynamicFrame != CurrentFrame)
+        {
+            const auto Offset = m_pDynamicRingBuffer->Allocate(BuffDesc.uiSizeInBytes);
+            if (Offset != GLDynamicRingBuffer::InvalidOffset)
+            {
+                if (pBufferGL->m_pDynamicGLBuffer == nullptr)
+                    m_RingAllocatedBuffers.emplace_back(pBufferGL);
+                pBufferGL->m_pDynamicGLBuffer = &m_pDynamicRingBuffer->GetGLBuffer();
+                pBufferGL->m_DynamicOffset    = Offset;
+                pBufferGL->m_DynamicFrame     = CurrentFrame;
+            }
+            else
+            {
+                LOG_WARNING_MESSAGE_ONCE("Dynamic ring buffer is exhausted by the allocations made in the current frame. "
+                                         "Increase EngineGLCreateInfo::DynamicHeapSize to avoid the slow path.");
+                // Fall back to mapping the buffer's own storage
+                pBufferGL->m_pDynamicGLBuffer = nullptr;
+                pBufferGL->m_DynamicOffset    = 0;
+            }
+        }
+
+        if (pBufferGL->m_pDynamicGLBuffer != nullptr)
+        {
+            pMappedData = m_pDynamicRingBuffer->GetCPUAddress(pBufferGL->m_DynamicOffset);
+            return;
+        }
+    }
+
     pBufferGL->Map(m_ContextState, MapType, MapFlags, pMappedData);
 }
 
@@ -1464,7 +1746,10 @@ void DeviceContextGLImpl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
 {
     TDeviceContextBase::UnmapBuffer(pBuffer, MapType);
     auto* pBufferGL = ValidatedCast<BufferGLImpl>(pBuffer);
-    pBufferGL->Unmap(m_ContextState);
+    // Ring buffer memory is mapped persistently and coherently, so the
+    // writes are visible to all subsequent commands without unmapping.
+    if (pBufferGL->m_pDynamicGLBuffer == nullptr)
+        pBufferGL->Unmap(m_ContextState);
 }
 
 void DeviceContextGLImpl::UpdateTexture(ITexture*                      pTexture,
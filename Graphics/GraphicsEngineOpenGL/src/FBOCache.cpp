@@ -67,17 +67,19 @@ std::size_t FBOCache::FBOCacheKeyHashFunc::operator()(const FBOCacheKey& Key) co
     if (Key.Hash == 0)
     {
         std::hash<TextureViewDesc> TexViewDescHasher;
-        Key.Hash = 0;
-        HashCombine(Key.Hash, Key.NumRenderTargets);
+
+        HashDataPacker<sizeof(Uint32) + (MAX_RENDER_TARGETS + 1) * (sizeof(UniqueIdentifier) + sizeof(size_t))> Packer;
+        Packer.Add(Key.NumRenderTargets);
         for (Uint32 rt = 0; rt < Key.NumRenderTargets; ++rt)
         {
-            HashCombine(Key.Hash, Key.RTIds[rt]);
+            Packer.Add(Key.RTIds[rt]);
             if (Key.RTIds[rt])
-                HashCombine(Key.Hash, TexViewDescHasher(Key.RTVDescs[rt]));
+                Packer.Add(TexViewDescHasher(Key.RTVDescs[rt]));
         }
-        HashCombine(Key.Hash, Key.DSId);
+        Packer.Add(Key.DSId);
         if (Key.DSId)
-            HashCombine(Key.Hash, TexViewDescHasher(Key.DSVDesc));
+            Packer.Add(TexViewDescHasher(Key.DSVDesc));
+        Key.Hash = Packer.GetHash();
     }
     return Key.Hash;
 }
@@ -268,14 +270,14 @@ const GLObjectWrappers::GLFrameBufferObj& FBOCache::GetFBO(Uint32             Nu
     auto It = m_Cache.find(Key);
     if (It != m_Cache.end())
     {
-        return It->second;
+        return *It->second;
     }
     else
     {
         // Create a new FBO
         auto NewFBO = CreateFBO(ContextState, NumRenderTargets, ppRTVs, pDSV);
 
-        auto NewElems = m_Cache.emplace(std::make_pair(Key, std::move(NewFBO)));
+        auto NewElems = m_Cache.emplace(std::make_pair(Key, std::unique_ptr<GLObjectWrappers::GLFrameBufferObj>{new GLObjectWrappers::GLFrameBufferObj{std::move(NewFBO)}}));
         // New element must be actually inserted
         VERIFY(NewElems.second, "New element was not inserted");
         if (Key.DSId != 0)
@@ -286,7 +288,7 @@ const GLObjectWrappers::GLFrameBufferObj& FBOCache::GetFBO(Uint32             Nu
                 m_TexIdToKey.insert(std::make_pair(Key.RTIds[rt], Key));
         }
 
-        return NewElems.first->second;
+        return *NewElems.first->second;
     }
 }
 
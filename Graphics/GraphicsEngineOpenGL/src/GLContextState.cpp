@@ -61,6 +61,29 @@ GLContextState::GLContextState(RenderDeviceGLImpl* pDeviceGL)
         VERIFY_EXPR(m_Caps.m_iMaxUniformBufferBindings > 0);
     }
 
+#if GL_ARB_multi_bind
+    if (DeviceCaps.DevType == RENDER_DEVICE_TYPE_GL)
+    {
+        const bool IsGL44OrAbove    = (DeviceCaps.MajorVersion >= 5) || (DeviceCaps.MajorVersion == 4 && DeviceCaps.MinorVersion >= 4);
+        m_Caps.IsMultiBindSupported = IsGL44OrAbove || pDeviceGL->CheckExtension("GL_ARB_multi_bind");
+    }
+#endif
+
+#if GL_ARB_vertex_attrib_binding
+    if (DeviceCaps.DevType == RENDER_DEVICE_TYPE_GL)
+    {
+        const bool IsGL43OrAbove              = (DeviceCaps.MajorVersion >= 5) || (DeviceCaps.MajorVersion == 4 && DeviceCaps.MinorVersion >= 3);
+        m_Caps.IsVertexAttribBindingSupported = IsGL43OrAbove || pDeviceGL->CheckExtension("GL_ARB_vertex_attrib_binding");
+    }
+    if (m_Caps.IsVertexAttribBindingSupported)
+    {
+        glGetIntegerv(GL_MAX_VERTEX_ATTRIB_BINDINGS, &m_Caps.m_iMaxVertexAttribBindings);
+        CHECK_GL_ERROR("Failed to get max vertex attrib bindings count");
+        glGetIntegerv(GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET, &m_Caps.m_iMaxVertexAttribRelativeOffset);
+        CHECK_GL_ERROR("Failed to get max vertex attrib relative offset");
+    }
+#endif
+
     m_BoundTextures.reserve(m_Caps.m_iMaxCombinedTexUnits);
     m_BoundSamplers.reserve(32);
     m_BoundImages.reserve(32);
@@ -72,6 +95,21 @@ GLContextState::GLContextState(RenderDeviceGLImpl* pDeviceGL)
     m_CurrentGLContext = pDeviceGL->m_GLContext.GetCurrentNativeGLContext();
 }
 
+GLContextState::~GLContextState()
+{
+    m_TotalStats += m_FrameStats;
+    LOG_INFO_MESSAGE("GL context state stats: ", m_TotalStats.NumGLCalls, " binding calls issued, ",
+                     m_TotalStats.NumFilteredCalls, " redundant calls filtered, ",
+                     m_TotalStats.NumMultiBoundSlots, " slots bound by ", m_TotalStats.NumMultiBindCalls, " multi-bind calls");
+}
+
+void GLContextState::FinishFrame()
+{
+    m_TotalStats += m_FrameStats;
+    m_LastFrameStats = m_FrameStats;
+    m_FrameStats     = Statistics{};
+}
+
 void GLContextState::Invalidate()
 {
 #if !PLATFORM_ANDROID
@@ -139,9 +177,14 @@ void GLContextState::SetProgram(const GLProgramObj& GLProgram)
     GLuint GLProgHandle = 0;
     if (UpdateBoundObject(m_GLProgId, GLProgram, GLProgHandle))
     {
+        ++m_FrameStats.NumGLCalls;
         glUseProgram(GLProgHandle);
         DEV_CHECK_GL_ERROR("Failed to set GL program");
     }
+    else
+    {
+        ++m_FrameStats.NumFilteredCalls;
+    }
 }
 
 void GLContextState::SetPipeline(const GLPipelineObj& GLPipeline)
@@ -149,9 +192,14 @@ void GLContextState::SetPipeline(const GLPipelineObj& GLPipeline)
     GLuint GLPipelineHandle = 0;
     if (UpdateBoundObject(m_GLPipelineId, GLPipeline, GLPipelineHandle))
     {
+        ++m_FrameStats.NumGLCalls;
         glBindProgramPipeline(GLPipelineHandle);
         DEV_CHECK_GL_ERROR("Failed to bind program pipeline");
     }
+    else
+    {
+        ++m_FrameStats.NumFilteredCalls;
+    }
 }
 
 void GLContextState::BindVAO(const GLVertexArrayObj& VAO)
@@ -159,9 +207,14 @@ void GLContextState::BindVAO(const GLVertexArrayObj& VAO)
     GLuint VAOHandle = 0;
     if (UpdateBoundObject(m_VAOId, VAO, VAOHandle))
     {
+        ++m_FrameStats.NumGLCalls;
         glBindVertexArray(VAOHandle);
         DEV_CHECK_GL_ERROR("Failed to set VAO");
     }
+    else
+    {
+        ++m_FrameStats.NumFilteredCalls;
+    }
 }
 
 void GLContextState::BindFBO(const GLFrameBufferObj& FBO)
@@ -169,6 +222,7 @@ void GLContextState::BindFBO(const GLFrameBufferObj& FBO)
     GLuint FBOHandle = 0;
     if (UpdateBoundObject(m_FBOId, FBO, FBOHandle))
     {
+        m_FrameStats.NumGLCalls += 2;
         // Even though the write mask only applies to writes to a framebuffer, the mask state is NOT
         // Framebuffer state. So it is NOT part of a Framebuffer Object or the Default Framebuffer.
         // Binding a new framebuffer will NOT affect the mask.
@@ -181,6 +235,10 @@ void GLContextState::BindFBO(const GLFrameBufferObj& FBO)
         glBindFramebuffer(GL_READ_FRAMEBUFFER, FBOHandle);
         DEV_CHECK_GL_ERROR("Failed to bind FBO as read framebuffer");
     }
+    else
+    {
+        ++m_FrameStats.NumFilteredCalls;
+    }
 }
 
 template <class ObjectType>
@@ -202,10 +260,15 @@ void GLContextState::SetActiveTexture(Int32 Index)
 
     if (m_iActiveTexture != Index)
     {
+        ++m_FrameStats.NumGLCalls;
         glActiveTexture(GL_TEXTURE0 + Index);
         DEV_CHECK_GL_ERROR("Failed to activate texture slot ", Index);
         m_iActiveTexture = Index;
     }
+    else
+    {
+        ++m_FrameStats.NumFilteredCalls;
+    }
 }
 
 void GLContextState::BindTexture(Int32 Index, GLenum BindTarget, const GLObjectWrappers::GLTextureObj& Tex)
@@ -222,9 +285,14 @@ void GLContextState::BindTexture(Int32 Index, GLenum BindTarget, const GLObjectW
     GLuint GLTexHandle = 0;
     if (UpdateBoundObjectsArr(m_BoundTextures, Index, Tex, GLTexHandle))
     {
+        ++m_FrameStats.NumGLCalls;
         glBindTexture(BindTarget, GLTexHandle);
         DEV_CHECK_GL_ERROR("Failed to bind texture to slot ", Index);
     }
+    else
+    {
+        ++m_FrameStats.NumFilteredCalls;
+    }
 }
 
 void GLContextState::BindSampler(Uint32 Index, const GLObjectWrappers::GLSamplerObj& GLSampler)
@@ -232,9 +300,14 @@ void GLContextState::BindSampler(Uint32 Index, const GLObjectWrappers::GLSampler
     GLuint GLSamplerHandle = 0;
     if (UpdateBoundObjectsArr(m_BoundSamplers, Index, GLSampler, GLSamplerHandle))
     {
+        ++m_FrameStats.NumGLCalls;
         glBindSampler(Index, GLSamplerHandle);
         DEV_CHECK_GL_ERROR("Failed to bind sampler to slot ", Index);
     }
+    else
+    {
+        ++m_FrameStats.NumFilteredCalls;
+    }
 }
 
 void GLContextState::BindImage(Uint32             Index,
@@ -260,10 +333,15 @@ void GLContextState::BindImage(Uint32             Index,
         m_BoundImages.resize(Index + 1);
     if (!(m_BoundImages[Index] == NewImageInfo))
     {
+        ++m_FrameStats.NumGLCalls;
         m_BoundImages[Index] = NewImageInfo;
         glBindImageTexture(Index, NewImageInfo.GLHandle, MipLevel, IsLayered, Layer, Access, Format);
         DEV_CHECK_GL_ERROR("glBindImageTexture() failed");
     }
+    else
+    {
+        ++m_FrameStats.NumFilteredCalls;
+    }
 #else
     UNSUPPORTED("GL_ARB_shader_image_load_store is not supported");
 #endif
@@ -286,10 +364,15 @@ void GLContextState::BindImage(Uint32 Index, BufferViewGLImpl* pBuffView, GLenum
         m_BoundImages.resize(Index + 1);
     if (!(m_BoundImages[Index] == NewImageInfo))
     {
+        ++m_FrameStats.NumGLCalls;
         m_BoundImages[Index] = NewImageInfo;
         glBindImageTexture(Index, NewImageInfo.GLHandle, 0, GL_FALSE, 0, Access, Format);
         DEV_CHECK_GL_ERROR("glBindImageTexture() failed");
     }
+    else
+    {
+        ++m_FrameStats.NumFilteredCalls;
+    }
 #else
     UNSUPPORTED("GL_ARB_shader_image_load_store is not supported");
 #endif
@@ -325,29 +408,44 @@ void GLContextState::GetBoundImage(Uint32     Index,
     }
 }
 
-void GLContextState::BindUniformBuffer(Int32 Index, const GLObjectWrappers::GLBufferObj& Buff)
+void GLContextState::BindUniformBuffer(Int32 Index, const GLObjectWrappers::GLBufferObj& Buff, GLintptr Offset, GLsizeiptr Size)
 {
     VERIFY(0 <= Index && Index < m_Caps.m_iMaxUniformBufferBindings, "Uniform buffer index is out of range");
+    VERIFY(Size != 0 || Offset == 0, "Offset must be zero when the whole buffer is bound");
+
+    BoundBufferInfo NewUBInfo{Buff.GetUniqueID(), Offset, Size};
+    if (Index >= static_cast<Int32>(m_BoundUniformBuffers.size()))
+        m_BoundUniformBuffers.resize(Index + 1);
 
-    GLuint GLBufferHandle = Buff;
-    if (UpdateBoundObjectsArr(m_BoundUniformBuffers, Index, Buff, GLBufferHandle))
+    if (!(m_BoundUniformBuffers[Index] == NewUBInfo))
     {
-        // In addition to binding buffer to the indexed buffer binding target, glBindBufferBase also binds
-        // buffer to the generic buffer binding point specified by target.
-        glBindBufferBase(GL_UNIFORM_BUFFER, Index, GLBufferHandle);
+        ++m_FrameStats.NumGLCalls;
+        m_BoundUniformBuffers[Index] = NewUBInfo;
+        GLuint GLBufferHandle        = Buff;
+        // In addition to binding buffer to the indexed buffer binding target, glBindBufferBase and
+        // glBindBufferRange also bind buffer to the generic buffer binding point specified by target.
+        if (Size != 0)
+            glBindBufferRange(GL_UNIFORM_BUFFER, Index, GLBufferHandle, Offset, Size);
+        else
+            glBindBufferBase(GL_UNIFORM_BUFFER, Index, GLBufferHandle);
         DEV_CHECK_GL_ERROR("Failed to bind uniform buffer to slot ", Index);
     }
+    else
+    {
+        ++m_FrameStats.NumFilteredCalls;
+    }
 }
 
 void GLContextState::BindStorageBlock(Int32 Index, const GLObjectWrappers::GLBufferObj& Buff, GLintptr Offset, GLsizeiptr Size)
 {
 #if GL_ARB_shader_storage_buffer_object
-    BoundSSBOInfo NewSSBOInfo{Buff.GetUniqueID(), Offset, Size};
+    BoundBufferInfo NewSSBOInfo{Buff.GetUniqueID(), Offset, Size};
     if (Index >= static_cast<Int32>(m_BoundStorageBlocks.size()))
         m_BoundStorageBlocks.resize(Index + 1);
 
     if (!(m_BoundStorageBlocks[Index] == NewSSBOInfo))
     {
+        ++m_FrameStats.NumGLCalls;
         m_BoundStorageBlocks[Index] = NewSSBOInfo;
         GLuint GLBufferHandle       = Buff;
         // In addition to binding buffer to the indexed buffer binding target, glBindBufferRange also binds
@@ -355,11 +453,156 @@ void GLContextState::BindStorageBlock(Int32 Index, const GLObjectWrappers::GLBuf
         glBindBufferRange(GL_SHADER_STORAGE_BUFFER, Index, GLBufferHandle, Offset, Size);
         DEV_CHECK_GL_ERROR("Failed to bind shader storage block to slot ", Index);
     }
+    else
+    {
+        ++m_FrameStats.NumFilteredCalls;
+    }
 #else
     UNSUPPORTED("GL_ARB_shader_image_load_store is not supported");
 #endif
 }
 
+template <typename ObjectType, typename UpdateSlotType, typename BindRangeType>
+void GLContextState::CommitMultiBind(Uint32 Count, const ObjectType* const* ppObjects, UpdateSlotType UpdateSlot, BindRangeType BindRange)
+{
+    if (m_MultiBindHandles.size() < Count)
+        m_MultiBindHandles.resize(Count);
+
+    Uint32 RangeStart = 0;
+    Uint32 RangeSize  = 0;
+    for (Uint32 i = 0; i <= Count; ++i)
+    {
+        if (i < Count && ppObjects[i] != nullptr)
+        {
+            if (UpdateSlot(i, *ppObjects[i], m_MultiBindHandles[i]))
+            {
+                if (RangeSize == 0)
+                    RangeStart = i;
+                ++RangeSize;
+                continue;
+            }
+            ++m_FrameStats.NumFilteredCalls;
+        }
+
+        // Commit the range of updated slots that ends here
+        if (RangeSize != 0)
+        {
+            BindRange(RangeStart, RangeSize, &m_MultiBindHandles[RangeStart]);
+            ++m_FrameStats.NumGLCalls;
+            ++m_FrameStats.NumMultiBindCalls;
+            m_FrameStats.NumMultiBoundSlots += RangeSize;
+            RangeSize = 0;
+        }
+    }
+}
+
+void GLContextState::BindTextures(Uint32 First, Uint32 Count, const GLenum* BindTargets, const GLTextureObj* const* ppTextures)
+{
+    VERIFY(First + Count <= static_cast<Uint32>(m_Caps.m_iMaxCombinedTexUnits), "Texture unit is out of range");
+
+#if GL_ARB_multi_bind
+    if (m_Caps.IsMultiBindSupported)
+    {
+        // glBindTextures binds every texture to the target it was created with and does not change the active texture unit
+        CommitMultiBind(
+            Count, ppTextures,
+            [&](Uint32 i, const GLTextureObj& Tex, GLuint& GLHandle) //
+            {
+                return UpdateBoundObjectsArr(m_BoundTextures, First + i, Tex, GLHandle);
+            },
+            [&](Uint32 Start, Uint32 NumSlots, const GLuint* GLHandles) //
+            {
+                glBindTextures(First + Start, NumSlots, GLHandles);
+                DEV_CHECK_GL_ERROR("Failed to bind textures to slots [", First + Start, ", ", First + Start + NumSlots, ")");
+            });
+        return;
+    }
+#endif
+
+    for (Uint32 i = 0; i < Count; ++i)
+    {
+        if (ppTextures[i] != nullptr)
+            BindTexture(First + i, BindTargets[i], *ppTextures[i]);
+    }
+}
+
+void GLContextState::BindSamplers(Uint32 First, Uint32 Count, const GLSamplerObj* const* ppSamplers)
+{
+#if GL_ARB_multi_bind
+    if (m_Caps.IsMultiBindSupported)
+    {
+        CommitMultiBind(
+            Count, ppSamplers,
+            [&](Uint32 i, const GLSamplerObj& Sampler, GLuint& GLHandle) //
+            {
+                return UpdateBoundObjectsArr(m_BoundSamplers, First + i, Sampler, GLHandle);
+            },
+            [&](Uint32 Start, Uint32 NumSlots, const GLuint* GLHandles) //
+            {
+                glBindSamplers(First + Start, NumSlots, GLHandles);
+                DEV_CHECK_GL_ERROR("Failed to bind samplers to slots [", First + Start, ", ", First + Start + NumSlots, ")");
+            });
+        return;
+    }
+#endif
+
+    for (Uint32 i = 0; i < Count; ++i)
+    {
+        if (ppSamplers[i] != nullptr)
+            BindSampler(First + i, *ppSamplers[i]);
+    }
+}
+
+void GLContextState::BindUniformBuffers(Uint32 First, Uint32 Count, const GLBufferObj* const* ppBuffers, const GLintptr* pOffsets, const GLsizeiptr* pSizes)
+{
+    VERIFY(First + Count <= static_cast<Uint32>(m_Caps.m_iMaxUniformBufferBindings), "Uniform buffer index is out of range");
+    VERIFY((pOffsets != nullptr) == (pSizes != nullptr), "Offsets and sizes must either both be null or both be non-null");
+
+#if GL_ARB_multi_bind
+    if (m_Caps.IsMultiBindSupported)
+    {
+        if (First + Count > m_BoundUniformBuffers.size())
+            m_BoundUniformBuffers.resize(First + Count);
+
+        CommitMultiBind(
+            Count, ppBuffers,
+            [&](Uint32 i, const GLBufferObj& Buff, GLuint& GLHandle) //
+            {
+                VERIFY(pSizes == nullptr || pSizes[i] != 0, "Size must not be zero when the buffer range is bound");
+                BoundBufferInfo NewUBInfo{Buff.GetUniqueID(), pOffsets != nullptr ? pOffsets[i] : 0, pSizes != nullptr ? pSizes[i] : 0};
+                if (m_BoundUniformBuffers[First + i] == NewUBInfo)
+                    return false;
+
+                m_BoundUniformBuffers[First + i] = NewUBInfo;
+                GLHandle                         = Buff;
+                return true;
+            },
+            [&](Uint32 Start, Uint32 NumSlots, const GLuint* GLHandles) //
+            {
+                // Similar to glBindBufferBase and glBindBufferRange, these functions bind the last
+                // buffer in the range to the generic GL_UNIFORM_BUFFER binding point.
+                if (pOffsets != nullptr)
+                    glBindBuffersRange(GL_UNIFORM_BUFFER, First + Start, NumSlots, GLHandles, pOffsets + Start, pSizes + Start);
+                else
+                    glBindBuffersBase(GL_UNIFORM_BUFFER, First + Start, NumSlots, GLHandles);
+                DEV_CHECK_GL_ERROR("Failed to bind uniform buffers to slots [", First + Start, ", ", First + Start + NumSlots, ")");
+            });
+        return;
+    }
+#endif
+
+    for (Uint32 i = 0; i < Count; ++i)
+    {
+        if (ppBuffers[i] != nullptr)
+        {
+            if (pOffsets != nullptr)
+                BindUniformBuffer(First + i, *ppBuffers[i], pOffsets[i], pSizes[i]);
+            else
+                BindUniformBuffer(First + i, *ppBuffers[i]);
+        }
+    }
+}
+
 void GLContextState::BindBuffer(GLenum BindTarget, const GLObjectWrappers::GLBufferObj& Buff, bool ResetVAO)
 {
     // Binding ARRAY_BUFFER or ELEMENT_ARRAY_BUFFER affects currently bound VAO
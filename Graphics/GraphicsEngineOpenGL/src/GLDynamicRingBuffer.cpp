@@ -0,0 +1,156 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "GLDynamicRingBuffer.hpp"
+#include "GLContextState.hpp"
+#include "EngineMemory.h"
+
+namespace Diligent
+{
+
+GLDynamicRingBuffer::GLDynamicRingBuffer(GLContextState& CtxState, Uint32 Size) :
+    // clang-format off
+    m_GLBuffer   {true                       },
+    m_Size       {Size                       },
+    m_RingBuffer {Size, GetRawAllocator()    }
+// clang-format on
+{
+#if GL_ARB_buffer_storage
+    GLint Alignment = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &Alignment);
+    CHECK_GL_ERROR("Failed to get uniform buffer offset alignment");
+    if (Alignment > 0)
+    {
+        VERIFY(IsPowerOfTwo(static_cast<Uint32>(Alignment)), "Uniform buffer offset alignment (", Alignment, ") is not power of 2");
+        m_Alignment = static_cast<Uint32>(Alignment);
+    }
+
+    constexpr GLbitfield Flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    // No need to reset VAO for the COPY_WRITE target
+    constexpr bool ResetVAO = false;
+    CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, m_GLBuffer, ResetVAO);
+    // Immutable storage that may stay mapped while the GL reads from it. Coherent mapping
+    // makes the writes visible to the commands issued after them without explicit flushes.
+    glBufferStorage(GL_COPY_WRITE_BUFFER, m_Size, nullptr, Flags);
+    CHECK_GL_ERROR_AND_THROW("glBufferStorage() failed");
+    m_pMappedData = reinterpret_cast<Uint8*>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, m_Size, Flags));
+    CHECK_GL_ERROR_AND_THROW("glMapBufferRange() failed");
+    CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
+
+    if (m_pMappedData == nullptr)
+        LOG_ERROR_AND_THROW("Failed to persistently map the dynamic ring buffer");
+#else
+    (void)CtxState;
+    LOG_ERROR_AND_THROW("Persistently mapped buffers are not supported");
+#endif
+}
+
+GLDynamicRingBuffer::~GLDynamicRingBuffer()
+{
+    LOG_INFO_MESSAGE("Dynamic ring buffer: peak usage: ", m_MaxUsedSize >> 10, " KB of ", m_Size >> 10, " KB; waits for the GPU: ", m_NumWaits);
+
+    // The buffer is implicitly unmapped when it is deleted, and the GL keeps
+    // the storage alive until the commands that reference it complete.
+    m_RingBuffer.FinishCurrentFrame(m_CurrentFrame);
+    m_RingBuffer.ReleaseCompletedFrames(m_CurrentFrame);
+}
+
+Uint32 GLDynamicRingBuffer::Allocate(Uint32 Size)
+{
+    auto Offset = m_RingBuffer.Allocate(Size, m_Alignment);
+    if (Offset == RingBuffer::InvalidOffset)
+    {
+        ReleaseCompletedFrames(false);
+        Offset = m_RingBuffer.Allocate(Size, m_Alignment);
+        // Wait for the oldest frames one by one until there is enough space. The space
+        // allocated in the current frame can't be released, so this may still fail.
+        while (Offset == RingBuffer::InvalidOffset && !m_PendingFrames.empty())
+        {
+            ReleaseCompletedFrames(true);
+            Offset = m_RingBuffer.Allocate(Size, m_Alignment);
+        }
+        if (Offset == RingBuffer::InvalidOffset)
+            return InvalidOffset;
+    }
+
+    ++m_NumCurrFrameAllocations;
+    m_MaxUsedSize = std::max(m_MaxUsedSize, m_RingBuffer.GetUsedSize());
+    return static_cast<Uint32>(Offset);
+}
+
+void GLDynamicRingBuffer::FinishFrame()
+{
+    // Frames that did not allocate anything do not need a fence
+    if (m_NumCurrFrameAllocations > 0)
+    {
+        m_RingBuffer.FinishCurrentFrame(m_CurrentFrame);
+        m_PendingFrames.emplace_back(m_CurrentFrame, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+        DEV_CHECK_GL_ERROR("Failed to create fence sync object");
+        m_NumCurrFrameAllocations = 0;
+    }
+    ++m_CurrentFrame;
+
+    ReleaseCompletedFrames(false);
+}
+
+void GLDynamicRingBuffer::ReleaseCompletedFrames(bool WaitForOldestFrame)
+{
+    Uint64 CompletedFrame = 0;
+    while (!m_PendingFrames.empty())
+    {
+        const auto& Frame = m_PendingFrames.front();
+
+        GLenum res = GL_TIMEOUT_EXPIRED;
+        if (WaitForOldestFrame && CompletedFrame == 0)
+        {
+            res = glClientWaitSync(Frame.second, GL_SYNC_FLUSH_COMMANDS_BIT, std::numeric_limits<GLuint64>::max());
+            VERIFY_EXPR(res == GL_ALREADY_SIGNALED || res == GL_CONDITION_SATISFIED);
+            ++m_NumWaits;
+        }
+        else
+        {
+            res = glClientWaitSync(Frame.second, 0, 0);
+        }
+
+        if (res != GL_ALREADY_SIGNALED && res != GL_CONDITION_SATISFIED)
+            break;
+
+        CompletedFrame = Frame.first;
+        m_PendingFrames.pop_front();
+    }
+
+    if (CompletedFrame != 0)
+        m_RingBuffer.ReleaseCompletedFrames(CompletedFrame);
+}
+
+} // namespace Diligent
@@ -0,0 +1,242 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include "GLProgramCache.hpp"
+#include "GLProgramResources.hpp"
+#include "GLContextState.hpp"
+#include "ShaderGLImpl.hpp"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+struct CacheEntryHeader
+{
+    static constexpr Uint32 ExpectedMagic   = 0x50474C44; // 'DLGP'
+    static constexpr Uint32 ExpectedVersion = 1;
+
+    Uint32 Magic         = ExpectedMagic;
+    Uint32 Version       = ExpectedVersion;
+    Uint64 Key           = 0;
+    Uint32 BinaryFormat  = 0;
+    Uint32 BinarySize    = 0;
+    Uint32 ResourcesSize = 0;
+    Uint32 Reserved      = 0;
+
+    // Bindings after the program resources have been loaded
+    GLProgramCache::ResourceBindings Bindings;
+};
+static_assert(sizeof(CacheEntryHeader) == 48, "Unexpected size of the cache entry header. Did you add padding?");
+
+} // namespace
+
+GLProgramCache::GLProgramCache(const Char* Directory) :
+    m_Directory{Directory}
+{
+    VERIFY_EXPR(Directory != nullptr && *Directory != 0);
+
+    if (!FileSystem::PathExists(Directory) && !FileSystem::CreateDirectory(Directory))
+        LOG_ERROR_AND_THROW("Failed to create program cache directory '", Directory, "'");
+
+    // Binaries are only valid for the driver that produced them
+    for (auto Name : {GL_VENDOR, GL_RENDERER, GL_VERSION})
+    {
+        const auto* Str = reinterpret_cast<const char*>(glGetString(Name));
+        if (Str != nullptr)
+            m_DriverHash = ComputeHashRaw(Str, strlen(Str), m_DriverHash);
+    }
+}
+
+GLProgramCache::~GLProgramCache()
+{
+    LOG_INFO_MESSAGE("GL program cache stats: ", m_Stats.NumHits, " hits, ", m_Stats.NumMisses, " misses, ",
+                     m_Stats.NumRejected, " entries rejected by the driver, ", m_Stats.NumStored, " entries stored");
+}
+
+Uint64 GLProgramCache::ComputeKey(ShaderGLImpl* const*    ppShaders,
+                                  Uint32                  NumShaders,
+                                  bool                    IsSeparableProgram,
+                                  const ResourceBindings& Bindings) const
+{
+    Uint64 Key = ComputeHashRaw(&Bindings, sizeof(Bindings), m_DriverHash);
+
+    const Uint32 IsSeparable = IsSeparableProgram ? 1 : 0;
+    Key                      = ComputeHashRaw(&IsSeparable, sizeof(IsSeparable), Key);
+    for (Uint32 i = 0; i < NumShaders; ++i)
+    {
+        const Uint64 ShaderData[] = {static_cast<Uint64>(ppShaders[i]->GetDesc().ShaderType), ppShaders[i]->GetSourceHash()};
+        Key                       = ComputeHashRaw(ShaderData, sizeof(ShaderData), Key);
+    }
+    return Key;
+}
+
+String GLProgramCache::GetEntryPath(Uint64 Key) const
+{
+    std::stringstream PathSS;
+    PathSS << m_Directory << FileSystem::GetSlashSymbol() << std::hex << std::setw(16) << std::setfill('0') << Key << ".bin";
+    return PathSS.str();
+}
+
+bool GLProgramCache::Load(Uint64                          Key,
+                          bool                            IsSeparableProgram,
+                          GLContextState&                 State,
+                          GLProgramResources&             Resources,
+                          ResourceBindings&               Bindings,
+                          GLObjectWrappers::GLProgramObj* pProgram)
+{
+    const auto Path = GetEntryPath(Key);
+    if (!FileSystem::FileExists(Path.c_str()))
+    {
+        ++m_Stats.NumMisses;
+        return false;
+    }
+
+    std::vector<Uint8> Data;
+    {
+        FileWrapper File{Path.c_str(), EFileAccessMode::Read};
+        if (File)
+        {
+            Data.resize(File->GetSize());
+            if (!File->Read(Data.data(), Data.size()))
+                Data.clear();
+        }
+    }
+
+    CacheEntryHeader Header;
+    if (Data.size() >= sizeof(Header))
+        memcpy(&Header, Data.data(), sizeof(Header));
+
+    // clang-format off
+    if (Data.size() < sizeof(Header)                           ||
+        Header.Magic   != CacheEntryHeader::ExpectedMagic      ||
+        Header.Version != CacheEntryHeader::ExpectedVersion    ||
+        Header.Key     != Key                                  ||
+        sizeof(Header) + size_t{Header.BinarySize} + Header.ResourcesSize != Data.size())
+    // clang-format on
+    {
+        LOG_WARNING_MESSAGE("Program cache entry '", Path, "' is corrupted");
+        ++m_Stats.NumMisses;
+        return false;
+    }
+
+    const auto* pBinary    = Data.data() + sizeof(Header);
+    const auto* pResources = pBinary + Header.BinarySize;
+
+    GLObjectWrappers::GLProgramObj Program{pProgram != nullptr};
+    if (pProgram != nullptr)
+    {
+        if (IsSeparableProgram)
+            glProgramParameteri(Program, GL_PROGRAM_SEPARABLE, GL_TRUE);
+
+        glProgramBinary(Program, Header.BinaryFormat, pBinary, static_cast<GLsizei>(Header.BinarySize));
+        GLint IsLinked = GL_FALSE;
+        glGetProgramiv(Program, GL_LINK_STATUS, &IsLinked);
+        // The driver generates GL_INVALID_ENUM if the binary format is no longer supported
+        if (glGetError() != GL_NO_ERROR || !IsLinked)
+        {
+            ++m_Stats.NumRejected;
+            return false;
+        }
+    }
+
+    if (!Resources.Deserialize(pResources, Header.ResourcesSize))
+    {
+        LOG_WARNING_MESSAGE("Failed to deserialize program resources from cache entry '", Path, "'");
+        ++m_Stats.NumMisses;
+        return false;
+    }
+
+    if (pProgram != nullptr)
+    {
+        Resources.ApplyBindings(Program, State);
+        *pProgram = std::move(Program);
+    }
+
+    Bindings = Header.Bindings;
+    ++m_Stats.NumHits;
+    return true;
+}
+
+void GLProgramCache::Store(Uint64                                Key,
+                           const GLObjectWrappers::GLProgramObj& Program,
+                           const GLProgramResources&             Resources,
+                           const ResourceBindings&               Bindings)
+{
+    GLint BinaryLength = 0;
+    glGetProgramiv(Program, GL_PROGRAM_BINARY_LENGTH, &BinaryLength);
+    if (glGetError() != GL_NO_ERROR || BinaryLength <= 0)
+    {
+        // Some drivers do not provide binaries for all programs
+        return;
+    }
+
+    std::vector<Uint8> Data(sizeof(CacheEntryHeader) + BinaryLength);
+
+    CacheEntryHeader Header;
+    Header.Key      = Key;
+    Header.Bindings = Bindings;
+
+    GLsizei Length       = 0;
+    GLenum  BinaryFormat = 0;
+    glGetProgramBinary(Program, BinaryLength, &Length, &BinaryFormat, Data.data() + sizeof(Header));
+    if (glGetError() != GL_NO_ERROR || Length <= 0)
+    {
+        LOG_WARNING_MESSAGE_ONCE("Failed to retrieve program binary");
+        return;
+    }
+    Data.resize(sizeof(Header) + Length);
+    Header.BinaryFormat = BinaryFormat;
+    Header.BinarySize   = static_cast<Uint32>(Length);
+
+    Resources.Serialize(Data);
+    Header.ResourcesSize = static_cast<Uint32>(Data.size() - sizeof(Header) - Header.BinarySize);
+    memcpy(Data.data(), &Header, sizeof(Header));
+
+    const auto Path = GetEntryPath(Key);
+
+    FileWrapper File{Path.c_str(), EFileAccessMode::Overwrite};
+    if (!File || !File->Write(Data.data(), Data.size()))
+    {
+        LOG_WARNING_MESSAGE("Failed to write program cache entry '", Path, "'");
+        return;
+    }
+    ++m_Stats.NumStored;
+}
+
+} // namespace Diligent
@@ -614,6 +614,113 @@ void GLProgramResources::LoadUniforms(SHADER_TYPE                           Shad
     AllocateResources(UniformBlocks, Samplers, Images, StorageBlocks);
 }
 
+void GLProgramResources::InitFromShader(const GLProgramResources& ShaderResources,
+                                        Uint32&                   UniformBufferBinding,
+                                        Uint32&                   SamplerBinding,
+                                        Uint32&                   ImageBinding,
+                                        Uint32&                   StorageBufferBinding)
+{
+    std::vector<UniformBufferInfo> UniformBlocks;
+    std::vector<SamplerInfo>       Samplers;
+    std::vector<ImageInfo>         Images;
+    std::vector<StorageBlockInfo>  StorageBlocks;
+
+    UniformBlocks.reserve(ShaderResources.GetNumUniformBuffers());
+    Samplers.reserve(ShaderResources.GetNumSamplers());
+    Images.reserve(ShaderResources.GetNumImages());
+    StorageBlocks.reserve(ShaderResources.GetNumStorageBlocks());
+
+    m_ShaderStages = ShaderResources.GetShaderStages();
+
+    // Every array element takes its own binding, the same way as in LoadUniforms()
+    Uint32 NumUBBindings = 0, NumSamBindings = 0, NumImgBindings = 0, NumSBBindings = 0;
+
+    // clang-format off
+    ShaderResources.ProcessConstResources(
+        [&](const UniformBufferInfo& UB)
+        {
+            UniformBlocks.emplace_back(UB.Name, UB.ShaderStages, UB.ResourceType, UniformBufferBinding + UB.Binding, UB.ArraySize, UB.UBIndex);
+            NumUBBindings = std::max(NumUBBindings, UB.Binding + UB.ArraySize);
+        },
+        [&](const SamplerInfo& Sam)
+        {
+            Samplers.emplace_back(Sam.Name, Sam.ShaderStages, Sam.ResourceType, SamplerBinding + Sam.Binding, Sam.ArraySize, Sam.Location, Sam.SamplerType);
+            NumSamBindings = std::max(NumSamBindings, Sam.Binding + Sam.ArraySize);
+        },
+        [&](const ImageInfo& Img)
+        {
+            Images.emplace_back(Img.Name, Img.ShaderStages, Img.ResourceType, ImageBinding + Img.Binding, Img.ArraySize, Img.Location, Img.ImageType);
+            NumImgBindings = std::max(NumImgBindings, Img.Binding + Img.ArraySize);
+        },
+        [&](const StorageBlockInfo& SB)
+        {
+            StorageBlocks.emplace_back(SB.Name, SB.ShaderStages, SB.ResourceType, StorageBufferBinding + SB.Binding, SB.ArraySize, SB.SBIndex);
+            NumSBBindings = std::max(NumSBBindings, SB.Binding + SB.ArraySize);
+        }
+    );
+    // clang-format on
+
+    UniformBufferBinding += NumUBBindings;
+    SamplerBinding += NumSamBindings;
+    ImageBinding += NumImgBindings;
+    StorageBufferBinding += NumSBBindings;
+
+    // Names are copied to the pool by AllocateResources()
+    AllocateResources(UniformBlocks, Samplers, Images, StorageBlocks);
+}
+
+void GLProgramResources::ResolveLocations(const GLObjectWrappers::GLProgramObj& GLProgram)
+{
+    VERIFY(GLProgram != 0, "Null GL program");
+
+    // Every element of a block array is enumerated individually with its own name, see LoadUniforms().
+    // Block indices of the elements are continuous, so only the index of the first element is needed.
+    auto GetFirstElementName = [](const GLResourceAttribs& Attribs) {
+        return String{Attribs.Name} + "[0]";
+    };
+
+    // clang-format off
+    ProcessResources(
+        [&](UniformBufferInfo& UB)
+        {
+            // glGetUniformBlockIndex(program, uniformBlockName) is equivalent to
+            // glGetProgramResourceIndex(program, GL_UNIFORM_BLOCK, uniformBlockName)
+            UB.UBIndex = glGetUniformBlockIndex(GLProgram, UB.Name);
+            if (UB.UBIndex == GL_INVALID_INDEX)
+                UB.UBIndex = glGetUniformBlockIndex(GLProgram, GetFirstElementName(UB).c_str());
+            CHECK_GL_ERROR("Unable to get uniform block index of '", UB.Name, '\'');
+            VERIFY(UB.UBIndex != GL_INVALID_INDEX, "Uniform block '", UB.Name, "' is not found in the program");
+        },
+        [&](SamplerInfo& Sam)
+        {
+            // For arrays, the location of the first element is returned
+            Sam.Location = glGetUniformLocation(GLProgram, Sam.Name);
+            CHECK_GL_ERROR("Unable to get location of sampler uniform '", Sam.Name, '\'');
+            VERIFY(Sam.Location >= 0, "Sampler uniform '", Sam.Name, "' is not found in the program");
+        },
+        [&](ImageInfo& Img)
+        {
+            Img.Location = glGetUniformLocation(GLProgram, Img.Name);
+            CHECK_GL_ERROR("Unable to get location of image uniform '", Img.Name, '\'');
+            VERIFY(Img.Location >= 0, "Image uniform '", Img.Name, "' is not found in the program");
+        },
+        [&](StorageBlockInfo& SB)
+        {
+#if GL_ARB_shader_storage_buffer_object
+            auto SBIndex = glGetProgramResourceIndex(GLProgram, GL_SHADER_STORAGE_BLOCK, SB.Name);
+            if (SBIndex == GL_INVALID_INDEX)
+                SBIndex = glGetProgramResourceIndex(GLProgram, GL_SHADER_STORAGE_BLOCK, GetFirstElementName(SB).c_str());
+            CHECK_GL_ERROR("Unable to get shader storage block index of '", SB.Name, '\'');
+            VERIFY(SBIndex != GL_INVALID_INDEX, "Shader storage block '", SB.Name, "' is not found in the program");
+            SB.SBIndex = static_cast<GLint>(SBIndex);
+#else
+            (void)SB;
+#endif
+        }
+    );
+    // clang-format on
+}
+
 ShaderResourceDesc GLProgramResources::GetResourceDesc(Uint32 Index) const
 {
     if (Index < m_NumUniformBuffers)
@@ -744,4 +851,251 @@ size_t GLProgramResources::GetHash() const
     return hash;
 }
 
+
+namespace
+{
+
+class ResourceDataWriter
+{
+public:
+    explicit ResourceDataWriter(std::vector<Uint8>& Data) :
+        m_Data{Data}
+    {}
+
+    void Write(Uint32 Val)
+    {
+        const auto* pBytes = reinterpret_cast<const Uint8*>(&Val);
+        m_Data.insert(m_Data.end(), pBytes, pBytes + sizeof(Val));
+    }
+
+    void Write(const Char* Str)
+    {
+        const auto Len = static_cast<Uint32>(strlen(Str));
+        Write(Len);
+        m_Data.insert(m_Data.end(), Str, Str + Len);
+    }
+
+    void Write(const GLProgramResources::GLResourceAttribs& Attribs)
+    {
+        Write(Attribs.Name);
+        Write(static_cast<Uint32>(Attribs.ShaderStages));
+        Write(static_cast<Uint32>(Attribs.ResourceType));
+        Write(Attribs.Binding);
+        Write(Attribs.ArraySize);
+    }
+
+private:
+    std::vector<Uint8>& m_Data;
+};
+
+class ResourceDataReader
+{
+public:
+    ResourceDataReader(const Uint8* pData, size_t Size) :
+        m_pCurr{pData},
+        m_pEnd{pData + Size}
+    {}
+
+    bool Read(Uint32& Val)
+    {
+        if (static_cast<size_t>(m_pEnd - m_pCurr) < sizeof(Val))
+            return false;
+        memcpy(&Val, m_pCurr, sizeof(Val));
+        m_pCurr += sizeof(Val);
+        return true;
+    }
+
+    bool Read(const Char*& Str, std::unordered_set<String>& NamesPool)
+    {
+        Uint32 Len = 0;
+        if (!Read(Len) || static_cast<size_t>(m_pEnd - m_pCurr) < Len)
+            return false;
+        Str = NamesPool.emplace(reinterpret_cast<const Char*>(m_pCurr), Len).first->c_str();
+        m_pCurr += Len;
+        return true;
+    }
+
+    bool Read(const Char*& Name, SHADER_TYPE& Stages, SHADER_RESOURCE_TYPE& ResType, Uint32& Binding, Uint32& ArraySize, std::unordered_set<String>& NamesPool)
+    {
+        Uint32 StagesVal = 0, ResTypeVal = 0;
+        if (!Read(Name, NamesPool) || !Read(StagesVal) || !Read(ResTypeVal) || !Read(Binding) || !Read(ArraySize))
+            return false;
+
+        Stages  = static_cast<SHADER_TYPE>(StagesVal);
+        ResType = static_cast<SHADER_RESOURCE_TYPE>(ResTypeVal);
+        return Stages != SHADER_TYPE_UNKNOWN && ResType != SHADER_RESOURCE_TYPE_UNKNOWN && ArraySize >= 1;
+    }
+
+    bool IsEnd() const { return m_pCurr == m_pEnd; }
+
+private:
+    const Uint8*       m_pCurr;
+    const Uint8* const m_pEnd;
+};
+
+} // namespace
+
+void GLProgramResources::Serialize(std::vector<Uint8>& Data) const
+{
+    ResourceDataWriter Writer{Data};
+    Writer.Write(static_cast<Uint32>(m_ShaderStages));
+    Writer.Write(m_NumUniformBuffers);
+    Writer.Write(m_NumSamplers);
+    Writer.Write(m_NumImages);
+    Writer.Write(m_NumStorageBlocks);
+
+    // clang-format off
+    ProcessConstResources(
+        [&](const UniformBufferInfo& UB)
+        {
+            Writer.Write(UB);
+            Writer.Write(UB.UBIndex);
+        },
+        [&](const SamplerInfo& Sam)
+        {
+            Writer.Write(Sam);
+            Writer.Write(static_cast<Uint32>(Sam.Location));
+            Writer.Write(Sam.SamplerType);
+        },
+        [&](const ImageInfo& Img)
+        {
+            Writer.Write(Img);
+            Writer.Write(static_cast<Uint32>(Img.Location));
+            Writer.Write(Img.ImageType);
+        },
+        [&](const StorageBlockInfo& SB)
+        {
+            Writer.Write(SB);
+            Writer.Write(static_cast<Uint32>(SB.SBIndex));
+        }
+    );
+    // clang-format on
+}
+
+bool GLProgramResources::Deserialize(const Uint8* pData, size_t Size)
+{
+    VERIFY(m_UniformBuffers == nullptr, "Resources have already been initialized");
+
+    std::vector<UniformBufferInfo> UniformBlocks;
+    std::vector<SamplerInfo>       Samplers;
+    std::vector<ImageInfo>         Images;
+    std::vector<StorageBlockInfo>  StorageBlocks;
+    std::unordered_set<String>     NamesPool;
+
+    ResourceDataReader Reader{pData, Size};
+
+    Uint32 ShaderStages = 0, NumUBs = 0, NumSamplers = 0, NumImages = 0, NumSBs = 0;
+    if (!Reader.Read(ShaderStages) || !Reader.Read(NumUBs) || !Reader.Read(NumSamplers) || !Reader.Read(NumImages) || !Reader.Read(NumSBs))
+        return false;
+
+    // Every resource takes at least 24 bytes, which protects from huge allocations when the data is corrupted
+    if ((static_cast<size_t>(NumUBs) + NumSamplers + NumImages + NumSBs) * 24 > Size)
+        return false;
+
+    const Char*          Name      = nullptr;
+    SHADER_TYPE          Stages    = SHADER_TYPE_UNKNOWN;
+    SHADER_RESOURCE_TYPE ResType   = SHADER_RESOURCE_TYPE_UNKNOWN;
+    Uint32               Binding   = 0;
+    Uint32               ArraySize = 0;
+
+    UniformBlocks.reserve(NumUBs);
+    for (Uint32 ub = 0; ub < NumUBs; ++ub)
+    {
+        Uint32 UBIndex = 0;
+        if (!Reader.Read(Name, Stages, ResType, Binding, ArraySize, NamesPool) || !Reader.Read(UBIndex))
+            return false;
+        UniformBlocks.emplace_back(Name, Stages, ResType, Binding, ArraySize, UBIndex);
+    }
+
+    Samplers.reserve(NumSamplers);
+    for (Uint32 s = 0; s < NumSamplers; ++s)
+    {
+        Uint32 Location = 0, SamplerType = 0;
+        if (!Reader.Read(Name, Stages, ResType, Binding, ArraySize, NamesPool) || !Reader.Read(Location) || !Reader.Read(SamplerType))
+            return false;
+        Samplers.emplace_back(Name, Stages, ResType, Binding, ArraySize, static_cast<GLint>(Location), SamplerType);
+    }
+
+    Images.reserve(NumImages);
+    for (Uint32 img = 0; img < NumImages; ++img)
+    {
+        Uint32 Location = 0, ImageType = 0;
+        if (!Reader.Read(Name, Stages, ResType, Binding, ArraySize, NamesPool) || !Reader.Read(Location) || !Reader.Read(ImageType))
+            return false;
+        Images.emplace_back(Name, Stages, ResType, Binding, ArraySize, static_cast<GLint>(Location), ImageType);
+    }
+
+    StorageBlocks.reserve(NumSBs);
+    for (Uint32 sb = 0; sb < NumSBs; ++sb)
+    {
+        Uint32 SBIndex = 0;
+        if (!Reader.Read(Name, Stages, ResType, Binding, ArraySize, NamesPool) || !Reader.Read(SBIndex))
+            return false;
+        StorageBlocks.emplace_back(Name, Stages, ResType, Binding, ArraySize, static_cast<GLint>(SBIndex));
+    }
+
+    if (!Reader.IsEnd() || ShaderStages == SHADER_TYPE_UNKNOWN)
+        return false;
+
+    m_ShaderStages = static_cast<SHADER_TYPE>(ShaderStages);
+    AllocateResources(UniformBlocks, Samplers, Images, StorageBlocks);
+
+    return true;
+}
+
+void GLProgramResources::ApplyBindings(const GLObjectWrappers::GLProgramObj& GLProgram, GLContextState& State) const
+{
+    VERIFY(GLProgram != 0, "Null GL program");
+    State.SetProgram(GLProgram);
+
+    // Bindings are assigned the same way as by LoadUniforms()
+
+    // clang-format off
+    ProcessConstResources(
+        [&](const UniformBufferInfo& UB)
+        {
+            for (Uint32 i = 0; i < UB.ArraySize; ++i)
+            {
+                glUniformBlockBinding(GLProgram, UB.UBIndex + i, UB.Binding + i);
+                CHECK_GL_ERROR("glUniformBlockBinding() failed");
+            }
+        },
+        [&](const SamplerInfo& Sam)
+        {
+            for (Uint32 i = 0; i < Sam.ArraySize; ++i)
+            {
+                glUniform1i(Sam.Location + i, Sam.Binding + i);
+                CHECK_GL_ERROR("Failed to set binding point for sampler uniform '", Sam.Name, '\'');
+            }
+        },
+        [&](const ImageInfo& Img)
+        {
+            for (Uint32 i = 0; i < Img.ArraySize; ++i)
+            {
+                // The failure has already been reported when the program was created
+                glUniform1i(Img.Location + i, Img.Binding + i);
+                glGetError();
+            }
+        },
+        [&](const StorageBlockInfo& SB)
+        {
+#if GL_ARB_shader_storage_buffer_object
+            if (glShaderStorageBlockBinding)
+            {
+                for (Uint32 i = 0; i < SB.ArraySize; ++i)
+                {
+                    glShaderStorageBlockBinding(GLProgram, SB.SBIndex + i, SB.Binding + i);
+                    CHECK_GL_ERROR("glShaderStorageBlockBinding() failed");
+                }
+            }
+#else
+            (void)SB;
+#endif
+        }
+    );
+    // clang-format on
+
+    State.SetProgram(GLObjectWrappers::GLProgramObj::Null());
+}
+
 } // namespace Diligent
@@ -69,7 +69,7 @@ void PipelineStateGLImpl::Initialize(const PSOCreateInfoType& CreateInfo, const
     // It is important to construct all objects before initializing them because if an exception is thrown,
     // destructors will be called for all objects
 
-    InitResourceLayouts(ShaderStages, MemPool);
+    InitResourceLayouts(ShaderStages, MemPool, (CreateInfo.Flags & PSO_CREATE_FLAG_ASYNCHRONOUS) != 0);
     InitializePipelineDesc(CreateInfo, MemPool);
 }
 
@@ -188,7 +188,8 @@ IMPLEMENT_QUERY_INTERFACE(PipelineStateGLImpl, IID_PipelineStateGL, TPipelineSta
 
 
 void PipelineStateGLImpl::InitResourceLayouts(const std::vector<GLPipelineShaderStageInfo>& ShaderStages,
-                                              LinearAllocator&                              MemPool)
+                                              LinearAllocator&                              MemPool,
+                                              bool                                          IsAsynchronous)
 {
     auto* const pDeviceGL  = GetDevice();
     const auto& deviceCaps = pDeviceGL->GetDeviceCaps();
@@ -199,10 +200,58 @@ void PipelineStateGLImpl::InitResourceLayouts(const std::vector<GLPipelineShader
     auto& GLState = pImmediateCtx.RawPtr<DeviceContextGLImpl>()->GetContextState();
 
     {
-        m_TotalUniformBufferBindings = 0;
-        m_TotalSamplerBindings       = 0;
-        m_TotalImageBindings         = 0;
-        m_TotalStorageBufferBindings = 0;
+        auto* const pProgramCache = pDeviceGL->GetProgramCache();
+
+        // Only separable programs can be linked in the background because the resources of
+        // non-separable programs can't be known until the link is complete.
+        const bool LinkInBackground = IsAsynchronous && deviceCaps.Features.SeparablePrograms && pDeviceGL->IsParallelShaderCompileSupported();
+
+        GLProgramCache::ResourceBindings Bindings;
+        // Loads the program from the cache or links it from the shaders and loads its resources.
+        // Bindings are assigned starting from the current values, which are then advanced.
+        auto CreateProgram = [&](Uint32 ProgIdx, ShaderGLImpl** ppShaders, Uint32 NumShaders, bool IsSeparableProgram, SHADER_TYPE Stages) //
+        {
+            auto& Resources = m_ProgramResources[ProgIdx];
+
+            Uint64 CacheKey = 0;
+            if (pProgramCache != nullptr)
+            {
+                CacheKey = pProgramCache->ComputeKey(ppShaders, NumShaders, IsSeparableProgram, Bindings);
+
+                GLProgramObj Program{false};
+                if (pProgramCache->Load(CacheKey, IsSeparableProgram, GLState, Resources, Bindings, &Program))
+                    return Program;
+            }
+
+            if (LinkInBackground)
+            {
+                VERIFY_EXPR(IsSeparableProgram && NumShaders == 1);
+                // Resources of the program are the same as the resources of the shader, so there
+                // is no need to wait for the link. Locations are resolved and bindings are assigned
+                // by FinalizePrograms().
+                auto Program = ShaderGLImpl::LinkProgram(ppShaders, NumShaders, IsSeparableProgram, false);
+                Resources.InitFromShader(ppShaders[0]->GetResources(),
+                                         Bindings.UniformBuffers,
+                                         Bindings.Samplers,
+                                         Bindings.Images,
+                                         Bindings.StorageBuffers);
+                m_PendingPrograms.emplace_back(ProgIdx, CacheKey, Bindings);
+                return Program;
+            }
+
+            auto Program = ShaderGLImpl::LinkProgram(ppShaders, NumShaders, IsSeparableProgram);
+            // Load uniforms and assign bindings
+            Resources.LoadUniforms(Stages, Program, GLState,
+                                   Bindings.UniformBuffers,
+                                   Bindings.Samplers,
+                                   Bindings.Images,
+                                   Bindings.StorageBuffers);
+            if (pProgramCache != nullptr)
+                pProgramCache->Store(CacheKey, Program, Resources, Bindings);
+
+            return Program;
+        };
+
         if (deviceCaps.Features.SeparablePrograms)
         {
             // Program pipelines are not shared between GL contexts, so we cannot create
@@ -212,13 +261,7 @@ void PipelineStateGLImpl::InitResourceLayouts(const std::vector<GLPipelineShader
             {
                 auto*       pShaderGL  = ShaderStages[i].pShader;
                 const auto& ShaderDesc = pShaderGL->GetDesc();
-                m_GLPrograms[i]        = GLProgramObj{ShaderGLImpl::LinkProgram(&pShaderGL, 1, true)};
-                // Load uniforms and assign bindings
-                m_ProgramResources[i].LoadUniforms(ShaderDesc.ShaderType, m_GLPrograms[i], GLState,
-                                                   m_TotalUniformBufferBindings,
-                                                   m_TotalSamplerBindings,
-                                                   m_TotalImageBindings,
-                                                   m_TotalStorageBufferBindings);
+                m_GLPrograms[i]        = CreateProgram(static_cast<Uint32>(i), &pShaderGL, 1, true, ShaderDesc.ShaderType);
 
                 HashCombine(m_ShaderResourceLayoutHash, m_ProgramResources[i].GetHash());
             }
@@ -235,17 +278,19 @@ void PipelineStateGLImpl::InitResourceLayouts(const std::vector<GLPipelineShader
                 ActiveStages |= Stage.Type;
             }
 
-            m_GLPrograms[0] = ShaderGLImpl::LinkProgram(Shaders.data(), static_cast<Uint32>(Shaders.size()), false);
-
-            m_ProgramResources[0].LoadUniforms(ActiveStages, m_GLPrograms[0], GLState,
-                                               m_TotalUniformBufferBindings,
-                                               m_TotalSamplerBindings,
-                                               m_TotalImageBindings,
-                                               m_TotalStorageBufferBindings);
+            m_GLPrograms[0] = CreateProgram(0, Shaders.data(), static_cast<Uint32>(Shaders.size()), false, ActiveStages);
 
             m_ShaderResourceLayoutHash = m_ProgramResources[0].GetHash();
         }
 
+        m_TotalUniformBufferBindings = Bindings.UniformBuffers;
+        m_TotalSamplerBindings       = Bindings.Samplers;
+        m_TotalImageBindings         = Bindings.Images;
+        m_TotalStorageBufferBindings = Bindings.StorageBuffers;
+
+        if (!m_PendingPrograms.empty())
+            m_Status = PIPELINE_STATE_STATUS_COMPILING;
+
         // Initialize master resource layout that keeps all variable types and does not reference a resource cache
         m_ResourceLayout.Initialize(m_ProgramResources, GetNumShaderStages(), m_Desc.PipelineType, m_Desc.ResourceLayout, nullptr, 0, nullptr);
     }
@@ -273,6 +318,69 @@ void PipelineStateGLImpl::CreateShaderResourceBinding(IShaderResourceBinding** p
     pResBinding->QueryInterface(IID_ShaderResourceBinding, reinterpret_cast<IObject**>(ppShaderResourceBinding));
 }
 
+PIPELINE_STATE_STATUS PipelineStateGLImpl::GetStatus(bool WaitForCompletion)
+{
+    if (m_Status != PIPELINE_STATE_STATUS_COMPILING)
+        return m_Status;
+
+#if GL_KHR_parallel_shader_compile
+    if (!WaitForCompletion)
+    {
+        // Unlike GL_LINK_STATUS, querying GL_COMPLETION_STATUS_KHR never blocks
+        for (const auto& Pending : m_PendingPrograms)
+        {
+            GLint IsComplete = GL_FALSE;
+            glGetProgramiv(m_GLPrograms[Pending.ProgramIndex], GL_COMPLETION_STATUS_KHR, &IsComplete);
+            if (!IsComplete)
+                return PIPELINE_STATE_STATUS_COMPILING;
+        }
+    }
+#endif
+
+    FinalizePrograms();
+    return m_Status;
+}
+
+void PipelineStateGLImpl::FinalizePrograms()
+{
+    VERIFY_EXPR(m_Status == PIPELINE_STATE_STATUS_COMPILING);
+
+    auto pImmediateCtx = m_pDevice->GetImmediateContext();
+    VERIFY_EXPR(pImmediateCtx);
+    auto& GLState = pImmediateCtx.RawPtr<DeviceContextGLImpl>()->GetContextState();
+
+    auto* const pProgramCache = GetDevice()->GetProgramCache();
+
+    m_Status = PIPELINE_STATE_STATUS_READY;
+    for (const auto& Pending : m_PendingPrograms)
+    {
+        const auto& Program   = m_GLPrograms[Pending.ProgramIndex];
+        auto&       Resources = m_ProgramResources[Pending.ProgramIndex];
+        if (!ShaderGLImpl::GetLinkStatus(Program))
+        {
+            LOG_ERROR_MESSAGE("Failed to link program for pipeline state '", m_Desc.Name, "'");
+            m_Status = PIPELINE_STATE_STATUS_FAILED;
+            break;
+        }
+
+        // The resources were copied from the shader's own program, whose uniform block
+        // indices and uniform locations may be different from the ones in this program
+        Resources.ResolveLocations(Program);
+        Resources.ApplyBindings(Program, GLState);
+        if (pProgramCache != nullptr)
+            pProgramCache->Store(Pending.CacheKey, Program, Resources, Pending.Bindings);
+    }
+
+    m_PendingPrograms.clear();
+    m_PendingPrograms.shrink_to_fit();
+
+    // The hash includes the resolved indices and locations. Only separable programs
+    // are linked in the background.
+    m_ShaderResourceLayoutHash = 0;
+    for (Uint32 i = 0; i < GetNumShaderStages(); ++i)
+        HashCombine(m_ShaderResourceLayoutHash, m_ProgramResources[i].GetHash());
+}
+
 bool PipelineStateGLImpl::IsCompatibleWith(const IPipelineState* pPSO) const
 {
     VERIFY_EXPR(pPSO != nullptr);
@@ -463,12 +463,66 @@ RenderDeviceGLImpl::RenderDeviceGLImpl(IReferenceCounters*       pRefCounters,
 #if defined(_MSC_VER) && defined(_WIN64)
     static_assert(sizeof(DeviceFeatures) == 31, "Did you add a new feature to DeviceFeatures? Please handle its satus here.");
 #endif
+
+    {
+        // Let the driver use as many compiler threads as it finds appropriate
+        constexpr GLuint MaxCompilerThreads = 0xFFFFFFFF;
+#if GL_KHR_parallel_shader_compile
+        if (CheckExtension("GL_KHR_parallel_shader_compile") && glMaxShaderCompilerThreadsKHR != nullptr)
+        {
+            glMaxShaderCompilerThreadsKHR(MaxCompilerThreads);
+            m_IsParallelShaderCompileSupported = true;
+        }
+#endif
+#if GL_ARB_parallel_shader_compile
+        if (!m_IsParallelShaderCompileSupported && CheckExtension("GL_ARB_parallel_shader_compile") && glMaxShaderCompilerThreadsARB != nullptr)
+        {
+            glMaxShaderCompilerThreadsARB(MaxCompilerThreads);
+            m_IsParallelShaderCompileSupported = true;
+        }
+#endif
+        (void)MaxCompilerThreads;
+        if (m_IsParallelShaderCompileSupported)
+            LOG_INFO_MESSAGE("Parallel shader compilation is enabled");
+    }
+
+    SetProgramCacheDirectory(InitAttribs.ProgramCacheDirectory);
 }
 
 RenderDeviceGLImpl::~RenderDeviceGLImpl()
 {
 }
 
+void RenderDeviceGLImpl::SetProgramCacheDirectory(const Char* Directory)
+{
+    m_pProgramCache.reset();
+    if (Directory == nullptr || *Directory == 0)
+        return;
+
+    GLint NumBinaryFormats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &NumBinaryFormats);
+    if (glGetError() == GL_NO_ERROR && NumBinaryFormats > 0)
+    {
+        try
+        {
+            m_pProgramCache.reset(new GLProgramCache{Directory});
+        }
+        catch (const std::runtime_error&)
+        {
+            LOG_WARNING_MESSAGE("Program binary cache is disabled");
+        }
+    }
+    else
+    {
+        LOG_WARNING_MESSAGE("Program binary cache is disabled because the driver does not support any program binary format");
+    }
+}
+
+void RenderDeviceGLImpl::GetProgramCacheStatistics(ProgramCacheStatisticsGL& Stats) const
+{
+    Stats = m_pProgramCache ? m_pProgramCache->GetStatistics() : ProgramCacheStatisticsGL{};
+}
+
 IMPLEMENT_QUERY_INTERFACE(RenderDeviceGLImpl, IID_RenderDeviceGL, TRenderDeviceBase)
 
 void RenderDeviceGLImpl::InitTexRegionRender()
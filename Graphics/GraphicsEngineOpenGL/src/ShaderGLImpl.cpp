@@ -35,6 +35,7 @@
 #include "DataBlobImpl.hpp"
 #include "GLSLUtils.hpp"
 #include "ShaderToolsCommon.hpp"
+#include "HashUtils.hpp"
 
 using namespace Diligent;
 
@@ -73,14 +74,6 @@ ShaderGLImpl::ShaderGLImpl(IReferenceCounters*     pRefCounters,
     // The log can then be queried in the same way
 
 
-    // Each element in the length array may contain the length of the corresponding string
-    // (the null character is not counted as part of the string length).
-    // Not specifying lengths causes shader compilation errors on Android
-    std::array<const char*, 1> ShaderStrings = {};
-    std::array<GLint, 1>       Lenghts       = {};
-
-    std::string              GLSLSourceString;
-    RefCntAutoPtr<IDataBlob> pSourceFileData;
     if (ShaderCI.SourceLanguage == SHADER_SOURCE_LANGUAGE_GLSL_VERBATIM)
     {
         if (ShaderCI.Macros != nullptr)
@@ -89,19 +82,69 @@ ShaderGLImpl::ShaderGLImpl(IReferenceCounters*     pRefCounters,
         }
 
         // Read the source file directly and use it as is
-        size_t SourceLen = 0;
-        ShaderStrings[0] = ReadShaderSourceFile(ShaderCI.Source, ShaderCI.pShaderSourceStreamFactory, ShaderCI.FilePath, pSourceFileData, SourceLen);
-        Lenghts[0]       = static_cast<GLint>(SourceLen);
+        RefCntAutoPtr<IDataBlob> pSourceFileData;
+        size_t                   SourceLen = 0;
+        const auto*              pSource   = ReadShaderSourceFile(ShaderCI.Source, ShaderCI.pShaderSourceStreamFactory, ShaderCI.FilePath, pSourceFileData, SourceLen);
+        m_GLSLSource.assign(pSource, SourceLen);
     }
     else
     {
         // Build the full source code string that will contain GLSL version declaration,
         // platform definitions, user-provided shader macros, etc.
-        GLSLSourceString = BuildGLSLSourceString(ShaderCI, deviceCaps, TargetGLSLCompiler::driver);
-        ShaderStrings[0] = GLSLSourceString.c_str();
-        Lenghts[0]       = static_cast<GLint>(GLSLSourceString.length());
+        m_GLSLSource = BuildGLSLSourceString(ShaderCI, deviceCaps, TargetGLSLCompiler::driver);
+    }
+    m_SourceHash = ComputeHashRaw(m_GLSLSource.data(), m_GLSLSource.length());
+
+    if (deviceCaps.Features.SeparablePrograms)
+    {
+        auto pImmediateCtx = m_pDevice->GetImmediateContext();
+        VERIFY_EXPR(pImmediateCtx);
+        auto& GLState = pImmediateCtx.RawPtr<DeviceContextGLImpl>()->GetContextState();
+
+        auto*                            pProgramCache = pDeviceGL->GetProgramCache();
+        ShaderGLImpl*                    ThisShader[]  = {this};
+        GLProgramCache::ResourceBindings Bindings;
+        Uint64                           CacheKey = 0;
+        if (pProgramCache != nullptr)
+        {
+            // The key is the same as the key of the first stage of a separable pipeline,
+            // so the entry is shared with the pipelines that use this shader.
+            CacheKey = pProgramCache->ComputeKey(ThisShader, 1, true, Bindings);
+            // Only the resources are needed here. Compilation is deferred until the
+            // shader is linked into a program that is not found in the cache.
+            if (pProgramCache->Load(CacheKey, true, GLState, m_Resources, Bindings, nullptr))
+                return;
+        }
+
+        Compile(ShaderCI.ppCompilerOutput);
+
+        GLObjectWrappers::GLProgramObj Program = LinkProgram(ThisShader, 1, true);
+        m_Resources.LoadUniforms(m_Desc.ShaderType, Program, GLState, Bindings.UniformBuffers, Bindings.Samplers, Bindings.Images, Bindings.StorageBuffers);
+        if (pProgramCache != nullptr)
+            pProgramCache->Store(CacheKey, Program, m_Resources, Bindings);
+    }
+    else
+    {
+        Compile(ShaderCI.ppCompilerOutput);
     }
+}
+
+ShaderGLImpl::~ShaderGLImpl()
+{
+}
+
+IMPLEMENT_QUERY_INTERFACE(ShaderGLImpl, IID_ShaderGL, TShaderBase)
+
+
+void ShaderGLImpl::Compile(IDataBlob** ppCompilerOutput)
+{
+    VERIFY(!m_IsCompiled, "The shader has already been compiled");
 
+    // Each element in the length array may contain the length of the corresponding string
+    // (the null character is not counted as part of the string length).
+    // Not specifying lengths causes shader compilation errors on Android
+    std::array<const char*, 1> ShaderStrings = {m_GLSLSource.c_str()};
+    std::array<GLint, 1>       Lenghts       = {static_cast<GLint>(m_GLSLSource.length())};
 
     // Provide source strings (the strings will be saved in internal OpenGL memory)
     glShaderSource(m_GLShaderObj, static_cast<GLsizei>(ShaderStrings.size()), ShaderStrings.data(), Lenghts.data());
@@ -117,7 +160,7 @@ ShaderGLImpl::ShaderGLImpl(IReferenceCounters*     pRefCounters,
             FullSource.append(str);
 
         std::stringstream ErrorMsgSS;
-        ErrorMsgSS << "Failed to compile shader file '" << (ShaderCI.Desc.Name != nullptr ? ShaderCI.Desc.Name : "") << '\'' << std::endl;
+        ErrorMsgSS << "Failed to compile shader file '" << (m_Desc.Name != nullptr ? m_Desc.Name : "") << '\'' << std::endl;
         int infoLogLen = 0;
         // The function glGetShaderiv() tells how many bytes to allocate; the length includes the NULL terminator.
         glGetShaderiv(m_GLShaderObj, GL_INFO_LOG_LENGTH, &infoLogLen);
@@ -135,7 +178,7 @@ ShaderGLImpl::ShaderGLImpl(IReferenceCounters*     pRefCounters,
                        << infoLog.data() << std::endl;
         }
 
-        if (ShaderCI.ppCompilerOutput != nullptr)
+        if (ppCompilerOutput != nullptr)
         {
             // infoLogLen accounts for null terminator
             auto* pOutputDataBlob = MakeNewRCObj<DataBlobImpl>()(infoLogLen + FullSource.length() + 1);
@@ -143,7 +186,7 @@ ShaderGLImpl::ShaderGLImpl(IReferenceCounters*     pRefCounters,
             if (infoLogLen > 0)
                 memcpy(DataPtr, infoLog.data(), infoLogLen);
             memcpy(DataPtr + infoLogLen, FullSource.data(), FullSource.length() + 1);
-            pOutputDataBlob->QueryInterface(IID_DataBlob, reinterpret_cast<IObject**>(ShaderCI.ppCompilerOutput));
+            pOutputDataBlob->QueryInterface(IID_DataBlob, reinterpret_cast<IObject**>(ppCompilerOutput));
         }
         else
         {
@@ -156,29 +199,21 @@ ShaderGLImpl::ShaderGLImpl(IReferenceCounters*     pRefCounters,
         LOG_ERROR_AND_THROW(ErrorMsgSS.str().c_str());
     }
 
-    if (deviceCaps.Features.SeparablePrograms)
-    {
-        ShaderGLImpl*                  ThisShader[]         = {this};
-        GLObjectWrappers::GLProgramObj Program              = LinkProgram(ThisShader, 1, true);
-        Uint32                         UniformBufferBinding = 0;
-        Uint32                         SamplerBinding       = 0;
-        Uint32                         ImageBinding         = 0;
-        Uint32                         StorageBufferBinding = 0;
-        auto                           pImmediateCtx        = m_pDevice->GetImmediateContext();
-        VERIFY_EXPR(pImmediateCtx);
-        auto& GLState = pImmediateCtx.RawPtr<DeviceContextGLImpl>()->GetContextState();
-        m_Resources.LoadUniforms(m_Desc.ShaderType, Program, GLState, UniformBufferBinding, SamplerBinding, ImageBinding, StorageBufferBinding);
-    }
+    m_IsCompiled = true;
+    // The source is not needed anymore, but its hash is still used as the program cache key
+    m_GLSLSource.clear();
+    m_GLSLSource.shrink_to_fit();
 }
 
-ShaderGLImpl::~ShaderGLImpl()
+const GLObjectWrappers::GLShaderObj& ShaderGLImpl::GetCompiledShader()
 {
+    if (!m_IsCompiled)
+        Compile(nullptr);
+    return m_GLShaderObj;
 }
 
-IMPLEMENT_QUERY_INTERFACE(ShaderGLImpl, IID_ShaderGL, TShaderBase)
-
 
-GLObjectWrappers::GLProgramObj ShaderGLImpl::LinkProgram(ShaderGLImpl** ppShaders, Uint32 NumShaders, bool IsSeparableProgram)
+GLObjectWrappers::GLProgramObj ShaderGLImpl::LinkProgram(ShaderGLImpl** ppShaders, Uint32 NumShaders, bool IsSeparableProgram, bool WaitForLink)
 {
     VERIFY(!IsSeparableProgram || NumShaders == 1, "Number of shaders must be 1 when separable program is created");
 
@@ -188,10 +223,14 @@ GLObjectWrappers::GLProgramObj ShaderGLImpl::LinkProgram(ShaderGLImpl** ppShader
     if (IsSeparableProgram)
         glProgramParameteri(GLProg, GL_PROGRAM_SEPARABLE, GL_TRUE);
 
+    // Binary retrievable hint must also be set before linking
+    if (ppShaders[0]->GetDevice()->GetProgramCache() != nullptr)
+        glProgramParameteri(GLProg, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
     for (Uint32 i = 0; i < NumShaders; ++i)
     {
         auto* pCurrShader = ppShaders[i];
-        glAttachShader(GLProg, pCurrShader->m_GLShaderObj);
+        glAttachShader(GLProg, pCurrShader->GetCompiledShader());
         CHECK_GL_ERROR("glAttachShader() failed");
     }
 
@@ -207,6 +246,24 @@ GLObjectWrappers::GLProgramObj ShaderGLImpl::LinkProgram(ShaderGLImpl** ppShader
     //of the inputs on the interface will be undefined.
     glLinkProgram(GLProg);
     CHECK_GL_ERROR("glLinkProgram() failed");
+    if (WaitForLink && !GetLinkStatus(GLProg))
+    {
+        UNEXPECTED("glLinkProgram failed");
+    }
+
+    // Shaders can be detached right away, even if the program is still being linked in the background
+    for (Uint32 i = 0; i < NumShaders; ++i)
+    {
+        auto* pCurrShader = ValidatedCast<ShaderGLImpl>(ppShaders[i]);
+        glDetachShader(GLProg, pCurrShader->m_GLShaderObj);
+        CHECK_GL_ERROR("glDetachShader() failed");
+    }
+
+    return GLProg;
+}
+
+bool ShaderGLImpl::GetLinkStatus(const GLObjectWrappers::GLProgramObj& GLProg)
+{
     int IsLinked = GL_FALSE;
     glGetProgramiv(GLProg, GL_LINK_STATUS, &IsLinked);
     CHECK_GL_ERROR("glGetProgramiv() failed");
@@ -224,17 +281,9 @@ GLObjectWrappers::GLProgramObj ShaderGLImpl::LinkProgram(ShaderGLImpl** ppShader
         glGetProgramInfoLog(GLProg, LengthWithNull, &Length, shaderProgramInfoLog.data());
         VERIFY(Length == LengthWithNull - 1, "Incorrect program info log len");
         LOG_ERROR_MESSAGE("Failed to link shader program:\n", shaderProgramInfoLog.data(), '\n');
-        UNEXPECTED("glLinkProgram failed");
     }
 
-    for (Uint32 i = 0; i < NumShaders; ++i)
-    {
-        auto* pCurrShader = ValidatedCast<ShaderGLImpl>(ppShaders[i]);
-        glDetachShader(GLProg, pCurrShader->m_GLShaderObj);
-        CHECK_GL_ERROR("glDetachShader() failed");
-    }
-
-    return GLProg;
+    return IsLinked != GL_FALSE;
 }
 
 Uint32 ShaderGLImpl::GetResourceCount() const
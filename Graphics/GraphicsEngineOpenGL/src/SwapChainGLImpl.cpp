@@ -112,6 +112,9 @@ void SwapChainGLImpl::Present(Uint32 SyncInterval)
         auto* pDeviceCtxGl = pDeviceContext.RawPtr<DeviceContextGLImpl>();
         auto* pBackBuffer  = ValidatedCast<TextureBaseGL>(m_pRenderTargetView->GetTexture());
         pDeviceCtxGl->UnbindTextureFromFramebuffer(pBackBuffer, false);
+
+        if (m_SwapChainDesc.IsPrimary)
+            pDeviceCtxGl->FinishFrame();
     }
 }
 
@@ -38,6 +38,17 @@
 namespace Diligent
 {
 
+static bool IsIntegerAttrib(const LayoutElement& Elem)
+{
+    return !Elem.IsNormalized &&
+        (Elem.ValueType == VT_INT8 ||
+         Elem.ValueType == VT_INT16 ||
+         Elem.ValueType == VT_INT32 ||
+         Elem.ValueType == VT_UINT8 ||
+         Elem.ValueType == VT_UINT16 ||
+         Elem.ValueType == VT_UINT32);
+}
+
 VAOCache::VAOCache() :
     m_EmptyVAO{true}
 {
@@ -63,6 +74,25 @@ void VAOCache::OnDestroyBuffer(IBuffer* pBuffer)
         m_Cache.erase(It->second);
     }
     m_BuffToKey.erase(EqualRange.first, EqualRange.second);
+
+    const auto BufferUId = ValidatedCast<BufferGLImpl>(pBuffer)->GetUniqueID();
+    for (auto& LayoutIt : m_LayoutCache)
+    {
+        auto& Layout = LayoutIt.second;
+        for (auto& BoundBuffer : Layout.VertexBuffers)
+        {
+            if (BoundBuffer.BufferUId == BufferUId)
+            {
+                BoundBuffer.BufferUId       = LayoutVAO::DestroyedBufferUId;
+                m_HasDestroyedLayoutBuffers = true;
+            }
+        }
+        if (Layout.IndexBufferUId == BufferUId)
+        {
+            Layout.IndexBufferUId       = LayoutVAO::DestroyedBufferUId;
+            m_HasDestroyedLayoutBuffers = true;
+        }
+    }
 }
 
 void VAOCache::OnDestroyPSO(IPipelineState* pPSO)
@@ -96,6 +126,15 @@ const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetVAO(IPipelineState*
     const auto&          InputLayout    = pPSOGL->GetGraphicsPipelineDesc().InputLayout;
     const LayoutElement* LayoutElems    = InputLayout.LayoutElements;
     Uint32               NumElems       = InputLayout.NumElements;
+
+#if GL_ARB_vertex_attrib_binding
+    if (GLState.GetContextCaps().IsVertexAttribBindingSupported)
+    {
+        if (const auto* pLayoutVAO = GetLayoutVAO(pPSOGL, pIndexBufferGL, VertexStreams, NumVertexStreams, GLState))
+            return *pLayoutVAO;
+    }
+#endif
+
     // Construct the key
     VAOCacheKey Key(pPSOGL->GetUniqueID(), pIndexBufferGL ? pIndexBufferGL->GetUniqueID() : 0);
 
@@ -162,7 +201,7 @@ const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetVAO(IPipelineState*
     auto It = m_Cache.find(Key);
     if (It != m_Cache.end())
     {
-        return It->second;
+        return *It->second;
     }
     else
     {
@@ -192,13 +231,7 @@ const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetVAO(IPipelineState*
             GLState.BindBuffer(GL_ARRAY_BUFFER, pBufferOGL->m_GlBuffer, ResetVAO);
             GLvoid* DataStartOffset = reinterpret_cast<GLvoid*>(static_cast<size_t>(CurrStream.Offset) + static_cast<size_t>(LayoutIt->RelativeOffset));
             auto    GlType          = TypeToGLType(LayoutIt->ValueType);
-            if (!LayoutIt->IsNormalized &&
-                (LayoutIt->ValueType == VT_INT8 ||
-                 LayoutIt->ValueType == VT_INT16 ||
-                 LayoutIt->ValueType == VT_INT32 ||
-                 LayoutIt->ValueType == VT_UINT8 ||
-                 LayoutIt->ValueType == VT_UINT16 ||
-                 LayoutIt->ValueType == VT_UINT32))
+            if (IsIntegerAttrib(*LayoutIt))
                 glVertexAttribIPointer(LayoutIt->InputIndex, LayoutIt->NumComponents, GlType, Stride, DataStartOffset);
             else
                 glVertexAttribPointer(LayoutIt->InputIndex, LayoutIt->NumComponents, GlType, LayoutIt->IsNormalized, Stride, DataStartOffset);
@@ -219,7 +252,7 @@ const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetVAO(IPipelineState*
             GLState.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, pIndBufferOGL->m_GlBuffer, ResetVAO);
         }
 
-        auto NewElems = m_Cache.emplace(std::make_pair(Key, std::move(NewVAO)));
+        auto NewElems = m_Cache.emplace(std::make_pair(Key, std::unique_ptr<GLObjectWrappers::GLVertexArrayObj>{new GLObjectWrappers::GLVertexArrayObj{std::move(NewVAO)}}));
         // New element must be actually inserted
         VERIFY(NewElems.second, "New element was not inserted into the cache");
         m_PSOToKey.insert(std::make_pair(pPSO, Key));
@@ -230,8 +263,204 @@ const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetVAO(IPipelineState*
                 m_BuffToKey.insert(std::make_pair(pCurrBuff, Key));
         }
 
-        return NewElems.first->second;
+        return *NewElems.first->second;
+    }
+}
+
+const GLObjectWrappers::GLVertexArrayObj* VAOCache::GetLayoutVAO(PipelineStateGLImpl*           pPSOGL,
+                                                                 BufferGLImpl*                  pIndexBufferGL,
+                                                                 VertexStreamInfo<BufferGLImpl> VertexStreams[],
+                                                                 Uint32                         NumVertexStreams,
+                                                                 GLContextState&                GLState)
+{
+#if GL_ARB_vertex_attrib_binding
+    const auto& InputLayout = pPSOGL->GetGraphicsPipelineDesc().InputLayout;
+    const auto& Caps        = GLState.GetContextCaps();
+    VERIFY_EXPR(InputLayout.NumElements <= MAX_LAYOUT_ELEMENTS);
+
+    // The divisor is a property of the buffer binding, so all elements in one slot must use the same one
+    static constexpr Uint32 InvalidDivisor = ~0u;
+
+    Uint32 SlotDivisors[MAX_BUFFER_SLOTS];
+    for (Uint32 s = 0; s < MAX_BUFFER_SLOTS; ++s)
+        SlotDivisors[s] = InvalidDivisor;
+
+    LayoutVAOKey Key;
+    Uint32       NumUsedSlots = 0;
+    for (Uint32 elem = 0; elem < InputLayout.NumElements; ++elem)
+    {
+        const auto& Elem     = InputLayout.LayoutElements[elem];
+        const auto  BuffSlot = Elem.BufferSlot;
+        if (BuffSlot >= NumVertexStreams || BuffSlot >= MAX_BUFFER_SLOTS)
+        {
+            UNEXPECTED("Input layout requires more buffers than bound to the pipeline");
+            return nullptr;
+        }
+
+        if (BuffSlot >= static_cast<Uint32>(Caps.m_iMaxVertexAttribBindings) ||
+            Elem.RelativeOffset > static_cast<Uint32>(Caps.m_iMaxVertexAttribRelativeOffset))
+            return nullptr;
+
+        const Uint32 Divisor = Elem.Frequency == INPUT_ELEMENT_FREQUENCY_PER_INSTANCE ? Elem.InstanceDataStepRate : 0;
+        if (SlotDivisors[BuffSlot] != InvalidDivisor && SlotDivisors[BuffSlot] != Divisor)
+            return nullptr;
+        SlotDivisors[BuffSlot] = Divisor;
+
+        auto& ElemKey          = Key.Elements[elem];
+        ElemKey.InputIndex     = Elem.InputIndex;
+        ElemKey.BufferSlot     = BuffSlot;
+        ElemKey.NumComponents  = Elem.NumComponents;
+        ElemKey.ValueType      = Elem.ValueType;
+        ElemKey.IsNormalized   = Elem.IsNormalized;
+        ElemKey.RelativeOffset = Elem.RelativeOffset;
+        ElemKey.Divisor        = Divisor;
+
+        NumUsedSlots = std::max(NumUsedSlots, BuffSlot + 1);
+    }
+    Key.NumElements = InputLayout.NumElements;
+
+    auto It = m_LayoutCache.find(Key);
+    if (It == m_LayoutCache.end())
+    {
+        It = m_LayoutCache.emplace(Key, LayoutVAO{}).first;
+
+        // Initialize the vertex format. Buffers are bound below.
+        GLState.BindVAO(It->second.VAO);
+        for (Uint32 elem = 0; elem < InputLayout.NumElements; ++elem)
+        {
+            const auto& Elem   = InputLayout.LayoutElements[elem];
+            const auto  GlType = TypeToGLType(Elem.ValueType);
+            if (IsIntegerAttrib(Elem))
+                glVertexAttribIFormat(Elem.InputIndex, Elem.NumComponents, GlType, Elem.RelativeOffset);
+            else
+                glVertexAttribFormat(Elem.InputIndex, Elem.NumComponents, GlType, Elem.IsNormalized, Elem.RelativeOffset);
+            glVertexAttribBinding(Elem.InputIndex, Elem.BufferSlot);
+            glEnableVertexAttribArray(Elem.InputIndex);
+        }
+        for (Uint32 s = 0; s < NumUsedSlots; ++s)
+        {
+            if (SlotDivisors[s] != InvalidDivisor)
+                glVertexBindingDivisor(s, SlotDivisors[s]);
+        }
+        DEV_CHECK_GL_ERROR("Failed to initialize vertex array object");
     }
+
+    auto& Layout = It->second;
+    GLState.BindVAO(Layout.VAO);
+
+    GLuint   Buffers[MAX_BUFFER_SLOTS];
+    GLintptr Offsets[MAX_BUFFER_SLOTS];
+    GLsizei  Strides[MAX_BUFFER_SLOTS];
+    bool     BuffersChanged = false;
+    for (Uint32 s = 0; s < NumUsedSlots; ++s)
+    {
+        LayoutVAO::BoundBufferInfo NewBufferInfo;
+        Buffers[s] = 0;
+        if (SlotDivisors[s] != InvalidDivisor)
+        {
+            auto* pBufferGL = VertexStreams[s].pBuffer.RawPtr();
+            VERIFY(pBufferGL != nullptr, "No buffer bound to slot ", s);
+            if (pBufferGL != nullptr)
+            {
+                pBufferGL->BufferMemoryBarrier(
+                    GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT, // Vertex data sourced from buffer objects after the barrier
+                                                        // will reflect data written by shaders prior to the barrier.
+                    GLState);
+
+                Buffers[s]              = pBufferGL->m_GlBuffer;
+                NewBufferInfo.BufferUId = pBufferGL->GetUniqueID();
+                NewBufferInfo.Offset    = VertexStreams[s].Offset;
+                NewBufferInfo.Stride    = pPSOGL->GetBufferStride(s);
+            }
+        }
+        Offsets[s] = NewBufferInfo.Offset;
+        Strides[s] = NewBufferInfo.Stride;
+
+        auto& BoundBuffer = Layout.VertexBuffers[s];
+        if (BoundBuffer.BufferUId != NewBufferInfo.BufferUId || BoundBuffer.Offset != NewBufferInfo.Offset || BoundBuffer.Stride != NewBufferInfo.Stride)
+        {
+            BoundBuffer = NewBufferInfo;
+            if (!Caps.IsMultiBindSupported)
+                glBindVertexBuffer(s, Buffers[s], Offsets[s], Strides[s]);
+            BuffersChanged = true;
+        }
+    }
+#    if GL_ARB_multi_bind
+    if (BuffersChanged && Caps.IsMultiBindSupported)
+        glBindVertexBuffers(0, NumUsedSlots, Buffers, Offsets, Strides);
+#    endif
+    DEV_CHECK_GL_ERROR("Failed to bind vertex buffers");
+
+    if (pIndexBufferGL != nullptr)
+    {
+        pIndexBufferGL->BufferMemoryBarrier(
+            GL_ELEMENT_ARRAY_BARRIER_BIT, // Vertex array indices sourced from buffer objects after the barrier
+                                          // will reflect data written by shaders prior to the barrier.
+            GLState);
+
+        // Index buffer binding is a part of the VAO state
+        if (Layout.IndexBufferUId != pIndexBufferGL->GetUniqueID())
+        {
+            Layout.IndexBufferUId   = pIndexBufferGL->GetUniqueID();
+            constexpr bool ResetVAO = false;
+            GLState.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, pIndexBufferGL->m_GlBuffer, ResetVAO);
+        }
+    }
+
+    return &Layout.VAO;
+#else
+    return nullptr;
+#endif
+}
+
+void VAOCache::UnbindDestroyedBuffers(GLContextState& GLState)
+{
+    ThreadingTools::LockHelper CacheLock{m_CacheLockFlag};
+    if (!m_HasDestroyedLayoutBuffers)
+        return;
+
+#if GL_ARB_vertex_attrib_binding
+    bool VAOChanged = false;
+    for (auto& LayoutIt : m_LayoutCache)
+    {
+        auto& Layout = LayoutIt.second;
+
+        bool IsVAOBound = false;
+        for (Uint32 s = 0; s < MAX_BUFFER_SLOTS; ++s)
+        {
+            auto& BoundBuffer = Layout.VertexBuffers[s];
+            if (BoundBuffer.BufferUId != LayoutVAO::DestroyedBufferUId)
+                continue;
+
+            if (!IsVAOBound)
+            {
+                GLState.BindVAO(Layout.VAO);
+                IsVAOBound = true;
+            }
+            glBindVertexBuffer(s, 0, 0, 0);
+            BoundBuffer = LayoutVAO::BoundBufferInfo{};
+        }
+
+        if (Layout.IndexBufferUId == LayoutVAO::DestroyedBufferUId)
+        {
+            if (!IsVAOBound)
+            {
+                GLState.BindVAO(Layout.VAO);
+                IsVAOBound = true;
+            }
+            constexpr bool ResetVAO = false;
+            GLState.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
+            Layout.IndexBufferUId = -1;
+        }
+        VAOChanged = VAOChanged || IsVAOBound;
+    }
+    DEV_CHECK_GL_ERROR("Failed to unbind destroyed buffers from vertex array objects");
+
+    // The VAO that was bound before may not be the one required by the next draw command
+    if (VAOChanged)
+        GLState.InvalidateVAO();
+#endif
+    m_HasDestroyedLayoutBuffers = false;
 }
 
 const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetEmptyVAO()
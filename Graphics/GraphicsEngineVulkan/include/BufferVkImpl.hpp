@@ -72,23 +72,14 @@ public:
     void DvpVerifyDynamicAllocation(DeviceContextVkImpl* pCtx) const;
 #endif
 
-    Uint32 GetDynamicOffset(Uint32 CtxId, DeviceContextVkImpl* pCtx) const
-    {
-        if (m_VulkanBuffer != VK_NULL_HANDLE)
-        {
-            return 0;
-        }
-        else
-        {
-            VERIFY(m_Desc.Usage == USAGE_DYNAMIC, "Dynamic buffer is expected");
-            VERIFY_EXPR(!m_DynamicAllocations.empty());
-#ifdef DILIGENT_DEVELOPMENT
-            DvpVerifyDynamicAllocation(pCtx);
-#endif
-            auto& DynAlloc = m_DynamicAllocations[CtxId];
-            return static_cast<Uint32>(DynAlloc.AlignedOffset);
-        }
-    }
+    // Defined in DeviceContextVkImpl.hpp as dynamic allocations are kept by the device context
+    inline Uint32 GetDynamicOffset(Uint32 CtxId, DeviceContextVkImpl* pCtx) const;
+
+    static constexpr Uint32 InvalidDynamicBufferId = ~Uint32{0};
+
+    // Returns the index of the buffer's entry in per-context tables of dynamic allocations,
+    // or InvalidDynamicBufferId if the buffer is not dynamic.
+    Uint32 GetDynamicBufferId() const { return m_DynamicBufferId; }
 
     /// Implementation of IBufferVk::GetVkBuffer().
     virtual VkBuffer DILIGENT_CALL_TYPE GetVkBuffer() const override final;
@@ -127,9 +118,7 @@ private:
     Uint32       m_DynamicOffsetAlignment    = 0;
     VkDeviceSize m_BufferMemoryAlignedOffset = 0;
 
-    // TODO (assiduous): improve cache performance, move dynamic allocations to
-    // device context.
-    std::vector<VulkanDynamicAllocation, STDAllocatorRawMem<VulkanDynamicAllocation>> m_DynamicAllocations;
+    Uint32 m_DynamicBufferId = InvalidDynamicBufferId;
 
     VulkanUtilities::BufferWrapper          m_VulkanBuffer;
     VulkanUtilities::VulkanMemoryAllocation m_MemoryAllocation;
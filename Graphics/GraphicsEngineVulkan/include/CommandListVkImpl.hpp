@@ -46,11 +46,13 @@ public:
     CommandListVkImpl(IReferenceCounters* pRefCounters,
                       RenderDeviceVkImpl* pDevice,
                       IDeviceContext*     pDeferredCtx,
-                      VkCommandBuffer     vkCmdBuff) :
+                      VkCommandBuffer     vkCmdBuff,
+                      bool                IsSecondary = false) :
         // clang-format off
         TCommandListBase {pRefCounters, pDevice},
         m_pDeferredCtx   {pDeferredCtx},
-        m_vkCmdBuff      {vkCmdBuff   }
+        m_vkCmdBuff      {vkCmdBuff   },
+        m_IsSecondary    {IsSecondary }
     // clang-format on
     {
     }
@@ -68,9 +70,14 @@ public:
         pDeferredCtx = std::move(m_pDeferredCtx);
     }
 
+    // Returns true if the command list contains a secondary command buffer that
+    // must be executed inside a render pass by IDeviceContextVk::ExecuteSecondaryCommandLists()
+    bool IsSecondary() const { return m_IsSecondary; }
+
 private:
     RefCntAutoPtr<IDeviceContext> m_pDeferredCtx;
     VkCommandBuffer               m_vkCmdBuff;
+    const bool                    m_IsSecondary;
 };
 
 } // namespace Diligent
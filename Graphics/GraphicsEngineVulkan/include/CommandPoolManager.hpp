@@ -30,8 +30,12 @@
 #include <deque>
 #include <mutex>
 #include <atomic>
+#include <memory>
+#include <vector>
+#include "DeviceContextVk.h"
 #include "STDAllocator.hpp"
 #include "VulkanUtilities/VulkanObjectWrappers.hpp"
+#include "VulkanUtilities/VulkanCommandBufferPool.hpp"
 
 namespace Diligent
 {
@@ -86,4 +90,101 @@ private:
 #endif
 };
 
+// Ring of command pools owned by a single device context.
+// All command buffers are allocated from the current pool. When the context submits its
+// commands, the current pool becomes stale together with the fence value that signals
+// completion of the commands. Once the fence is completed, the whole pool is reset with
+// vkResetCommandPool and reused. Command buffers are never returned to the pools individually,
+// so command buffer allocation requires no synchronization with other threads.
+// The class is not thread-safe as device contexts must not be used in multiple threads simultaneously.
+//
+//           GetCommandBuffer()
+//                  |
+//    ______________V______________     ReleasePool()     ___________________
+//   |                             | ------------------> |                   |
+//   |        Current pool         |                     |    Stale pools    |
+//   |_____________________________| <---- Free pools <- |___________________|
+//                                   GetCurrentPool()      Reset() once the
+//                                                         fence is completed
+//
+class CommandPoolRing
+{
+public:
+    CommandPoolRing(RenderDeviceVkImpl&      DeviceVkImpl,
+                    std::string              Name,
+                    uint32_t                 queueFamilyIndex,
+                    VkCommandPoolCreateFlags flags) noexcept;
+
+    // clang-format off
+    CommandPoolRing             (const CommandPoolRing&)  = delete;
+    CommandPoolRing             (      CommandPoolRing&&) = delete;
+    CommandPoolRing& operator = (const CommandPoolRing&)  = delete;
+    CommandPoolRing& operator = (      CommandPoolRing&&) = delete;
+    // clang-format on
+
+    ~CommandPoolRing();
+
+    VkCommandBuffer GetCommandBuffer(const char* DebugName = "");
+    VkCommandBuffer GetSecondaryCommandBuffer(const VkCommandBufferInheritanceInfo& InheritanceInfo, const char* DebugName = "");
+
+    // Makes the current pool stale. The pool is reset and reused once the given fence value is completed by the queue.
+    // All command buffers allocated from the current pool must have been submitted to this queue.
+    void ReleasePool(Uint32 QueueIndex, Uint64 FenceValue);
+
+    // Makes the current pool stale after the commands have been submitted to the queues in QueueMask.
+    // If more than one queue is used, the pool is destroyed through the release queues instead.
+    void ReleasePool(Uint64 QueueMask);
+
+    // Detaches the current pool if any command buffers have been allocated from it. The caller takes
+    // ownership of the pool and must release it through the release queues once the command buffers
+    // have been submitted. Returns a null wrapper if there is nothing to detach.
+    VulkanUtilities::CommandPoolWrapper DetachPool();
+
+    bool HasUsedCommandBuffers() const
+    {
+        return m_CurrentPool && m_CurrentPool->GetUsedBufferCount() != 0;
+    }
+
+    const CommandPoolStatisticsVk& GetStatistics() const { return m_Stats; }
+
+private:
+    VulkanUtilities::VulkanCommandBufferPool& GetCurrentPool();
+
+    // Resets all stale pools whose commands have been completed by the GPU and moves them to the free list
+    void RecycleStalePools();
+
+    void UpdateBufferStats(const VulkanUtilities::VulkanCommandBufferPool& Pool, size_t NumAllocatedBuffers);
+
+    using PoolPtr = std::unique_ptr<VulkanUtilities::VulkanCommandBufferPool>;
+
+    struct StalePool
+    {
+        // clang-format off
+        StalePool(PoolPtr&& _Pool,
+                  Uint32    _QueueIndex,
+                  Uint64    _FenceValue) noexcept :
+            Pool      {std::move(_Pool)},
+            QueueIndex{_QueueIndex     },
+            FenceValue{_FenceValue     }
+        {}
+        // clang-format on
+
+        PoolPtr Pool;
+        Uint32  QueueIndex;
+        // The pool can be reset once this fence value has been completed by the queue
+        Uint64 FenceValue;
+    };
+
+    RenderDeviceVkImpl&            m_DeviceVkImpl;
+    const std::string              m_Name;
+    const uint32_t                 m_QueueFamilyIndex;
+    const VkCommandPoolCreateFlags m_CmdPoolFlags;
+
+    PoolPtr               m_CurrentPool;
+    std::deque<StalePool> m_StalePools;
+    std::vector<PoolPtr>  m_FreePools;
+
+    CommandPoolStatisticsVk m_Stats;
+};
+
 } // namespace Diligent
@@ -32,6 +32,7 @@
 
 #include <mutex>
 #include <deque>
+#include <vector>
 #include "VulkanUtilities/VulkanHeaders.h"
 #include "CommandQueueVk.h"
 #include "ObjectBase.hpp"
@@ -83,6 +84,9 @@ public:
 
     void SetFence(RefCntAutoPtr<FenceVkImpl> pFence) { m_pFence = std::move(pFence); }
 
+    // Returns true if the queue tracks completion with a timeline semaphore rather than with fences
+    bool UsesTimelineSemaphore() const { return m_TimelineSemaphore != VK_NULL_HANDLE; }
+
 private:
     std::shared_ptr<VulkanUtilities::VulkanLogicalDevice> m_LogicalDevice;
 
@@ -94,6 +98,15 @@ private:
     // are guaranteed to be finished by the GPU
     RefCntAutoPtr<FenceVkImpl> m_pFence;
 
+    // When VK_KHR_timeline_semaphore is enabled, every submission signals the timeline
+    // semaphore with its fence value instead of using a fence from the pool, and
+    // the completed value is obtained with a single semaphore counter query.
+    VulkanUtilities::SemaphoreWrapper m_TimelineSemaphore;
+
+    // Signal semaphores of the current submission followed by the timeline semaphore
+    std::vector<VkSemaphore> m_SignalSemaphores;
+    std::vector<uint64_t>    m_SignalSemaphoreValues;
+
     // A value that will be signaled by the command queue next
     Atomics::AtomicInt64 m_NextFenceValue;
 
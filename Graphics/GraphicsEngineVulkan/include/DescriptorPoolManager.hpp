@@ -242,22 +242,29 @@ private:
 // the global manager and allocates descriptor sets from this pool. When space in the pool is exhausted,
 // the class requests a new pool.
 // The class is not thread-safe as device contexts must not be used in multiple threads simultaneously.
-// All allocated pools are recycled at the end of every frame.
+// At the end of every frame, all allocated pools become stale. The allocator keeps stale pools in its own
+// chain and resets them wholesale once the GPU has finished the frame, so that in the steady state, pools are
+// recycled without touching the global manager and its mutex. The global manager is only used when no
+// recycled pool is available. To prevent a usage spike from pinning pools to the context for its whole
+// lifetime, free pools in excess of the peak per-frame usage over the last FreePoolTrimPeriod frames are
+// periodically returned to the global manager.
 //   ____________________________________________________________________________
 //  |                                                                            |
 //  |                           DynamicDescriptorSetAllocator                    |
 //  |                                                                            |
 //  |  || DescriptorPool[0] | DescriptorPool[1] |  ...   | DescriptorPool[N] ||  |
 //  |__________|_________________________________________________________________|
-//             |                          A                   |
-//             |                          |                   |
-//             |Allocate()       GetPool()|                   |FreePool()
-//             |                     _____|___________________V____
-//             V                    |                              |
-//       VkDescriptorSet            |     DescriptorPoolManager    |
-//                                  |                              |
-//                                  |   |Global dynamic buffer|    |
-//                                  |______________________________|
+//             |              A         |          A            |
+//             |              |         |ReleasePools()         |
+//             |              |         V          |            |
+//             |              |  | Stale pools | --  Free pools |
+//             |              |                                 |
+//             |Allocate()    |GetPool()                        |DisposePool()
+//             |         _____|_________________________________V____
+//             V        |                                            |
+//       VkDescriptorSet|             DescriptorPoolManager          |
+//                      |                                            |
+//                      |____________________________________________|
 //
 class DynamicDescriptorSetAllocator
 {
@@ -272,18 +279,58 @@ public:
 
     VkDescriptorSet Allocate(VkDescriptorSetLayout SetLayout, const char* DebugName);
 
-    // Releases all allocated pools that are later returned to the global pool manager.
-    // As global pool manager is hosted by the render device, the allocator can
+    // Moves all pools allocated in this frame to the stale pool chain. The pools are
+    // reset and reused by this allocator once the GPU has finished the frame.
+    // If commands were submitted to more than one queue, the pools are instead returned to the
+    // global pool manager. As global pool manager is hosted by the render device, the allocator can
     // be destroyed before the pools are actually returned to the global pool manager.
     void ReleasePools(Uint64 QueueMask);
 
     size_t GetAllocatedPoolCount() const { return m_AllocatedPools.size(); }
+    size_t GetStalePoolCount() const { return m_StalePools.size(); }
+    size_t GetFreePoolCount() const { return m_FreePools.size(); }
 
 private:
+    VulkanUtilities::DescriptorPoolWrapper GetPool();
+
+    // Resets all stale pools whose frames have been completed by the GPU and moves them to the free list
+    void RecycleStalePools();
+
+    // Returns free pools in excess of MaxFreePools to the global pool manager
+    void TrimFreePools(size_t MaxFreePools);
+
+    static constexpr Uint32 FreePoolTrimPeriod = 64;
+
+    struct StalePool
+    {
+        // clang-format off
+        StalePool(VulkanUtilities::DescriptorPoolWrapper&& _Pool,
+                  Uint32                                   _QueueIndex,
+                  Uint64                                   _FenceValue) noexcept :
+            Pool      {std::move(_Pool)},
+            QueueIndex{_QueueIndex     },
+            FenceValue{_FenceValue     }
+        {}
+        // clang-format on
+
+        VulkanUtilities::DescriptorPoolWrapper Pool;
+        Uint32                                 QueueIndex;
+        // The pool can be reset once this fence value has been completed by the queue
+        Uint64 FenceValue;
+    };
+
     DescriptorPoolManager&                              m_GlobalPoolMgr;
     const std::string                                   m_Name;
     std::vector<VulkanUtilities::DescriptorPoolWrapper> m_AllocatedPools;
-    size_t                                              m_PeakPoolCount = 0;
+    std::deque<StalePool>                               m_StalePools;
+    std::vector<VulkanUtilities::DescriptorPoolWrapper> m_FreePools;
+    size_t                                              m_PeakPoolCount     = 0;
+    size_t                                              m_RecycledPoolCount = 0;
+    size_t                                              m_TrimmedPoolCount  = 0;
+
+    // Peak number of pools used by a single frame since the free pools were last trimmed
+    size_t m_PeriodPeakPoolCount = 0;
+    Uint32 m_FramesSinceTrim     = 0;
 };
 
 } // namespace Diligent
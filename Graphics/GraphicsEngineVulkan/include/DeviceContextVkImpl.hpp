@@ -33,12 +33,12 @@
 
 #include "DeviceContextVk.h"
 #include "DeviceContextNextGenBase.hpp"
-#include "VulkanUtilities/VulkanCommandBufferPool.hpp"
 #include "VulkanUtilities/VulkanCommandBuffer.hpp"
 #include "VulkanUploadHeap.hpp"
 #include "VulkanDynamicHeap.hpp"
 #include "ResourceReleaseQueue.hpp"
 #include "DescriptorPoolManager.hpp"
+#include "CommandPoolManager.hpp"
 #include "PipelineLayout.hpp"
 #include "GenerateMipsVkHelper.hpp"
 #include "BufferVkImpl.hpp"
@@ -149,6 +149,10 @@ public:
     virtual void DILIGENT_CALL_TYPE Draw               (const DrawAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexed() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE DrawIndexed        (const DrawIndexedAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDraw() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE MultiDraw          (const MultiDrawAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDrawIndexed() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE MultiDrawIndexed   (const MultiDrawIndexedAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndirect() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE DrawIndirect       (const DrawIndirectAttribs& Attribs, IBuffer* pAttribsBuffer) override final;
     /// Implementation of IDeviceContext::DrawIndexedIndirect() in Vulkan backend.
@@ -278,6 +282,18 @@ public:
     /// Implementation of IDeviceContextVk::BufferMemoryBarrier().
     virtual void DILIGENT_CALL_TYPE BufferMemoryBarrier(IBuffer* pBuffer, VkAccessFlags NewAccessFlags) override final;
 
+    /// Implementation of IDeviceContextVk::BeginSecondaryCommandList().
+    virtual void DILIGENT_CALL_TYPE BeginSecondaryCommandList(IRenderPass* pRenderPass, Uint32 SubpassIndex, IFramebuffer* pFramebuffer) override final;
+
+    /// Implementation of IDeviceContextVk::ExecuteSecondaryCommandLists().
+    virtual void DILIGENT_CALL_TYPE ExecuteSecondaryCommandLists(Uint32 NumCommandLists, ICommandList* const* ppCommandLists) override final;
+
+    /// Implementation of IDeviceContextVk::GetCommandPoolStatistics().
+    virtual void DILIGENT_CALL_TYPE GetCommandPoolStatistics(CommandPoolStatisticsVk& Stats) const override final
+    {
+        Stats = m_CmdPool.GetStatistics();
+    }
+
 
     void AddWaitSemaphore(ManagedSemaphore* pWaitSemaphore, VkPipelineStageFlags WaitDstStageMask)
     {
@@ -345,6 +361,21 @@ public:
 
     VulkanDynamicAllocation AllocateDynamicSpace(Uint32 SizeInBytes, Uint32 Alignment);
 
+    // Returns the allocation of the dynamic buffer in this context, or null if the buffer
+    // has never been mapped in this context.
+    const VulkanDynamicAllocation* GetDynamicBufferAllocation(const BufferVkImpl& Buffer) const
+    {
+        const auto Id = Buffer.GetDynamicBufferId();
+        VERIFY(Id != BufferVkImpl::InvalidDynamicBufferId, "Dynamic buffer is expected");
+        if (Id < m_DynamicBufferAllocations.size())
+        {
+            const auto& Entry = m_DynamicBufferAllocations[Id];
+            if (Entry.BufferUID == Buffer.GetUniqueID())
+                return &Entry.Allocation;
+        }
+        return nullptr;
+    }
+
     virtual void ResetRenderTargets() override final;
 
     Int64 GetContextFrameNumber() const { return m_ContextFrameNumber; }
@@ -384,7 +415,6 @@ private:
         }
     }
 
-    inline void DisposeVkCmdBuffer(Uint32 CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue);
     inline void DisposeCurrentCmdBuffer(Uint32 CmdQueue, Uint64 FenceValue);
 
     void CopyBufferToTexture(VkBuffer                       vkSrcBuffer,
@@ -434,8 +464,29 @@ private:
     /// This framebuffer may or may not be currently set in the command buffer
     VkFramebuffer m_vkFramebuffer = VK_NULL_HANDLE;
 
+    /// Contents of the subpasses of the active render pass
+    VkSubpassContents m_vkSubpassContents = VK_SUBPASS_CONTENTS_INLINE;
+
+    /// Indicates that the deferred context records a secondary command buffer
+    /// (see BeginSecondaryCommandList())
+    bool m_IsRecordingSecondaryCmdBuffer = false;
+
     FixedBlockMemoryAllocator m_CmdListAllocator;
 
+    // Deferred contexts that recorded secondary command buffers executed in the current command buffer.
+    // When the command buffer is submitted, the contexts are notified of the command queue used.
+    std::vector<RefCntAutoPtr<IDeviceContext>> m_PendingSecondaryCmdListContexts;
+    std::vector<VkCommandBuffer>               m_vkSecondaryCmdBuffers;
+
+    // The number of secondary command lists recorded by this deferred context that have been
+    // executed by immediate contexts, but have not been submitted to the queue yet.
+    Uint32 m_NumPendingSecondaryCmdLists = 0;
+
+    // Command pools that the deferred context detached in FinishFrame() while some of its secondary
+    // command lists were pending. The pools are released when the last pending list is submitted.
+    std::vector<VulkanUtilities::CommandPoolWrapper> m_DetachedCmdPools;
+    Uint64                                           m_DetachedCmdPoolsQueueMask = 0;
+
     // Semaphores are not owned by the command context
     std::vector<RefCntAutoPtr<ManagedSemaphore>> m_WaitSemaphores;
     std::vector<VkPipelineStageFlags>            m_WaitDstStageMasks;
@@ -449,6 +500,19 @@ private:
 
     std::unordered_map<BufferVkImpl*, VulkanUploadAllocation> m_UploadAllocations;
 
+    struct DynamicBufferAllocation
+    {
+        VulkanDynamicAllocation Allocation;
+
+        // Unique ID of the buffer the allocation belongs to. Dynamic buffer ids are reused
+        // when buffers are destroyed, so the entry may be left over from a released buffer.
+        Int32 BufferUID = 0;
+    };
+    // Dynamic allocations of all dynamic buffers mapped in this context, indexed by
+    // BufferVkImpl::GetDynamicBufferId(). Keeping them in one dense array rather than
+    // in every buffer makes reading dynamic offsets when binding descriptor sets cache-friendly.
+    std::vector<DynamicBufferAllocation> m_DynamicBufferAllocations;
+
     struct MappedTextureKey
     {
         TextureVkImpl* const Texture;
@@ -476,10 +540,10 @@ private:
     };
     std::unordered_map<MappedTextureKey, MappedTexture, MappedTextureKey::Hasher> m_MappedTextures;
 
-    VulkanUtilities::VulkanCommandBufferPool m_CmdPool;
-    VulkanUploadHeap                         m_UploadHeap;
-    VulkanDynamicHeap                        m_DynamicHeap;
-    DynamicDescriptorSetAllocator            m_DynamicDescrSetAllocator;
+    CommandPoolRing               m_CmdPool;
+    VulkanUploadHeap              m_UploadHeap;
+    VulkanDynamicHeap             m_DynamicHeap;
+    DynamicDescriptorSetAllocator m_DynamicDescrSetAllocator;
 
     PipelineLayout::DescriptorSetBindInfo m_DescrSetBindInfo;
     std::shared_ptr<GenerateMipsVkHelper> m_GenerateMipsHelper;
@@ -494,4 +558,26 @@ private:
     std::vector<VkClearValue> m_vkClearValues;
 };
 
+inline Uint32 BufferVkImpl::GetDynamicOffset(Uint32 CtxId, DeviceContextVkImpl* pCtx) const
+{
+    if (m_VulkanBuffer != VK_NULL_HANDLE)
+    {
+        return 0;
+    }
+    else
+    {
+        VERIFY(m_Desc.Usage == USAGE_DYNAMIC, "Dynamic buffer is expected");
+        VERIFY_EXPR(pCtx != nullptr && pCtx->GetContextId() == CtxId);
+        const auto* pDynAlloc = pCtx->GetDynamicBufferAllocation(*this);
+        DEV_CHECK_ERR(pDynAlloc != nullptr, "Dynamic buffer '", m_Desc.Name, "' has no allocation in context ", CtxId,
+                      ". Note: memory for dynamic buffers is allocated when a buffer is mapped.");
+        if (pDynAlloc == nullptr)
+            return 0;
+#ifdef DILIGENT_DEVELOPMENT
+        DvpVerifyDynamicAllocation(pCtx);
+#endif
+        return static_cast<Uint32>(pDynAlloc->AlignedOffset);
+    }
+}
+
 } // namespace Diligent
@@ -33,6 +33,7 @@
 #include <unordered_map>
 #include <mutex>
 #include "VulkanUtilities/VulkanObjectWrappers.hpp"
+#include "FlatHashMap.hpp"
 
 namespace Diligent
 {
@@ -86,8 +87,8 @@ private:
         }
     };
 
-    std::mutex                                                                                            m_Mutex;
-    std::unordered_map<FramebufferCacheKey, VulkanUtilities::FramebufferWrapper, FramebufferCacheKeyHash> m_Cache;
+    std::mutex                                                                                     m_Mutex;
+    FlatHashMap<FramebufferCacheKey, VulkanUtilities::FramebufferWrapper, FramebufferCacheKeyHash> m_Cache;
 
     std::unordered_multimap<VkImageView, FramebufferCacheKey>  m_ViewToKeyMap;
     std::unordered_multimap<VkRenderPass, FramebufferCacheKey> m_RenderPassToKeyMap;
@@ -58,6 +58,10 @@ public:
 
     std::array<Uint32, 2> GetDescriptorSetSizes(Uint32& NumSets) const;
 
+    // Returns the mask of descriptor sets that are written with vkUpdateDescriptorSetWithTemplate()
+    // and thus need descriptor infos in the resource cache
+    Uint32 GetDescriptorUpdateTemplateSetMask() const;
+
     void InitResourceCache(RenderDeviceVkImpl*    pDeviceVkImpl,
                            ShaderResourceCacheVk& ResourceCache,
                            IMemoryAllocator&      CacheMemAllocator,
@@ -92,6 +96,13 @@ public:
         return m_LayoutMgr.GetDescriptorSet(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC).VkLayout;
     }
 
+    // Writes all dynamic resource descriptors from the resource cache into the given
+    // descriptor set with a single vkUpdateDescriptorSetWithTemplate() call.
+    // Returns false if descriptor update templates are not supported by the device.
+    bool UpdateDynamicDescriptorSet(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice,
+                                    const ShaderResourceCacheVk&                ResourceCache,
+                                    VkDescriptorSet                             vkDynamicDescrSet) const;
+
     struct DescriptorSetBindInfo
     {
         std::vector<VkDescriptorSet> vkSets;
@@ -168,10 +179,17 @@ private:
             uint16_t                                    NumLayoutBindings     = 0;
             VkDescriptorSetLayoutBinding*               pBindings             = nullptr;
             VulkanUtilities::DescriptorSetLayoutWrapper VkLayout;
+            // Update template that reads descriptors from ShaderResourceCacheVk descriptor infos.
+            // Only created for the dynamic set when VK_KHR_descriptor_update_template is enabled.
+            VulkanUtilities::DescriptorUpdateTemplateWrapper VkUpdateTemplate;
+            // Whether the update template writes combined image samplers that take their
+            // samplers from texture views rather than from the layout
+            bool HasViewSamplers = false;
 
             ~DescriptorSetLayout();
             void AddBinding(const VkDescriptorSetLayoutBinding& Binding, IMemoryAllocator& MemAllocator);
             void Finalize(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice, IMemoryAllocator& MemAllocator, VkDescriptorSetLayoutBinding* pNewBindings);
+            void CreateUpdateTemplate(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice);
             void Release(RenderDeviceVkImpl* pRenderDeviceVk, IMemoryAllocator& MemAllocator, Uint64 CommandQueueMask);
 
             bool   operator==(const DescriptorSetLayout& rhs) const;
@@ -31,6 +31,9 @@
 /// Declaration of Diligent::PipelineStateVkImpl class
 
 #include <array>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 
 #include "RenderDeviceVk.h"
 #include "PipelineStateVk.h"
@@ -69,6 +72,9 @@ public:
     /// Implementation of IPipelineState::IsCompatibleWith() in Vulkan backend.
     virtual bool DILIGENT_CALL_TYPE IsCompatibleWith(const IPipelineState* pPSO) const override final;
 
+    /// Implementation of IPipelineState::GetStatus() in Vulkan backend.
+    virtual PIPELINE_STATE_STATUS DILIGENT_CALL_TYPE GetStatus(bool WaitForCompletion) override final;
+
     /// Implementation of IPipelineStateVk::GetRenderPass().
     virtual IRenderPassVk* DILIGENT_CALL_TYPE GetRenderPass() const override final { return m_pRenderPass.RawPtr<IRenderPassVk>(); }
 
@@ -84,6 +90,9 @@ public:
     /// Implementation of IPipelineState::GetStaticVariableByName() in Vulkan backend.
     virtual IShaderResourceVariable* DILIGENT_CALL_TYPE GetStaticVariableByName(SHADER_TYPE ShaderType, const Char* Name) override final;
 
+    /// Implementation of IPipelineState::GetStaticVariableByInternedName() in Vulkan backend.
+    virtual IShaderResourceVariable* DILIGENT_CALL_TYPE GetStaticVariableByInternedName(SHADER_TYPE ShaderType, const InternedString& Name) override final;
+
     /// Implementation of IPipelineState::GetStaticVariableByIndex() in Vulkan backend.
     virtual IShaderResourceVariable* DILIGENT_CALL_TYPE GetStaticVariableByIndex(SHADER_TYPE ShaderType, Uint32 Index) override final;
 
@@ -129,9 +138,14 @@ private:
     using TShaderStages = ShaderResourceLayoutVk::TShaderStages;
 
     template <typename PSOCreateInfoType>
-    void InitInternalObjects(const PSOCreateInfoType&                           CreateInfo,
-                             std::vector<VkPipelineShaderStageCreateInfo>&      vkShaderStages,
-                             std::vector<VulkanUtilities::ShaderModuleWrapper>& ShaderModules);
+    void InitInternalObjects(const PSOCreateInfoType& CreateInfo,
+                             TShaderStages&           ShaderStages);
+
+    // Creates shader modules and the Vulkan pipeline
+    void CreatePipeline(TShaderStages& ShaderStages);
+
+    // Runs CreatePipeline() in the device's pipeline thread pool
+    void CreatePipelineAsync(TShaderStages&& ShaderStages);
 
     void InitResourceLayouts(const PipelineStateCreateInfo& CreateInfo,
                              TShaderStages&                 ShaderStages);
@@ -172,6 +186,15 @@ private:
 
     bool m_HasStaticResources    = false;
     bool m_HasNonStaticResources = false;
+
+    std::atomic<PIPELINE_STATE_STATUS> m_Status{PIPELINE_STATE_STATUS_READY};
+
+    // Used to wait for the asynchronous creation to complete
+    std::mutex              m_StatusMtx;
+    std::condition_variable m_StatusCV;
+
+    // Set while the asynchronous creation task may access the object, protected by m_StatusMtx
+    bool m_AsyncTaskRunning = false;
 };
 
 } // namespace Diligent
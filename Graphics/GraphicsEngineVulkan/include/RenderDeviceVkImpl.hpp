@@ -30,6 +30,7 @@
 /// \file
 /// Declaration of Diligent::RenderDeviceVkImpl class
 #include <memory>
+#include <mutex>
 
 #include "RenderDeviceVk.h"
 #include "RenderDeviceBase.hpp"
@@ -49,6 +50,8 @@
 #include "RenderPassCache.hpp"
 #include "CommandPoolManager.hpp"
 #include "DXCompiler.hpp"
+#include "SPIRVCompilationCache.hpp"
+#include "ThreadPool.hpp"
 
 namespace Diligent
 {
@@ -136,6 +139,9 @@ public:
                                                                    RESOURCE_STATE    InitialState,
                                                                    IBuffer**         ppBuffer) override final;
 
+    /// Implementation of IRenderDeviceVk::GetPipelineCacheData().
+    virtual void DILIGENT_CALL_TYPE GetPipelineCacheData(IDataBlob** ppData) override final;
+
     /// Implementation of IRenderDevice::IdleGPU() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE IdleGPU() override final;
 
@@ -182,12 +188,29 @@ public:
 
     IDXCompiler* GetDxCompiler() const { return m_pDxCompiler.get(); }
 
+    VkPipelineCache GetVkPipelineCache() const { return m_PipelineCache; }
+
+    // Returns null if the SPIR-V compilation cache is disabled
+    SPIRVCompilationCache* GetSPIRVCompilationCache() const { return m_pSPIRVCache.get(); }
+
+    // Returns the worker thread pool that creates pipelines asynchronously.
+    // The pool is created when the method is called for the first time.
+    ThreadPool& GetPipelineThreadPool();
+
+    // Dynamic buffers are identified by compact indices that address dense per-context
+    // tables of dynamic allocations (see DeviceContextVkImpl::GetDynamicBufferAllocation).
+    // Released indices are reused by new buffers.
+    Uint32 AllocateDynamicBufferId();
+    void   ReleaseDynamicBufferId(Uint32 Id);
+
 private:
     template <typename PSOCreateInfoType>
     void CreatePipelineState(const PSOCreateInfoType& PSOCreateInfo, IPipelineState** ppPipelineState);
 
     virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) override final;
 
+    void InitPipelineCache(const void* pCacheData, size_t CacheDataSize);
+
     // Submits command buffer for execution to the command queue
     // Returns the submitted command buffer number and the fence value
     // Parameters:
@@ -216,6 +239,21 @@ private:
     VulkanDynamicMemoryManager m_DynamicMemoryManager;
 
     std::unique_ptr<IDXCompiler> m_pDxCompiler;
+
+    // Pipeline cache used to create all pipelines. Vulkan implementations synchronize
+    // access to the cache internally, so it can be used by multiple threads simultaneously.
+    VulkanUtilities::PipelineCacheWrapper m_PipelineCache;
+
+    std::unique_ptr<SPIRVCompilationCache> m_pSPIRVCache;
+
+    // Every pipeline state waits for its asynchronous creation task in the destructor,
+    // so the pool has no pending tasks when the device is destroyed.
+    std::mutex                  m_PipelineThreadPoolMtx;
+    std::unique_ptr<ThreadPool> m_pPipelineThreadPool;
+
+    std::mutex          m_DynamicBufferIdsMtx;
+    std::vector<Uint32> m_FreeDynamicBufferIds;
+    Uint32              m_NextDynamicBufferId = 0;
 };
 
 } // namespace Diligent
@@ -35,6 +35,7 @@
 #include "GraphicsTypes.h"
 #include "Constants.h"
 #include "HashUtils.hpp"
+#include "FlatHashMap.hpp"
 #include "VulkanUtilities/VulkanObjectWrappers.hpp"
 #include "RefCntAutoPtr.hpp"
 
@@ -113,9 +114,11 @@ public:
         {
             if (Hash == 0)
             {
-                Hash = ComputeHash(NumRenderTargets, SampleCount, DSVFormat);
+                HashDataPacker<sizeof(RenderPassCacheKey)> Packer;
+                Packer.Add(NumRenderTargets, SampleCount, DSVFormat);
                 for (Uint32 rt = 0; rt < NumRenderTargets; ++rt)
-                    HashCombine(Hash, RTVFormats[rt]);
+                    Packer.Add(RTVFormats[rt]);
+                Hash = Packer.GetHash();
             }
             return Hash;
         }
@@ -139,8 +142,8 @@ private:
 
     RenderDeviceVkImpl& m_DeviceVkImpl;
 
-    std::mutex                                                                                      m_Mutex;
-    std::unordered_map<RenderPassCacheKey, RefCntAutoPtr<RenderPassVkImpl>, RenderPassCacheKeyHash> m_Cache;
+    std::mutex                                                                               m_Mutex;
+    FlatHashMap<RenderPassCacheKey, RefCntAutoPtr<RenderPassVkImpl>, RenderPassCacheKeyHash> m_Cache;
 };
 
 } // namespace Diligent
@@ -62,6 +62,9 @@ public:
     /// Implementation of IShaderResourceBinding::GetVariableByName() in Vulkan backend.
     virtual IShaderResourceVariable* DILIGENT_CALL_TYPE GetVariableByName(SHADER_TYPE ShaderType, const char* Name) override final;
 
+    /// Implementation of IShaderResourceBinding::GetVariableByInternedName() in Vulkan backend.
+    virtual IShaderResourceVariable* DILIGENT_CALL_TYPE GetVariableByInternedName(SHADER_TYPE ShaderType, const InternedString& Name) override final;
+
     /// Implementation of IShaderResourceBinding::GetVariableCount() in Vulkan backend.
     virtual Uint32 DILIGENT_CALL_TYPE GetVariableCount(SHADER_TYPE ShaderType) const override final;
 
@@ -52,6 +52,15 @@
 //
 // Descriptor set for static and mutable resources is assigned during cache initialization
 // Descriptor set for dynamic resources is assigned at every draw call
+//
+// Sets that are written with a descriptor update template additionally keep descriptor infos of
+// all their resources in the format consumed by vkUpdateDescriptorSetWithTemplate(). Descriptor
+// infos are stored after all resources:
+//
+//  |  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ...  |  Res[m-1]  |  Info[0]  |  ...  |  Info[m-1]  |
+//                                                                                            A
+//                                                                                            |
+//                                                              m_pDescriptorInfos ___________|
 
 #include <vector>
 #include "DescriptorPoolManager.hpp"
@@ -90,11 +99,21 @@ public:
 
     ~ShaderResourceCacheVk();
 
-    static size_t GetRequiredMemorySize(Uint32 NumSets, Uint32 SetSizes[]);
+    // TemplateSetMask indicates the sets that keep descriptor infos for vkUpdateDescriptorSetWithTemplate()
+    static size_t GetRequiredMemorySize(Uint32 NumSets, Uint32 SetSizes[], Uint32 TemplateSetMask = 0);
 
-    void InitializeSets(IMemoryAllocator& MemAllocator, Uint32 NumSets, Uint32 SetSizes[]);
+    void InitializeSets(IMemoryAllocator& MemAllocator, Uint32 NumSets, Uint32 SetSizes[], Uint32 TemplateSetMask = 0);
     void InitializeResources(Uint32 Set, Uint32 Offset, Uint32 ArraySize, SPIRVShaderResourceAttribs::ResourceType Type);
 
+    // Descriptor in the raw format consumed by vkUpdateDescriptorSetWithTemplate()
+    // sizeof(DescriptorInfo) == 24 (x64, msvc, Release)
+    union DescriptorInfo
+    {
+        VkDescriptorImageInfo  ImageInfo;
+        VkDescriptorBufferInfo BufferInfo;
+        VkBufferView           TexelBufferView;
+    };
+
     // sizeof(Resource) == 16 (x64, msvc, Release)
     struct Resource
     {
@@ -118,17 +137,19 @@ public:
         VkBufferView           GetBufferViewWriteInfo       ()                       const;
         VkDescriptorImageInfo  GetSamplerDescriptorWriteInfo()                       const;
         VkDescriptorImageInfo  GetInputAttachmentDescriptorWriteInfo()               const;
+        DescriptorInfo         GetDescriptorInfo            (bool IsImmutableSampler)const;
         // clang-format on
     };
 
-    // sizeof(DescriptorSet) == 48 (x64, msvc, Release)
+    // sizeof(DescriptorSet) == 56 (x64, msvc, Release)
     class DescriptorSet
     {
     public:
         // clang-format off
-        DescriptorSet(Uint32 NumResources, Resource *pResources) :
-            m_NumResources  {NumResources},
-            m_pResources    {pResources  }
+        DescriptorSet(Uint32 NumResources, Resource *pResources, DescriptorInfo *pDescriptorInfos) :
+            m_NumResources     {NumResources    },
+            m_pResources       {pResources      },
+            m_pDescriptorInfos {pDescriptorInfos}
         {}
 
         DescriptorSet             (const DescriptorSet&) = delete;
@@ -150,6 +171,27 @@ public:
 
         inline Uint32 GetSize() const { return m_NumResources; }
 
+        // Returns the descriptor info of the resource in the update template format,
+        // or null if the set is not written with a descriptor update template
+        inline DescriptorInfo* GetDescriptorInfo(Uint32 CacheOffset)
+        {
+            VERIFY(CacheOffset < m_NumResources, "Offset ", CacheOffset, " is out of range");
+            return m_pDescriptorInfos != nullptr ? m_pDescriptorInfos + CacheOffset : nullptr;
+        }
+
+        // Updates the samplers in the descriptor infos of Count combined image samplers starting at
+        // CacheOffset from the texture views in the cache. A sampler may be assigned to a view after
+        // the view has been bound, so these infos are refreshed before every template update.
+        // The infos are derived from the cached resources, so the method is const.
+        void RefreshCombinedImageSamplers(Uint32 CacheOffset, Uint32 Count) const;
+
+        // Returns the pointer to the descriptor data of the set in the update template format
+        const void* GetDescriptorUpdateTemplateData() const
+        {
+            VERIFY(m_pDescriptorInfos != nullptr, "This set is not written with a descriptor update template");
+            return m_pDescriptorInfos;
+        }
+
         VkDescriptorSet GetVkDescriptorSet() const
         {
             return m_DescriptorSetAllocation.GetVkDescriptorSet();
@@ -165,9 +207,10 @@ public:
 /* 0 */ const Uint32 m_NumResources = 0;
 
     private:
-/* 8 */ Resource* const m_pResources = nullptr;
-/*16 */ DescriptorSetAllocation m_DescriptorSetAllocation;
-/*48 */ // End of structure
+/* 8 */ Resource* const       m_pResources       = nullptr;
+/*16 */ DescriptorInfo* const m_pDescriptorInfos = nullptr;
+/*24 */ DescriptorSetAllocation m_DescriptorSetAllocation;
+/*56 */ // End of structure
         // clang-format on
     };
 
@@ -89,6 +89,7 @@ public:
     void DestroyVariables(IMemoryAllocator& Allocator);
 
     ShaderVariableVkImpl* GetVariable(const Char* Name) const;
+    ShaderVariableVkImpl* GetVariable(const InternedString& Name) const;
     ShaderVariableVkImpl* GetVariable(Uint32 Index) const;
 
     void BindResources(IResourceMapping* pResourceMapping, Uint32 Flags) const;
@@ -105,6 +106,17 @@ private:
 
     Uint32 GetVariableIndex(const ShaderVariableVkImpl& Variable);
 
+    // Entry of the name hash index that follows the variables in the same memory block.
+    // The entries are sorted by hash, so variables are looked up by interned names
+    // with a binary search.
+    struct VariableHashEntry
+    {
+        size_t NameHash;
+        Uint32 VarIndex;
+
+        bool operator<(const VariableHashEntry& rhs) const { return NameHash < rhs.NameHash; }
+    };
+
     IObject& m_Owner;
     // Variable mgr is owned by either Pipeline state object (in which case m_ResourceCache references
     // static resource cache owned by the same PSO object), or by SRB object (in which case
@@ -116,6 +128,7 @@ private:
     // memory allocator is used. This ensures that all resources from different shader resource bindings reside in
     // continuous memory. If allocation granularity == 1, raw allocator is used.
     ShaderVariableVkImpl* m_pVariables   = nullptr;
+    VariableHashEntry*    m_pHashIndex   = nullptr;
     Uint32                m_NumVariables = 0;
 
 #ifdef DILIGENT_DEBUG
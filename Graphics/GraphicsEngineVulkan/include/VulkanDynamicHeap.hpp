@@ -114,10 +114,10 @@ struct VulkanDynamicAllocation
 //
 // We cannot use global memory manager for dynamic resources because they
 // need to use the same Vulkan buffer
-class VulkanDynamicMemoryManager : public DynamicHeap::MasterBlockListBasedManager
+class VulkanDynamicMemoryManager : public DynamicHeap::MasterBlockListBasedManager<>
 {
 public:
-    using TBase       = DynamicHeap::MasterBlockListBasedManager;
+    using TBase       = DynamicHeap::MasterBlockListBasedManager<>;
     using OffsetType  = TBase::OffsetType;
     using MasterBlock = TBase::MasterBlock;
 
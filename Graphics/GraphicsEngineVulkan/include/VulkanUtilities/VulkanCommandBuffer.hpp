@@ -187,7 +187,8 @@ public:
                                        uint32_t            FramebufferWidth,
                                        uint32_t            FramebufferHeight,
                                        uint32_t            ClearValueCount = 0,
-                                       const VkClearValue* pClearValues    = nullptr)
+                                       const VkClearValue* pClearValues    = nullptr,
+                                       VkSubpassContents   Contents        = VK_SUBPASS_CONTENTS_INLINE)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
         VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "Current pass has not been ended");
@@ -210,9 +211,10 @@ public:
                                                       // ignored (7.4)
 
             vkCmdBeginRenderPass(m_VkCmdBuffer, &BeginInfo,
-                                 VK_SUBPASS_CONTENTS_INLINE // the contents of the subpass will be recorded inline in the
-                                                            // primary command buffer, and secondary command buffers must not
-                                                            // be executed within the subpass
+                                 Contents // VK_SUBPASS_CONTENTS_INLINE: the contents of the subpass will be recorded inline in the
+                                          // primary command buffer, and secondary command buffers must not be executed within the subpass.
+                                          // VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS: the contents are recorded in secondary
+                                          // command buffers, and vkCmdExecuteCommands is the only valid command in the subpass (7.4)
             );
             m_State.RenderPass        = RenderPass;
             m_State.Framebuffer       = Framebuffer;
@@ -239,11 +241,41 @@ public:
         }
     }
 
-    __forceinline void NextSubpass()
+    __forceinline void NextSubpass(VkSubpassContents Contents = VK_SUBPASS_CONTENTS_INLINE)
     {
         VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "Render pass has not been started");
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        vkCmdNextSubpass(m_VkCmdBuffer, VK_SUBPASS_CONTENTS_INLINE);
+        vkCmdNextSubpass(m_VkCmdBuffer, Contents);
+    }
+
+    // Marks the secondary command buffer as recording commands inside the render pass
+    // instance that will be begun by the primary command buffer executing it.
+    __forceinline void SetInheritedRenderPass(VkRenderPass  RenderPass,
+                                              VkFramebuffer Framebuffer,
+                                              uint32_t      FramebufferWidth,
+                                              uint32_t      FramebufferHeight)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "Current pass has not been ended");
+        m_State.RenderPass        = RenderPass;
+        m_State.Framebuffer       = Framebuffer;
+        m_State.FramebufferWidth  = FramebufferWidth;
+        m_State.FramebufferHeight = FramebufferHeight;
+    }
+
+    __forceinline void ExecuteCommands(uint32_t CommandBufferCount, const VkCommandBuffer* pCommandBuffers)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "Secondary command buffers that continue a render pass must be executed inside render pass");
+        vkCmdExecuteCommands(m_VkCmdBuffer, CommandBufferCount, pCommandBuffers);
+
+        // After vkCmdExecuteCommands, any state bound in the primary command buffer
+        // becomes undefined (6.6)
+        m_State.GraphicsPipeline  = VK_NULL_HANDLE;
+        m_State.ComputePipeline   = VK_NULL_HANDLE;
+        m_State.IndexBuffer       = VK_NULL_HANDLE;
+        m_State.IndexBufferOffset = 0;
+        m_State.IndexType         = VK_INDEX_TYPE_MAX_ENUM;
     }
 
     __forceinline void EndCommandBuffer()
@@ -27,10 +27,8 @@
 
 #pragma once
 
-#include <deque>
+#include <vector>
 #include <memory>
-#include <mutex>
-#include <atomic>
 #include "VulkanHeaders.h"
 #include "VulkanLogicalDevice.hpp"
 #include "VulkanObjectWrappers.hpp"
@@ -38,6 +36,10 @@
 namespace VulkanUtilities
 {
 
+// Command pool together with all command buffers allocated from it.
+// Command buffers are never returned to the pool individually. Instead, the whole pool is reset
+// by Reset() once the GPU has finished all buffers, which makes all of them available for reuse.
+// The class is not thread-safe: the pool must only be accessed by the thread that records the commands.
 class VulkanCommandBufferPool
 {
 public:
@@ -55,28 +57,39 @@ public:
     ~VulkanCommandBufferPool();
 
     VkCommandBuffer GetCommandBuffer(const char* DebugName = "");
-    // The GPU must have finished with the command buffer being returned to the pool
-    void FreeCommandBuffer(VkCommandBuffer&& CmdBuffer);
+    // Returns a secondary command buffer that records commands inside the render pass subpass
+    // described by InheritanceInfo
+    VkCommandBuffer GetSecondaryCommandBuffer(const VkCommandBufferInheritanceInfo& InheritanceInfo, const char* DebugName = "");
 
-    CommandPoolWrapper&& Release();
+    // Resets the command pool with vkResetCommandPool and makes all command buffers available for reuse.
+    // The GPU must have finished with all command buffers allocated from the pool.
+    void Reset();
+
+    // Returns the number of command buffers that have been requested since the last reset
+    size_t GetUsedBufferCount() const
+    {
+        return m_NumUsedBuffers[VK_COMMAND_BUFFER_LEVEL_PRIMARY] + m_NumUsedBuffers[VK_COMMAND_BUFFER_LEVEL_SECONDARY];
+    }
 
-#ifdef DILIGENT_DEVELOPMENT
-    int32_t DvpGetBufferCounter() const
+    // Returns the total number of command buffers allocated from the pool
+    size_t GetAllocatedBufferCount() const
     {
-        return m_BuffCounter;
+        return m_CmdBuffers[VK_COMMAND_BUFFER_LEVEL_PRIMARY].size() + m_CmdBuffers[VK_COMMAND_BUFFER_LEVEL_SECONDARY].size();
     }
-#endif
+
+    CommandPoolWrapper&& Release();
 
 private:
+    VkCommandBuffer AllocateCommandBuffer(VkCommandBufferLevel Level);
+
     // Shared point to logical device must be defined before the command pool
     std::shared_ptr<const VulkanLogicalDevice> m_LogicalDevice;
     CommandPoolWrapper                         m_CmdPool;
 
-    std::mutex                  m_Mutex;
-    std::deque<VkCommandBuffer> m_CmdBuffers;
-#ifdef DILIGENT_DEVELOPMENT
-    std::atomic_int32_t m_BuffCounter;
-#endif
+    // Primary and secondary command buffers allocated from the pool, indexed by VkCommandBufferLevel.
+    // The first m_NumUsedBuffers[Level] buffers are in use, the rest are available.
+    std::vector<VkCommandBuffer> m_CmdBuffers[2];
+    size_t                       m_NumUsedBuffers[2] = {};
 };
 
 } // namespace VulkanUtilities
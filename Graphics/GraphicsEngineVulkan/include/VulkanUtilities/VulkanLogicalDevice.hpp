@@ -57,7 +57,9 @@ enum class VulkanHandleTypeId : uint32_t
     Semaphore,
     Queue,
     Event,
-    QueryPool
+    QueryPool,
+    PipelineCache,
+    DescriptorUpdateTemplate
 };
 
 template <typename VulkanObjectType, VulkanHandleTypeId>
@@ -81,6 +83,8 @@ using DescriptorPoolWrapper      = DEFINE_VULKAN_OBJECT_WRAPPER(DescriptorPool);
 using DescriptorSetLayoutWrapper = DEFINE_VULKAN_OBJECT_WRAPPER(DescriptorSetLayout);
 using SemaphoreWrapper           = DEFINE_VULKAN_OBJECT_WRAPPER(Semaphore);
 using QueryPoolWrapper           = DEFINE_VULKAN_OBJECT_WRAPPER(QueryPool);
+using PipelineCacheWrapper       = DEFINE_VULKAN_OBJECT_WRAPPER(PipelineCache);
+using DescriptorUpdateTemplateWrapper = VulkanObjectWrapper<VkDescriptorUpdateTemplateKHR, VulkanHandleTypeId::DescriptorUpdateTemplate>;
 #undef DEFINE_VULKAN_OBJECT_WRAPPER
 
 class VulkanLogicalDevice : public std::enable_shared_from_this<VulkanLogicalDevice>
@@ -141,6 +145,10 @@ public:
     SemaphoreWrapper    CreateSemaphore(const VkSemaphoreCreateInfo& SemaphoreCI, const char* DebugName = "") const;
     QueryPoolWrapper    CreateQueryPool(const VkQueryPoolCreateInfo& QueryPoolCI, const char* DebugName = "") const;
 
+    PipelineCacheWrapper CreatePipelineCache(const VkPipelineCacheCreateInfo& PipelineCacheCI, const char* DebugName = "") const;
+
+    DescriptorUpdateTemplateWrapper CreateDescriptorUpdateTemplate(const VkDescriptorUpdateTemplateCreateInfoKHR& TemplateCI, const char* DebugName = "") const;
+
     VkCommandBuffer     AllocateVkCommandBuffer(const VkCommandBufferAllocateInfo& AllocInfo, const char* DebugName = "") const;
     VkDescriptorSet     AllocateVkDescriptorSet(const VkDescriptorSetAllocateInfo& AllocInfo, const char* DebugName = "") const;
 
@@ -161,6 +169,8 @@ public:
     void ReleaseVulkanObject(DescriptorSetLayoutWrapper&& DescriptorSetLayout) const;
     void ReleaseVulkanObject(SemaphoreWrapper&&     Semaphore) const;
     void ReleaseVulkanObject(QueryPoolWrapper&&     QueryPool) const;
+    void ReleaseVulkanObject(PipelineCacheWrapper&& PipelineCache) const;
+    void ReleaseVulkanObject(DescriptorUpdateTemplateWrapper&& DescriptorUpdateTemplate) const;
 
     void FreeDescriptorSet(VkDescriptorPool Pool, VkDescriptorSet Set) const;
 
@@ -189,6 +199,16 @@ public:
                               uint32_t                    descriptorCopyCount,
                               const VkCopyDescriptorSet*  pDescriptorCopies) const;
 
+    void UpdateDescriptorSetWithTemplate(VkDescriptorSet               descriptorSet,
+                                         VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate,
+                                         const void*                   pData) const;
+
+    VkResult GetSemaphoreCounterValue(VkSemaphore semaphore, uint64_t* pValue) const;
+
+    VkResult WaitSemaphore(VkSemaphore semaphore, uint64_t value, uint64_t timeout) const;
+
+    VkResult SignalSemaphore(VkSemaphore semaphore, uint64_t value) const;
+
     VkResult ResetCommandPool(VkCommandPool           vkCmdPool,
                               VkCommandPoolResetFlags flags = 0) const;
 
@@ -207,10 +227,23 @@ public:
                                      dataSize, pData, stride, flags);
     }
 
+    VkResult GetPipelineCacheData(VkPipelineCache pipelineCache,
+                                  size_t*         pDataSize,
+                                  void*           pData) const
+    {
+        return vkGetPipelineCacheData(m_VkDevice, pipelineCache, pDataSize, pData);
+    }
+
     VkPipelineStageFlags GetEnabledGraphicsShaderStages() const { return m_EnabledGraphicsShaderStages; }
 
     const VkPhysicalDeviceFeatures& GetEnabledFeatures() const { return m_EnabledFeatures; }
 
+    // Returns true if VK_KHR_descriptor_update_template extension is enabled
+    bool IsDescriptorUpdateTemplateSupported() const { return m_vkUpdateDescriptorSetWithTemplate != nullptr; }
+
+    // Returns true if VK_KHR_timeline_semaphore extension is enabled
+    bool IsTimelineSemaphoreSupported() const { return m_vkGetSemaphoreCounterValue != nullptr; }
+
 private:
     VulkanLogicalDevice(VkPhysicalDevice             vkPhysicalDevice,
                         const VkDeviceCreateInfo&    DeviceCI,
@@ -229,6 +262,16 @@ private:
     const VkAllocationCallbacks* const m_VkAllocator;
     VkPipelineStageFlags               m_EnabledGraphicsShaderStages = 0;
     const VkPhysicalDeviceFeatures     m_EnabledFeatures;
+
+    // VK_KHR_descriptor_update_template entry points, null if the extension is not enabled
+    PFN_vkCreateDescriptorUpdateTemplateKHR  m_vkCreateDescriptorUpdateTemplate  = nullptr;
+    PFN_vkDestroyDescriptorUpdateTemplateKHR m_vkDestroyDescriptorUpdateTemplate = nullptr;
+    PFN_vkUpdateDescriptorSetWithTemplateKHR m_vkUpdateDescriptorSetWithTemplate = nullptr;
+
+    // VK_KHR_timeline_semaphore entry points, null if the extension is not enabled
+    PFN_vkGetSemaphoreCounterValueKHR m_vkGetSemaphoreCounterValue = nullptr;
+    PFN_vkWaitSemaphoresKHR           m_vkWaitSemaphores           = nullptr;
+    PFN_vkSignalSemaphoreKHR          m_vkSignalSemaphore          = nullptr;
 };
 
 } // namespace VulkanUtilities
@@ -32,8 +32,10 @@
 #include <unordered_map>
 #include <atomic>
 #include <string>
+#include <memory>
 #include "MemoryAllocator.h"
 #include "VariableSizeAllocationsManager.hpp"
+#include "TLSFAllocationsManager.hpp"
 #include "VulkanUtilities/VulkanPhysicalDevice.hpp"
 #include "VulkanUtilities/VulkanLogicalDevice.hpp"
 #include "VulkanUtilities/VulkanObjectWrappers.hpp"
@@ -95,18 +97,22 @@ struct VulkanMemoryAllocation
 class VulkanMemoryPage
 {
 public:
+    // When UseTLSFAllocator is true, the page suballocates its memory with the constant-time
+    // TLSFAllocationsManager. Otherwise, the best-fit VariableSizeAllocationsManager is used.
     VulkanMemoryPage(VulkanMemoryManager& ParentMemoryMgr,
                      VkDeviceSize         PageSize,
                      uint32_t             MemoryTypeIndex,
-                     bool                 IsHostVisible) noexcept;
+                     bool                 IsHostVisible,
+                     bool                 UseTLSFAllocator) noexcept;
     ~VulkanMemoryPage();
 
     // clang-format off
     VulkanMemoryPage(VulkanMemoryPage&& rhs)noexcept :
-        m_ParentMemoryMgr {rhs.m_ParentMemoryMgr         },
-        m_AllocationMgr   {std::move(rhs.m_AllocationMgr)},
-        m_VkMemory        {std::move(rhs.m_VkMemory)     },
-        m_CPUMemory       {rhs.m_CPUMemory               }
+        m_ParentMemoryMgr   {rhs.m_ParentMemoryMgr             },
+        m_ListAllocationMgr {std::move(rhs.m_ListAllocationMgr)},
+        m_TLSFAllocationMgr {std::move(rhs.m_TLSFAllocationMgr)},
+        m_VkMemory          {std::move(rhs.m_VkMemory)         },
+        m_CPUMemory         {rhs.m_CPUMemory                   }
     {
         rhs.m_CPUMemory = nullptr;
     }
@@ -115,10 +121,10 @@ public:
     VulkanMemoryPage& operator= (VulkanMemoryPage&)       = delete;
     VulkanMemoryPage& operator= (VulkanMemoryPage&& rhs)  = delete;
     
-    bool IsEmpty() const { return m_AllocationMgr.IsEmpty(); }
-    bool IsFull()  const { return m_AllocationMgr.IsFull();  }
-    VkDeviceSize GetPageSize() const { return m_AllocationMgr.GetMaxSize();  }
-    VkDeviceSize GetUsedSize() const { return m_AllocationMgr.GetUsedSize(); }
+    bool IsEmpty() const { return m_TLSFAllocationMgr ? m_TLSFAllocationMgr->IsEmpty() : m_ListAllocationMgr->IsEmpty(); }
+    bool IsFull()  const { return m_TLSFAllocationMgr ? m_TLSFAllocationMgr->IsFull()  : m_ListAllocationMgr->IsFull();  }
+    VkDeviceSize GetPageSize() const { return m_TLSFAllocationMgr ? m_TLSFAllocationMgr->GetMaxSize()  : m_ListAllocationMgr->GetMaxSize();  }
+    VkDeviceSize GetUsedSize() const { return m_TLSFAllocationMgr ? m_TLSFAllocationMgr->GetUsedSize() : m_ListAllocationMgr->GetUsedSize(); }
 
     // clang-format on
 
@@ -135,11 +141,15 @@ private:
     // Memory is reclaimed immediately. The application is responsible to ensure it is not in use by the GPU
     void Free(VulkanMemoryAllocation&& Allocation);
 
-    VulkanMemoryManager&                     m_ParentMemoryMgr;
-    std::mutex                               m_Mutex;
-    Diligent::VariableSizeAllocationsManager m_AllocationMgr;
-    VulkanUtilities::DeviceMemoryWrapper     m_VkMemory;
-    void*                                    m_CPUMemory = nullptr;
+    VulkanMemoryManager& m_ParentMemoryMgr;
+    std::mutex           m_Mutex;
+
+    // Only one of the two managers is created
+    std::unique_ptr<Diligent::VariableSizeAllocationsManager> m_ListAllocationMgr;
+    std::unique_ptr<Diligent::TLSFAllocationsManager>         m_TLSFAllocationMgr;
+
+    VulkanUtilities::DeviceMemoryWrapper m_VkMemory;
+    void*                                m_CPUMemory = nullptr;
 };
 
 class VulkanMemoryManager
@@ -153,7 +163,8 @@ public:
                         VkDeviceSize                 DeviceLocalPageSize,
                         VkDeviceSize                 HostVisiblePageSize,
                         VkDeviceSize                 DeviceLocalReserveSize,
-                        VkDeviceSize                 HostVisibleReserveSize) : 
+                        VkDeviceSize                 HostVisibleReserveSize,
+                        bool                         UseTLSFAllocator = false) : 
         m_MgrName               {std::move(MgrName)    },
         m_LogicalDevice         {LogicalDevice         },
         m_PhysicalDevice        {PhysicalDevice        },
@@ -161,7 +172,8 @@ public:
         m_DeviceLocalPageSize   {DeviceLocalPageSize   },
         m_HostVisiblePageSize   {HostVisiblePageSize   },
         m_DeviceLocalReserveSize{DeviceLocalReserveSize},
-        m_HostVisibleReserveSize{HostVisibleReserveSize}
+        m_HostVisibleReserveSize{HostVisibleReserveSize},
+        m_UseTLSFAllocator      {UseTLSFAllocator      }
     {}
 
 
@@ -179,6 +191,7 @@ public:
         m_HostVisiblePageSize    {rhs.m_HostVisiblePageSize   },
         m_DeviceLocalReserveSize {rhs.m_DeviceLocalReserveSize},
         m_HostVisibleReserveSize {rhs.m_HostVisibleReserveSize},
+        m_UseTLSFAllocator       {rhs.m_UseTLSFAllocator      },
     
         //m_CurrUsedSize      {rhs.m_CurrUsedSize},
         m_PeakUsedSize      {rhs.m_PeakUsedSize     },
@@ -250,6 +263,9 @@ protected:
     const VkDeviceSize m_DeviceLocalReserveSize;
     const VkDeviceSize m_HostVisibleReserveSize;
 
+    // Whether new pages use TLSFAllocationsManager instead of VariableSizeAllocationsManager
+    const bool m_UseTLSFAllocator;
+
     void OnFreeAllocation(VkDeviceSize Size, bool IsHostVisble);
 
     // 0 == Device local, 1 == Host-visible
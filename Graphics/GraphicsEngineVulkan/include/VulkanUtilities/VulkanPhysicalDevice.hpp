@@ -43,6 +43,7 @@ public:
         VkPhysicalDevice16BitStorageFeaturesKHR      Storage16Bit      = {};
         VkPhysicalDevice8BitStorageFeaturesKHR       Storage8Bit       = {};
         VkPhysicalDeviceShaderFloat16Int8FeaturesKHR ShaderFloat16Int8 = {};
+        VkPhysicalDeviceTimelineSemaphoreFeaturesKHR TimelineSemaphore = {};
     };
 
 public:
@@ -39,6 +39,28 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static const INTERFACE_ID IID_DeviceContextVk =
     {0x72aeb1ba, 0xc6ad, 0x42ec, {0x88, 0x11, 0x7e, 0xd9, 0xc7, 0x21, 0x76, 0xbb}};
 
+/// Statistics of the command pools owned by a Vulkan device context
+struct CommandPoolStatisticsVk
+{
+    /// The number of Vulkan command pools created by the context
+    Uint32 NumPools DEFAULT_INITIALIZER(0);
+
+    /// The number of times the pools have been reset by vkResetCommandPool and reused
+    Uint64 NumPoolResets DEFAULT_INITIALIZER(0);
+
+    /// The number of pools that have been destroyed through the release queues because
+    /// the command buffers allocated from them were submitted to more than one queue, or
+    /// because the frame was finished before the secondary command lists were submitted
+    Uint64 NumReleasedPools DEFAULT_INITIALIZER(0);
+
+    /// The number of command buffers allocated by vkAllocateCommandBuffers
+    Uint64 NumAllocatedBuffers DEFAULT_INITIALIZER(0);
+
+    /// The number of command buffers reused after the pools have been reset
+    Uint64 NumReusedBuffers DEFAULT_INITIALIZER(0);
+};
+typedef struct CommandPoolStatisticsVk CommandPoolStatisticsVk;
+
 #define DILIGENT_INTERFACE_NAME IDeviceContextVk
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -89,6 +111,52 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContextVk, IDeviceContext)
 
     /// Unlocks the command queue that was previously locked by IDeviceContextVk::LockCommandQueue().
     VIRTUAL void METHOD(UnlockCommandQueue)(THIS) PURE;
+
+    /// Begins recording commands of a render pass subpass into a secondary command list.
+
+    /// \param [in] pRenderPass  - Render pass that the commands will be executed in.
+    /// \param [in] SubpassIndex - Index of the subpass that the commands will be executed in.
+    /// \param [in] pFramebuffer - Framebuffer that will be used with the render pass.
+    ///
+    /// \remarks  Only deferred contexts can record secondary command lists.
+    ///           Until IDeviceContext::FinishCommandList() is called, the context behaves as if the given subpass
+    ///           was active: only commands that are allowed inside a render pass may be recorded, and pipeline
+    ///           states must be compatible with the render pass. The command list returned by FinishCommandList()
+    ///           must be executed by IDeviceContextVk::ExecuteSecondaryCommandLists() in the same subpass of
+    ///           a render pass instance that was begun with SUBPASS_CONTENTS_SECONDARY_COMMAND_LISTS.
+    ///
+    ///           Multiple deferred contexts may record secondary command lists for the same subpass
+    ///           in parallel.
+    VIRTUAL void METHOD(BeginSecondaryCommandList)(THIS_
+                                                   IRenderPass*  pRenderPass,
+                                                   Uint32        SubpassIndex,
+                                                   IFramebuffer* pFramebuffer) PURE;
+
+    /// Executes secondary command lists in the current subpass of the active render pass.
+
+    /// \param [in] NumCommandLists - The number of command lists to execute.
+    /// \param [in] ppCommandLists  - Pointer to the array of NumCommandLists secondary command lists
+    ///                               that were recorded by IDeviceContextVk::BeginSecondaryCommandList().
+    ///
+    /// \remarks  Only immediate contexts can execute secondary command lists. The render pass must have been
+    ///           begun with SUBPASS_CONTENTS_SECONDARY_COMMAND_LISTS.
+    ///           The command lists are executed in the order they are given. Similar to IDeviceContext::ExecuteCommandList(),
+    ///           all states bound to the immediate context except for the render pass are invalidated.
+    ///           Deferred contexts that recorded the lists must not call IDeviceContext::FinishFrame()
+    ///           until the immediate context has been flushed.
+    VIRTUAL void METHOD(ExecuteSecondaryCommandLists)(THIS_
+                                                      Uint32               NumCommandLists,
+                                                      ICommandList* const* ppCommandLists) PURE;
+
+    /// Returns the statistics of the command pools owned by this device context.
+
+    /// \param [out] Stats - Command pool statistics accumulated since the context was created.
+    ///
+    /// \remarks Command pools are reset and reused once the GPU has finished the commands
+    ///          allocated from them, so the number of pools should stay bounded while the
+    ///          application keeps calling IDeviceContext::FinishFrame().
+    VIRTUAL void METHOD(GetCommandPoolStatistics)(THIS_
+                                                  CommandPoolStatisticsVk REF Stats) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -98,10 +166,13 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define IDeviceContextVk_TransitionImageLayout(This, ...) CALL_IFACE_METHOD(DeviceContextVk, TransitionImageLayout, This, __VA_ARGS__)
-#    define IDeviceContextVk_BufferMemoryBarrier(This, ...)   CALL_IFACE_METHOD(DeviceContextVk, BufferMemoryBarrier,   This, __VA_ARGS__)
-#    define IDeviceContextVk_LockCommandQueue(This)           CALL_IFACE_METHOD(DeviceContextVk, LockCommandQueue,      This)
-#    define IDeviceContextVk_UnlockCommandQueue(This)         CALL_IFACE_METHOD(DeviceContextVk, UnlockCommandQueue,    This)
+#    define IDeviceContextVk_TransitionImageLayout(This, ...)        CALL_IFACE_METHOD(DeviceContextVk, TransitionImageLayout,        This, __VA_ARGS__)
+#    define IDeviceContextVk_BufferMemoryBarrier(This, ...)          CALL_IFACE_METHOD(DeviceContextVk, BufferMemoryBarrier,          This, __VA_ARGS__)
+#    define IDeviceContextVk_LockCommandQueue(This)                  CALL_IFACE_METHOD(DeviceContextVk, LockCommandQueue,             This)
+#    define IDeviceContextVk_UnlockCommandQueue(This)                CALL_IFACE_METHOD(DeviceContextVk, UnlockCommandQueue,           This)
+#    define IDeviceContextVk_BeginSecondaryCommandList(This, ...)    CALL_IFACE_METHOD(DeviceContextVk, BeginSecondaryCommandList,    This, __VA_ARGS__)
+#    define IDeviceContextVk_ExecuteSecondaryCommandLists(This, ...) CALL_IFACE_METHOD(DeviceContextVk, ExecuteSecondaryCommandLists, This, __VA_ARGS__)
+#    define IDeviceContextVk_GetCommandPoolStatistics(This, ...)     CALL_IFACE_METHOD(DeviceContextVk, GetCommandPoolStatistics,     This, __VA_ARGS__)
 
 // clang-format on
 
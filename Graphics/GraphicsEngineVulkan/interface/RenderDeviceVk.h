@@ -30,6 +30,7 @@
 /// \file
 /// Definition of the Diligent::IRenderDeviceVk interface
 
+#include "../../../Primitives/interface/DataBlob.h"
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
@@ -112,6 +113,19 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceVk, IRenderDevice)
                                                         const BufferDesc REF BuffDesc,
                                                         RESOURCE_STATE       InitialState,
                                                         IBuffer**            ppBuffer) PURE;
+
+    /// Retrieves the contents of the device pipeline cache
+
+    /// \param [out] ppData - Address of the memory location where the pointer to the data blob
+    ///                       containing the pipeline cache data will be stored.
+    ///                       The function calls AddRef(), so that the new object will contain
+    ///                       one reference. If the data can't be retrieved, null is written.
+    ///
+    /// \remarks The data can be saved by the application and provided to the engine
+    ///          through EngineVkCreateInfo::pPipelineCacheData when the device is created next
+    ///          time to avoid recompiling pipelines that have already been compiled.
+    VIRTUAL void METHOD(GetPipelineCacheData)(THIS_
+                                              IDataBlob** ppData) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -129,6 +143,7 @@ DILIGENT_END_INTERFACE
 #    define IRenderDeviceVk_IsFenceSignaled(This, ...)                CALL_IFACE_METHOD(RenderDeviceVk, IsFenceSignaled,                This, __VA_ARGS__)
 #    define IRenderDeviceVk_CreateTextureFromVulkanImage(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateTextureFromVulkanImage,   This, __VA_ARGS__)
 #    define IRenderDeviceVk_CreateBufferFromVulkanResource(This, ...) CALL_IFACE_METHOD(RenderDeviceVk, CreateBufferFromVulkanResource, This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetPipelineCacheData(This, ...)           CALL_IFACE_METHOD(RenderDeviceVk, GetPipelineCacheData,           This, __VA_ARGS__)
 
 // clang-format on
 
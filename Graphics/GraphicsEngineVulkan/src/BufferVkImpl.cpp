@@ -53,8 +53,7 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         pRenderDeviceVk,
         BuffDesc,
         false
-    },
-    m_DynamicAllocations(STD_ALLOCATOR_RAW_MEM(VulkanDynamicAllocation, GetRawAllocator(), "Allocator for vector<VulkanDynamicAllocation>"))
+    }
 // clang-format on
 {
     ValidateBufferInitData(BuffDesc, pBuffData);
@@ -138,10 +137,7 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
 
     if (m_Desc.Usage == USAGE_DYNAMIC)
     {
-        auto CtxCount = 1 + pRenderDeviceVk->GetNumDeferredContexts();
-        m_DynamicAllocations.reserve(CtxCount);
-        for (Uint32 ctx = 0; ctx < CtxCount; ++ctx)
-            m_DynamicAllocations.emplace_back();
+        m_DynamicBufferId = pRenderDeviceVk->AllocateDynamicBufferId();
     }
 
     if (m_Desc.Usage == USAGE_DYNAMIC && (VkBuffCI.usage & (VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT)) == 0)
@@ -355,7 +351,6 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         BuffDesc,
         false
     },
-    m_DynamicAllocations(STD_ALLOCATOR_RAW_MEM(VulkanDynamicAllocation, GetRawAllocator(), "Allocator for vector<VulkanDynamicAllocation>")),
     m_VulkanBuffer{vkBuffer}
 // clang-format on
 {
@@ -369,8 +364,12 @@ BufferVkImpl::~BufferVkImpl()
         m_pDevice->SafeReleaseDeviceObject(std::move(m_VulkanBuffer), m_Desc.CommandQueueMask);
     if (m_MemoryAllocation.Page != nullptr)
         m_pDevice->SafeReleaseDeviceObject(std::move(m_MemoryAllocation), m_Desc.CommandQueueMask);
+    if (m_DynamicBufferId != InvalidDynamicBufferId)
+        m_pDevice->ReleaseDynamicBufferId(m_DynamicBufferId);
 }
 
+constexpr Uint32 BufferVkImpl::InvalidDynamicBufferId;
+
 IMPLEMENT_QUERY_INTERFACE(BufferVkImpl, IID_BufferVk, TBufferBase)
 
 
@@ -461,10 +460,10 @@ VkAccessFlags BufferVkImpl::GetAccessFlags() const
 void BufferVkImpl::DvpVerifyDynamicAllocation(DeviceContextVkImpl* pCtx) const
 {
     auto        ContextId    = pCtx->GetContextId();
-    const auto& DynAlloc     = m_DynamicAllocations[ContextId];
+    const auto* pDynAlloc    = pCtx->GetDynamicBufferAllocation(*this);
     auto        CurrentFrame = pCtx->GetContextFrameNumber();
-    DEV_CHECK_ERR(DynAlloc.pDynamicMemMgr != nullptr, "Dynamic buffer '", m_Desc.Name, "' has not been mapped before its first use. Context Id: ", ContextId, ". Note: memory for dynamic buffers is allocated when a buffer is mapped.");
-    DEV_CHECK_ERR(DynAlloc.dvpFrameNumber == CurrentFrame, "Dynamic allocation of dynamic buffer '", m_Desc.Name, "' in frame ", CurrentFrame, " is out-of-date. Note: contents of all dynamic resources is discarded at the end of every frame. A buffer must be mapped before its first use in any frame.");
+    DEV_CHECK_ERR(pDynAlloc != nullptr && pDynAlloc->pDynamicMemMgr != nullptr, "Dynamic buffer '", m_Desc.Name, "' has not been mapped before its first use. Context Id: ", ContextId, ". Note: memory for dynamic buffers is allocated when a buffer is mapped.");
+    DEV_CHECK_ERR(pDynAlloc == nullptr || pDynAlloc->dvpFrameNumber == CurrentFrame, "Dynamic allocation of dynamic buffer '", m_Desc.Name, "' in frame ", CurrentFrame, " is out-of-date. Note: contents of all dynamic resources is discarded at the end of every frame. A buffer must be mapped before its first use in any frame.");
 }
 #endif
 
@@ -28,6 +28,7 @@
 #include "pch.h"
 #include "CommandPoolManager.hpp"
 #include "RenderDeviceVkImpl.hpp"
+#include "PlatformMisc.hpp"
 
 namespace Diligent
 {
@@ -149,4 +150,160 @@ CommandPoolManager::~CommandPoolManager()
     DEV_CHECK_ERR(m_CmdPools.empty() && m_AllocatedPoolCounter == 0, "Command pools have not been destroyed");
 }
 
+
+CommandPoolRing::CommandPoolRing(RenderDeviceVkImpl&      DeviceVkImpl,
+                                 std::string              Name,
+                                 uint32_t                 queueFamilyIndex,
+                                 VkCommandPoolCreateFlags flags) noexcept :
+    // clang-format off
+    m_DeviceVkImpl    {DeviceVkImpl    },
+    m_Name            {std::move(Name) },
+    m_QueueFamilyIndex{queueFamilyIndex},
+    m_CmdPoolFlags    {flags           }
+// clang-format on
+{
+}
+
+VulkanUtilities::VulkanCommandBufferPool& CommandPoolRing::GetCurrentPool()
+{
+    if (m_CurrentPool)
+        return *m_CurrentPool;
+
+    if (m_FreePools.empty())
+        RecycleStalePools();
+
+    if (!m_FreePools.empty())
+    {
+        m_CurrentPool = std::move(m_FreePools.back());
+        m_FreePools.pop_back();
+    }
+    else
+    {
+        m_CurrentPool.reset(new VulkanUtilities::VulkanCommandBufferPool{m_DeviceVkImpl.GetLogicalDevice().GetSharedPtr(), m_QueueFamilyIndex, m_CmdPoolFlags});
+        ++m_Stats.NumPools;
+    }
+
+    return *m_CurrentPool;
+}
+
+void CommandPoolRing::UpdateBufferStats(const VulkanUtilities::VulkanCommandBufferPool& Pool, size_t NumAllocatedBuffers)
+{
+    if (Pool.GetAllocatedBufferCount() != NumAllocatedBuffers)
+        ++m_Stats.NumAllocatedBuffers;
+    else
+        ++m_Stats.NumReusedBuffers;
+}
+
+VkCommandBuffer CommandPoolRing::GetCommandBuffer(const char* DebugName)
+{
+    auto&      Pool                = GetCurrentPool();
+    const auto NumAllocatedBuffers = Pool.GetAllocatedBufferCount();
+
+    auto vkCmdBuff = Pool.GetCommandBuffer(DebugName);
+    UpdateBufferStats(Pool, NumAllocatedBuffers);
+    return vkCmdBuff;
+}
+
+VkCommandBuffer CommandPoolRing::GetSecondaryCommandBuffer(const VkCommandBufferInheritanceInfo& InheritanceInfo, const char* DebugName)
+{
+    auto&      Pool                = GetCurrentPool();
+    const auto NumAllocatedBuffers = Pool.GetAllocatedBufferCount();
+
+    auto vkCmdBuff = Pool.GetSecondaryCommandBuffer(InheritanceInfo, DebugName);
+    UpdateBufferStats(Pool, NumAllocatedBuffers);
+    return vkCmdBuff;
+}
+
+void CommandPoolRing::ReleasePool(Uint32 QueueIndex, Uint64 FenceValue)
+{
+    if (!m_CurrentPool || m_CurrentPool->GetUsedBufferCount() == 0)
+        return;
+
+    // Stale pools are added in the order of increasing fence values
+    VERIFY(m_StalePools.empty() || m_StalePools.back().QueueIndex != QueueIndex || m_StalePools.back().FenceValue <= FenceValue,
+           "Fence values of stale pools must not decrease");
+    m_StalePools.emplace_back(std::move(m_CurrentPool), QueueIndex, FenceValue);
+
+    RecycleStalePools();
+}
+
+void CommandPoolRing::ReleasePool(Uint64 QueueMask)
+{
+    if (!m_CurrentPool || m_CurrentPool->GetUsedBufferCount() == 0)
+        return;
+
+    VERIFY(QueueMask != 0, "Command buffers allocated from the pool have not been submitted to any queue");
+    if ((QueueMask & (QueueMask - 1)) == 0)
+    {
+        // All command buffers have been submitted to a single queue. The pool may be safely reset
+        // when the last submitted command buffer is completed.
+        const auto QueueIndex = static_cast<Uint32>(PlatformMisc::GetLSB(QueueMask));
+        ReleasePool(QueueIndex, m_DeviceVkImpl.GetNextFenceValue(QueueIndex) - 1);
+    }
+    else
+    {
+        m_DeviceVkImpl.SafeReleaseDeviceObject(m_CurrentPool->Release(), QueueMask);
+        m_CurrentPool.reset();
+        ++m_Stats.NumReleasedPools;
+    }
+}
+
+VulkanUtilities::CommandPoolWrapper CommandPoolRing::DetachPool()
+{
+    if (!HasUsedCommandBuffers())
+        return VulkanUtilities::CommandPoolWrapper{};
+
+    auto CmdPool = m_CurrentPool->Release();
+    m_CurrentPool.reset();
+    ++m_Stats.NumReleasedPools;
+    return CmdPool;
+}
+
+void CommandPoolRing::RecycleStalePools()
+{
+    if (m_StalePools.empty())
+        return;
+
+    Uint32 QueueIndex          = m_StalePools.front().QueueIndex;
+    Uint64 CompletedFenceValue = m_DeviceVkImpl.GetCompletedFenceValue(QueueIndex);
+    while (!m_StalePools.empty())
+    {
+        auto& Stale = m_StalePools.front();
+        if (Stale.QueueIndex != QueueIndex)
+        {
+            QueueIndex          = Stale.QueueIndex;
+            CompletedFenceValue = m_DeviceVkImpl.GetCompletedFenceValue(QueueIndex);
+        }
+        if (Stale.FenceValue > CompletedFenceValue)
+            break;
+
+        Stale.Pool->Reset();
+        m_FreePools.emplace_back(std::move(Stale.Pool));
+        m_StalePools.pop_front();
+        ++m_Stats.NumPoolResets;
+    }
+}
+
+CommandPoolRing::~CommandPoolRing()
+{
+    // Stale pools may still be used by the GPU, so all pools are destroyed through the release queues
+    for (auto& Stale : m_StalePools)
+        m_DeviceVkImpl.SafeReleaseDeviceObject(Stale.Pool->Release(), Uint64{1} << Uint64{Stale.QueueIndex});
+    m_StalePools.clear();
+
+    for (auto& Pool : m_FreePools)
+        m_DeviceVkImpl.SafeReleaseDeviceObject(Pool->Release(), ~Uint64{0});
+    m_FreePools.clear();
+
+    if (m_CurrentPool)
+    {
+        m_DeviceVkImpl.SafeReleaseDeviceObject(m_CurrentPool->Release(), ~Uint64{0});
+        m_CurrentPool.reset();
+    }
+
+    const auto NumRequestedBuffers = m_Stats.NumAllocatedBuffers + m_Stats.NumReusedBuffers;
+    LOG_INFO_MESSAGE(m_Name, " command pool count: ", m_Stats.NumPools, ", pool resets: ", m_Stats.NumPoolResets, ", released pools: ", m_Stats.NumReleasedPools,
+                     ", command buffer reuse rate: ", NumRequestedBuffers != 0 ? m_Stats.NumReusedBuffers * 100 / NumRequestedBuffers : 0, '%');
+}
+
 } // namespace Diligent
@@ -43,6 +43,19 @@ CommandQueueVkImpl::CommandQueueVkImpl(IReferenceCounters*
     m_NextFenceValue   {1}
 // clang-format on
 {
+    if (m_LogicalDevice->IsTimelineSemaphoreSupported())
+    {
+        VkSemaphoreTypeCreateInfoKHR TypeCI = {};
+        TypeCI.sType                        = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+        TypeCI.semaphoreType                = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+        TypeCI.initialValue                 = 0;
+
+        VkSemaphoreCreateInfo SemaphoreCI = {};
+        SemaphoreCI.sType                 = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        SemaphoreCI.pNext                 = &TypeCI;
+
+        m_TimelineSemaphore = m_LogicalDevice->CreateSemaphore(SemaphoreCI, "Command queue timeline semaphore");
+    }
 }
 
 CommandQueueVkImpl::~CommandQueueVkImpl()
@@ -50,6 +63,12 @@ CommandQueueVkImpl::~CommandQueueVkImpl()
     // Queues are created along with the logical device during vkCreateDevice.
     // All queues associated with the logical device are destroyed when vkDestroyDevice
     // is called on that device.
+
+    if (m_TimelineSemaphore != VK_NULL_HANDLE)
+    {
+        // All submissions that signal the semaphore must complete before it is destroyed
+        m_LogicalDevice->WaitSemaphore(m_TimelineSemaphore, static_cast<uint64_t>(m_NextFenceValue - 1), UINT64_MAX);
+    }
 }
 
 IMPLEMENT_QUERY_INTERFACE(CommandQueueVkImpl, IID_CommandQueueVk, TBase)
@@ -63,6 +82,34 @@ Uint64 CommandQueueVkImpl::Submit(const VkSubmitInfo& SubmitInfo)
     // Increment the value before submitting the buffer to be overly safe
     Atomics::AtomicIncrement(m_NextFenceValue);
 
+    if (m_TimelineSemaphore != VK_NULL_HANDLE)
+    {
+        // Append the timeline semaphore to the signal semaphores of the submission.
+        // Values for binary semaphores are ignored.
+        m_SignalSemaphores.assign(SubmitInfo.pSignalSemaphores, SubmitInfo.pSignalSemaphores + SubmitInfo.signalSemaphoreCount);
+        m_SignalSemaphores.push_back(m_TimelineSemaphore);
+        m_SignalSemaphoreValues.assign(m_SignalSemaphores.size(), 0);
+        m_SignalSemaphoreValues.back() = static_cast<uint64_t>(FenceValue);
+
+        VkTimelineSemaphoreSubmitInfoKHR TimelineInfo = {};
+        TimelineInfo.sType                            = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+        TimelineInfo.pNext                            = SubmitInfo.pNext;
+        TimelineInfo.signalSemaphoreValueCount        = static_cast<uint32_t>(m_SignalSemaphoreValues.size());
+        TimelineInfo.pSignalSemaphoreValues           = m_SignalSemaphoreValues.data();
+
+        auto TimelineSubmitInfo                 = SubmitInfo;
+        TimelineSubmitInfo.pNext                = &TimelineInfo;
+        TimelineSubmitInfo.signalSemaphoreCount = static_cast<uint32_t>(m_SignalSemaphores.size());
+        TimelineSubmitInfo.pSignalSemaphores    = m_SignalSemaphores.data();
+
+        // Empty submissions are not skipped as they must still signal the semaphore
+        auto err = vkQueueSubmit(m_VkQueue, 1, &TimelineSubmitInfo, VK_NULL_HANDLE);
+        DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit command buffer to the command queue");
+        (void)err;
+
+        return FenceValue;
+    }
+
     auto vkFence = m_pFence->GetVkFence();
 
     uint32_t SubmitCount =
@@ -110,14 +157,31 @@ Uint64 CommandQueueVkImpl::WaitForIdle()
     // Increment fence before idling the queue
     Atomics::AtomicIncrement(m_NextFenceValue);
     vkQueueWaitIdle(m_VkQueue);
-    // For some reason after idling the queue not all fences are signaled
-    m_pFence->Wait(UINT64_MAX);
-    m_pFence->Reset(LastCompletedFenceValue);
+    if (m_TimelineSemaphore != VK_NULL_HANDLE)
+    {
+        // LastCompletedFenceValue has never been submitted, so signal it from the host.
+        // This is valid as there are no pending signal operations after the queue is idle.
+        m_LogicalDevice->SignalSemaphore(m_TimelineSemaphore, static_cast<uint64_t>(LastCompletedFenceValue));
+    }
+    else
+    {
+        // For some reason after idling the queue not all fences are signaled
+        m_pFence->Wait(UINT64_MAX);
+        m_pFence->Reset(LastCompletedFenceValue);
+    }
     return LastCompletedFenceValue;
 }
 
 Uint64 CommandQueueVkImpl::GetCompletedFenceValue()
 {
+    if (m_TimelineSemaphore != VK_NULL_HANDLE)
+    {
+        // Querying the counter value does not require external synchronization
+        uint64_t CompletedValue = 0;
+        m_LogicalDevice->GetSemaphoreCounterValue(m_TimelineSemaphore, &CompletedValue);
+        return CompletedValue;
+    }
+
     std::lock_guard<std::mutex> Lock{m_QueueMutex};
     return m_pFence->GetCompletedValue();
 }
@@ -28,6 +28,7 @@
 #include "pch.h"
 #include "DescriptorPoolManager.hpp"
 #include "RenderDeviceVkImpl.hpp"
+#include "PlatformMisc.hpp"
 
 namespace Diligent
 {
@@ -260,27 +261,122 @@ VkDescriptorSet DynamicDescriptorSetAllocator::Allocate(VkDescriptorSetLayout Se
 
     if (set == VK_NULL_HANDLE)
     {
-        m_AllocatedPools.emplace_back(m_GlobalPoolMgr.GetPool("Dynamic Descriptor Pool"));
+        m_AllocatedPools.emplace_back(GetPool());
         set = AllocateDescriptorSet(LogicalDevice, m_AllocatedPools.back(), SetLayout, DebugName);
     }
 
     return set;
 }
 
+VulkanUtilities::DescriptorPoolWrapper DynamicDescriptorSetAllocator::GetPool()
+{
+    if (m_FreePools.empty())
+        RecycleStalePools();
+
+    if (!m_FreePools.empty())
+    {
+        // Fast path: reuse the pool that has already been reset without locking the global manager
+        auto Pool = std::move(m_FreePools.back());
+        m_FreePools.pop_back();
+        return Pool;
+    }
+
+    return m_GlobalPoolMgr.GetPool("Dynamic Descriptor Pool");
+}
+
+void DynamicDescriptorSetAllocator::RecycleStalePools()
+{
+    if (m_StalePools.empty())
+        return;
+
+    auto&       DeviceVkImpl  = m_GlobalPoolMgr.GetDeviceVkImpl();
+    const auto& LogicalDevice = DeviceVkImpl.GetLogicalDevice();
+
+    // Stale pools are added in the order of increasing fence values, so stop at the first pool that is still in use
+    Uint32 QueueIndex          = m_StalePools.front().QueueIndex;
+    Uint64 CompletedFenceValue = DeviceVkImpl.GetCompletedFenceValue(QueueIndex);
+    while (!m_StalePools.empty())
+    {
+        auto& Stale = m_StalePools.front();
+        if (Stale.QueueIndex != QueueIndex)
+        {
+            QueueIndex          = Stale.QueueIndex;
+            CompletedFenceValue = DeviceVkImpl.GetCompletedFenceValue(QueueIndex);
+        }
+        if (Stale.FenceValue > CompletedFenceValue)
+            break;
+
+        // vkResetDescriptorPool returns all descriptor sets allocated from the pool back to the pool (13.2.3)
+        LogicalDevice.ResetDescriptorPool(Stale.Pool);
+        m_FreePools.emplace_back(std::move(Stale.Pool));
+        m_StalePools.pop_front();
+        ++m_RecycledPoolCount;
+    }
+}
+
+void DynamicDescriptorSetAllocator::TrimFreePools(size_t MaxFreePools)
+{
+    // DisposePool() returns the pool to the global manager through the device release queue
+    while (m_FreePools.size() > MaxFreePools)
+    {
+        m_GlobalPoolMgr.DisposePool(std::move(m_FreePools.back()), ~Uint64{0});
+        m_FreePools.pop_back();
+        ++m_TrimmedPoolCount;
+    }
+}
+
 void DynamicDescriptorSetAllocator::ReleasePools(Uint64 QueueMask)
 {
-    for (auto& Pool : m_AllocatedPools)
+    m_PeakPoolCount       = std::max(m_PeakPoolCount, m_AllocatedPools.size());
+    m_PeriodPeakPoolCount = std::max(m_PeriodPeakPoolCount, m_AllocatedPools.size());
+
+    if (QueueMask != 0 && (QueueMask & (QueueMask - 1)) == 0)
+    {
+        // All commands have been submitted to a single queue. The pools may be safely reset
+        // when the last submitted command buffer is completed.
+        auto& DeviceVkImpl = m_GlobalPoolMgr.GetDeviceVkImpl();
+
+        const auto QueueIndex = static_cast<Uint32>(PlatformMisc::GetLSB(QueueMask));
+        const auto FenceValue = DeviceVkImpl.GetNextFenceValue(QueueIndex) - 1;
+        for (auto& Pool : m_AllocatedPools)
+            m_StalePools.emplace_back(std::move(Pool), QueueIndex, FenceValue);
+    }
+    else
     {
-        m_GlobalPoolMgr.DisposePool(std::move(Pool), QueueMask);
+        for (auto& Pool : m_AllocatedPools)
+            m_GlobalPoolMgr.DisposePool(std::move(Pool), QueueMask);
     }
-    m_PeakPoolCount = std::max(m_PeakPoolCount, m_AllocatedPools.size());
     m_AllocatedPools.clear();
+
+    RecycleStalePools();
+
+    // A frame never needs more free pools than the peak number of pools used by a single frame.
+    // Using the peak over a period rather than the last frame's count avoids returning pools
+    // to the global manager and taking them back when usage fluctuates from frame to frame.
+    if (++m_FramesSinceTrim >= FreePoolTrimPeriod)
+    {
+        TrimFreePools(m_PeriodPeakPoolCount);
+        m_PeriodPeakPoolCount = 0;
+        m_FramesSinceTrim     = 0;
+    }
 }
 
 DynamicDescriptorSetAllocator::~DynamicDescriptorSetAllocator()
 {
     DEV_CHECK_ERR(m_AllocatedPools.empty(), "All allocated pools must be returned to the parent descriptor pool manager");
-    LOG_INFO_MESSAGE(m_Name, " peak descriptor pool count: ", m_PeakPoolCount);
+
+    // Return all stale and free pools to the global manager. Stale pools may still be in use
+    // by the GPU, so they go through the release queue of their command queue.
+    for (auto& Stale : m_StalePools)
+        m_GlobalPoolMgr.DisposePool(std::move(Stale.Pool), Uint64{1} << Uint64{Stale.QueueIndex});
+    m_StalePools.clear();
+
+    for (auto& Pool : m_FreePools)
+        m_GlobalPoolMgr.DisposePool(std::move(Pool), ~Uint64{0});
+    m_FreePools.clear();
+
+    LOG_INFO_MESSAGE(m_Name, " peak descriptor pool count: ", m_PeakPoolCount, ", recycled pools: ", m_RecycledPoolCount,
+                     ", pools returned to the global manager: ", m_TrimmedPoolCount);
 }
 
 } // namespace Diligent
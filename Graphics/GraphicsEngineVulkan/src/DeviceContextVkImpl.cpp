@@ -71,13 +71,14 @@ DeviceContextVkImpl::DeviceContextVkImpl(IReferenceCounters*                   p
     },
     m_CommandBuffer { pDeviceVkImpl->GetLogicalDevice().GetEnabledGraphicsShaderStages() },
     m_CmdListAllocator { GetRawAllocator(), sizeof(CommandListVkImpl), 64 },
-    // Command pools must be thread safe because command buffers are returned into pools by release queues
-    // potentially running in another thread
+    // Command pools are only accessed by the context and are reset as a whole once the GPU has
+    // finished the commands, so command buffers do not need to be reset individually
     m_CmdPool
     {
-        pDeviceVkImpl->GetLogicalDevice().GetSharedPtr(),
+        *pDeviceVkImpl,
+        GetContextObjectName("Command pool ring", bIsDeferred, ContextId),
         pDeviceVkImpl->GetCommandQueue(CommandQueueId).GetQueueFamilyIndex(),
-        VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT
+        VK_COMMAND_POOL_CREATE_TRANSIENT_BIT
     },
     // Upload heap must always be thread-safe as Finish() may be called from another thread
     m_UploadHeap
@@ -153,77 +154,29 @@ DeviceContextVkImpl::~DeviceContextVkImpl()
     DEV_CHECK_ERR(m_DynamicDescrSetAllocator.GetAllocatedPoolCount() == 0, "All allocated dynamic descriptor set pools must have been released at this point");
     // clang-format on
 
-    auto VkCmdPool = m_CmdPool.Release();
-    m_pDevice->SafeReleaseDeviceObject(std::move(VkCmdPool), ~Uint64{0});
-
     // clang-format off
     m_pDevice->SafeReleaseDeviceObject(std::move(m_GenerateMipsHelper), ~Uint64{0});
     m_pDevice->SafeReleaseDeviceObject(std::move(m_GenerateMipsSRB),    ~Uint64{0});
     m_pDevice->SafeReleaseDeviceObject(std::move(m_DummyVB),            ~Uint64{0});
     // clang-format on
 
-    // The main reason we need to idle the GPU is because we need to make sure that all command buffers are returned to the
-    // pool. Upload heap, dynamic heap and dynamic descriptor manager return their resources to global managers and
-    // do not really need to wait for GPU to idle.
+    // The main reason we need to idle the GPU is because we need to make sure that all command buffers recorded
+    // by the context have been completed. Command pools, upload heap, dynamic heap and dynamic descriptor manager
+    // release their resources through release queues and do not really need to wait for GPU to idle.
     m_pDevice->IdleGPU();
-    DEV_CHECK_ERR(m_CmdPool.DvpGetBufferCounter() == 0, "All command buffers must have been returned to the pool");
 }
 
 IMPLEMENT_QUERY_INTERFACE(DeviceContextVkImpl, IID_DeviceContextVk, TDeviceContextBase)
 
-void DeviceContextVkImpl::DisposeVkCmdBuffer(Uint32 CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue)
-{
-    VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
-    class CmdBufferDeleter
-    {
-    public:
-        // clang-format off
-        CmdBufferDeleter(VkCommandBuffer                           _vkCmdBuff, 
-                         VulkanUtilities::VulkanCommandBufferPool& _Pool) noexcept :
-            vkCmdBuff {_vkCmdBuff},
-            Pool      {&_Pool    }
-        {
-            VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
-        }
-
-        CmdBufferDeleter             (const CmdBufferDeleter&)  = delete;
-        CmdBufferDeleter& operator = (const CmdBufferDeleter&)  = delete;
-        CmdBufferDeleter& operator = (      CmdBufferDeleter&&) = delete;
-
-        CmdBufferDeleter(CmdBufferDeleter&& rhs) noexcept : 
-            vkCmdBuff {rhs.vkCmdBuff},
-            Pool      {rhs.Pool     }
-        {
-            rhs.vkCmdBuff = VK_NULL_HANDLE;
-            rhs.Pool      = nullptr;
-        }
-        // clang-format on
-
-        ~CmdBufferDeleter()
-        {
-            if (Pool != nullptr)
-            {
-                Pool->FreeCommandBuffer(std::move(vkCmdBuff));
-            }
-        }
-
-    private:
-        VkCommandBuffer                           vkCmdBuff;
-        VulkanUtilities::VulkanCommandBufferPool* Pool;
-    };
-
-    auto& ReleaseQueue = m_pDevice->GetReleaseQueue(CmdQueue);
-    ReleaseQueue.DiscardResource(CmdBufferDeleter{vkCmdBuff, m_CmdPool}, FenceValue);
-}
-
 inline void DeviceContextVkImpl::DisposeCurrentCmdBuffer(Uint32 CmdQueue, Uint64 FenceValue)
 {
     VERIFY(m_CommandBuffer.GetState().RenderPass == VK_NULL_HANDLE, "Disposing command buffer with unifinished render pass");
-    auto vkCmdBuff = m_CommandBuffer.GetVkCmdBuffer();
-    if (vkCmdBuff != VK_NULL_HANDLE)
+    if (m_CommandBuffer.GetVkCmdBuffer() != VK_NULL_HANDLE)
     {
-        DisposeVkCmdBuffer(CmdQueue, vkCmdBuff, FenceValue);
         m_CommandBuffer.Reset();
+        // The command buffer is the only buffer allocated from the current pool since the last
+        // submission, so the whole pool can be reset once the command buffer is completed.
+        m_CmdPool.ReleasePool(CmdQueue, FenceValue);
     }
 }
 
@@ -234,6 +187,17 @@ void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
     if (PipelineStateVkImpl::IsSameObject(m_pPipelineState, pPipelineStateVk))
         return;
 
+    // Wait for the pipeline if it is being created asynchronously
+    if (pPipelineStateVk->GetStatus(true) != PIPELINE_STATE_STATUS_READY)
+    {
+        LOG_ERROR_MESSAGE("Pipeline state '", pPipelineStateVk->GetDesc().Name, "' can't be bound because its creation failed. "
+                                                                                "Draw and dispatch commands will be ignored until another pipeline state is bound.");
+        // Do not leave the previous pipeline bound: the draw commands intended for the failed
+        // pipeline would otherwise silently be executed with it.
+        m_pPipelineState = nullptr;
+        return;
+    }
+
     if (m_State.NumCommands >= m_NumCommandsToFlush &&
         !m_bIsDeferred &&           // Never flush deferred context
         !m_pActiveRenderPass &&     // Never flush inside active render pass (https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VUID-vkEndCommandBuffer-commandBuffer-00060)
@@ -320,7 +284,7 @@ void DeviceContextVkImpl::TransitionShaderResources(IPipelineState* pPipelineSta
 
 void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderResourceBinding, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
-    if (!DeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0 /*Dummy*/))
+    if (!DeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0 /*Dummy*/) || !m_pPipelineState)
         return;
 
     m_pPipelineState->CommitAndTransitionShaderResources(pShaderResourceBinding, this, true, StateTransitionMode, &m_DescrSetBindInfo);
@@ -441,6 +405,8 @@ void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
 
     VERIFY(m_vkRenderPass != VK_NULL_HANDLE, "No render pass is active while executing draw command");
     VERIFY(m_vkFramebuffer != VK_NULL_HANDLE, "No framebuffer is bound while executing draw command");
+    DEV_CHECK_ERR(m_vkSubpassContents == VK_SUBPASS_CONTENTS_INLINE,
+                  "Draw commands can't be recorded inline in a render pass that was begun with SUBPASS_CONTENTS_SECONDARY_COMMAND_LISTS");
 #endif
 
     EnsureVkCmdBuffer();
@@ -532,7 +498,7 @@ void DeviceContextVkImpl::PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE Ind
 
 void DeviceContextVkImpl::Draw(const DrawAttribs& Attribs)
 {
-    if (!DvpVerifyDrawArguments(Attribs))
+    if (!DvpVerifyDrawArguments(Attribs) || !m_pPipelineState)
         return;
 
     PrepareForDraw(Attribs.Flags);
@@ -543,7 +509,7 @@ void DeviceContextVkImpl::Draw(const DrawAttribs& Attribs)
 
 void DeviceContextVkImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 {
-    if (!DvpVerifyDrawIndexedArguments(Attribs))
+    if (!DvpVerifyDrawIndexedArguments(Attribs) || !m_pPipelineState)
         return;
 
     PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
@@ -552,9 +518,46 @@ void DeviceContextVkImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
     ++m_State.NumCommands;
 }
 
+void DeviceContextVkImpl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    if (!DvpVerifyMultiDrawArguments(Attribs) || !m_pPipelineState)
+        return;
+
+    if (Attribs.DrawCount == 0)
+        return;
+
+    // Pipeline, vertex buffers and resources are committed once for the entire batch
+    PrepareForDraw(Attribs.Flags);
+
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        const auto& Item = Attribs.pDrawItems[i];
+        m_CommandBuffer.Draw(Item.NumVertices, Attribs.NumInstances, Item.StartVertexLocation, Attribs.FirstInstanceLocation);
+    }
+    m_State.NumCommands += Attribs.DrawCount;
+}
+
+void DeviceContextVkImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    if (!DvpVerifyMultiDrawIndexedArguments(Attribs) || !m_pPipelineState)
+        return;
+
+    if (Attribs.DrawCount == 0)
+        return;
+
+    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        const auto& Item = Attribs.pDrawItems[i];
+        m_CommandBuffer.DrawIndexed(Item.NumIndices, Attribs.NumInstances, Item.FirstIndexLocation, Item.BaseVertex, Attribs.FirstInstanceLocation);
+    }
+    m_State.NumCommands += Attribs.DrawCount;
+}
+
 void DeviceContextVkImpl::DrawIndirect(const DrawIndirectAttribs& Attribs, IBuffer* pAttribsBuffer)
 {
-    if (!DvpVerifyDrawIndirectArguments(Attribs, pAttribsBuffer))
+    if (!DvpVerifyDrawIndirectArguments(Attribs, pAttribsBuffer) || !m_pPipelineState)
         return;
 
     // We must prepare indirect draw attribs buffer first because state transitions must
@@ -569,7 +572,7 @@ void DeviceContextVkImpl::DrawIndirect(const DrawIndirectAttribs& Attribs, IBuff
 
 void DeviceContextVkImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs, IBuffer* pAttribsBuffer)
 {
-    if (!DvpVerifyDrawIndexedIndirectArguments(Attribs, pAttribsBuffer))
+    if (!DvpVerifyDrawIndexedIndirectArguments(Attribs, pAttribsBuffer) || !m_pPipelineState)
         return;
 
     // We must prepare indirect draw attribs buffer first because state transitions must
@@ -584,7 +587,7 @@ void DeviceContextVkImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs&
 
 void DeviceContextVkImpl::DrawMesh(const DrawMeshAttribs& Attribs)
 {
-    if (!DvpVerifyDrawMeshArguments(Attribs))
+    if (!DvpVerifyDrawMeshArguments(Attribs) || !m_pPipelineState)
         return;
 
     PrepareForDraw(Attribs.Flags);
@@ -595,7 +598,7 @@ void DeviceContextVkImpl::DrawMesh(const DrawMeshAttribs& Attribs)
 
 void DeviceContextVkImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs, IBuffer* pAttribsBuffer)
 {
-    if (!DvpVerifyDrawMeshIndirectArguments(Attribs, pAttribsBuffer))
+    if (!DvpVerifyDrawMeshIndirectArguments(Attribs, pAttribsBuffer) || !m_pPipelineState)
         return;
 
     // We must prepare indirect draw attribs buffer first because state transitions must
@@ -636,7 +639,7 @@ void DeviceContextVkImpl::PrepareForDispatchCompute()
 
 void DeviceContextVkImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 {
-    if (!DvpVerifyDispatchArguments(Attribs))
+    if (!DvpVerifyDispatchArguments(Attribs) || !m_pPipelineState)
         return;
 
     PrepareForDispatchCompute();
@@ -646,7 +649,7 @@ void DeviceContextVkImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 
 void DeviceContextVkImpl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs, IBuffer* pAttribsBuffer)
 {
-    if (!DvpVerifyDispatchIndirectArguments(Attribs, pAttribsBuffer))
+    if (!DvpVerifyDispatchIndirectArguments(Attribs, pAttribsBuffer) || !m_pPipelineState)
         return;
 
     PrepareForDispatchCompute();
@@ -931,11 +934,41 @@ void DeviceContextVkImpl::FinishFrame()
     // be destroyed before the blocks are actually returned to the global dynamic memory manager.
     m_DynamicHeap.ReleaseMasterBlocks(*m_pDevice, m_SubmittedBuffersCmdQueueMask);
 
-    // Dynamic descriptor set allocator returns all allocated pools to the global dynamic descriptor pool manager.
-    // Note: as global pool manager is hosted by the render device, the allocator can
-    // be destroyed before the pools are actually returned to the global pool manager.
+    // Dynamic descriptor set allocator keeps all allocated pools in its own stale pool chain and
+    // resets them once the GPU has finished this frame, so that they can be reused by this context
+    // without synchronizing with other contexts through the global dynamic descriptor pool manager.
     m_DynamicDescrSetAllocator.ReleasePools(m_SubmittedBuffersCmdQueueMask);
 
+    if (m_bIsDeferred)
+    {
+        // Immediate context releases its pool every time it is flushed.
+        if (m_NumPendingSecondaryCmdLists != 0)
+        {
+            // Secondary command lists recorded by this context have been executed by an immediate context
+            // that has not been flushed yet, so the queue and the fence value are not known. The pool is
+            // detached and will be released when the immediate context submits the last pending list.
+            auto CmdPool = m_CmdPool.DetachPool();
+            if (CmdPool != VK_NULL_HANDLE)
+            {
+                m_DetachedCmdPools.emplace_back(std::move(CmdPool));
+                m_DetachedCmdPoolsQueueMask |= m_SubmittedBuffersCmdQueueMask;
+            }
+        }
+        else if (m_SubmittedBuffersCmdQueueMask != 0)
+        {
+            // All command buffers recorded by the deferred context in this frame have been submitted.
+            // The command pool will be reset once the GPU has finished the frame.
+            m_CmdPool.ReleasePool(m_SubmittedBuffersCmdQueueMask);
+        }
+        else
+        {
+            // The pool is kept until the command buffers are submitted
+            DEV_CHECK_ERR(!m_CmdPool.HasUsedCommandBuffers(),
+                          "Deferred context #", m_ContextId, " is finishing the frame, but the command lists it recorded have not been "
+                                                             "executed by an immediate context. Execute all command lists before finishing the frame.");
+        }
+    }
+
     EndFrame();
 }
 
@@ -1012,12 +1045,37 @@ void DeviceContextVkImpl::Flush()
         DisposeCurrentCmdBuffer(m_CommandQueueId, SubmittedFenceValue);
     }
 
+    for (auto& pDeferredCtx : m_PendingSecondaryCmdListContexts)
+    {
+        auto* pDeferredCtxVk = pDeferredCtx.RawPtr<DeviceContextVkImpl>();
+        // Set the bit in the deferred context cmd queue mask corresponding to cmd queue of this context.
+        // The deferred context will recycle its command pool when it finishes the frame.
+        pDeferredCtxVk->m_SubmittedBuffersCmdQueueMask |= Uint64{1} << m_CommandQueueId;
+
+        VERIFY_EXPR(pDeferredCtxVk->m_NumPendingSecondaryCmdLists > 0);
+        --pDeferredCtxVk->m_NumPendingSecondaryCmdLists;
+        if (!pDeferredCtxVk->m_DetachedCmdPools.empty())
+        {
+            // The deferred context has finished the frame before its secondary command lists were submitted
+            pDeferredCtxVk->m_DetachedCmdPoolsQueueMask |= Uint64{1} << m_CommandQueueId;
+            if (pDeferredCtxVk->m_NumPendingSecondaryCmdLists == 0)
+            {
+                for (auto& CmdPool : pDeferredCtxVk->m_DetachedCmdPools)
+                    m_pDevice->SafeReleaseDeviceObject(std::move(CmdPool), pDeferredCtxVk->m_DetachedCmdPoolsQueueMask);
+                pDeferredCtxVk->m_DetachedCmdPools.clear();
+                pDeferredCtxVk->m_DetachedCmdPoolsQueueMask = 0;
+            }
+        }
+    }
+    m_PendingSecondaryCmdListContexts.clear();
+
     m_State = ContextState{};
     m_DescrSetBindInfo.Reset();
     m_CommandBuffer.Reset();
     m_pPipelineState    = nullptr;
     m_pActiveRenderPass = nullptr;
     m_pBoundFramebuffer = nullptr;
+    m_vkSubpassContents = VK_SUBPASS_CONTENTS_INLINE;
 }
 
 void DeviceContextVkImpl::SetVertexBuffers(Uint32                         StartSlot,
@@ -1323,18 +1381,31 @@ void DeviceContextVkImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
         pVkClearValues = m_vkClearValues.data();
     }
 
+    m_vkSubpassContents = Attribs.SubpassContents == SUBPASS_CONTENTS_SECONDARY_COMMAND_LISTS ?
+        VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS :
+        VK_SUBPASS_CONTENTS_INLINE;
+
     EnsureVkCmdBuffer();
-    m_CommandBuffer.BeginRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight, Attribs.ClearValueCount, pVkClearValues);
+    m_CommandBuffer.BeginRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight, Attribs.ClearValueCount, pVkClearValues, m_vkSubpassContents);
 
-    // Set the viewport to match the framebuffer size
-    SetViewports(1, nullptr, 0, 0);
+    if (m_vkSubpassContents == VK_SUBPASS_CONTENTS_INLINE)
+    {
+        // Set the viewport to match the framebuffer size
+        SetViewports(1, nullptr, 0, 0);
+    }
+    else
+    {
+        // vkCmdExecuteCommands is the only command allowed in the subpass, so only
+        // update the viewport in the context. Secondary command buffers set their own viewports.
+        TDeviceContextBase::SetViewports(1, nullptr, 0, 0);
+    }
 }
 
 void DeviceContextVkImpl::NextSubpass()
 {
     TDeviceContextBase::NextSubpass();
     VERIFY_EXPR(m_CommandBuffer.GetVkCmdBuffer() != VK_NULL_HANDLE && m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE);
-    m_CommandBuffer.NextSubpass();
+    m_CommandBuffer.NextSubpass(m_vkSubpassContents);
 }
 
 void DeviceContextVkImpl::EndRenderPass()
@@ -1342,6 +1413,7 @@ void DeviceContextVkImpl::EndRenderPass()
     TDeviceContextBase::EndRenderPass();
     // TDeviceContextBase::EndRenderPass calls ResetRenderTargets() that in turn
     // calls m_CommandBuffer.EndRenderPass()
+    m_vkSubpassContents = VK_SUBPASS_CONTENTS_INLINE;
 
     if (m_State.NumCommands >= m_NumCommandsToFlush &&
         !m_bIsDeferred &&           // Never flush deferred context
@@ -1473,7 +1545,20 @@ void DeviceContextVkImpl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAG
             DEV_CHECK_ERR((MapFlags & (MAP_FLAG_DISCARD | MAP_FLAG_NO_OVERWRITE)) != 0, "Failed to map buffer '",
                           BuffDesc.Name, "': Vulkan buffer must be mapped for writing with MAP_FLAG_DISCARD or MAP_FLAG_NO_OVERWRITE flag. Context Id: ", m_ContextId);
 
-            auto& DynAllocation = pBufferVk->m_DynamicAllocations[m_ContextId];
+            const auto DynBufferId = pBufferVk->GetDynamicBufferId();
+            VERIFY_EXPR(DynBufferId != BufferVkImpl::InvalidDynamicBufferId);
+            if (DynBufferId >= m_DynamicBufferAllocations.size())
+                m_DynamicBufferAllocations.resize(DynBufferId + 1);
+
+            auto& DynBufferEntry = m_DynamicBufferAllocations[DynBufferId];
+            if (DynBufferEntry.BufferUID != pBufferVk->GetUniqueID())
+            {
+                // The entry is either unused or was left by a released buffer with the same id
+                DynBufferEntry.Allocation = VulkanDynamicAllocation{};
+                DynBufferEntry.BufferUID  = pBufferVk->GetUniqueID();
+            }
+
+            auto& DynAllocation = DynBufferEntry.Allocation;
             if ((MapFlags & MAP_FLAG_DISCARD) != 0 || DynAllocation.pDynamicMemMgr == nullptr)
             {
                 DynAllocation = AllocateDynamicSpace(BuffDesc.uiSizeInBytes, pBufferVk->m_DynamicOffsetAlignment);
@@ -1539,9 +1624,10 @@ void DeviceContextVkImpl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
         {
             if (pBufferVk->m_VulkanBuffer != VK_NULL_HANDLE)
             {
-                auto& DynAlloc  = pBufferVk->m_DynamicAllocations[m_ContextId];
-                auto  vkSrcBuff = DynAlloc.pDynamicMemMgr->GetVkBuffer();
-                UpdateBufferRegion(pBufferVk, 0, BuffDesc.uiSizeInBytes, vkSrcBuff, DynAlloc.AlignedOffset, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+                const auto* pDynAlloc = GetDynamicBufferAllocation(*pBufferVk);
+                VERIFY(pDynAlloc != nullptr, "Dynamic buffer '", BuffDesc.Name, "' has not been mapped in this context");
+                auto vkSrcBuff = pDynAlloc->pDynamicMemMgr->GetVkBuffer();
+                UpdateBufferRegion(pBufferVk, 0, BuffDesc.uiSizeInBytes, vkSrcBuff, pDynAlloc->AlignedOffset, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
             }
         }
     }
@@ -2057,11 +2143,26 @@ void DeviceContextVkImpl::UnmapTextureSubresource(ITexture* pTexture,
 
 void DeviceContextVkImpl::FinishCommandList(class ICommandList** ppCommandList)
 {
-    VERIFY(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
-
-    if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+    if (m_IsRecordingSecondaryCmdBuffer)
     {
-        m_CommandBuffer.EndRenderPass();
+        // Secondary command buffer continues the render pass instance that is begun
+        // by the immediate context, so the pass must not be ended here.
+        VERIFY_EXPR(m_pActiveRenderPass != nullptr);
+        m_pActiveRenderPass.Release();
+        m_pBoundFramebuffer.Release();
+        m_SubpassIndex  = 0;
+        m_vkRenderPass  = VK_NULL_HANDLE;
+        m_vkFramebuffer = VK_NULL_HANDLE;
+        TDeviceContextBase::ResetRenderTargets();
+    }
+    else
+    {
+        VERIFY(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
+
+        if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+        {
+            m_CommandBuffer.EndRenderPass();
+        }
     }
 
     auto vkCmdBuff = m_CommandBuffer.GetVkCmdBuffer();
@@ -2069,9 +2170,10 @@ void DeviceContextVkImpl::FinishCommandList(class ICommandList** ppCommandList)
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to end command buffer");
     (void)err;
 
-    CommandListVkImpl* pCmdListVk(NEW_RC_OBJ(m_CmdListAllocator, "CommandListVkImpl instance", CommandListVkImpl)(m_pDevice, this, vkCmdBuff));
+    CommandListVkImpl* pCmdListVk(NEW_RC_OBJ(m_CmdListAllocator, "CommandListVkImpl instance", CommandListVkImpl)(m_pDevice, this, vkCmdBuff, m_IsRecordingSecondaryCmdBuffer));
     pCmdListVk->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
 
+    m_IsRecordingSecondaryCmdBuffer = false;
     m_CommandBuffer.Reset();
     m_State = ContextState{};
     m_DescrSetBindInfo.Reset();
@@ -2093,7 +2195,8 @@ void DeviceContextVkImpl::ExecuteCommandList(class ICommandList* pCommandList)
     InvalidateState();
 
     CommandListVkImpl* pCmdListVk = ValidatedCast<CommandListVkImpl>(pCommandList);
-    VkCommandBuffer    vkCmdBuff  = VK_NULL_HANDLE;
+    DEV_CHECK_ERR(!pCmdListVk->IsSecondary(), "Secondary command lists must be executed inside a render pass by IDeviceContextVk::ExecuteSecondaryCommandLists()");
+    VkCommandBuffer vkCmdBuff = VK_NULL_HANDLE;
 
     RefCntAutoPtr<IDeviceContext> pDeferredCtx;
     pCmdListVk->Close(vkCmdBuff, pDeferredCtx);
@@ -2106,13 +2209,102 @@ void DeviceContextVkImpl::ExecuteCommandList(class ICommandList* pCommandList)
     SubmitInfo.commandBufferCount = 1;
     SubmitInfo.pCommandBuffers    = &vkCmdBuff;
     VERIFY_EXPR(m_PendingFences.empty());
-    auto pDeferredCtxVkImpl  = pDeferredCtx.RawPtr<DeviceContextVkImpl>();
-    auto SubmittedFenceValue = m_pDevice->ExecuteCommandBuffer(m_CommandQueueId, SubmitInfo, this, nullptr);
-    // Set the bit in the deferred context cmd queue mask corresponding to cmd queue of this context
+    auto pDeferredCtxVkImpl = pDeferredCtx.RawPtr<DeviceContextVkImpl>();
+    m_pDevice->ExecuteCommandBuffer(m_CommandQueueId, SubmitInfo, this, nullptr);
+    // Set the bit in the deferred context cmd queue mask corresponding to cmd queue of this context.
+    // The command buffer is not returned to the deferred context's pool individually: the context
+    // resets the whole pool once the GPU has finished the frame (see FinishFrame()).
     pDeferredCtxVkImpl->m_SubmittedBuffersCmdQueueMask |= Uint64{1} << m_CommandQueueId;
-    // It is OK to dispose command buffer from another thread. We are not going to
-    // record any commands and only need to add the buffer to the queue
-    pDeferredCtxVkImpl->DisposeVkCmdBuffer(m_CommandQueueId, vkCmdBuff, SubmittedFenceValue);
+}
+
+void DeviceContextVkImpl::BeginSecondaryCommandList(IRenderPass* pRenderPass, Uint32 SubpassIndex, IFramebuffer* pFramebuffer)
+{
+    if (!m_bIsDeferred)
+    {
+        LOG_ERROR_MESSAGE("Only deferred contexts can record secondary command lists");
+        return;
+    }
+
+    DEV_CHECK_ERR(pRenderPass != nullptr, "Render pass must not be null");
+    DEV_CHECK_ERR(pFramebuffer != nullptr, "Framebuffer must not be null");
+    DEV_CHECK_ERR(SubpassIndex < pRenderPass->GetDesc().SubpassCount, "Subpass index (", SubpassIndex, ") exceeds the number of subpasses (",
+                  pRenderPass->GetDesc().SubpassCount, ") in render pass '", pRenderPass->GetDesc().Name, "'");
+    DEV_CHECK_ERR(m_CommandBuffer.GetVkCmdBuffer() == VK_NULL_HANDLE,
+                  "Deferred context already contains recorded commands. Call FinishCommandList() before beginning a secondary command list.");
+    VERIFY(m_pActiveRenderPass == nullptr, "Beginning secondary command list inside an active render pass.");
+
+    m_pActiveRenderPass = ValidatedCast<RenderPassVkImpl>(pRenderPass);
+    m_pBoundFramebuffer = ValidatedCast<FramebufferVkImpl>(pFramebuffer);
+    m_SubpassIndex      = SubpassIndex;
+    // Attachment states are managed by the immediate context that begins the render pass
+    m_RenderPassAttachmentsTransitionMode = RESOURCE_STATE_TRANSITION_MODE_NONE;
+    SetSubpassRenderTargets();
+
+    m_vkRenderPass  = m_pActiveRenderPass->GetVkRenderPass();
+    m_vkFramebuffer = m_pBoundFramebuffer->GetVkFramebuffer();
+
+    VkCommandBufferInheritanceInfo InheritanceInfo = {};
+
+    InheritanceInfo.sType                = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    InheritanceInfo.pNext                = nullptr;
+    InheritanceInfo.renderPass           = m_vkRenderPass;
+    InheritanceInfo.subpass              = SubpassIndex;
+    InheritanceInfo.framebuffer          = m_vkFramebuffer; // Optional, but may allow the driver to generate better code
+    InheritanceInfo.occlusionQueryEnable = VK_FALSE;
+
+    m_CommandBuffer.SetVkCmdBuffer(m_CmdPool.GetSecondaryCommandBuffer(InheritanceInfo));
+    m_CommandBuffer.SetInheritedRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight);
+    m_IsRecordingSecondaryCmdBuffer = true;
+    m_State.NumCommands             = 1;
+
+    // Dynamic states are not inherited by secondary command buffers (6.6), so
+    // set the viewport to match the framebuffer size
+    SetViewports(1, nullptr, 0, 0);
+}
+
+void DeviceContextVkImpl::ExecuteSecondaryCommandLists(Uint32 NumCommandLists, ICommandList* const* ppCommandLists)
+{
+    if (m_bIsDeferred)
+    {
+        LOG_ERROR_MESSAGE("Only immediate context can execute secondary command lists");
+        return;
+    }
+
+    DEV_CHECK_ERR(m_pActiveRenderPass != nullptr, "Secondary command lists must be executed inside an active render pass");
+    DEV_CHECK_ERR(m_vkSubpassContents == VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS,
+                  "Secondary command lists can only be executed in a render pass that was begun with SUBPASS_CONTENTS_SECONDARY_COMMAND_LISTS");
+    if (NumCommandLists == 0)
+        return;
+    DEV_CHECK_ERR(ppCommandLists != nullptr, "ppCommandLists must not be null when NumCommandLists is not zero");
+
+    m_vkSecondaryCmdBuffers.clear();
+    for (Uint32 i = 0; i < NumCommandLists; ++i)
+    {
+        auto* pCmdListVk = ValidatedCast<CommandListVkImpl>(ppCommandLists[i]);
+        DEV_CHECK_ERR(pCmdListVk->IsSecondary(), "Command list #", i, " is not a secondary command list");
+
+        VkCommandBuffer               vkCmdBuff = VK_NULL_HANDLE;
+        RefCntAutoPtr<IDeviceContext> pDeferredCtx;
+        pCmdListVk->Close(vkCmdBuff, pDeferredCtx);
+        VERIFY(vkCmdBuff != VK_NULL_HANDLE, "Trying to execute empty command buffer");
+        VERIFY_EXPR(pDeferredCtx);
+
+        m_vkSecondaryCmdBuffers.push_back(vkCmdBuff);
+        // The deferred contexts will be notified of the command queue when this context is flushed
+        ++pDeferredCtx.RawPtr<DeviceContextVkImpl>()->m_NumPendingSecondaryCmdLists;
+        m_PendingSecondaryCmdListContexts.emplace_back(std::move(pDeferredCtx));
+    }
+
+    EnsureVkCmdBuffer();
+    m_CommandBuffer.ExecuteCommands(NumCommandLists, m_vkSecondaryCmdBuffers.data());
+    m_State.NumCommands += NumCommandLists;
+
+    // Pipeline, vertex and index buffers and descriptor sets bound in the command
+    // buffer become undefined after vkCmdExecuteCommands
+    m_State.CommittedVBsUpToDate = false;
+    m_State.CommittedIBUpToDate  = false;
+    m_DescrSetBindInfo.Reset();
+    m_pPipelineState = nullptr;
 }
 
 void DeviceContextVkImpl::SignalFence(IFence* pFence, Uint64 Value)
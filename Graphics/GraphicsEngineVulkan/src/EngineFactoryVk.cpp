@@ -238,6 +238,10 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& _E
                 VK_KHR_MAINTENANCE1_EXTENSION_NAME // To allow negative viewport height
             };
 
+        // Descriptor update templates allow committing all dynamic shader resources with a single call
+        if (PhysicalDevice->IsExtensionSupported(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME))
+            DeviceExtensions.push_back(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME);
+
         const auto& DeviceExtFeatures = PhysicalDevice->GetExtFeatures();
 
 #define ENABLE_FEATURE(IsFeatureSupported, Feature, FeatureName)                         \
@@ -271,6 +275,9 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& _E
         // clang-format on
 #undef FeatureSupport
 
+        // Timeline semaphores are not exposed as a device feature and are used internally by command queues
+        auto TimelineSemaphoreFeats = DeviceExtFeatures.TimelineSemaphore;
+
 
         // To enable some device extensions you must enable instance extension VK_KHR_get_physical_device_properties2
         // and add feature description to DeviceCreateInfo.pNext.
@@ -383,6 +390,17 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& _E
                 DeviceExtensions.push_back(VK_KHR_STORAGE_BUFFER_STORAGE_CLASS_EXTENSION_NAME);
             }
 
+            if (TimelineSemaphoreFeats.timelineSemaphore != VK_FALSE)
+            {
+                VERIFY(PhysicalDevice->IsExtensionSupported(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME),
+                       "VK_KHR_timeline_semaphore extension must be supported as it has already been checked by VulkanPhysicalDevice "
+                       "and timelineSemaphore feature is TRUE");
+                DeviceExtensions.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+
+                *NextExt = &TimelineSemaphoreFeats;
+                NextExt  = &TimelineSemaphoreFeats.pNext;
+            }
+
             *NextExt = nullptr;
         }
 
@@ -58,9 +58,11 @@ size_t FramebufferCache::FramebufferCacheKey::GetHash() const
 {
     if (Hash == 0)
     {
-        Hash = ComputeHash(Pass, NumRenderTargets, DSV, CommandQueueMask);
+        HashDataPacker<sizeof(FramebufferCacheKey)> Packer;
+        Packer.Add(Pass, NumRenderTargets, DSV, CommandQueueMask);
         for (Uint32 rt = 0; rt < NumRenderTargets; ++rt)
-            HashCombine(Hash, RTVs[rt]);
+            Packer.Add(RTVs[rt]);
+        Hash = Packer.GetHash();
     }
     return Hash;
 }
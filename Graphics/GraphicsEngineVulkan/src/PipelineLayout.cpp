@@ -29,6 +29,7 @@
 
 #include "PipelineLayout.hpp"
 #include "ShaderResourceLayoutVk.hpp"
+#include "ShaderResourceCacheVk.hpp"
 #include "ShaderVkImpl.hpp"
 #include "RenderDeviceVkImpl.hpp"
 #include "DeviceContextVkImpl.hpp"
@@ -172,9 +173,68 @@ void PipelineLayout::DescriptorSetLayoutManager::DescriptorSetLayout::Finalize(c
     pBindings = pNewBindings;
 }
 
+void PipelineLayout::DescriptorSetLayoutManager::DescriptorSetLayout::CreateUpdateTemplate(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice)
+{
+    VERIFY(VkLayout != VK_NULL_HANDLE, "Descriptor set layout must be finalized");
+    VERIFY(VkUpdateTemplate == VK_NULL_HANDLE, "Update template has already been created");
+
+    // Bindings are allocated sequentially, and every binding occupies descriptorCount consecutive
+    // resources in the cache (see AllocateResourceSlot()). Every resource of the set has a matching
+    // descriptor info at the same offset in the ShaderResourceCacheVk::DescriptorInfo array.
+    std::vector<VkDescriptorUpdateTemplateEntryKHR> Entries;
+    Entries.reserve(NumLayoutBindings);
+    Uint32 CacheOffset = 0;
+    for (uint32_t b = 0; b < NumLayoutBindings; ++b)
+    {
+        const auto& Binding = pBindings[b];
+        VERIFY_EXPR(Binding.binding == b);
+
+        // Immutable samplers are permanently bound into the set layout; later binding a sampler
+        // into an immutable sampler slot in a descriptor set is not allowed (13.2.1).
+        // Atomic counters (the only non-dynamic storage buffers) are never written.
+        bool SkipBinding =
+            (Binding.descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER && Binding.pImmutableSamplers != nullptr) ||
+            Binding.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        if (!SkipBinding && Binding.descriptorCount > 0)
+        {
+            VkDescriptorUpdateTemplateEntryKHR Entry = {};
+
+            Entry.dstBinding      = Binding.binding;
+            Entry.dstArrayElement = 0;
+            Entry.descriptorCount = Binding.descriptorCount;
+            Entry.descriptorType  = Binding.descriptorType;
+            Entry.offset          = CacheOffset * sizeof(ShaderResourceCacheVk::DescriptorInfo);
+            Entry.stride          = sizeof(ShaderResourceCacheVk::DescriptorInfo);
+            Entries.push_back(Entry);
+
+            if (Binding.descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER && Binding.pImmutableSamplers == nullptr)
+                HasViewSamplers = true;
+        }
+        CacheOffset += Binding.descriptorCount;
+    }
+    VERIFY_EXPR(CacheOffset == TotalDescriptors);
+
+    if (Entries.empty())
+        return;
+
+    VkDescriptorUpdateTemplateCreateInfoKHR TemplateCI = {};
+
+    TemplateCI.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO_KHR;
+    TemplateCI.pNext                      = nullptr;
+    TemplateCI.flags                      = 0; // reserved for future use
+    TemplateCI.descriptorUpdateEntryCount = static_cast<uint32_t>(Entries.size());
+    TemplateCI.pDescriptorUpdateEntries   = Entries.data();
+    TemplateCI.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET_KHR;
+    TemplateCI.descriptorSetLayout        = VkLayout;
+    // pipelineBindPoint, pipelineLayout and set are ignored for VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET
+    VkUpdateTemplate = LogicalDevice.CreateDescriptorUpdateTemplate(TemplateCI);
+}
+
 void PipelineLayout::DescriptorSetLayoutManager::DescriptorSetLayout::Release(RenderDeviceVkImpl* pRenderDeviceVk, IMemoryAllocator& MemAllocator, Uint64 CommandQueueMask)
 {
     pRenderDeviceVk->SafeReleaseDeviceObject(std::move(VkLayout), CommandQueueMask);
+    if (VkUpdateTemplate != VK_NULL_HANDLE)
+        pRenderDeviceVk->SafeReleaseDeviceObject(std::move(VkUpdateTemplate), CommandQueueMask);
     for (uint32_t b = 0; b < NumLayoutBindings; ++b)
     {
         if (pBindings[b].pImmutableSamplers != nullptr)
@@ -182,6 +242,7 @@ void PipelineLayout::DescriptorSetLayoutManager::DescriptorSetLayout::Release(Re
     }
     pBindings         = nullptr;
     NumLayoutBindings = 0;
+    HasViewSamplers   = false;
 }
 
 PipelineLayout::DescriptorSetLayoutManager::DescriptorSetLayout::~DescriptorSetLayout()
@@ -252,6 +313,12 @@ void PipelineLayout::DescriptorSetLayoutManager::Finalize(const VulkanUtilities:
             ActiveDescrSetLayouts[Layout.SetIndex] = Layout.VkLayout;
         }
     }
+
+    // Static and mutable descriptors are written once when resources are bound, while dynamic
+    // descriptors are written every time an SRB is committed, so only the dynamic set needs a template
+    auto& DynamicSet = GetDescriptorSet(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+    if (DynamicSet.SetIndex >= 0 && LogicalDevice.IsDescriptorUpdateTemplateSupported())
+        DynamicSet.CreateUpdateTemplate(LogicalDevice);
     VERIFY_EXPR(BindingOffset == TotalBindings);
     // clang-format off
     VERIFY_EXPR(m_ActiveSets == 0 && ActiveDescrSetLayouts[0] == VK_NULL_HANDLE && ActiveDescrSetLayouts[1] == VK_NULL_HANDLE ||
@@ -408,6 +475,12 @@ std::array<Uint32, 2> PipelineLayout::GetDescriptorSetSizes(Uint32& NumSets) con
     return SetSizes;
 }
 
+Uint32 PipelineLayout::GetDescriptorUpdateTemplateSetMask() const
+{
+    const auto& DynamicSet = m_LayoutMgr.GetDescriptorSet(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+    return DynamicSet.SetIndex >= 0 && DynamicSet.VkUpdateTemplate != VK_NULL_HANDLE ? (1u << DynamicSet.SetIndex) : 0u;
+}
+
 void PipelineLayout::InitResourceCache(RenderDeviceVkImpl*    pDeviceVkImpl,
                                        ShaderResourceCacheVk& ResourceCache,
                                        IMemoryAllocator&      CacheMemAllocator,
@@ -418,7 +491,7 @@ void PipelineLayout::InitResourceCache(RenderDeviceVkImpl*    pDeviceVkImpl,
 
     // This call only initializes descriptor sets (ShaderResourceCacheVk::DescriptorSet) in the resource cache
     // Resources are initialized by source layout when shader resource binding objects are created
-    ResourceCache.InitializeSets(CacheMemAllocator, NumSets, SetSizes.data());
+    ResourceCache.InitializeSets(CacheMemAllocator, NumSets, SetSizes.data(), GetDescriptorUpdateTemplateSetMask());
 
     const auto& StaticAndMutSet = m_LayoutMgr.GetDescriptorSet(SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
     if (StaticAndMutSet.SetIndex >= 0)
@@ -434,6 +507,37 @@ void PipelineLayout::InitResourceCache(RenderDeviceVkImpl*    pDeviceVkImpl,
     }
 }
 
+bool PipelineLayout::UpdateDynamicDescriptorSet(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice,
+                                                const ShaderResourceCacheVk&                ResourceCache,
+                                                VkDescriptorSet                             vkDynamicDescrSet) const
+{
+    const auto& DynamicSet = m_LayoutMgr.GetDescriptorSet(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+    VERIFY(DynamicSet.SetIndex >= 0, "This pipeline layout does not contain dynamic resources");
+    VERIFY_EXPR(vkDynamicDescrSet != VK_NULL_HANDLE);
+    if (DynamicSet.VkUpdateTemplate == VK_NULL_HANDLE)
+        return false;
+
+    const auto& CachedSet = ResourceCache.GetDescriptorSet(DynamicSet.SetIndex);
+    VERIFY(CachedSet.GetVkDescriptorSet() == VK_NULL_HANDLE, "Dynamic descriptor set must not be assigned to the resource cache");
+    VERIFY_EXPR(CachedSet.GetSize() == DynamicSet.TotalDescriptors);
+
+    if (DynamicSet.HasViewSamplers)
+    {
+        // ITextureView::SetSampler() may have replaced the sampler that was current when the view was bound
+        Uint32 CacheOffset = 0;
+        for (uint32_t b = 0; b < DynamicSet.NumLayoutBindings; ++b)
+        {
+            const auto& Binding = DynamicSet.pBindings[b];
+            if (Binding.descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER && Binding.pImmutableSamplers == nullptr)
+                CachedSet.RefreshCombinedImageSamplers(CacheOffset, Binding.descriptorCount);
+            CacheOffset += Binding.descriptorCount;
+        }
+    }
+
+    LogicalDevice.UpdateDescriptorSetWithTemplate(vkDynamicDescrSet, DynamicSet.VkUpdateTemplate, CachedSet.GetDescriptorUpdateTemplateData());
+    return true;
+}
+
 void PipelineLayout::PrepareDescriptorSets(DeviceContextVkImpl*         pCtxVkImpl,
                                            bool                         IsCompute,
                                            const ShaderResourceCacheVk& ResourceCache,
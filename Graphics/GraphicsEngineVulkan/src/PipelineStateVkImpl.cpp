@@ -214,7 +214,7 @@ static void CreateComputePipeline(RenderDeviceVkImpl*
     PipelineCI.stage  = Stages[0];
     PipelineCI.layout = Layout.GetVkPipelineLayout();
 
-    Pipeline = LogicalDevice.CreateComputePipeline(PipelineCI, VK_NULL_HANDLE, PSODesc.Name);
+    Pipeline = LogicalDevice.CreateComputePipeline(PipelineCI, pDeviceVk->GetVkPipelineCache(), PSODesc.Name);
 }
 
 
@@ -224,21 +224,12 @@ static void CreateGraphicsPipeline(RenderDeviceVkImpl*
                                    const PipelineStateDesc&                      PSODesc,
                                    const GraphicsPipelineDesc&                   GraphicsPipeline,
                                    VulkanUtilities::PipelineWrapper&             Pipeline,
-                                   RefCntAutoPtr<IRenderPass>&                   pRenderPass)
+                                   IRenderPass*                                  pRenderPass)
 {
+    VERIFY_EXPR(pRenderPass != nullptr);
+
     const auto& LogicalDevice  = pDeviceVk->GetLogicalDevice();
     const auto& PhysicalDevice = pDeviceVk->GetPhysicalDevice();
-    auto&       RPCache        = pDeviceVk->GetImplicitRenderPassCache();
-
-    if (pRenderPass == nullptr)
-    {
-        RenderPassCache::RenderPassCacheKey Key{
-            GraphicsPipeline.NumRenderTargets,
-            GraphicsPipeline.SmplDesc.Count,
-            GraphicsPipeline.RTVFormats,
-            GraphicsPipeline.DSVFormat};
-        pRenderPass = RPCache.GetRenderPass(Key);
-    }
 
     VkGraphicsPipelineCreateInfo PipelineCI = {};
 
@@ -393,12 +384,12 @@ static void CreateGraphicsPipeline(RenderDeviceVkImpl*
     PipelineCI.pDynamicState         = &DynamicStateCI;
 
 
-    PipelineCI.renderPass         = pRenderPass.RawPtr<IRenderPassVk>()->GetVkRenderPass();
+    PipelineCI.renderPass         = static_cast<IRenderPassVk*>(pRenderPass)->GetVkRenderPass();
     PipelineCI.subpass            = GraphicsPipeline.SubpassIndex;
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
-    Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, VK_NULL_HANDLE, PSODesc.Name);
+    Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, pDeviceVk->GetVkPipelineCache(), PSODesc.Name);
 }
 
 void PipelineStateVkImpl::InitResourceLayouts(const PipelineStateCreateInfo& CreateInfo,
@@ -439,7 +430,7 @@ void PipelineStateVkImpl::InitResourceLayouts(const PipelineStateCreateInfo& Cre
 
         Uint32 NumSets            = 0;
         auto   DescriptorSetSizes = m_PipelineLayout.GetDescriptorSetSizes(NumSets);
-        auto   CacheMemorySize    = ShaderResourceCacheVk::GetRequiredMemorySize(NumSets, DescriptorSetSizes.data());
+        auto   CacheMemorySize    = ShaderResourceCacheVk::GetRequiredMemorySize(NumSets, DescriptorSetSizes.data(), m_PipelineLayout.GetDescriptorUpdateTemplateSetMask());
 
         m_SRBMemAllocator.Initialize(m_Desc.SRBAllocationGranularity, GetNumShaderStages(), ShaderVariableDataSizes.data(), 1, &CacheMemorySize);
     }
@@ -461,13 +452,11 @@ void PipelineStateVkImpl::InitResourceLayouts(const PipelineStateCreateInfo& Cre
 }
 
 template <typename PSOCreateInfoType>
-void PipelineStateVkImpl::InitInternalObjects(const PSOCreateInfoType&                           CreateInfo,
-                                              std::vector<VkPipelineShaderStageCreateInfo>&      vkShaderStages,
-                                              std::vector<VulkanUtilities::ShaderModuleWrapper>& ShaderModules)
+void PipelineStateVkImpl::InitInternalObjects(const PSOCreateInfoType& CreateInfo,
+                                              TShaderStages&           ShaderStages)
 {
     m_ResourceLayoutIndex.fill(-1);
 
-    TShaderStages ShaderStages;
     ExtractShaders<ShaderVkImpl>(CreateInfo, ShaderStages);
 
     LinearAllocator MemPool{GetRawAllocator()};
@@ -504,9 +493,81 @@ void PipelineStateVkImpl::InitInternalObjects(const PSOCreateInfoType&
     // destructors will be called for all objects
 
     InitResourceLayouts(CreateInfo, ShaderStages);
+}
+
+void PipelineStateVkImpl::CreatePipeline(TShaderStages& ShaderStages)
+{
+    std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
+    std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
 
     // Create shader modules and initialize shader stages
     InitPipelineShaderStages(GetDevice()->GetLogicalDevice(), ShaderStages, ShaderModules, vkShaderStages);
+
+    if (m_Desc.IsAnyGraphicsPipeline())
+        CreateGraphicsPipeline(GetDevice(), vkShaderStages, m_PipelineLayout, m_Desc, GetGraphicsPipelineDesc(), m_Pipeline, m_pRenderPass);
+    else
+        CreateComputePipeline(GetDevice(), vkShaderStages, m_PipelineLayout, m_Desc, m_Pipeline);
+}
+
+void PipelineStateVkImpl::CreatePipelineAsync(TShaderStages&& ShaderStages)
+{
+    struct AsyncTaskData
+    {
+        explicit AsyncTaskData(TShaderStages&& _ShaderStages) :
+            ShaderStages{std::move(_ShaderStages)}
+        {
+            // Keep the shaders alive until the pipeline is created
+            for (const auto& Stage : ShaderStages)
+                Shaders.emplace_back(const_cast<ShaderVkImpl*>(Stage.pShader));
+        }
+
+        TShaderStages                            ShaderStages;
+        std::vector<RefCntAutoPtr<ShaderVkImpl>> Shaders;
+    };
+    // std::function requires copyable function objects
+    auto pTaskData = std::make_shared<AsyncTaskData>(std::move(ShaderStages));
+
+    m_Status.store(PIPELINE_STATE_STATUS_COMPILING);
+    m_AsyncTaskRunning = true;
+    GetDevice()->GetPipelineThreadPool().EnqueueTask(
+        [this, pTaskData]() //
+        {
+            auto Status = PIPELINE_STATE_STATUS_READY;
+            try
+            {
+                CreatePipeline(pTaskData->ShaderStages);
+            }
+            catch (...)
+            {
+                LOG_ERROR_MESSAGE("Failed to asynchronously create pipeline '", m_Desc.Name, '\'');
+                Status = PIPELINE_STATE_STATUS_FAILED;
+            }
+
+            // Release the shaders while the pipeline, which holds a reference to the device, is still alive.
+            // Otherwise the last reference to the device could be released by the pool thread, which
+            // would then destroy the thread pool from one of its own threads.
+            pTaskData->ShaderStages.clear();
+            pTaskData->Shaders.clear();
+
+            // The destructor waits until m_AsyncTaskRunning is reset, so the
+            // object must not be accessed after the mutex is released.
+            std::lock_guard<std::mutex> Lock{m_StatusMtx};
+            m_Status.store(Status);
+            m_AsyncTaskRunning = false;
+            m_StatusCV.notify_all();
+        });
+}
+
+PIPELINE_STATE_STATUS PipelineStateVkImpl::GetStatus(bool WaitForCompletion)
+{
+    auto Status = m_Status.load();
+    if (Status == PIPELINE_STATE_STATUS_COMPILING && WaitForCompletion)
+    {
+        std::unique_lock<std::mutex> Lock{m_StatusMtx};
+        m_StatusCV.wait(Lock, [this] { return m_Status.load() != PIPELINE_STATE_STATUS_COMPILING; });
+        Status = m_Status.load();
+    }
+    return Status;
 }
 
 PipelineStateVkImpl::PipelineStateVkImpl(IReferenceCounters*                    pRefCounters,
@@ -517,12 +578,26 @@ PipelineStateVkImpl::PipelineStateVkImpl(IReferenceCounters*
 {
     try
     {
-        std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
-        std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
+        TShaderStages ShaderStages;
+        InitInternalObjects(CreateInfo, ShaderStages);
 
-        InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+        if (m_pRenderPass == nullptr)
+        {
+            // Get the implicit render pass before the pipeline is created
+            // so that it is never modified by another thread
+            const auto&                         GraphicsPipeline = GetGraphicsPipelineDesc();
+            RenderPassCache::RenderPassCacheKey Key{
+                GraphicsPipeline.NumRenderTargets,
+                GraphicsPipeline.SmplDesc.Count,
+                GraphicsPipeline.RTVFormats,
+                GraphicsPipeline.DSVFormat};
+            m_pRenderPass = pDeviceVk->GetImplicitRenderPassCache().GetRenderPass(Key);
+        }
 
-        CreateGraphicsPipeline(pDeviceVk, vkShaderStages, m_PipelineLayout, m_Desc, GetGraphicsPipelineDesc(), m_Pipeline, m_pRenderPass);
+        if ((CreateInfo.Flags & PSO_CREATE_FLAG_ASYNCHRONOUS) != 0)
+            CreatePipelineAsync(std::move(ShaderStages));
+        else
+            CreatePipeline(ShaderStages);
     }
     catch (...)
     {
@@ -540,12 +615,13 @@ PipelineStateVkImpl::PipelineStateVkImpl(IReferenceCounters*                   p
 {
     try
     {
-        std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
-        std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
-
-        InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+        TShaderStages ShaderStages;
+        InitInternalObjects(CreateInfo, ShaderStages);
 
-        CreateComputePipeline(pDeviceVk, vkShaderStages, m_PipelineLayout, m_Desc, m_Pipeline);
+        if ((CreateInfo.Flags & PSO_CREATE_FLAG_ASYNCHRONOUS) != 0)
+            CreatePipelineAsync(std::move(ShaderStages));
+        else
+            CreatePipeline(ShaderStages);
     }
     catch (...)
     {
@@ -557,6 +633,12 @@ PipelineStateVkImpl::PipelineStateVkImpl(IReferenceCounters*                   p
 
 PipelineStateVkImpl::~PipelineStateVkImpl()
 {
+    // Wait until the worker thread stops accessing the object. Unlike GetStatus(), always lock
+    // the mutex: the worker updates the status before it notifies the condition variable.
+    {
+        std::unique_lock<std::mutex> Lock{m_StatusMtx};
+        m_StatusCV.wait(Lock, [this] { return !m_AsyncTaskRunning; });
+    }
     Destruct();
 }
 
@@ -728,12 +810,16 @@ void PipelineStateVkImpl::CommitAndTransitionShaderResources(IShaderResourceBind
 #endif
             // Allocate vulkan descriptor set for dynamic resources
             DynamicDescrSet = pCtxVkImpl->AllocateDynamicDescriptorSet(DynamicDescriptorSetVkLayout, DynamicDescrSetName);
-            // Commit all dynamic resource descriptors
-            for (Uint32 s = 0; s < GetNumShaderStages(); ++s)
+            // Commit all dynamic resource descriptors. The resource cache keeps descriptors in the update
+            // template format, so when templates are supported, the entire set is written by a single call.
+            if (!m_PipelineLayout.UpdateDynamicDescriptorSet(GetDevice()->GetLogicalDevice(), ResourceCache, DynamicDescrSet))
             {
-                const auto& Layout = m_ShaderResourceLayouts[s];
-                if (Layout.GetResourceCount(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC) != 0)
-                    Layout.CommitDynamicResources(ResourceCache, DynamicDescrSet);
+                for (Uint32 s = 0; s < GetNumShaderStages(); ++s)
+                {
+                    const auto& Layout = m_ShaderResourceLayouts[s];
+                    if (Layout.GetResourceCount(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC) != 0)
+                        Layout.CommitDynamicResources(ResourceCache, DynamicDescrSet);
+                }
             }
         }
         // Prepare descriptor sets, and also bind them if there are no dynamic descriptors
@@ -777,6 +863,16 @@ IShaderResourceVariable* PipelineStateVkImpl::GetStaticVariableByName(SHADER_TYP
     return StaticVarMgr.GetVariable(Name);
 }
 
+IShaderResourceVariable* PipelineStateVkImpl::GetStaticVariableByInternedName(SHADER_TYPE ShaderType, const InternedString& Name)
+{
+    const auto LayoutInd = GetStaticVariableByNameHelper(ShaderType, Name.Str, m_ResourceLayoutIndex);
+    if (LayoutInd < 0)
+        return nullptr;
+
+    auto& StaticVarMgr = GetStaticVarMgr(LayoutInd);
+    return StaticVarMgr.GetVariable(Name);
+}
+
 IShaderResourceVariable* PipelineStateVkImpl::GetStaticVariableByIndex(SHADER_TYPE ShaderType, Uint32 Index)
 {
     const auto LayoutInd = GetStaticVariableByIndexHelper(ShaderType, Index, m_ResourceLayoutIndex);
@@ -40,6 +40,7 @@
 #include "RenderPassVkImpl.hpp"
 #include "FramebufferVkImpl.hpp"
 #include "EngineMemory.h"
+#include "DataBlobImpl.hpp"
 
 namespace Diligent
 {
@@ -142,7 +143,8 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
         EngineCI.DeviceLocalMemoryPageSize,
         EngineCI.HostVisibleMemoryPageSize,
         EngineCI.DeviceLocalMemoryReserveSize,
-        EngineCI.HostVisibleMemoryReserveSize
+        EngineCI.HostVisibleMemoryReserveSize,
+        EngineCI.UseTLSFMemoryAllocator
     },
     m_DynamicMemoryManager
     {
@@ -248,6 +250,141 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
     SamCaps.BorderSamplingModeSupported   = True;
     SamCaps.AnisotropicFilteringSupported = vkEnabledFeatures.samplerAnisotropy;
     SamCaps.LODBiasSupported              = True;
+
+    InitPipelineCache(EngineCI.pPipelineCacheData, EngineCI.PipelineCacheDataSize);
+    // The engine does not keep the pipeline cache data
+    m_EngineAttribs.pPipelineCacheData    = nullptr;
+    m_EngineAttribs.PipelineCacheDataSize = 0;
+
+    if (EngineCI.SPIRVCacheMemorySize != 0 || EngineCI.SPIRVCacheDirectory != nullptr)
+    {
+        m_pSPIRVCache.reset(new SPIRVCompilationCache{EngineCI.SPIRVCacheMemorySize, EngineCI.SPIRVCacheDirectory});
+    }
+    m_EngineAttribs.SPIRVCacheDirectory = nullptr;
+}
+
+ThreadPool& RenderDeviceVkImpl::GetPipelineThreadPool()
+{
+    std::lock_guard<std::mutex> Lock{m_PipelineThreadPoolMtx};
+    if (!m_pPipelineThreadPool)
+    {
+        m_pPipelineThreadPool.reset(new ThreadPool{m_EngineAttribs.NumAsyncPipelineThreads});
+        LOG_INFO_MESSAGE("Started ", m_pPipelineThreadPool->GetNumThreads(), " worker threads for asynchronous pipeline creation");
+    }
+    return *m_pPipelineThreadPool;
+}
+
+Uint32 RenderDeviceVkImpl::AllocateDynamicBufferId()
+{
+    std::lock_guard<std::mutex> Lock{m_DynamicBufferIdsMtx};
+    if (!m_FreeDynamicBufferIds.empty())
+    {
+        auto Id = m_FreeDynamicBufferIds.back();
+        m_FreeDynamicBufferIds.pop_back();
+        return Id;
+    }
+    return m_NextDynamicBufferId++;
+}
+
+void RenderDeviceVkImpl::ReleaseDynamicBufferId(Uint32 Id)
+{
+    std::lock_guard<std::mutex> Lock{m_DynamicBufferIdsMtx};
+    VERIFY_EXPR(Id < m_NextDynamicBufferId);
+    m_FreeDynamicBufferIds.push_back(Id);
+}
+
+// Checks if the pipeline cache data was created by a compatible device and driver.
+static bool IsPipelineCacheDataCompatible(const void* pCacheData, size_t CacheDataSize, const VkPhysicalDeviceProperties& DeviceProps)
+{
+    // Layout of VK_PIPELINE_CACHE_HEADER_VERSION_ONE header (see vkGetPipelineCacheData)
+    struct PipelineCacheHeader
+    {
+        uint32_t HeaderSize;
+        uint32_t HeaderVersion;
+        uint32_t VendorID;
+        uint32_t DeviceID;
+        uint8_t  PipelineCacheUUID[VK_UUID_SIZE];
+    };
+    static_assert(sizeof(PipelineCacheHeader) == 16 + VK_UUID_SIZE, "Unexpected pipeline cache header size");
+
+    if (CacheDataSize < sizeof(PipelineCacheHeader))
+    {
+        LOG_WARNING_MESSAGE("Pipeline cache data size (", CacheDataSize, ") is smaller than the size of the pipeline cache header");
+        return false;
+    }
+
+    PipelineCacheHeader Header;
+    memcpy(&Header, pCacheData, sizeof(Header));
+
+    if (Header.HeaderVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE || Header.HeaderSize < sizeof(PipelineCacheHeader) || Header.HeaderSize > CacheDataSize)
+    {
+        LOG_WARNING_MESSAGE("Pipeline cache data header is invalid");
+        return false;
+    }
+
+    if (Header.VendorID != DeviceProps.vendorID || Header.DeviceID != DeviceProps.deviceID)
+    {
+        LOG_INFO_MESSAGE("Pipeline cache data was created by a different device (vendor id: ", Header.VendorID, ", device id: ", Header.DeviceID, ')');
+        return false;
+    }
+
+    if (memcmp(Header.PipelineCacheUUID, DeviceProps.pipelineCacheUUID, VK_UUID_SIZE) != 0)
+    {
+        LOG_INFO_MESSAGE("Pipeline cache data was created by a different driver version");
+        return false;
+    }
+
+    return true;
+}
+
+void RenderDeviceVkImpl::InitPipelineCache(const void* pCacheData, size_t CacheDataSize)
+{
+    VkPipelineCacheCreateInfo PipelineCacheCI = {};
+    PipelineCacheCI.sType                     = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    PipelineCacheCI.pNext                     = nullptr;
+    PipelineCacheCI.flags                     = 0;
+    if (pCacheData != nullptr && CacheDataSize != 0)
+    {
+        if (IsPipelineCacheDataCompatible(pCacheData, CacheDataSize, m_PhysicalDevice->GetProperties()))
+        {
+            PipelineCacheCI.initialDataSize = CacheDataSize;
+            PipelineCacheCI.pInitialData    = pCacheData;
+        }
+        else
+        {
+            LOG_INFO_MESSAGE("Pipeline cache data is not compatible with the device and will be ignored");
+        }
+    }
+
+    m_PipelineCache = m_LogicalVkDevice->CreatePipelineCache(PipelineCacheCI, "Device pipeline cache");
+}
+
+void RenderDeviceVkImpl::GetPipelineCacheData(IDataBlob** ppData)
+{
+    DEV_CHECK_ERR(ppData != nullptr, "ppData must not be null");
+    DEV_CHECK_ERR(*ppData == nullptr, "Overwriting reference to existing object may cause memory leaks");
+    *ppData = nullptr;
+
+    size_t DataSize = 0;
+    auto   err      = m_LogicalVkDevice->GetPipelineCacheData(m_PipelineCache, &DataSize, nullptr);
+    if (err != VK_SUCCESS)
+    {
+        LOG_ERROR_MESSAGE("Failed to get the pipeline cache data size: ", VulkanUtilities::VkResultToString(err));
+        return;
+    }
+
+    RefCntAutoPtr<IDataBlob> pDataBlob{MakeNewRCObj<DataBlobImpl>{}(DataSize)};
+    // The cache may grow between the two calls, in which case the driver
+    // writes as much data as fits and returns VK_INCOMPLETE
+    err = m_LogicalVkDevice->GetPipelineCacheData(m_PipelineCache, &DataSize, pDataBlob->GetDataPtr());
+    if (err != VK_SUCCESS && err != VK_INCOMPLETE)
+    {
+        LOG_ERROR_MESSAGE("Failed to get the pipeline cache data: ", VulkanUtilities::VkResultToString(err));
+        return;
+    }
+    pDataBlob->Resize(DataSize);
+
+    *ppData = pDataBlob.Detach();
 }
 
 RenderDeviceVkImpl::~RenderDeviceVkImpl()
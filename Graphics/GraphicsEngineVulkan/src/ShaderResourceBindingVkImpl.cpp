@@ -153,6 +153,16 @@ IShaderResourceVariable* ShaderResourceBindingVkImpl::GetVariableByName(SHADER_T
     return m_pShaderVarMgrs[ResLayoutInd].GetVariable(Name);
 }
 
+IShaderResourceVariable* ShaderResourceBindingVkImpl::GetVariableByInternedName(SHADER_TYPE ShaderType, const InternedString& Name)
+{
+    auto ResLayoutInd = GetVariableByNameHelper(ShaderType, Name.Str, m_ResourceLayoutIndex);
+    if (ResLayoutInd < 0)
+        return nullptr;
+
+    VERIFY_EXPR(static_cast<Uint32>(ResLayoutInd) < Uint32{m_NumShaders});
+    return m_pShaderVarMgrs[ResLayoutInd].GetVariable(Name);
+}
+
 Uint32 ShaderResourceBindingVkImpl::GetVariableCount(SHADER_TYPE ShaderType) const
 {
     auto ResLayoutInd = GetVariableCountHelper(ShaderType, m_ResourceLayoutIndex);
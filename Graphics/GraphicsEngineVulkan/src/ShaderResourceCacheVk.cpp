@@ -38,53 +38,73 @@
 namespace Diligent
 {
 
-size_t ShaderResourceCacheVk::GetRequiredMemorySize(Uint32 NumSets, Uint32 SetSizes[])
+size_t ShaderResourceCacheVk::GetRequiredMemorySize(Uint32 NumSets, Uint32 SetSizes[], Uint32 TemplateSetMask)
 {
-    Uint32 TotalResources = 0;
+    Uint32 TotalResources       = 0;
+    Uint32 TotalDescriptorInfos = 0;
     for (Uint32 t = 0; t < NumSets; ++t)
+    {
         TotalResources += SetSizes[t];
-    auto MemorySize = NumSets * sizeof(DescriptorSet) + TotalResources * sizeof(Resource);
+        if (TemplateSetMask & (1u << t))
+            TotalDescriptorInfos += SetSizes[t];
+    }
+    auto MemorySize = NumSets * sizeof(DescriptorSet) + TotalResources * sizeof(Resource) + TotalDescriptorInfos * sizeof(DescriptorInfo);
     return MemorySize;
 }
 
-void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint32 NumSets, Uint32 SetSizes[])
+void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint32 NumSets, Uint32 SetSizes[], Uint32 TemplateSetMask)
 {
     // Memory layout:
     //
     //  m_pMemory
     //  |
     //  V
-    // ||  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  ||
+    // ||  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  |  Info[0]  |  ... |  Info[m-1]  ||
     //
     //
     //  Ns = m_NumSets
+    //  Descriptor infos are only allocated for the sets in TemplateSetMask
 
     VERIFY(m_pAllocator == nullptr && m_pMemory == nullptr, "Cache already initialized");
     m_pAllocator = &MemAllocator;
     VERIFY(NumSets < std::numeric_limits<decltype(m_NumSets)>::max(), "NumSets (", NumSets, ") exceed maximum representable value");
-    m_NumSets        = static_cast<Uint16>(NumSets);
-    m_TotalResources = 0;
+    m_NumSets                   = static_cast<Uint16>(NumSets);
+    m_TotalResources            = 0;
+    Uint32 TotalDescriptorInfos = 0;
     for (Uint32 t = 0; t < NumSets; ++t)
+    {
         m_TotalResources += SetSizes[t];
-    auto MemorySize = NumSets * sizeof(DescriptorSet) + m_TotalResources * sizeof(Resource);
-    VERIFY_EXPR(MemorySize == GetRequiredMemorySize(NumSets, SetSizes));
+        if (TemplateSetMask & (1u << t))
+            TotalDescriptorInfos += SetSizes[t];
+    }
+    auto MemorySize = NumSets * sizeof(DescriptorSet) + m_TotalResources * sizeof(Resource) + TotalDescriptorInfos * sizeof(DescriptorInfo);
+    VERIFY_EXPR(MemorySize == GetRequiredMemorySize(NumSets, SetSizes, TemplateSetMask));
 #ifdef DILIGENT_DEBUG
     m_DbgInitializedResources.resize(m_NumSets);
 #endif
     if (MemorySize > 0)
     {
-        m_pMemory         = ALLOCATE_RAW(*m_pAllocator, "Memory for shader resource cache data", MemorySize);
-        auto* pSets       = reinterpret_cast<DescriptorSet*>(m_pMemory);
-        auto* pCurrResPtr = reinterpret_cast<Resource*>(pSets + m_NumSets);
+        m_pMemory          = ALLOCATE_RAW(*m_pAllocator, "Memory for shader resource cache data", MemorySize);
+        auto* pSets        = reinterpret_cast<DescriptorSet*>(m_pMemory);
+        auto* pCurrResPtr  = reinterpret_cast<Resource*>(pSets + m_NumSets);
+        auto* pCurrInfoPtr = reinterpret_cast<DescriptorInfo*>(pCurrResPtr + m_TotalResources);
         for (Uint32 t = 0; t < NumSets; ++t)
         {
-            new (&GetDescriptorSet(t)) DescriptorSet(SetSizes[t], SetSizes[t] > 0 ? pCurrResPtr : nullptr);
+            DescriptorInfo* pDescriptorInfos = nullptr;
+            if ((TemplateSetMask & (1u << t)) != 0 && SetSizes[t] > 0)
+            {
+                pDescriptorInfos = pCurrInfoPtr;
+                // Unbound descriptors are written as null handles
+                memset(pDescriptorInfos, 0, SetSizes[t] * sizeof(DescriptorInfo));
+                pCurrInfoPtr += SetSizes[t];
+            }
+            new (&GetDescriptorSet(t)) DescriptorSet(SetSizes[t], SetSizes[t] > 0 ? pCurrResPtr : nullptr, pDescriptorInfos);
             pCurrResPtr += SetSizes[t];
 #ifdef DILIGENT_DEBUG
             m_DbgInitializedResources[t].resize(SetSizes[t]);
 #endif
         }
-        VERIFY_EXPR((char*)pCurrResPtr == (char*)m_pMemory + MemorySize);
+        VERIFY_EXPR((char*)pCurrInfoPtr == (char*)m_pMemory + MemorySize);
     }
 }
 
@@ -497,4 +517,67 @@ VkDescriptorImageInfo ShaderResourceCacheVk::Resource::GetInputAttachmentDescrip
     return DescrImgInfo;
 }
 
+void ShaderResourceCacheVk::DescriptorSet::RefreshCombinedImageSamplers(Uint32 CacheOffset, Uint32 Count) const
+{
+    VERIFY(m_pDescriptorInfos != nullptr, "This set is not written with a descriptor update template");
+    VERIFY(CacheOffset + Count <= m_NumResources, "Range [", CacheOffset, ", ", CacheOffset + Count, ") is out of bounds");
+    for (Uint32 i = CacheOffset; i < CacheOffset + Count; ++i)
+    {
+        const auto& Res = m_pResources[i];
+        VERIFY(Res.Type == SPIRVShaderResourceAttribs::ResourceType::SampledImage, "Combined image sampler is expected");
+        if (!Res.pObject)
+            continue;
+
+        auto* pSamplerVk = ValidatedCast<const SamplerVkImpl>(Res.pObject.RawPtr<const TextureViewVkImpl>()->GetSampler());
+        // The missing sampler is reported when the view is bound
+        m_pDescriptorInfos[i].ImageInfo.sampler = pSamplerVk != nullptr ? pSamplerVk->GetVkSampler() : VK_NULL_HANDLE;
+    }
+}
+
+ShaderResourceCacheVk::DescriptorInfo ShaderResourceCacheVk::Resource::GetDescriptorInfo(bool IsImmutableSampler) const
+{
+    DescriptorInfo Info = {};
+    if (!pObject)
+        return Info;
+
+    switch (Type)
+    {
+        case SPIRVShaderResourceAttribs::ResourceType::UniformBuffer:
+            Info.BufferInfo = GetUniformBufferDescriptorWriteInfo();
+            break;
+
+        case SPIRVShaderResourceAttribs::ResourceType::ROStorageBuffer:
+        case SPIRVShaderResourceAttribs::ResourceType::RWStorageBuffer:
+            Info.BufferInfo = GetStorageBufferDescriptorWriteInfo();
+            break;
+
+        case SPIRVShaderResourceAttribs::ResourceType::UniformTexelBuffer:
+        case SPIRVShaderResourceAttribs::ResourceType::StorageTexelBuffer:
+            Info.TexelBufferView = GetBufferViewWriteInfo();
+            break;
+
+        case SPIRVShaderResourceAttribs::ResourceType::StorageImage:
+        case SPIRVShaderResourceAttribs::ResourceType::SeparateImage:
+        case SPIRVShaderResourceAttribs::ResourceType::SampledImage:
+            Info.ImageInfo = GetImageDescriptorWriteInfo(IsImmutableSampler);
+            break;
+
+        case SPIRVShaderResourceAttribs::ResourceType::AtomicCounter:
+            // Atomic counters are never written to descriptor sets
+            break;
+
+        case SPIRVShaderResourceAttribs::ResourceType::SeparateSampler:
+            Info.ImageInfo = GetSamplerDescriptorWriteInfo();
+            break;
+
+        case SPIRVShaderResourceAttribs::ResourceType::InputAttachment:
+            Info.ImageInfo = GetInputAttachmentDescriptorWriteInfo();
+            break;
+
+        default:
+            UNEXPECTED("Unexpected resource type");
+    }
+    return Info;
+}
+
 } // namespace Diligent
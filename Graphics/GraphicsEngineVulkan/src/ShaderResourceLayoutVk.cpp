@@ -1021,6 +1021,11 @@ void ShaderResourceLayoutVk::VkResource::BindResource(IDeviceObject* pObj, Uint3
 
         DstRes.pObject.Release();
     }
+
+    // Keep the descriptor in the update template format up to date. Only sets written
+    // with vkUpdateDescriptorSetWithTemplate() have descriptor infos in the cache.
+    if (auto* pDescrInfo = DstDescrSet.GetDescriptorInfo(CacheOffset + ArrayIndex))
+        *pDescrInfo = DstRes.GetDescriptorInfo(IsImmutableSamplerAssigned());
 }
 
 bool ShaderResourceLayoutVk::VkResource::IsBound(Uint32 ArrayIndex, const ShaderResourceCacheVk& ResourceCache) const
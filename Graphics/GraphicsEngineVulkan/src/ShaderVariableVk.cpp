@@ -61,7 +61,8 @@ size_t ShaderVariableManagerVk::GetRequiredMemorySize(const ShaderResourceLayout
         }
     }
 
-    return NumVariables * sizeof(ShaderVariableVkImpl);
+    static_assert(sizeof(ShaderVariableVkImpl) % alignof(VariableHashEntry) == 0, "Hash index entries that follow the variables are misaligned");
+    return NumVariables * (sizeof(ShaderVariableVkImpl) + sizeof(VariableHashEntry));
 }
 
 // Creates shader variable for every resource from SrcLayout whose type is one AllowedVarTypes
@@ -83,6 +84,7 @@ void ShaderVariableManagerVk::Initialize(const ShaderResourceLayoutVk&        Sr
 
     auto* pRawMem = ALLOCATE_RAW(Allocator, "Raw memory buffer for shader variables", MemSize);
     m_pVariables  = reinterpret_cast<ShaderVariableVkImpl*>(pRawMem);
+    m_pHashIndex  = reinterpret_cast<VariableHashEntry*>(m_pVariables + m_NumVariables);
 
     Uint32     VarInd                = 0;
     const bool UsingSeparateSamplers = SrcLayout.IsUsingSeparateSamplers();
@@ -101,10 +103,13 @@ void ShaderVariableManagerVk::Initialize(const ShaderResourceLayoutVk&        Sr
                 continue;
 
             ::new (m_pVariables + VarInd) ShaderVariableVkImpl(*this, SrcRes);
+            m_pHashIndex[VarInd] = VariableHashEntry{CStringHash<Char>{}(SrcRes.SpirvAttribs.Name), VarInd};
             ++VarInd;
         }
     }
     VERIFY_EXPR(VarInd == m_NumVariables);
+
+    std::sort(m_pHashIndex, m_pHashIndex + m_NumVariables);
 }
 
 ShaderVariableManagerVk::~ShaderVariableManagerVk()
@@ -122,6 +127,7 @@ void ShaderVariableManagerVk::DestroyVariables(IMemoryAllocator& Allocator)
             m_pVariables[v].~ShaderVariableVkImpl();
         Allocator.Free(m_pVariables);
         m_pVariables = nullptr;
+        m_pHashIndex = nullptr;
     }
 }
 
@@ -141,6 +147,21 @@ ShaderVariableVkImpl* ShaderVariableManagerVk::GetVariable(const Char* Name) con
     return pVar;
 }
 
+ShaderVariableVkImpl* ShaderVariableManagerVk::GetVariable(const InternedString& Name) const
+{
+    const VariableHashEntry Key{Name.Hash, 0};
+    for (auto* pEntry = std::lower_bound(m_pHashIndex, m_pHashIndex + m_NumVariables, Key);
+         pEntry != m_pHashIndex + m_NumVariables && pEntry->NameHash == Name.Hash; ++pEntry)
+    {
+        auto& Var = m_pVariables[pEntry->VarIndex];
+        // The interned string may come from a pool other than the one used by this module,
+        // so the names are compared when the pointers differ.
+        const auto* ResName = Var.m_Resource.SpirvAttribs.Name;
+        if (ResName == Name.Str || strcmp(ResName, Name.Str) == 0)
+            return &Var;
+    }
+    return nullptr;
+}
 
 ShaderVariableVkImpl* ShaderVariableManagerVk::GetVariable(Uint32 Index) const
 {
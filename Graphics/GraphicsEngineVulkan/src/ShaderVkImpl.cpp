@@ -76,63 +76,118 @@ ShaderVkImpl::ShaderVkImpl(IReferenceCounters*     pRefCounters,
             }
         }
 
-        switch (ShaderCompiler)
+        const bool UseGlslang = ShaderCompiler == SHADER_COMPILER_DEFAULT || ShaderCompiler == SHADER_COMPILER_GLSLANG;
+
+        std::string GLSLSourceString;
+        if (UseGlslang && ShaderCI.SourceLanguage != SHADER_SOURCE_LANGUAGE_HLSL && ShaderCI.SourceLanguage != SHADER_SOURCE_LANGUAGE_GLSL_VERBATIM)
         {
-            case SHADER_COMPILER_DXC:
+            // Build the full source code string that will contain GLSL version declaration,
+            // platform definitions, user-provided shader macros, etc.
+            GLSLSourceString = BuildGLSLSourceString(ShaderCI, pRenderDeviceVk->GetDeviceCaps(), TargetGLSLCompiler::glslang, VulkanDefine);
+        }
+
+        auto* const                pSPIRVCache = pRenderDeviceVk->GetSPIRVCompilationCache();
+        SPIRVCompilationCache::Key CacheKey;
+        if (pSPIRVCache != nullptr)
+        {
+            SPIRVCompilationCache::KeyAttribs KeyAttribs;
+            if (!GLSLSourceString.empty())
             {
-                auto* pDXComiler = pRenderDeviceVk->GetDxCompiler();
-                VERIFY_EXPR(pDXComiler != nullptr && pDXComiler->IsLoaded());
-                pDXComiler->Compile(ShaderCI, ShaderVersion{}, VulkanDefine, nullptr, &m_SPIRV, ShaderCI.ppCompilerOutput);
+                // The source string already contains all macros and definitions
+                KeyAttribs.Source       = GLSLSourceString.c_str();
+                KeyAttribs.SourceLength = GLSLSourceString.length();
             }
-            break;
+            else
+            {
+                KeyAttribs.Source           = ShaderCI.Source;
+                KeyAttribs.FilePath         = ShaderCI.Source == nullptr ? ShaderCI.FilePath : nullptr;
+                KeyAttribs.Macros           = ShaderCI.Macros;
+                KeyAttribs.ExtraDefinitions = VulkanDefine;
+            }
+            KeyAttribs.pShaderSourceStreamFactory = ShaderCI.pShaderSourceStreamFactory;
+            KeyAttribs.EntryPoint                 = ShaderCI.EntryPoint;
+            KeyAttribs.ShaderType                 = m_Desc.ShaderType;
+            KeyAttribs.SourceLanguage             = ShaderCI.SourceLanguage;
+            KeyAttribs.ShaderCompiler             = UseGlslang ? SHADER_COMPILER_GLSLANG : ShaderCompiler;
+            if (ShaderCompiler == SHADER_COMPILER_DXC)
+            {
+                const auto MaxSM           = pRenderDeviceVk->GetDxCompiler()->GetMaxShaderModel();
+                KeyAttribs.CompilerVersion = (Uint32{MaxSM.Major} << 8u) | Uint32{MaxSM.Minor};
+            }
+#if !DILIGENT_NO_GLSLANG
+            else
+            {
+                KeyAttribs.CompilerVersionString = GLSLangUtils::GetCompilerVersionString();
+            }
+#endif
 
-            case SHADER_COMPILER_DEFAULT:
-            case SHADER_COMPILER_GLSLANG:
+            CacheKey = SPIRVCompilationCache::ComputeKey(KeyAttribs);
+            if (pSPIRVCache->Find(CacheKey, m_SPIRV) && ShaderCI.ppCompilerOutput != nullptr)
             {
-#if DILIGENT_NO_GLSLANG
-                LOG_ERROR_AND_THROW("Diligent engine was not linked with glslang, use DXC or precompiled SPIRV bytecode.");
-#else
-                if (ShaderCI.SourceLanguage == SHADER_SOURCE_LANGUAGE_HLSL)
+                // The compiler does not run, so there is no output
+                *ShaderCI.ppCompilerOutput = nullptr;
+            }
+        }
+
+        if (m_SPIRV.empty())
+        {
+            switch (ShaderCompiler)
+            {
+                case SHADER_COMPILER_DXC:
                 {
-                    m_SPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, VulkanDefine, ShaderCI.ppCompilerOutput);
+                    auto* pDXComiler = pRenderDeviceVk->GetDxCompiler();
+                    VERIFY_EXPR(pDXComiler != nullptr && pDXComiler->IsLoaded());
+                    pDXComiler->Compile(ShaderCI, ShaderVersion{}, VulkanDefine, nullptr, &m_SPIRV, ShaderCI.ppCompilerOutput);
                 }
-                else
-                {
-                    std::string              GLSLSourceString;
-                    RefCntAutoPtr<IDataBlob> pSourceFileData;
+                break;
 
-                    const char*        ShaderSource = nullptr;
-                    size_t             SourceLength = 0;
-                    const ShaderMacro* Macros       = nullptr;
-                    if (ShaderCI.SourceLanguage == SHADER_SOURCE_LANGUAGE_GLSL_VERBATIM)
+                case SHADER_COMPILER_DEFAULT:
+                case SHADER_COMPILER_GLSLANG:
+                {
+#if DILIGENT_NO_GLSLANG
+                    LOG_ERROR_AND_THROW("Diligent engine was not linked with glslang, use DXC or precompiled SPIRV bytecode.");
+#else
+                    if (ShaderCI.SourceLanguage == SHADER_SOURCE_LANGUAGE_HLSL)
                     {
-                        // Read the source file directly and use it as is
-                        ShaderSource = ReadShaderSourceFile(ShaderCI.Source, ShaderCI.pShaderSourceStreamFactory, ShaderCI.FilePath, pSourceFileData, SourceLength);
-
-                        // Add user macros.
-                        // BuildGLSLSourceString adds the macros to the source string, so we don't need to do this for SHADER_SOURCE_LANGUAGE_GLSL
-                        Macros = ShaderCI.Macros;
+                        m_SPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, VulkanDefine, ShaderCI.ppCompilerOutput);
                     }
                     else
                     {
-                        // Build the full source code string that will contain GLSL version declaration,
-                        // platform definitions, user-provided shader macros, etc.
-                        GLSLSourceString = BuildGLSLSourceString(ShaderCI, pRenderDeviceVk->GetDeviceCaps(), TargetGLSLCompiler::glslang, VulkanDefine);
-                        ShaderSource     = GLSLSourceString.c_str();
-                        SourceLength     = GLSLSourceString.length();
-                    }
+                        RefCntAutoPtr<IDataBlob> pSourceFileData;
 
-                    m_SPIRV = GLSLangUtils::GLSLtoSPIRV(m_Desc.ShaderType, ShaderSource,
-                                                        static_cast<int>(SourceLength), Macros,
-                                                        ShaderCI.pShaderSourceStreamFactory,
-                                                        ShaderCI.ppCompilerOutput);
-                }
+                        const char*        ShaderSource = nullptr;
+                        size_t             SourceLength = 0;
+                        const ShaderMacro* Macros       = nullptr;
+                        if (ShaderCI.SourceLanguage == SHADER_SOURCE_LANGUAGE_GLSL_VERBATIM)
+                        {
+                            // Read the source file directly and use it as is
+                            ShaderSource = ReadShaderSourceFile(ShaderCI.Source, ShaderCI.pShaderSourceStreamFactory, ShaderCI.FilePath, pSourceFileData, SourceLength);
+
+                            // Add user macros.
+                            // BuildGLSLSourceString adds the macros to the source string, so we don't need to do this for SHADER_SOURCE_LANGUAGE_GLSL
+                            Macros = ShaderCI.Macros;
+                        }
+                        else
+                        {
+                            ShaderSource = GLSLSourceString.c_str();
+                            SourceLength = GLSLSourceString.length();
+                        }
+
+                        m_SPIRV = GLSLangUtils::GLSLtoSPIRV(m_Desc.ShaderType, ShaderSource,
+                                                            static_cast<int>(SourceLength), Macros,
+                                                            ShaderCI.pShaderSourceStreamFactory,
+                                                            ShaderCI.ppCompilerOutput);
+                    }
 #endif
-                break;
+                    break;
+                }
+
+                default:
+                    LOG_ERROR_AND_THROW("Unsupported shader compiler");
             }
 
-            default:
-                LOG_ERROR_AND_THROW("Unsupported shader compiler");
+            if (pSPIRVCache != nullptr)
+                pSPIRVCache->Add(CacheKey, m_SPIRV);
         }
 
         if (m_SPIRV.empty())
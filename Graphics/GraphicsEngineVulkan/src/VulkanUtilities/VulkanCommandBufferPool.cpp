@@ -49,52 +49,43 @@ VulkanCommandBufferPool::VulkanCommandBufferPool(std::shared_ptr<const VulkanLog
 
     m_CmdPool = m_LogicalDevice->CreateCommandPool(CmdPoolCI);
     DEV_CHECK_ERR(m_CmdPool != VK_NULL_HANDLE, "Failed to create vulkan command pool");
-#ifdef DILIGENT_DEVELOPMENT
-    m_BuffCounter = 0;
-#endif
 }
 
 VulkanCommandBufferPool::~VulkanCommandBufferPool()
 {
+    // Command buffers are freed together with the pool
     m_CmdPool.Release();
-    DEV_CHECK_ERR(m_BuffCounter == 0, m_BuffCounter, " command buffer(s) have not been returned to the pool. If there are outstanding references to these buffers in release queues, FreeCommandBuffer() will crash when attempting to return a buffer to the pool.");
+}
+
+VkCommandBuffer VulkanCommandBufferPool::AllocateCommandBuffer(VkCommandBufferLevel Level)
+{
+    auto& CmdBuffers     = m_CmdBuffers[Level];
+    auto& NumUsedBuffers = m_NumUsedBuffers[Level];
+
+    // All buffers that have not been used since the last reset are in the initial state
+    // and can be reused without resetting them individually
+    if (NumUsedBuffers < CmdBuffers.size())
+        return CmdBuffers[NumUsedBuffers++];
+
+    VkCommandBufferAllocateInfo BuffAllocInfo = {};
+
+    BuffAllocInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    BuffAllocInfo.pNext              = nullptr;
+    BuffAllocInfo.commandPool        = m_CmdPool;
+    BuffAllocInfo.level              = Level;
+    BuffAllocInfo.commandBufferCount = 1;
+
+    auto CmdBuffer = m_LogicalDevice->AllocateVkCommandBuffer(BuffAllocInfo);
+    DEV_CHECK_ERR(CmdBuffer != VK_NULL_HANDLE, "Failed to allocate vulkan command buffer");
+
+    CmdBuffers.push_back(CmdBuffer);
+    ++NumUsedBuffers;
+    return CmdBuffer;
 }
 
 VkCommandBuffer VulkanCommandBufferPool::GetCommandBuffer(const char* DebugName)
 {
-    VkCommandBuffer CmdBuffer = VK_NULL_HANDLE;
-
-    {
-        std::lock_guard<std::mutex> Lock{m_Mutex};
-
-        if (!m_CmdBuffers.empty())
-        {
-            CmdBuffer = m_CmdBuffers.front();
-            auto err  = vkResetCommandBuffer(
-                CmdBuffer,
-                0 // VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT -  specifies that most or all memory resources currently
-                  // owned by the command buffer should be returned to the parent command pool.
-            );
-            DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to reset command buffer");
-            (void)err;
-            m_CmdBuffers.pop_front();
-        }
-    }
-
-    // If no cmd buffers were ready to be reused, create a new one
-    if (CmdBuffer == VK_NULL_HANDLE)
-    {
-        VkCommandBufferAllocateInfo BuffAllocInfo = {};
-
-        BuffAllocInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-        BuffAllocInfo.pNext              = nullptr;
-        BuffAllocInfo.commandPool        = m_CmdPool;
-        BuffAllocInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        BuffAllocInfo.commandBufferCount = 1;
-
-        CmdBuffer = m_LogicalDevice->AllocateVkCommandBuffer(BuffAllocInfo);
-        DEV_CHECK_ERR(CmdBuffer != VK_NULL_HANDLE, "Failed to allocate vulkan command buffer");
-    }
+    auto CmdBuffer = AllocateCommandBuffer(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
 
     VkCommandBufferBeginInfo CmdBuffBeginInfo = {};
 
@@ -108,26 +99,48 @@ VkCommandBuffer VulkanCommandBufferPool::GetCommandBuffer(const char* DebugName)
     auto err = vkBeginCommandBuffer(CmdBuffer, &CmdBuffBeginInfo);
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to begin command buffer");
     (void)err;
-#ifdef DILIGENT_DEVELOPMENT
-    ++m_BuffCounter;
-#endif
     return CmdBuffer;
 }
 
-void VulkanCommandBufferPool::FreeCommandBuffer(VkCommandBuffer&& CmdBuffer)
+VkCommandBuffer VulkanCommandBufferPool::GetSecondaryCommandBuffer(const VkCommandBufferInheritanceInfo& InheritanceInfo, const char* DebugName)
 {
-    std::lock_guard<std::mutex> Lock{m_Mutex};
-    m_CmdBuffers.emplace_back(CmdBuffer);
-    CmdBuffer = VK_NULL_HANDLE;
-#ifdef DILIGENT_DEVELOPMENT
-    --m_BuffCounter;
-#endif
+    VERIFY(InheritanceInfo.renderPass != VK_NULL_HANDLE, "Secondary command buffers are only used to record commands inside render pass");
+
+    auto CmdBuffer = AllocateCommandBuffer(VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+
+    VkCommandBufferBeginInfo CmdBuffBeginInfo = {};
+
+    CmdBuffBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    CmdBuffBeginInfo.pNext = nullptr;
+    CmdBuffBeginInfo.flags =
+        VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT |     // The command buffer will only be executed once
+        VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT; // The command buffer is entirely inside a render pass
+    CmdBuffBeginInfo.pInheritanceInfo = &InheritanceInfo;
+
+    auto err = vkBeginCommandBuffer(CmdBuffer, &CmdBuffBeginInfo);
+    DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to begin secondary command buffer");
+    (void)err;
+    return CmdBuffer;
+}
+
+void VulkanCommandBufferPool::Reset()
+{
+    // Resetting a command pool recycles all of the resources from all of the command buffers
+    // allocated from the command pool back to the command pool. All command buffers that have
+    // been allocated from the command pool are put in the initial state (5.2).
+    m_LogicalDevice->ResetCommandPool(m_CmdPool);
+
+    m_NumUsedBuffers[VK_COMMAND_BUFFER_LEVEL_PRIMARY]   = 0;
+    m_NumUsedBuffers[VK_COMMAND_BUFFER_LEVEL_SECONDARY] = 0;
 }
 
 CommandPoolWrapper&& VulkanCommandBufferPool::Release()
 {
     m_LogicalDevice.reset();
-    m_CmdBuffers.clear();
+    for (auto& CmdBuffers : m_CmdBuffers)
+        CmdBuffers.clear();
+    m_NumUsedBuffers[VK_COMMAND_BUFFER_LEVEL_PRIMARY]   = 0;
+    m_NumUsedBuffers[VK_COMMAND_BUFFER_LEVEL_SECONDARY] = 0;
     return std::move(m_CmdPool);
 }
 
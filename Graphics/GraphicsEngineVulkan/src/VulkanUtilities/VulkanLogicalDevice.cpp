@@ -26,6 +26,7 @@
  */
 
 #include <limits>
+#include <cstring>
 #include "VulkanErrors.hpp"
 #include "VulkanUtilities/VulkanLogicalDevice.hpp"
 #include "VulkanUtilities/VulkanDebug.hpp"
@@ -62,6 +63,37 @@ VulkanLogicalDevice::VulkanLogicalDevice(VkPhysicalDevice             vkPhysical
     volkLoadDevice(m_VkDevice);
 #endif
 
+    for (uint32_t ext = 0; ext < DeviceCI.enabledExtensionCount; ++ext)
+    {
+        if (strcmp(DeviceCI.ppEnabledExtensionNames[ext], VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME) == 0)
+        {
+            // Extension entry points are not exported by the loader and must always be queried
+            m_vkCreateDescriptorUpdateTemplate  = reinterpret_cast<PFN_vkCreateDescriptorUpdateTemplateKHR>(vkGetDeviceProcAddr(m_VkDevice, "vkCreateDescriptorUpdateTemplateKHR"));
+            m_vkDestroyDescriptorUpdateTemplate = reinterpret_cast<PFN_vkDestroyDescriptorUpdateTemplateKHR>(vkGetDeviceProcAddr(m_VkDevice, "vkDestroyDescriptorUpdateTemplateKHR"));
+            m_vkUpdateDescriptorSetWithTemplate = reinterpret_cast<PFN_vkUpdateDescriptorSetWithTemplateKHR>(vkGetDeviceProcAddr(m_VkDevice, "vkUpdateDescriptorSetWithTemplateKHR"));
+            if (m_vkCreateDescriptorUpdateTemplate == nullptr || m_vkDestroyDescriptorUpdateTemplate == nullptr || m_vkUpdateDescriptorSetWithTemplate == nullptr)
+            {
+                LOG_WARNING_MESSAGE("Failed to load VK_KHR_descriptor_update_template entry points. Descriptor update templates will not be used.");
+                m_vkCreateDescriptorUpdateTemplate  = nullptr;
+                m_vkDestroyDescriptorUpdateTemplate = nullptr;
+                m_vkUpdateDescriptorSetWithTemplate = nullptr;
+            }
+        }
+        else if (strcmp(DeviceCI.ppEnabledExtensionNames[ext], VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME) == 0)
+        {
+            m_vkGetSemaphoreCounterValue = reinterpret_cast<PFN_vkGetSemaphoreCounterValueKHR>(vkGetDeviceProcAddr(m_VkDevice, "vkGetSemaphoreCounterValueKHR"));
+            m_vkWaitSemaphores           = reinterpret_cast<PFN_vkWaitSemaphoresKHR>(vkGetDeviceProcAddr(m_VkDevice, "vkWaitSemaphoresKHR"));
+            m_vkSignalSemaphore          = reinterpret_cast<PFN_vkSignalSemaphoreKHR>(vkGetDeviceProcAddr(m_VkDevice, "vkSignalSemaphoreKHR"));
+            if (m_vkGetSemaphoreCounterValue == nullptr || m_vkWaitSemaphores == nullptr || m_vkSignalSemaphore == nullptr)
+            {
+                LOG_WARNING_MESSAGE("Failed to load VK_KHR_timeline_semaphore entry points. Command queues will use fences to track completion.");
+                m_vkGetSemaphoreCounterValue = nullptr;
+                m_vkWaitSemaphores           = nullptr;
+                m_vkSignalSemaphore          = nullptr;
+            }
+        }
+    }
+
     m_EnabledGraphicsShaderStages = VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
     if (DeviceCI.pEnabledFeatures->geometryShader)
         m_EnabledGraphicsShaderStages |= VK_PIPELINE_STAGE_GEOMETRY_SHADER_BIT;
@@ -264,6 +296,19 @@ QueryPoolWrapper VulkanLogicalDevice::CreateQueryPool(const VkQueryPoolCreateInf
     return CreateVulkanObject<VkQueryPool, VulkanHandleTypeId::QueryPool>(vkCreateQueryPool, QueryPoolCI, DebugName, "query pool");
 }
 
+PipelineCacheWrapper VulkanLogicalDevice::CreatePipelineCache(const VkPipelineCacheCreateInfo& PipelineCacheCI, const char* DebugName) const
+{
+    VERIFY_EXPR(PipelineCacheCI.sType == VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO);
+    return CreateVulkanObject<VkPipelineCache, VulkanHandleTypeId::PipelineCache>(vkCreatePipelineCache, PipelineCacheCI, DebugName, "pipeline cache");
+}
+
+DescriptorUpdateTemplateWrapper VulkanLogicalDevice::CreateDescriptorUpdateTemplate(const VkDescriptorUpdateTemplateCreateInfoKHR& TemplateCI, const char* DebugName) const
+{
+    VERIFY_EXPR(TemplateCI.sType == VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO_KHR);
+    VERIFY(m_vkCreateDescriptorUpdateTemplate != nullptr, "VK_KHR_descriptor_update_template extension is not enabled");
+    return CreateVulkanObject<VkDescriptorUpdateTemplateKHR, VulkanHandleTypeId::DescriptorUpdateTemplate>(m_vkCreateDescriptorUpdateTemplate, TemplateCI, DebugName, "descriptor update template");
+}
+
 VkCommandBuffer VulkanLogicalDevice::AllocateVkCommandBuffer(const VkCommandBufferAllocateInfo& AllocInfo, const char* DebugName) const
 {
     VERIFY_EXPR(AllocInfo.sType == VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO);
@@ -405,6 +450,19 @@ void VulkanLogicalDevice::ReleaseVulkanObject(QueryPoolWrapper&& QueryPool) cons
     QueryPool.m_VkObject = VK_NULL_HANDLE;
 }
 
+void VulkanLogicalDevice::ReleaseVulkanObject(PipelineCacheWrapper&& PipelineCache) const
+{
+    vkDestroyPipelineCache(m_VkDevice, PipelineCache.m_VkObject, m_VkAllocator);
+    PipelineCache.m_VkObject = VK_NULL_HANDLE;
+}
+
+void VulkanLogicalDevice::ReleaseVulkanObject(DescriptorUpdateTemplateWrapper&& DescriptorUpdateTemplate) const
+{
+    VERIFY(m_vkDestroyDescriptorUpdateTemplate != nullptr, "VK_KHR_descriptor_update_template extension is not enabled");
+    m_vkDestroyDescriptorUpdateTemplate(m_VkDevice, DescriptorUpdateTemplate.m_VkObject, m_VkAllocator);
+    DescriptorUpdateTemplate.m_VkObject = VK_NULL_HANDLE;
+}
+
 void VulkanLogicalDevice::FreeDescriptorSet(VkDescriptorPool Pool, VkDescriptorSet Set) const
 {
     VERIFY_EXPR(Pool != VK_NULL_HANDLE && Set != VK_NULL_HANDLE);
@@ -486,6 +544,47 @@ void VulkanLogicalDevice::UpdateDescriptorSets(uint32_t                    descr
     vkUpdateDescriptorSets(m_VkDevice, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
 }
 
+void VulkanLogicalDevice::UpdateDescriptorSetWithTemplate(VkDescriptorSet               descriptorSet,
+                                                          VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate,
+                                                          const void*                   pData) const
+{
+    VERIFY(m_vkUpdateDescriptorSetWithTemplate != nullptr, "VK_KHR_descriptor_update_template extension is not enabled");
+    m_vkUpdateDescriptorSetWithTemplate(m_VkDevice, descriptorSet, descriptorUpdateTemplate, pData);
+}
+
+VkResult VulkanLogicalDevice::GetSemaphoreCounterValue(VkSemaphore semaphore, uint64_t* pValue) const
+{
+    VERIFY(m_vkGetSemaphoreCounterValue != nullptr, "VK_KHR_timeline_semaphore extension is not enabled");
+    auto err = m_vkGetSemaphoreCounterValue(m_VkDevice, semaphore, pValue);
+    DEV_CHECK_ERR(err == VK_SUCCESS, "vkGetSemaphoreCounterValueKHR() failed");
+    return err;
+}
+
+VkResult VulkanLogicalDevice::WaitSemaphore(VkSemaphore semaphore, uint64_t value, uint64_t timeout) const
+{
+    VERIFY(m_vkWaitSemaphores != nullptr, "VK_KHR_timeline_semaphore extension is not enabled");
+
+    VkSemaphoreWaitInfoKHR WaitInfo = {};
+    WaitInfo.sType                  = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+    WaitInfo.semaphoreCount         = 1;
+    WaitInfo.pSemaphores            = &semaphore;
+    WaitInfo.pValues                = &value;
+    return m_vkWaitSemaphores(m_VkDevice, &WaitInfo, timeout);
+}
+
+VkResult VulkanLogicalDevice::SignalSemaphore(VkSemaphore semaphore, uint64_t value) const
+{
+    VERIFY(m_vkSignalSemaphore != nullptr, "VK_KHR_timeline_semaphore extension is not enabled");
+
+    VkSemaphoreSignalInfoKHR SignalInfo = {};
+    SignalInfo.sType                    = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO_KHR;
+    SignalInfo.semaphore                = semaphore;
+    SignalInfo.value                    = value;
+    auto err                            = m_vkSignalSemaphore(m_VkDevice, &SignalInfo);
+    DEV_CHECK_ERR(err == VK_SUCCESS, "vkSignalSemaphoreKHR() failed");
+    return err;
+}
+
 VkResult VulkanLogicalDevice::ResetCommandPool(VkCommandPool           vkCmdPool,
                                                VkCommandPoolResetFlags flags) const
 {
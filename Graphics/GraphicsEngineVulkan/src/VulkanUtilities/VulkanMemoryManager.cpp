@@ -43,16 +43,19 @@ VulkanMemoryAllocation::~VulkanMemoryAllocation()
 VulkanMemoryPage::VulkanMemoryPage(VulkanMemoryManager& ParentMemoryMgr,
                                    VkDeviceSize         PageSize,
                                    uint32_t             MemoryTypeIndex,
-                                   bool                 IsHostVisible) noexcept :
-    // clang-format off
-    m_ParentMemoryMgr{ParentMemoryMgr},
-    m_AllocationMgr  {static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator}
-// clang-format on
+                                   bool                 IsHostVisible,
+                                   bool                 UseTLSFAllocator) noexcept :
+    m_ParentMemoryMgr{ParentMemoryMgr}
 {
     VERIFY(PageSize <= std::numeric_limits<AllocationsMgrOffsetType>::max(),
            "PageSize (", PageSize, ") exceeds maximum allowed value ",
            std::numeric_limits<AllocationsMgrOffsetType>::max());
 
+    if (UseTLSFAllocator)
+        m_TLSFAllocationMgr.reset(new Diligent::TLSFAllocationsManager{static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator});
+    else
+        m_ListAllocationMgr.reset(new Diligent::VariableSizeAllocationsManager{static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator});
+
     VkMemoryAllocateInfo MemAlloc = {};
 
     MemAlloc.pNext           = nullptr;
@@ -83,7 +86,8 @@ VulkanMemoryPage::~VulkanMemoryPage()
         m_ParentMemoryMgr.m_LogicalDevice.UnmapMemory(m_VkMemory);
     }
 
-    VERIFY(IsEmpty(), "Destroying a page with not all allocations released");
+    // Both managers are null in a page that has been moved from
+    VERIFY((!m_ListAllocationMgr && !m_TLSFAllocationMgr) || IsEmpty(), "Destroying a page with not all allocations released");
 }
 
 VulkanMemoryAllocation VulkanMemoryPage::Allocate(VkDeviceSize size, VkDeviceSize alignment)
@@ -92,7 +96,9 @@ VulkanMemoryAllocation VulkanMemoryPage::Allocate(VkDeviceSize size, VkDeviceSiz
     VERIFY(size <= std::numeric_limits<AllocationsMgrOffsetType>::max(),
            "Allocation size (", size, ") exceeds maximum allowed value ",
            std::numeric_limits<AllocationsMgrOffsetType>::max());
-    auto Allocation = m_AllocationMgr.Allocate(static_cast<AllocationsMgrOffsetType>(size), static_cast<AllocationsMgrOffsetType>(alignment));
+    auto Allocation = m_TLSFAllocationMgr ?
+        m_TLSFAllocationMgr->Allocate(static_cast<AllocationsMgrOffsetType>(size), static_cast<AllocationsMgrOffsetType>(alignment)) :
+        m_ListAllocationMgr->Allocate(static_cast<AllocationsMgrOffsetType>(size), static_cast<AllocationsMgrOffsetType>(alignment));
     if (Allocation.IsValid())
     {
         // Offset may not necessarily be aligned, but the allocation is guaranteed to be large enough
@@ -112,7 +118,10 @@ void VulkanMemoryPage::Free(VulkanMemoryAllocation&& Allocation)
     std::lock_guard<std::mutex> Lock{m_Mutex};
     VERIFY_EXPR(Allocation.UnalignedOffset <= std::numeric_limits<AllocationsMgrOffsetType>::max());
     VERIFY_EXPR(Allocation.Size <= std::numeric_limits<AllocationsMgrOffsetType>::max());
-    m_AllocationMgr.Free(static_cast<AllocationsMgrOffsetType>(Allocation.UnalignedOffset), static_cast<AllocationsMgrOffsetType>(Allocation.Size));
+    if (m_TLSFAllocationMgr)
+        m_TLSFAllocationMgr->Free(static_cast<AllocationsMgrOffsetType>(Allocation.UnalignedOffset), static_cast<AllocationsMgrOffsetType>(Allocation.Size));
+    else
+        m_ListAllocationMgr->Free(static_cast<AllocationsMgrOffsetType>(Allocation.UnalignedOffset), static_cast<AllocationsMgrOffsetType>(Allocation.Size));
     Allocation = VulkanMemoryAllocation{};
 }
 
@@ -180,7 +189,7 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDevice
         m_CurrAllocatedSize[stat_ind] += PageSize;
         m_PeakAllocatedSize[stat_ind] = std::max(m_PeakAllocatedSize[stat_ind], m_CurrAllocatedSize[stat_ind]);
 
-        auto it = m_Pages.emplace(PageIdx, VulkanMemoryPage{*this, PageSize, MemoryTypeIndex, HostVisible});
+        auto it = m_Pages.emplace(PageIdx, VulkanMemoryPage{*this, PageSize, MemoryTypeIndex, HostVisible, m_UseTLSFAllocator});
         LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': created new ", (HostVisible ? "host-visible" : "device-local"),
                          " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", MemoryTypeIndex,
                          "). Current allocated size: ", Diligent::FormatMemorySize(m_CurrAllocatedSize[stat_ind], 2));
@@ -112,6 +112,14 @@ VulkanPhysicalDevice::VulkanPhysicalDevice(VkPhysicalDevice      vkDevice,
             m_ExtFeatures.MeshShader.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_NV;
         }
 
+        if (IsExtensionSupported(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.TimelineSemaphore;
+            NextFeat  = &m_ExtFeatures.TimelineSemaphore.pNext;
+
+            m_ExtFeatures.TimelineSemaphore.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+        }
+
         *NextFeat = nullptr;
 
         // Initialize device extension features by current physical device features.
@@ -40,6 +40,10 @@ namespace GLSLangUtils
 void InitializeGlslang();
 void FinalizeGlslang();
 
+// Returns the string that identifies the versions of glslang and SPIRV-Tools
+// the engine was built with
+const char* GetCompilerVersionString();
+
 std::vector<unsigned int> GLSLtoSPIRV(SHADER_TYPE                      ShaderType,
                                       const char*                      ShaderSource,
                                       int                              SourceCodeLen,
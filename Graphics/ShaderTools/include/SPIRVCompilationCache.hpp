@@ -0,0 +1,171 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Content-addressed cache of compiled SPIR-V bytecode
+
+#include <vector>
+#include <list>
+#include <string>
+#include <mutex>
+#include <unordered_map>
+
+#include "Shader.h"
+
+namespace Diligent
+{
+
+/// Caches SPIR-V bytecode produced by the shader compilers.
+
+/// The cache is addressed by a 128-bit hash of everything that affects the compiler output:
+/// the full shader source including all files it includes, shader macros, entry point, shader type,
+/// source language, compiler and compiler version. The cache has two tiers:
+/// an in-memory LRU tier limited by the total size of the cached bytecode, and an optional
+/// on-disk tier that stores every bytecode blob in a separate file in the cache directory.
+/// All methods are thread-safe.
+class SPIRVCompilationCache
+{
+public:
+    struct Key
+    {
+        Uint64 Hash[2] = {};
+
+        bool operator==(const Key& rhs) const
+        {
+            return Hash[0] == rhs.Hash[0] && Hash[1] == rhs.Hash[1];
+        }
+
+        /// Returns the 32-character hexadecimal representation of the key
+        std::string ToString() const;
+
+        struct Hasher
+        {
+            size_t operator()(const Key& k) const
+            {
+                return static_cast<size_t>(k.Hash[0]);
+            }
+        };
+    };
+
+    struct KeyAttribs
+    {
+        /// Shader source code. If FilePath is not null, the source is loaded from the stream factory.
+        const Char* Source       = nullptr;
+        size_t      SourceLength = 0;
+        const Char* FilePath     = nullptr;
+
+        /// Stream factory that is used to load the source file as well as all files it includes
+        IShaderSourceInputStreamFactory* pShaderSourceStreamFactory = nullptr;
+
+        const ShaderMacro*     Macros           = nullptr;
+        const Char*            EntryPoint       = nullptr;
+        const Char*            ExtraDefinitions = nullptr;
+        SHADER_TYPE            ShaderType       = SHADER_TYPE_UNKNOWN;
+        SHADER_SOURCE_LANGUAGE SourceLanguage   = SHADER_SOURCE_LANGUAGE_DEFAULT;
+        SHADER_COMPILER        ShaderCompiler   = SHADER_COMPILER_DEFAULT;
+
+        /// Compiler version, e.g. the maximum shader model supported by DXC
+        Uint32 CompilerVersion = 0;
+
+        /// Optional string that identifies the compiler build, e.g. the glslang version string
+        const Char* CompilerVersionString = nullptr;
+    };
+
+    /// Computes the cache key.
+
+    /// All files referenced by #include directives are recursively loaded through the stream factory
+    /// and hashed together with the main source. Preprocessor conditions are not evaluated, so a file
+    /// that is included under a disabled branch still contributes to the key. This may only cause
+    /// spurious cache misses, but never returns stale bytecode.
+    static Key ComputeKey(const KeyAttribs& Attribs) noexcept(false);
+
+    /// Version of the cache format and of the compilation pipeline. Increment this value whenever
+    /// the compiler, the optimization passes, or the set of engine-defined macros changes.
+    static constexpr Uint32 Version = 1;
+
+    /// \param [in] MaxMemoryCacheSize - Maximum total size, in bytes, of the bytecode kept in the memory tier.
+    ///                                  Zero disables the memory tier.
+    /// \param [in] DiskCacheDirectory - Optional directory for the on-disk tier. If null or empty,
+    ///                                  the on-disk tier is disabled. The directory is created if it does not exist.
+    SPIRVCompilationCache(size_t MaxMemoryCacheSize, const Char* DiskCacheDirectory = nullptr);
+
+    // clang-format off
+    SPIRVCompilationCache           (const SPIRVCompilationCache&)  = delete;
+    SPIRVCompilationCache           (      SPIRVCompilationCache&&) = delete;
+    SPIRVCompilationCache& operator=(const SPIRVCompilationCache&)  = delete;
+    SPIRVCompilationCache& operator=(      SPIRVCompilationCache&&) = delete;
+    // clang-format on
+
+    /// Looks up the bytecode in the memory tier and then in the disk tier.
+    /// Bytecode found on disk is promoted to the memory tier.
+    bool Find(const Key& CacheKey, std::vector<uint32_t>& SPIRV);
+
+    /// Adds the bytecode to the memory tier and writes it to the disk tier.
+    void Add(const Key& CacheKey, const std::vector<uint32_t>& SPIRV);
+
+    struct Statistics
+    {
+        Uint32 MemoryHits = 0;
+        Uint32 DiskHits   = 0;
+        Uint32 Misses     = 0;
+        Uint32 Evictions  = 0;
+        Uint32 NumEntries = 0;
+        size_t MemorySize = 0;
+    };
+    Statistics GetStatistics() const;
+
+    bool IsDiskCacheEnabled() const { return !m_DiskCacheDirectory.empty(); }
+
+private:
+    std::string GetDiskCachePath(const Key& CacheKey) const;
+
+    bool ReadFromDisk(const Key& CacheKey, std::vector<uint32_t>& SPIRV) const;
+    void WriteToDisk(const Key& CacheKey, const std::vector<uint32_t>& SPIRV) const;
+
+    // Requires m_Mtx to be locked
+    void AddToMemoryCache(const Key& CacheKey, const std::vector<uint32_t>& SPIRV);
+
+    const size_t m_MaxMemoryCacheSize;
+    std::string  m_DiskCacheDirectory;
+
+    struct Entry
+    {
+        Key                   CacheKey;
+        std::vector<uint32_t> SPIRV;
+    };
+    // Most recently used entries are at the front of the list
+    using LRUListType = std::list<Entry>;
+
+    mutable std::mutex                                          m_Mtx;
+    LRUListType                                                 m_LRUList;
+    std::unordered_map<Key, LRUListType::iterator, Key::Hasher> m_Map;
+    Statistics                                                  m_Stats;
+};
+
+} // namespace Diligent
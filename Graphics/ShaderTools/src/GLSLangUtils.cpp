@@ -68,6 +68,14 @@ void FinalizeGlslang()
     ::glslang::FinalizeProcess();
 }
 
+const char* GetCompilerVersionString()
+{
+    // Both strings contain the revision of the respective library, so the bytecode
+    // compiled by one build is not mistaken for the output of another.
+    static const std::string VersionString = std::string{::glslang::GetGlslVersionString()} + "; " + spvSoftwareVersionDetailsString();
+    return VersionString.c_str();
+}
+
 static EShLanguage ShaderTypeToShLanguage(SHADER_TYPE ShaderType)
 {
     static_assert(SHADER_TYPE_LAST == 0x080, "Please handle the new shader type in the switch below");
@@ -0,0 +1,412 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <unordered_set>
+#include <atomic>
+#include <random>
+#include <string>
+
+#include "SPIRVCompilationCache.hpp"
+#include "ShaderToolsCommon.hpp"
+#include "HashUtils.hpp"
+#include "FileWrapper.hpp"
+#include "DataBlobImpl.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Seeds of the two halves of the 128-bit key
+constexpr Uint64 KeySeed0 = 0;
+constexpr Uint64 KeySeed1 = 0x9E3779B97F4A7C15ull;
+
+constexpr Uint32 MaxIncludeDepth = 64;
+
+struct DiskCacheFileHeader
+{
+    static constexpr Uint32 ExpectedMagic = 0x43565053; // 'SPVC'
+
+    Uint32 Magic;
+    Uint32 Version;
+    Uint64 Key[2];
+    Uint64 Size;     // Bytecode size, in bytes
+    Uint64 Checksum; // Hash of the bytecode
+};
+
+// Appends the value as a length-prefixed string so that the
+// boundaries between the key components are unambiguous
+void AppendKeyString(std::string& KeyData, const char* Str, size_t Len)
+{
+    const Uint64 Len64 = Len;
+    KeyData.append(reinterpret_cast<const char*>(&Len64), sizeof(Len64));
+    if (Len > 0)
+        KeyData.append(Str, Len);
+}
+
+void AppendKeyString(std::string& KeyData, const char* Str)
+{
+    AppendKeyString(KeyData, Str, Str != nullptr ? strlen(Str) : 0);
+}
+
+template <typename T>
+void AppendKeyValue(std::string& KeyData, const T& Val)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be appended");
+    KeyData.append(reinterpret_cast<const char*>(&Val), sizeof(Val));
+}
+
+// Recursively appends the names and the contents of all files referenced by
+// #include directives in the source.
+void AppendIncludedFiles(std::string&                     KeyData,
+                         const char*                      Source,
+                         size_t                           SourceLength,
+                         IShaderSourceInputStreamFactory* pStreamFactory,
+                         std::unordered_set<std::string>& ProcessedFiles,
+                         Uint32                           Depth)
+{
+    if (Depth >= MaxIncludeDepth)
+    {
+        LOG_WARNING_MESSAGE("Maximum include depth (", MaxIncludeDepth, ") has been exceeded while computing SPIR-V cache key");
+        return;
+    }
+
+    static constexpr char   IncludeDirective[]  = "include";
+    static constexpr size_t IncludeDirectiveLen = sizeof(IncludeDirective) - 1;
+
+    const char* const End = Source + SourceLength;
+    for (const char* c = Source; c < End; ++c)
+    {
+        if (*c != '#')
+            continue;
+
+        ++c;
+        while (c < End && (*c == ' ' || *c == '\t'))
+            ++c;
+        if (End - c < static_cast<ptrdiff_t>(IncludeDirectiveLen) || strncmp(c, IncludeDirective, IncludeDirectiveLen) != 0)
+            continue;
+
+        c += IncludeDirectiveLen;
+        while (c < End && (*c == ' ' || *c == '\t'))
+            ++c;
+        if (c == End || (*c != '"' && *c != '<'))
+            continue;
+
+        const char  ClosingQuote = *c == '"' ? '"' : '>';
+        const char* NameStart    = ++c;
+        while (c < End && *c != ClosingQuote && *c != '\n')
+            ++c;
+        if (c == End || *c != ClosingQuote)
+            continue;
+
+        std::string IncludeName{NameStart, c};
+        if (!ProcessedFiles.insert(IncludeName).second)
+            continue;
+
+        AppendKeyString(KeyData, IncludeName.c_str(), IncludeName.length());
+
+        RefCntAutoPtr<IFileStream> pSourceStream;
+        if (pStreamFactory != nullptr)
+            pStreamFactory->CreateInputStream2(IncludeName.c_str(), CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT, &pSourceStream);
+        if (pSourceStream == nullptr)
+        {
+            // The file may be included under a disabled preprocessor branch.
+            // If it is not, the compiler will report the error.
+            AppendKeyString(KeyData, nullptr, 0);
+            continue;
+        }
+
+        RefCntAutoPtr<IDataBlob> pFileData{MakeNewRCObj<DataBlobImpl>{}(0)};
+        pSourceStream->ReadBlob(pFileData);
+
+        const auto* IncludeSource = reinterpret_cast<const char*>(pFileData->GetDataPtr());
+        const auto  IncludeLength = pFileData->GetSize();
+        AppendKeyString(KeyData, IncludeSource, IncludeLength);
+        AppendIncludedFiles(KeyData, IncludeSource, IncludeLength, pStreamFactory, ProcessedFiles, Depth + 1);
+    }
+}
+
+} // namespace
+
+constexpr Uint32 SPIRVCompilationCache::Version;
+
+std::string SPIRVCompilationCache::Key::ToString() const
+{
+    char Str[33];
+    snprintf(Str, sizeof(Str), "%016llx%016llx",
+             static_cast<unsigned long long>(Hash[0]),
+             static_cast<unsigned long long>(Hash[1]));
+    return Str;
+}
+
+SPIRVCompilationCache::Key SPIRVCompilationCache::ComputeKey(const KeyAttribs& Attribs) noexcept(false)
+{
+    RefCntAutoPtr<IDataBlob> pFileData;
+
+    const char* Source       = Attribs.Source;
+    size_t      SourceLength = Attribs.SourceLength;
+    if (Source == nullptr)
+    {
+        Source = ReadShaderSourceFile(nullptr, Attribs.pShaderSourceStreamFactory, Attribs.FilePath, pFileData, SourceLength);
+    }
+    else if (SourceLength == 0)
+    {
+        SourceLength = strlen(Source);
+    }
+
+    std::string KeyData;
+    KeyData.reserve(SourceLength + 256);
+
+    AppendKeyValue(KeyData, Version);
+    AppendKeyValue(KeyData, Attribs.CompilerVersion);
+    AppendKeyString(KeyData, Attribs.CompilerVersionString);
+    AppendKeyValue(KeyData, static_cast<Uint32>(Attribs.ShaderType));
+    AppendKeyValue(KeyData, static_cast<Uint32>(Attribs.SourceLanguage));
+    AppendKeyValue(KeyData, static_cast<Uint32>(Attribs.ShaderCompiler));
+    AppendKeyString(KeyData, Attribs.EntryPoint);
+    AppendKeyString(KeyData, Attribs.ExtraDefinitions);
+
+    if (Attribs.Macros != nullptr)
+    {
+        for (const auto* pMacro = Attribs.Macros; pMacro->Name != nullptr && pMacro->Definition != nullptr; ++pMacro)
+        {
+            AppendKeyString(KeyData, pMacro->Name);
+            AppendKeyString(KeyData, pMacro->Definition);
+        }
+    }
+    // Terminate the macro list
+    AppendKeyString(KeyData, nullptr, 0);
+
+    AppendKeyString(KeyData, Source, SourceLength);
+
+    std::unordered_set<std::string> ProcessedFiles;
+    AppendIncludedFiles(KeyData, Source, SourceLength, Attribs.pShaderSourceStreamFactory, ProcessedFiles, 0);
+
+    Key CacheKey;
+    CacheKey.Hash[0] = ComputeHashRaw(KeyData.data(), KeyData.size(), KeySeed0);
+    CacheKey.Hash[1] = ComputeHashRaw(KeyData.data(), KeyData.size(), KeySeed1);
+    return CacheKey;
+}
+
+SPIRVCompilationCache::SPIRVCompilationCache(size_t MaxMemoryCacheSize, const Char* DiskCacheDirectory) :
+    m_MaxMemoryCacheSize{MaxMemoryCacheSize}
+{
+    if (DiskCacheDirectory != nullptr && *DiskCacheDirectory != '\0')
+    {
+        m_DiskCacheDirectory = DiskCacheDirectory;
+        FileSystem::CorrectSlashes(m_DiskCacheDirectory, FileSystem::GetSlashSymbol());
+        if (!FileSystem::PathExists(m_DiskCacheDirectory.c_str()) && !FileSystem::CreateDirectory(m_DiskCacheDirectory.c_str()))
+        {
+            LOG_WARNING_MESSAGE("Failed to create SPIR-V cache directory '", m_DiskCacheDirectory, "'. On-disk cache will be disabled.");
+            m_DiskCacheDirectory.clear();
+        }
+        else if (m_DiskCacheDirectory.back() != FileSystem::GetSlashSymbol())
+        {
+            m_DiskCacheDirectory.push_back(FileSystem::GetSlashSymbol());
+        }
+    }
+}
+
+bool SPIRVCompilationCache::Find(const Key& CacheKey, std::vector<uint32_t>& SPIRV)
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        auto it = m_Map.find(CacheKey);
+        if (it != m_Map.end())
+        {
+            // Move the entry to the front of the LRU list
+            m_LRUList.splice(m_LRUList.begin(), m_LRUList, it->second);
+            SPIRV = it->second->SPIRV;
+            ++m_Stats.MemoryHits;
+            return true;
+        }
+    }
+
+    // Read the file outside of the lock
+    if (IsDiskCacheEnabled() && ReadFromDisk(CacheKey, SPIRV))
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        ++m_Stats.DiskHits;
+        AddToMemoryCache(CacheKey, SPIRV);
+        return true;
+    }
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    ++m_Stats.Misses;
+    return false;
+}
+
+void SPIRVCompilationCache::Add(const Key& CacheKey, const std::vector<uint32_t>& SPIRV)
+{
+    if (SPIRV.empty())
+        return;
+
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        AddToMemoryCache(CacheKey, SPIRV);
+    }
+
+    if (IsDiskCacheEnabled())
+        WriteToDisk(CacheKey, SPIRV);
+}
+
+void SPIRVCompilationCache::AddToMemoryCache(const Key& CacheKey, const std::vector<uint32_t>& SPIRV)
+{
+    const size_t Size = SPIRV.size() * sizeof(uint32_t);
+    if (Size > m_MaxMemoryCacheSize)
+        return;
+
+    auto it = m_Map.find(CacheKey);
+    if (it != m_Map.end())
+    {
+        // Another thread has added the same bytecode
+        m_LRUList.splice(m_LRUList.begin(), m_LRUList, it->second);
+        return;
+    }
+
+    // Evict least recently used entries
+    while (m_Stats.MemorySize + Size > m_MaxMemoryCacheSize)
+    {
+        VERIFY_EXPR(!m_LRUList.empty());
+        auto& LastEntry = m_LRUList.back();
+        m_Stats.MemorySize -= LastEntry.SPIRV.size() * sizeof(uint32_t);
+        m_Map.erase(LastEntry.CacheKey);
+        m_LRUList.pop_back();
+        ++m_Stats.Evictions;
+    }
+
+    m_LRUList.emplace_front(Entry{CacheKey, SPIRV});
+    m_Map.emplace(CacheKey, m_LRUList.begin());
+    m_Stats.MemorySize += Size;
+}
+
+SPIRVCompilationCache::Statistics SPIRVCompilationCache::GetStatistics() const
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    auto Stats       = m_Stats;
+    Stats.NumEntries = static_cast<Uint32>(m_Map.size());
+    return Stats;
+}
+
+std::string SPIRVCompilationCache::GetDiskCachePath(const Key& CacheKey) const
+{
+    return m_DiskCacheDirectory + CacheKey.ToString() + ".spv";
+}
+
+bool SPIRVCompilationCache::ReadFromDisk(const Key& CacheKey, std::vector<uint32_t>& SPIRV) const
+{
+    const auto Path = GetDiskCachePath(CacheKey);
+    if (!FileSystem::FileExists(Path.c_str()))
+        return false;
+
+    FileWrapper File{Path.c_str(), EFileAccessMode::Read};
+    if (!File)
+        return false;
+
+    const auto FileSize = File->GetSize();
+
+    DiskCacheFileHeader Header;
+    if (FileSize < sizeof(Header) || !File->Read(&Header, sizeof(Header)))
+        return false;
+
+    if (Header.Magic != DiskCacheFileHeader::ExpectedMagic ||
+        Header.Version != Version ||
+        Header.Key[0] != CacheKey.Hash[0] ||
+        Header.Key[1] != CacheKey.Hash[1] ||
+        Header.Size == 0 ||
+        Header.Size % sizeof(uint32_t) != 0 ||
+        Header.Size != FileSize - sizeof(Header))
+    {
+        LOG_WARNING_MESSAGE("SPIR-V cache file '", Path, "' is invalid and will be ignored");
+        return false;
+    }
+
+    std::vector<uint32_t> Bytecode(static_cast<size_t>(Header.Size / sizeof(uint32_t)));
+    if (!File->Read(Bytecode.data(), static_cast<size_t>(Header.Size)) ||
+        ComputeHashRaw(Bytecode.data(), static_cast<size_t>(Header.Size)) != Header.Checksum)
+    {
+        LOG_WARNING_MESSAGE("SPIR-V cache file '", Path, "' is corrupted and will be ignored");
+        return false;
+    }
+
+    SPIRV = std::move(Bytecode);
+    return true;
+}
+
+void SPIRVCompilationCache::WriteToDisk(const Key& CacheKey, const std::vector<uint32_t>& SPIRV) const
+{
+    const auto Path = GetDiskCachePath(CacheKey);
+
+    DiskCacheFileHeader Header;
+    Header.Magic    = DiskCacheFileHeader::ExpectedMagic;
+    Header.Version  = Version;
+    Header.Key[0]   = CacheKey.Hash[0];
+    Header.Key[1]   = CacheKey.Hash[1];
+    Header.Size     = SPIRV.size() * sizeof(uint32_t);
+    Header.Checksum = ComputeHashRaw(SPIRV.data(), SPIRV.size() * sizeof(uint32_t));
+
+    // Write the data to a temporary file first and then rename it so that
+    // other processes never observe a partially written file.
+    // Every write uses its own temporary file, so that threads and processes that write
+    // the same entry concurrently never write to the same file: the process tag tells
+    // processes apart and the counter tells writes within the process apart.
+    static const auto          ProcessTag = std::random_device{}();
+    static std::atomic<Uint32> TmpFileCounter{0};
+
+    const auto TmpPath = Path + '.' + std::to_string(ProcessTag) + '.' + std::to_string(TmpFileCounter.fetch_add(1)) + ".tmp";
+    {
+        FileWrapper File{TmpPath.c_str(), EFileAccessMode::Overwrite};
+        if (!File)
+        {
+            LOG_WARNING_MESSAGE("Failed to create SPIR-V cache file '", TmpPath, '\'');
+            return;
+        }
+
+        if (!File->Write(&Header, sizeof(Header)) ||
+            !File->Write(SPIRV.data(), SPIRV.size() * sizeof(uint32_t)))
+        {
+            LOG_WARNING_MESSAGE("Failed to write SPIR-V cache file '", TmpPath, '\'');
+            File.Close();
+            FileSystem::DeleteFile(TmpPath.c_str());
+            return;
+        }
+    }
+
+    if (std::rename(TmpPath.c_str(), Path.c_str()) != 0)
+    {
+        // The file may have already been written by another thread or process
+        FileSystem::DeleteFile(TmpPath.c_str());
+    }
+}
+
+} // namespace Diligent
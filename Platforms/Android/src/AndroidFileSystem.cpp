@@ -348,6 +348,11 @@ void AndroidFileSystem::DeleteFile(const Diligent::Char* strPath)
     UNSUPPORTED("Not implemented");
 }
 
+void AndroidFileSystem::DeleteDirectory(const Diligent::Char* strPath)
+{
+    UNSUPPORTED("Not implemented");
+}
+
 std::vector<std::unique_ptr<FindFileData>> AndroidFileSystem::Search(const Diligent::Char* SearchPattern)
 {
     UNSUPPORTED("Not implemented");
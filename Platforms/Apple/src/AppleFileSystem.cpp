@@ -139,6 +139,11 @@ void AppleFileSystem::DeleteFile(const Diligent::Char* strPath)
     remove(strPath);
 }
 
+void AppleFileSystem::DeleteDirectory(const Diligent::Char* strPath)
+{
+    UNSUPPORTED("Not implemented");
+}
+
 std::vector<std::unique_ptr<FindFileData>> AppleFileSystem::Search(const Diligent::Char* SearchPattern)
 {
     UNSUPPORTED("Not implemented");
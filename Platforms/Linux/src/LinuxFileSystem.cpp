@@ -25,6 +25,11 @@
 #include <unistd.h>
 #include <cstdio>
 
+#include <sys/stat.h>
+#include <ftw.h>
+#include <glob.h>
+#include <errno.h>
+
 #include "LinuxFileSystem.hpp"
 #include "Errors.hpp"
 #include "DebugUtilities.hpp"
@@ -58,14 +63,32 @@ bool LinuxFileSystem::FileExists(const Diligent::Char* strFilePath)
 
 bool LinuxFileSystem::PathExists(const Diligent::Char* strPath)
 {
-    UNSUPPORTED("Not implemented");
-    return false;
+    struct stat StatBuff;
+    return stat(strPath, &StatBuff) == 0;
 }
 
 bool LinuxFileSystem::CreateDirectory(const Diligent::Char* strPath)
 {
-    UNSUPPORTED("Not implemented");
-    return false;
+    // Test all parent directories
+    std::string            DirectoryPath = strPath;
+    std::string::size_type SlashPos      = std::string::npos;
+    const auto             SlashSym      = LinuxFileSystem::GetSlashSymbol();
+    LinuxFileSystem::CorrectSlashes(DirectoryPath, SlashSym);
+
+    do
+    {
+        SlashPos = DirectoryPath.find(SlashSym, (SlashPos != std::string::npos) ? SlashPos + 1 : 0);
+
+        std::string ParentDir = (SlashPos != std::string::npos) ? DirectoryPath.substr(0, SlashPos) : DirectoryPath;
+        if (!ParentDir.empty() && !LinuxFileSystem::PathExists(ParentDir.c_str()))
+        {
+            // If there is no directory, create it
+            if (mkdir(ParentDir.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH) != 0 && errno != EEXIST)
+                return false;
+        }
+    } while (SlashPos != std::string::npos);
+
+    return true;
 }
 
 void LinuxFileSystem::ClearDirectory(const Diligent::Char* strPath)
@@ -78,8 +101,56 @@ void LinuxFileSystem::DeleteFile(const Diligent::Char* strPath)
     remove(strPath);
 }
 
+void LinuxFileSystem::DeleteDirectory(const Diligent::Char* strPath)
+{
+    // FTW_DEPTH visits the contents of a directory before the directory itself,
+    // FTW_PHYS removes symbolic links instead of following them
+    auto RemoveEntry = [](const char* Path, const struct stat*, int, struct FTW*) {
+        return remove(Path);
+    };
+    if (nftw(strPath, RemoveEntry, 16, FTW_DEPTH | FTW_PHYS) != 0)
+    {
+        LOG_ERROR_MESSAGE("Failed to remove directory '", strPath, "'. Error code: ", errno);
+    }
+}
+
+struct LinuxFindFileData : public FindFileData
+{
+    virtual const Diligent::Char* Name() const override { return FileName.c_str(); }
+
+    virtual bool IsDirectory() const override { return IsDir; }
+
+    std::string FileName;
+    bool        IsDir;
+
+    LinuxFindFileData(std::string _FileName, bool _IsDir) :
+        FileName{std::move(_FileName)},
+        IsDir{_IsDir}
+    {}
+};
+
 std::vector<std::unique_ptr<FindFileData>> LinuxFileSystem::Search(const Diligent::Char* SearchPattern)
 {
-    UNSUPPORTED("Not implemented");
-    return std::vector<std::unique_ptr<FindFileData>>();
+    std::vector<std::unique_ptr<FindFileData>> SearchRes;
+
+    glob_t GlobRes = {};
+    // GLOB_MARK appends a slash to the names of directories
+    if (glob(SearchPattern, GLOB_MARK, nullptr, &GlobRes) == 0)
+    {
+        for (size_t i = 0; i < GlobRes.gl_pathc; ++i)
+        {
+            std::string Path{GlobRes.gl_pathv[i]};
+
+            const bool IsDir = !Path.empty() && Path.back() == '/';
+            if (IsDir)
+                Path.pop_back();
+
+            // Similar to Windows, only the file name is returned
+            const auto SlashPos = Path.rfind('/');
+            SearchRes.emplace_back(new LinuxFindFileData{SlashPos != std::string::npos ? Path.substr(SlashPos + 1) : Path, IsDir});
+        }
+    }
+    globfree(&GlobRes);
+
+    return SearchRes;
 }
@@ -71,6 +71,7 @@ public:
     static bool CreateDirectory(const Diligent::Char* strPath);
     static void ClearDirectory(const Diligent::Char* strPath);
     static void DeleteFile(const Diligent::Char* strPath);
+    static void DeleteDirectory(const Diligent::Char* strPath);
 
     static std::vector<std::unique_ptr<FindFileData>> Search(const Diligent::Char* SearchPattern);
 };
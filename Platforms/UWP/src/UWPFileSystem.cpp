@@ -254,6 +254,11 @@ void WindowsStoreFileSystem::ClearDirectory(const Diligent::Char* strPath)
     UNSUPPORTED("Not implemented");
 }
 
+void WindowsStoreFileSystem::DeleteDirectory(const Diligent::Char* strPath)
+{
+    UNSUPPORTED("Not implemented");
+}
+
 
 bool CreateDirectoryImpl(const Diligent::Char* strPath)
 {
@@ -0,0 +1,57 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Defines Diligent::InternedString structure
+
+#include "BasicTypes.h"
+
+DILIGENT_BEGIN_NAMESPACE(Diligent)
+
+/// Handle to a string stored in an interning pool (see Diligent::InternedStringPool).
+
+/// Interned strings are never released, so the handle and the string pointer remain valid
+/// for the lifetime of the pool. Two handles obtained from the same pool for equal strings
+/// always reference the same memory, so they can be compared by pointer.
+struct InternedString
+{
+    /// Null-terminated string stored in the pool.
+    const Char* Str DEFAULT_INITIALIZER(nullptr);
+
+    /// Precomputed string hash. The hash is equal to the one computed by
+    /// Diligent::CStringHash for the same string.
+    size_t Hash DEFAULT_INITIALIZER(0);
+
+    /// String length, not including the terminating zero.
+    Uint32 Length DEFAULT_INITIALIZER(0);
+};
+typedef struct InternedString InternedString;
+
+DILIGENT_END_NAMESPACE // namespace Diligent
@@ -29,6 +29,7 @@
 
 #include <atomic>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "RenderDevice.h"
@@ -56,6 +57,8 @@ public:
         Uint32             AdapterId   = DEFAULT_ADAPTER_ID;
 
         bool ForceNonSeparablePrograms = false;
+
+        const char* GLProgramCacheDirectory = nullptr;
     };
     TestingEnvironment(const CreateInfo& CI, const SwapChainDesc& SCDesc);
 
@@ -95,8 +98,12 @@ public:
 
     IRenderDevice*  GetDevice() { return m_pDevice; }
     IDeviceContext* GetDeviceContext() { return m_pDeviceContext; }
+    Uint32          GetNumDeferredContexts() const { return static_cast<Uint32>(m_pDeferredContexts.size()); }
+    IDeviceContext* GetDeferredContext(Uint32 Ctx) { return m_pDeferredContexts[Ctx]; }
     ISwapChain*     GetSwapChain() { return m_pSwapChain; }
 
+    const std::string& GetGLProgramCacheDirectory() const { return m_GLProgramCacheDirectory; }
+
     static TestingEnvironment* GetInstance() { return m_pTheEnvironment; }
 
     RefCntAutoPtr<ITexture> CreateTexture(const char* Name, TEXTURE_FORMAT Fmt, BIND_FLAGS BindFlags, Uint32 Width, Uint32 Height);
@@ -120,6 +127,7 @@ protected:
                                Uint32                                  AdapterId);
 
     const RENDER_DEVICE_TYPE m_DeviceType;
+    const std::string        m_GLProgramCacheDirectory;
 
     // Any platform-specific data (e.g. window handle) that should
     // be cleaned-up when the testing environment object is destroyed.
@@ -131,10 +139,11 @@ protected:
 
     static TestingEnvironment* m_pTheEnvironment;
 
-    RefCntAutoPtr<IRenderDevice>  m_pDevice;
-    RefCntAutoPtr<IDeviceContext> m_pDeviceContext;
-    RefCntAutoPtr<ISwapChain>     m_pSwapChain;
-    SHADER_COMPILER               m_ShaderCompiler = SHADER_COMPILER_DEFAULT;
+    RefCntAutoPtr<IRenderDevice>               m_pDevice;
+    RefCntAutoPtr<IDeviceContext>              m_pDeviceContext;
+    std::vector<RefCntAutoPtr<IDeviceContext>> m_pDeferredContexts;
+    RefCntAutoPtr<ISwapChain>                  m_pSwapChain;
+    SHADER_COMPILER                            m_ShaderCompiler = SHADER_COMPILER_DEFAULT;
 
     static std::atomic_int m_NumAllowedErrors;
 };
@@ -0,0 +1,297 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+#include <thread>
+#include <algorithm>
+#include <vector>
+#include <string>
+
+#include "TestingEnvironment.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+static const char g_ShaderSource[] = R"(
+struct PSInput
+{
+    float4 Pos   : SV_POSITION;
+    float4 Color : COLOR;
+};
+
+void VSMain(in uint VertId : SV_VertexID, out PSInput PSIn)
+{
+    float4 Pos[3];
+    Pos[0] = float4(-1.0, -1.0, 0.0, 1.0);
+    Pos[1] = float4( 0.0,  1.0, 0.0, 1.0);
+    Pos[2] = float4( 1.0, -1.0, 0.0, 1.0);
+    PSIn.Pos   = Pos[VertId % 3];
+    PSIn.Color = float4(float(VARIANT % 7) / 7.0, float(VARIANT % 5) / 5.0, float(VARIANT % 3) / 3.0, 1.0);
+}
+
+float4 PSMain(in PSInput PSIn) : SV_Target
+{
+    float4 Color = PSIn.Color;
+    for (int i = 0; i < 4 + VARIANT % 8; ++i)
+        Color = sin(Color * float(i + VARIANT)) + cos(Color);
+    return Color;
+}
+)";
+
+class AsyncPipelineCreationTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        auto* pEnv    = TestingEnvironment::GetInstance();
+        auto* pDevice = pEnv->GetDevice();
+
+        // Every variant produces different shaders, so that every pipeline has to be compiled by the driver
+        for (Uint32 i = 0; i < NumVariants; ++i)
+        {
+            const auto        Variant  = std::to_string(i);
+            const ShaderMacro Macros[] = {{"VARIANT", Variant.c_str()}, {}};
+
+            ShaderCreateInfo ShaderCI;
+            ShaderCI.Source                     = g_ShaderSource;
+            ShaderCI.Macros                     = Macros;
+            ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+            ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+            ShaderCI.UseCombinedTextureSamplers = true;
+
+            ShaderCI.EntryPoint      = "VSMain";
+            ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+            ShaderCI.Desc.Name       = "Async pipeline creation test VS";
+            pDevice->CreateShader(ShaderCI, &Shaders[i].pVS);
+            ASSERT_NE(Shaders[i].pVS, nullptr);
+
+            ShaderCI.EntryPoint      = "PSMain";
+            ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+            ShaderCI.Desc.Name       = "Async pipeline creation test PS";
+            pDevice->CreateShader(ShaderCI, &Shaders[i].pPS);
+            ASSERT_NE(Shaders[i].pPS, nullptr);
+        }
+    }
+
+    static void TearDownTestSuite()
+    {
+        for (auto& VariantShaders : Shaders)
+        {
+            VariantShaders.pVS.Release();
+            VariantShaders.pPS.Release();
+        }
+        TestingEnvironment::GetInstance()->Reset();
+    }
+
+    static void CreatePSO(Uint32 Variant, PSO_CREATE_FLAGS Flags, IPipelineState** ppPSO)
+    {
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+        auto& PSODesc          = PSOCreateInfo.PSODesc;
+        auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+        PSODesc.Name                                  = "Async pipeline creation test PSO";
+        PSOCreateInfo.Flags                           = Flags;
+        PSOCreateInfo.pVS                             = Shaders[Variant].pVS;
+        PSOCreateInfo.pPS                             = Shaders[Variant].pPS;
+        GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        GraphicsPipeline.NumRenderTargets             = 1;
+        GraphicsPipeline.RTVFormats[0]                = TEX_FORMAT_RGBA8_UNORM;
+        GraphicsPipeline.DSVFormat                    = TEX_FORMAT_UNKNOWN;
+        GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+        TestingEnvironment::GetInstance()->GetDevice()->CreateGraphicsPipelineState(PSOCreateInfo, ppPSO);
+    }
+
+    static constexpr Uint32 NumVariants = 128;
+
+    struct VariantShaders
+    {
+        RefCntAutoPtr<IShader> pVS;
+        RefCntAutoPtr<IShader> pPS;
+    };
+    static VariantShaders Shaders[NumVariants];
+};
+
+constexpr Uint32                          AsyncPipelineCreationTest::NumVariants;
+AsyncPipelineCreationTest::VariantShaders AsyncPipelineCreationTest::Shaders[AsyncPipelineCreationTest::NumVariants];
+
+
+TEST_F(AsyncPipelineCreationTest, CreateAndWait)
+{
+    std::vector<RefCntAutoPtr<IPipelineState>> PSOs(NumVariants);
+    for (Uint32 i = 0; i < NumVariants; ++i)
+    {
+        CreatePSO(i, PSO_CREATE_FLAG_ASYNCHRONOUS, &PSOs[i]);
+        ASSERT_NE(PSOs[i], nullptr);
+
+        // Static variables and SRBs must be accessible while the pipeline is being created
+        RefCntAutoPtr<IShaderResourceBinding> pSRB;
+        PSOs[i]->CreateShaderResourceBinding(&pSRB, true);
+        EXPECT_NE(pSRB, nullptr);
+    }
+
+    for (auto& pPSO : PSOs)
+        EXPECT_EQ(pPSO->GetStatus(true), PIPELINE_STATE_STATUS_READY);
+
+    // Pipelines created without the flag are ready immediately
+    RefCntAutoPtr<IPipelineState> pSyncPSO;
+    CreatePSO(0, PSO_CREATE_FLAG_NONE, &pSyncPSO);
+    ASSERT_NE(pSyncPSO, nullptr);
+    EXPECT_EQ(pSyncPSO->GetStatus(), PIPELINE_STATE_STATUS_READY);
+}
+
+TEST_F(AsyncPipelineCreationTest, DISABLED_CreationBenchmark)
+{
+    std::vector<RefCntAutoPtr<IPipelineState>> PSOs(NumVariants);
+
+    Timer T;
+
+    auto StartTime = T.GetElapsedTime();
+    for (Uint32 i = 0; i < NumVariants; ++i)
+    {
+        CreatePSO(i, PSO_CREATE_FLAG_ASYNCHRONOUS, &PSOs[i]);
+        ASSERT_NE(PSOs[i], nullptr);
+    }
+    const auto IssueTime = T.GetElapsedTime() - StartTime;
+
+    for (auto& pPSO : PSOs)
+        EXPECT_EQ(pPSO->GetStatus(true), PIPELINE_STATE_STATUS_READY);
+    const auto AsyncTime = T.GetElapsedTime() - StartTime;
+
+    // Release the pipelines to prevent the driver from returning them from its internal cache
+    PSOs.clear();
+    PSOs.resize(NumVariants);
+
+    StartTime = T.GetElapsedTime();
+    for (Uint32 i = 0; i < NumVariants; ++i)
+    {
+        CreatePSO(i, PSO_CREATE_FLAG_NONE, &PSOs[i]);
+        ASSERT_NE(PSOs[i], nullptr);
+        EXPECT_EQ(PSOs[i]->GetStatus(), PIPELINE_STATE_STATUS_READY);
+    }
+    const auto SyncTime = T.GetElapsedTime() - StartTime;
+
+    LOG_INFO_MESSAGE("Created ", Uint32{NumVariants}, " PSOs asynchronously in ", AsyncTime * 1000, " ms (",
+                     IssueTime * 1000, " ms on the calling thread); synchronously in ", SyncTime * 1000, " ms");
+}
+
+TEST_F(AsyncPipelineCreationTest, CreateFromMultipleThreads)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (pDevice->GetDeviceCaps().IsGLDevice())
+    {
+        GTEST_SKIP() << "OpenGL does not support multithreaded resource creation";
+    }
+
+    const Uint32 NumThreads = std::max(std::min(std::thread::hardware_concurrency(), 8u), 2u);
+
+    std::vector<RefCntAutoPtr<IPipelineState>> PSOs(NumVariants);
+    std::vector<std::thread>                   Threads;
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back(
+            [&PSOs, t, NumThreads]() //
+            {
+                for (Uint32 i = t; i < NumVariants; i += NumThreads)
+                    CreatePSO(i, PSO_CREATE_FLAG_ASYNCHRONOUS, &PSOs[i]);
+            });
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    for (auto& pPSO : PSOs)
+    {
+        ASSERT_NE(pPSO, nullptr);
+        // Some pipelines may still be compiling at this point
+        const auto Status = pPSO->GetStatus();
+        EXPECT_TRUE(Status == PIPELINE_STATE_STATUS_COMPILING || Status == PIPELINE_STATE_STATUS_READY);
+    }
+
+    for (auto& pPSO : PSOs)
+        EXPECT_EQ(pPSO->GetStatus(true), PIPELINE_STATE_STATUS_READY);
+}
+
+TEST_F(AsyncPipelineCreationTest, PollUntilReady)
+{
+    std::vector<RefCntAutoPtr<IPipelineState>> PSOs(NumVariants);
+    for (Uint32 i = 0; i < NumVariants; ++i)
+    {
+        CreatePSO(i, PSO_CREATE_FLAG_ASYNCHRONOUS, &PSOs[i]);
+        ASSERT_NE(PSOs[i], nullptr);
+    }
+
+    // GetStatus() without waiting must not block, so the application can keep rendering
+    // while the pipelines are being compiled.
+    for (bool AllReady = false; !AllReady;)
+    {
+        AllReady = true;
+        for (auto& pPSO : PSOs)
+        {
+            const auto Status = pPSO->GetStatus();
+            ASSERT_NE(Status, PIPELINE_STATE_STATUS_FAILED);
+            AllReady = AllReady && Status == PIPELINE_STATE_STATUS_READY;
+        }
+        if (!AllReady)
+            std::this_thread::yield();
+    }
+}
+
+TEST_F(AsyncPipelineCreationTest, BindWhileCompiling)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    CreatePSO(0, PSO_CREATE_FLAG_ASYNCHRONOUS, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    // The context must wait until the pipeline is ready
+    pContext->SetPipelineState(pPSO);
+    EXPECT_EQ(pPSO->GetStatus(), PIPELINE_STATE_STATUS_READY);
+
+    pContext->Flush();
+    pContext->InvalidateState();
+}
+
+TEST_F(AsyncPipelineCreationTest, ReleaseWhileCompiling)
+{
+    // Releasing the pipeline before it is ready must wait for the worker thread
+    for (Uint32 i = 0; i < NumVariants; ++i)
+    {
+        RefCntAutoPtr<IPipelineState> pPSO;
+        CreatePSO(i, PSO_CREATE_FLAG_ASYNCHRONOUS, &pPSO);
+        EXPECT_NE(pPSO, nullptr);
+    }
+}
+
+} // namespace
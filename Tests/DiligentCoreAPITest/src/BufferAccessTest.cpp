@@ -26,6 +26,7 @@
  */
 
 #include <sstream>
+#include <vector>
 
 #include "TestingEnvironment.hpp"
 
@@ -154,6 +155,113 @@ TEST(BufferAccessTest, MapWriteDiscard)
     VerifyBufferData(pBuffer);
 }
 
+TEST(BufferAccessTest, MapManyDynamicBuffers)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumBuffers = 1024;
+    constexpr Uint32 NumFrames  = 4;
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name           = "Test dynamic buffer";
+    BuffDesc.Usage          = USAGE_DYNAMIC;
+    BuffDesc.uiSizeInBytes  = sizeof(TestBufferData);
+    BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+
+    std::vector<RefCntAutoPtr<IBuffer>> Buffers(NumBuffers);
+    for (auto& pBuffer : Buffers)
+    {
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+        ASSERT_NE(pBuffer, nullptr) << "Buffer desc:\n"
+                                    << BuffDesc;
+    }
+
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        // Release and recreate every other buffer so that new buffers reuse the
+        // dynamic allocation slots of the released ones
+        if (frame == NumFrames / 2)
+        {
+            for (Uint32 i = 0; i < NumBuffers; i += 2)
+            {
+                Buffers[i].Release();
+                pDevice->CreateBuffer(BuffDesc, nullptr, &Buffers[i]);
+                ASSERT_NE(Buffers[i], nullptr) << "Buffer desc:\n"
+                                               << BuffDesc;
+            }
+        }
+
+        for (auto& pBuffer : Buffers)
+        {
+            void* pData = nullptr;
+            pContext->MapBuffer(pBuffer, MAP_WRITE, MAP_FLAG_DISCARD, pData);
+            ASSERT_NE(pData, nullptr);
+            memcpy(pData, TestBufferData, sizeof(TestBufferData));
+            pContext->UnmapBuffer(pBuffer, MAP_WRITE);
+        }
+
+        if (frame + 1 < NumFrames)
+        {
+            pContext->Flush();
+            pContext->FinishFrame();
+        }
+    }
+
+    VerifyBufferData(Buffers.front());
+    VerifyBufferData(Buffers.back());
+}
+
+TEST(BufferAccessTest, MapDiscardManyTimesPerFrame)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    // Typical per-draw constant buffer update pattern: the same buffer
+    // is mapped with MAP_FLAG_DISCARD many times in every frame
+    constexpr Uint32 NumMapsPerFrame = 8192;
+    constexpr Uint32 NumFrames       = 4;
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name           = "Test dynamic buffer";
+    BuffDesc.Usage          = USAGE_DYNAMIC;
+    BuffDesc.uiSizeInBytes  = sizeof(TestBufferData);
+    BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    ASSERT_NE(pBuffer, nullptr) << "Buffer desc:\n"
+                                << BuffDesc;
+
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        for (Uint32 i = 0; i < NumMapsPerFrame; ++i)
+        {
+            void* pData = nullptr;
+            pContext->MapBuffer(pBuffer, MAP_WRITE, MAP_FLAG_DISCARD, pData);
+            ASSERT_NE(pData, nullptr);
+            memcpy(pData, TestBufferData, sizeof(TestBufferData));
+            pContext->UnmapBuffer(pBuffer, MAP_WRITE);
+        }
+
+        if (frame + 1 < NumFrames)
+        {
+            pContext->Flush();
+            pContext->FinishFrame();
+        }
+    }
+
+    VerifyBufferData(pBuffer);
+}
+
 TEST(BufferAccessTest, CopyFromStaging)
 {
     auto* pEnv     = TestingEnvironment::GetInstance();
@@ -28,6 +28,7 @@
 #include "TestingEnvironment.hpp"
 #include "TestingSwapChainBase.hpp"
 #include "BasicMath.hpp"
+#include "Timer.hpp"
 
 #include "gtest/gtest.h"
 
@@ -703,6 +704,135 @@ TEST_F(DrawCommandTest, DrawIndexed_IBOffset_BaseVertex)
 }
 
 
+
+// Multi-draw calls (glMultiDrawArrays/glMultiDrawElementsBaseVertex)
+
+TEST_F(DrawCommandTest, MultiDraw)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    SetRenderTargets(sm_pDrawPSO);
+
+    // clang-format off
+    const Vertex Triangles[] =
+    {
+        {}, {},
+        Vert[0], Vert[1], Vert[2],
+        {},
+        Vert[3], Vert[4], Vert[5]
+    };
+    // clang-format on
+
+    auto     pVB       = CreateVertexBuffer(Triangles, sizeof(Triangles));
+    IBuffer* pVBs[]    = {pVB};
+    Uint32   Offsets[] = {0};
+    pContext->SetVertexBuffers(0, 1, pVBs, Offsets, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+
+    // clang-format off
+    const MultiDrawItem DrawItems[] =
+    {
+        {3, 2},
+        {3, 6}
+    };
+    // clang-format on
+
+    MultiDrawAttribs drawAttrs{_countof(DrawItems), DrawItems, DRAW_FLAG_VERIFY_ALL};
+    pContext->MultiDraw(drawAttrs);
+
+    Present();
+}
+
+TEST_F(DrawCommandTest, MultiDrawIndexed_IBOffset_BaseVertex)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    SetRenderTargets(sm_pDrawPSO);
+
+    // clang-format off
+    const Vertex Triangles[] =
+    {
+        {}, {},
+        Vert[0], {}, Vert[1], {}, {}, Vert[2],
+        Vert[3], {}, {}, Vert[5], Vert[4]
+    };
+    Uint32 Indices[] = {0,0,0,0, 0,2,5, 0,0, 0,4,3};
+    // clang-format on
+
+    auto pVB = CreateVertexBuffer(Triangles, sizeof(Triangles));
+    auto pIB = CreateIndexBuffer(Indices, _countof(Indices));
+
+    IBuffer* pVBs[]    = {pVB};
+    Uint32   Offsets[] = {0};
+    pContext->SetVertexBuffers(0, 1, pVBs, Offsets, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+    pContext->SetIndexBuffer(pIB, sizeof(Uint32) * 4, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    // clang-format off
+    const MultiDrawIndexedItem DrawItems[] =
+    {
+        {3, 0, 2}, // NumIndices, FirstIndexLocation, BaseVertex
+        {3, 5, 8}
+    };
+    // clang-format on
+
+    MultiDrawIndexedAttribs drawAttrs{_countof(DrawItems), DrawItems, VT_UINT32, DRAW_FLAG_VERIFY_ALL};
+    pContext->MultiDrawIndexed(drawAttrs);
+
+    Present();
+}
+
+TEST_F(DrawCommandTest, DISABLED_MultiDraw_Throughput)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    SetRenderTargets(sm_pDrawPSO);
+
+    // clang-format off
+    const Vertex Triangles[] =
+    {
+        Vert[0], Vert[1], Vert[2],
+        Vert[3], Vert[4], Vert[5]
+    };
+    // clang-format on
+
+    auto     pVB       = CreateVertexBuffer(Triangles, sizeof(Triangles));
+    IBuffer* pVBs[]    = {pVB};
+    Uint32   Offsets[] = {0};
+    pContext->SetVertexBuffers(0, 1, pVBs, Offsets, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+
+    constexpr Uint32 NumDraws = 4096;
+
+    std::vector<MultiDrawItem> DrawItems(NumDraws);
+    for (Uint32 i = 0; i < NumDraws; ++i)
+    {
+        DrawItems[i].NumVertices         = 3;
+        DrawItems[i].StartVertexLocation = (i % 2) * 3;
+    }
+
+    Timer T;
+
+    auto StartTime = T.GetElapsedTime();
+    for (const auto& Item : DrawItems)
+    {
+        DrawAttribs drawAttrs{Item.NumVertices, DRAW_FLAG_NONE};
+        drawAttrs.StartVertexLocation = Item.StartVertexLocation;
+        pContext->Draw(drawAttrs);
+    }
+    const auto DrawTime = T.GetElapsedTime() - StartTime;
+
+    StartTime = T.GetElapsedTime();
+    MultiDrawAttribs drawAttrs{NumDraws, DrawItems.data(), DRAW_FLAG_NONE};
+    pContext->MultiDraw(drawAttrs);
+    const auto MultiDrawTime = T.GetElapsedTime() - StartTime;
+
+    LOG_INFO_MESSAGE("Recorded ", NumDraws, " draws in ", DrawTime * 1000, " ms using Draw and in ", MultiDrawTime * 1000, " ms using MultiDraw");
+
+    Present();
+}
+
+
 // Instanced non-indexed draw calls (glDrawArraysInstanced/DrawInstanced)
 
 TEST_F(DrawCommandTest, DrawInstanced)
@@ -0,0 +1,226 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "TestingEnvironment.hpp"
+#include "DeviceContextGL.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+static const char g_ShaderSource[] = R"(
+cbuffer Constants0
+{
+    float4 g_Color0;
+};
+
+cbuffer Constants1
+{
+    float4 g_Color1;
+};
+
+Texture2D    g_Tex0;
+SamplerState g_Tex0_sampler;
+
+Texture2D    g_Tex1;
+SamplerState g_Tex1_sampler;
+
+void VSMain(in uint VertId : SV_VertexID, out float4 Pos : SV_POSITION)
+{
+    float2 UV = float2(float((VertId << 1u) & 2u), float(VertId & 2u));
+    Pos = float4(UV * 2.0 - 1.0, 0.0, 1.0);
+}
+
+float4 PSMain(in float4 Pos : SV_POSITION) : SV_Target
+{
+    float2 UV = float2(0.5, 0.5);
+    return g_Color0 * g_Tex0.Sample(g_Tex0_sampler, UV) +
+           g_Color1 * g_Tex1.Sample(g_Tex1_sampler, UV);
+}
+)";
+
+BindingStatisticsGL operator-(const BindingStatisticsGL& lhs, const BindingStatisticsGL& rhs)
+{
+    BindingStatisticsGL Diff;
+    Diff.NumGLCalls         = lhs.NumGLCalls - rhs.NumGLCalls;
+    Diff.NumFilteredCalls   = lhs.NumFilteredCalls - rhs.NumFilteredCalls;
+    Diff.NumMultiBindCalls  = lhs.NumMultiBindCalls - rhs.NumMultiBindCalls;
+    Diff.NumMultiBoundSlots = lhs.NumMultiBoundSlots - rhs.NumMultiBoundSlots;
+    return Diff;
+}
+
+// Commits the same SRB twice and checks that the second commit is served
+// by the context state cache instead of issuing GL binding calls.
+TEST(BindingStatisticsGLTest, RedundantCommit)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceCaps().IsGLDevice())
+    {
+        GTEST_SKIP() << "This test is only applicable to OpenGL";
+    }
+
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    RefCntAutoPtr<IDeviceContextGL> pContextGL{pContext, IID_DeviceContextGL};
+    ASSERT_NE(pContextGL, nullptr);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Source                     = g_ShaderSource;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.UseCombinedTextureSamplers = true;
+
+    RefCntAutoPtr<IShader> pVS;
+    ShaderCI.EntryPoint      = "VSMain";
+    ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+    ShaderCI.Desc.Name       = "Binding statistics test VS";
+    pDevice->CreateShader(ShaderCI, &pVS);
+    ASSERT_NE(pVS, nullptr);
+
+    RefCntAutoPtr<IShader> pPS;
+    ShaderCI.EntryPoint      = "PSMain";
+    ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+    ShaderCI.Desc.Name       = "Binding statistics test PS";
+    pDevice->CreateShader(ShaderCI, &pPS);
+    ASSERT_NE(pPS, nullptr);
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+    auto& PSODesc          = PSOCreateInfo.PSODesc;
+    auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+    PSODesc.Name                                  = "Binding statistics test PSO";
+    PSODesc.ResourceLayout.DefaultVariableType    = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+    PSOCreateInfo.pVS                             = pVS;
+    PSOCreateInfo.pPS                             = pPS;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    GraphicsPipeline.DSVFormat                    = TEX_FORMAT_UNKNOWN;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPSO->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+
+    // Default-usage buffers are bound through the context state rather than the dynamic ring buffer
+    const char* CBNames[] = {"Constants0", "Constants1"};
+    for (const auto* CBName : CBNames)
+    {
+        const float Color[] = {1, 1, 1, 1};
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name          = "Binding statistics test constant buffer";
+        BuffDesc.BindFlags     = BIND_UNIFORM_BUFFER;
+        BuffDesc.Usage         = USAGE_DEFAULT;
+        BuffDesc.uiSizeInBytes = sizeof(Color);
+
+        BufferData InitialData{Color, sizeof(Color)};
+
+        RefCntAutoPtr<IBuffer> pCB;
+        pDevice->CreateBuffer(BuffDesc, &InitialData, &pCB);
+        ASSERT_NE(pCB, nullptr);
+
+        auto* pVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, CBName);
+        ASSERT_NE(pVar, nullptr);
+        pVar->Set(pCB);
+    }
+
+    const char* TexNames[] = {"g_Tex0", "g_Tex1"};
+    for (const auto* TexName : TexNames)
+    {
+        TextureDesc TexDesc;
+        TexDesc.Name      = "Binding statistics test texture";
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Width     = 4;
+        TexDesc.Height    = 4;
+        TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+        TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+        TexDesc.Usage     = USAGE_DEFAULT;
+
+        RefCntAutoPtr<ITexture> pTex;
+        pDevice->CreateTexture(TexDesc, nullptr, &pTex);
+        ASSERT_NE(pTex, nullptr);
+
+        auto* pVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, TexName);
+        ASSERT_NE(pVar, nullptr);
+        pVar->Set(pTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+    }
+
+    pContext->SetPipelineState(pPSO);
+
+    BindingStatisticsGL FrameStats, TotalStats0, TotalStats1, TotalStats2;
+    pContextGL->GetBindingStatistics(FrameStats, TotalStats0);
+
+    pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContextGL->GetBindingStatistics(FrameStats, TotalStats1);
+
+    pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContextGL->GetBindingStatistics(FrameStats, TotalStats2);
+
+    const auto FirstCommit  = TotalStats1 - TotalStats0;
+    const auto SecondCommit = TotalStats2 - TotalStats1;
+    LOG_INFO_MESSAGE("First commit: ", FirstCommit.NumGLCalls, " GL calls (", FirstCommit.NumMultiBindCalls, " multi-bind), ",
+                     FirstCommit.NumFilteredCalls, " filtered. Second commit: ", SecondCommit.NumGLCalls, " GL calls (",
+                     SecondCommit.NumMultiBindCalls, " multi-bind), ", SecondCommit.NumFilteredCalls, " filtered.");
+
+    // All resources are already bound, so the second commit must be filtered out
+    EXPECT_GT(SecondCommit.NumFilteredCalls, FirstCommit.NumFilteredCalls);
+    EXPECT_LT(SecondCommit.NumGLCalls, FirstCommit.NumGLCalls);
+    if (FirstCommit.NumMultiBindCalls > 0)
+    {
+        EXPECT_LT(SecondCommit.NumMultiBindCalls, FirstCommit.NumMultiBindCalls);
+        EXPECT_EQ(SecondCommit.NumMultiBoundSlots, Uint64{0});
+    }
+    else
+    {
+        LOG_INFO_MESSAGE("Multi-bind is not supported by the context");
+    }
+
+    // Frame statistics are only updated when the frame is finished
+    pContext->Flush();
+    pContext->FinishFrame();
+    pContextGL->GetBindingStatistics(FrameStats, TotalStats0);
+    EXPECT_GE(FrameStats.NumGLCalls, FirstCommit.NumGLCalls + SecondCommit.NumGLCalls);
+    EXPECT_GE(FrameStats.NumFilteredCalls, FirstCommit.NumFilteredCalls + SecondCommit.NumFilteredCalls);
+    EXPECT_EQ(TotalStats0.NumGLCalls, TotalStats2.NumGLCalls);
+
+    pContext->InvalidateState();
+
+    pEnv->Reset();
+}
+
+} // namespace
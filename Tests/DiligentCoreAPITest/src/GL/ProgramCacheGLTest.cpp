@@ -0,0 +1,261 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+#include "RenderDeviceGL.h"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+static const char g_ShaderSource[] = R"(
+cbuffer Constants
+{
+    float4 g_Scale;
+};
+
+Texture2D    g_Texture;
+SamplerState g_Texture_sampler;
+
+struct PSInput
+{
+    float4 Pos : SV_POSITION;
+    float2 UV  : TEX_COORD;
+};
+
+void VSMain(in uint VertId : SV_VertexID, out PSInput PSIn)
+{
+    float4 Pos[3];
+    Pos[0] = float4(-1.0, -1.0, 0.0, 1.0);
+    Pos[1] = float4( 0.0,  1.0, 0.0, 1.0);
+    Pos[2] = float4( 1.0, -1.0, 0.0, 1.0);
+    PSIn.Pos = Pos[VertId % 3] * g_Scale;
+    PSIn.UV  = PSIn.Pos.xy * float(VARIANT + 1);
+}
+
+float4 PSMain(in PSInput PSIn) : SV_Target
+{
+    float4 Color = g_Texture.Sample(g_Texture_sampler, PSIn.UV) * g_Scale;
+    for (int i = 0; i < 4 + VARIANT % 8; ++i)
+        Color = sin(Color * float(i + VARIANT)) + cos(Color);
+    return Color;
+}
+)";
+
+// Overwrites every cache entry in the directory. Entries with even indices are truncated,
+// so that they fail the size check. Binaries of the entries with odd indices are corrupted
+// while the size is preserved, so that the driver has to reject them.
+static void CorruptCacheEntries(const char* CacheDir)
+{
+    const auto SearchPattern = std::string{CacheDir} + FileSystem::GetSlashSymbol() + "*.bin";
+    const auto Entries       = FileSystem::Search(SearchPattern.c_str());
+    ASSERT_FALSE(Entries.empty());
+
+    for (size_t i = 0; i < Entries.size(); ++i)
+    {
+        const auto Path = std::string{CacheDir} + FileSystem::GetSlashSymbol() + Entries[i]->Name();
+
+        std::vector<Uint8> Data;
+        {
+            FileWrapper File{Path.c_str(), EFileAccessMode::Read};
+            ASSERT_TRUE(File != nullptr);
+            Data.resize(File->GetSize());
+            ASSERT_TRUE(File->Read(Data.data(), Data.size()));
+        }
+
+        // The entry starts with a 48-byte header that is followed by the program binary
+        constexpr size_t HeaderSize = 48;
+        ASSERT_GT(Data.size(), HeaderSize + 16);
+        if (i % 2 == 0)
+        {
+            Data.resize(Data.size() / 2);
+        }
+        else
+        {
+            for (size_t b = HeaderSize; b < HeaderSize + 16; ++b)
+                Data[b] = ~Data[b];
+        }
+
+        FileWrapper File{Path.c_str(), EFileAccessMode::Overwrite};
+        ASSERT_TRUE(File != nullptr);
+        ASSERT_TRUE(File->Write(Data.data(), Data.size()));
+    }
+}
+
+// Creates shaders and pipelines with the program binary cache in a fresh directory and
+// measures the time it takes when the programs are not in the cache versus when they are.
+// Then corrupts the cache entries and checks that the programs are compiled from the
+// sources again.
+TEST(ProgramCacheGLTest, CreateTime)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceCaps().IsGLDevice())
+    {
+        GTEST_SKIP() << "Program binary cache is only available in OpenGL";
+    }
+
+    RefCntAutoPtr<IRenderDeviceGL> pDeviceGL{pDevice, IID_RenderDeviceGL};
+    ASSERT_NE(pDeviceGL, nullptr);
+
+    const char* CacheDir = "ProgramCacheGLTest";
+    if (FileSystem::PathExists(CacheDir))
+        FileSystem::DeleteDirectory(CacheDir);
+
+    pDeviceGL->SetProgramCacheDirectory(CacheDir);
+
+    constexpr Uint32 NumVariants = 64;
+
+    auto CreatePipelines = [&](std::vector<RefCntAutoPtr<IPipelineState>>& PSOs) //
+    {
+        PSOs.resize(NumVariants);
+        for (Uint32 i = 0; i < NumVariants; ++i)
+        {
+            const auto        Variant  = std::to_string(i);
+            const ShaderMacro Macros[] = {{"VARIANT", Variant.c_str()}, {}};
+
+            ShaderCreateInfo ShaderCI;
+            ShaderCI.Source                     = g_ShaderSource;
+            ShaderCI.Macros                     = Macros;
+            ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+            ShaderCI.UseCombinedTextureSamplers = true;
+
+            RefCntAutoPtr<IShader> pVS;
+            ShaderCI.EntryPoint      = "VSMain";
+            ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+            ShaderCI.Desc.Name       = "Program cache test VS";
+            pDevice->CreateShader(ShaderCI, &pVS);
+            ASSERT_NE(pVS, nullptr);
+
+            RefCntAutoPtr<IShader> pPS;
+            ShaderCI.EntryPoint      = "PSMain";
+            ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+            ShaderCI.Desc.Name       = "Program cache test PS";
+            pDevice->CreateShader(ShaderCI, &pPS);
+            ASSERT_NE(pPS, nullptr);
+
+            GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+            auto& PSODesc          = PSOCreateInfo.PSODesc;
+            auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+            PSODesc.Name                                  = "Program cache test PSO";
+            PSOCreateInfo.pVS                             = pVS;
+            PSOCreateInfo.pPS                             = pPS;
+            GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+            GraphicsPipeline.NumRenderTargets             = 1;
+            GraphicsPipeline.RTVFormats[0]                = TEX_FORMAT_RGBA8_UNORM;
+            GraphicsPipeline.DSVFormat                    = TEX_FORMAT_UNKNOWN;
+            GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+            pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &PSOs[i]);
+            ASSERT_NE(PSOs[i], nullptr);
+        }
+    };
+
+    // Programs created from the cache must expose the same resources
+    auto VerifyPipelines = [&](std::vector<RefCntAutoPtr<IPipelineState>>& RefPSOs, std::vector<RefCntAutoPtr<IPipelineState>>& PSOs) //
+    {
+        for (Uint32 i = 0; i < NumVariants; ++i)
+        {
+            ASSERT_NE(RefPSOs[i], nullptr);
+            ASSERT_NE(PSOs[i], nullptr);
+            EXPECT_TRUE(RefPSOs[i]->IsCompatibleWith(PSOs[i]));
+            EXPECT_NE(PSOs[i]->GetStaticVariableByName(SHADER_TYPE_PIXEL, "g_Texture"), nullptr);
+            EXPECT_NE(PSOs[i]->GetStaticVariableByName(SHADER_TYPE_VERTEX, "Constants"), nullptr);
+        }
+    };
+
+    std::vector<RefCntAutoPtr<IPipelineState>> ColdPSOs;
+    CreatePipelines(ColdPSOs);
+
+    ProgramCacheStatisticsGL ColdStats;
+    pDeviceGL->GetProgramCacheStatistics(ColdStats);
+    if (ColdStats.NumStored != 0)
+    {
+        EXPECT_GE(ColdStats.NumMisses, NumVariants);
+        EXPECT_EQ(ColdStats.NumRejected, 0u);
+
+        std::vector<RefCntAutoPtr<IPipelineState>> WarmPSOs;
+        CreatePipelines(WarmPSOs);
+
+        // All programs must now be loaded from the cache
+        ProgramCacheStatisticsGL WarmStats;
+        pDeviceGL->GetProgramCacheStatistics(WarmStats);
+        EXPECT_GE(WarmStats.NumHits - ColdStats.NumHits, NumVariants);
+        EXPECT_EQ(WarmStats.NumMisses, ColdStats.NumMisses);
+        EXPECT_EQ(WarmStats.NumRejected, 0u);
+        EXPECT_EQ(WarmStats.NumStored, ColdStats.NumStored);
+        VerifyPipelines(ColdPSOs, WarmPSOs);
+
+        // Corrupted entries must not prevent the pipelines from being created. The programs
+        // are compiled from the sources instead, and the entries are overwritten.
+        CorruptCacheEntries(CacheDir);
+
+        std::vector<RefCntAutoPtr<IPipelineState>> RecompiledPSOs;
+        CreatePipelines(RecompiledPSOs);
+
+        ProgramCacheStatisticsGL RecompiledStats;
+        pDeviceGL->GetProgramCacheStatistics(RecompiledStats);
+        EXPECT_GT(RecompiledStats.NumMisses, WarmStats.NumMisses);
+        EXPECT_GT(RecompiledStats.NumRejected, WarmStats.NumRejected);
+        EXPECT_GT(RecompiledStats.NumStored, WarmStats.NumStored);
+        VerifyPipelines(ColdPSOs, RecompiledPSOs);
+
+        std::vector<RefCntAutoPtr<IPipelineState>> ReloadedPSOs;
+        CreatePipelines(ReloadedPSOs);
+
+        ProgramCacheStatisticsGL ReloadedStats;
+        pDeviceGL->GetProgramCacheStatistics(ReloadedStats);
+        EXPECT_EQ(ReloadedStats.NumMisses, RecompiledStats.NumMisses);
+        EXPECT_EQ(ReloadedStats.NumRejected, RecompiledStats.NumRejected);
+        VerifyPipelines(ColdPSOs, ReloadedPSOs);
+    }
+    else
+    {
+        LOG_INFO_MESSAGE("The driver does not provide program binaries. Cache hits are not tested.");
+    }
+
+    pEnv->Reset();
+
+    // Restore the cache directory set from the command line
+    pDeviceGL->SetProgramCacheDirectory(pEnv->GetGLProgramCacheDirectory().c_str());
+
+    FileSystem::DeleteDirectory(CacheDir);
+    EXPECT_FALSE(FileSystem::PathExists(CacheDir));
+}
+
+} // namespace
@@ -0,0 +1,313 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+
+#include "GL/TestingEnvironmentGL.hpp"
+#include "BasicMath.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+static const char g_ShaderSource[] = R"(
+struct VSInput
+{
+    float4 Pos   : ATTRIB0;
+    float3 Color : ATTRIB1;
+};
+
+struct PSInput
+{
+    float4 Pos   : SV_POSITION;
+    float3 Color : COLOR;
+};
+
+void VSMain(in VSInput VSIn, out PSInput PSIn)
+{
+    PSIn.Pos   = VSIn.Pos;
+    PSIn.Color = VSIn.Color;
+}
+
+float4 PSMain(in PSInput PSIn) : SV_Target
+{
+    return float4(PSIn.Color, 1.0);
+}
+)";
+
+// Counts vertex array objects in the current GL context by probing object names.
+// glIsVertexArray only recognizes names that have been bound at least once, which
+// is always the case for the VAOs created by the engine.
+Uint32 CountVAOs()
+{
+    constexpr GLuint MaxProbedName = 1 << 16;
+
+    Uint32 NumVAOs = 0;
+    for (GLuint Name = 1; Name <= MaxProbedName; ++Name)
+    {
+        if (glIsVertexArray(Name))
+            ++NumVAOs;
+    }
+    return NumVAOs;
+}
+
+// Creates a pipeline with a two-element input layout that uses one vertex buffer
+void CreateTestPSO(IRenderDevice* pDevice, TEXTURE_FORMAT RTVFormat, IPipelineState** ppPSO)
+{
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Source                     = g_ShaderSource;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.UseCombinedTextureSamplers = true;
+
+    RefCntAutoPtr<IShader> pVS;
+    ShaderCI.EntryPoint      = "VSMain";
+    ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+    ShaderCI.Desc.Name       = "VAO cache test VS";
+    pDevice->CreateShader(ShaderCI, &pVS);
+    if (!pVS)
+        return;
+
+    RefCntAutoPtr<IShader> pPS;
+    ShaderCI.EntryPoint      = "PSMain";
+    ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+    ShaderCI.Desc.Name       = "VAO cache test PS";
+    pDevice->CreateShader(ShaderCI, &pPS);
+    if (!pPS)
+        return;
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+    auto& PSODesc          = PSOCreateInfo.PSODesc;
+    auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+    // clang-format off
+    LayoutElement Elems[] =
+    {
+        LayoutElement{0, 0, 4, VT_FLOAT32},
+        LayoutElement{1, 0, 3, VT_FLOAT32}
+    };
+    // clang-format on
+
+    PSODesc.Name                                  = "VAO cache test PSO";
+    PSOCreateInfo.pVS                             = pVS;
+    PSOCreateInfo.pPS                             = pPS;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = RTVFormat;
+    GraphicsPipeline.DSVFormat                    = TEX_FORMAT_UNKNOWN;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+    GraphicsPipeline.InputLayout.LayoutElements   = Elems;
+    GraphicsPipeline.InputLayout.NumElements      = _countof(Elems);
+
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, ppPSO);
+}
+
+// Draws a scene where every object has its own vertex buffer and checks that
+// the number of VAOs depends on the number of input layouts rather than buffers.
+TEST(VAOCacheGLTest, NumVAOs)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceCaps().IsGLDevice())
+    {
+        GTEST_SKIP() << "This test is only applicable to OpenGL";
+    }
+    if (!GLEW_VERSION_4_3 && !GLEW_ARB_vertex_attrib_binding)
+    {
+        GTEST_SKIP() << "ARB_vertex_attrib_binding is not supported";
+    }
+
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    // Two pipelines with the same input layout must share the VAOs
+    RefCntAutoPtr<IPipelineState> pPSOs[2];
+    for (auto& pPSO : pPSOs)
+    {
+        CreateTestPSO(pDevice, pSwapChain->GetDesc().ColorBufferFormat, &pPSO);
+        ASSERT_NE(pPSO, nullptr);
+    }
+
+    struct Vertex
+    {
+        float4 Pos;
+        float3 Color;
+    };
+
+    constexpr Uint32 NumBuffers = 4096;
+
+    std::vector<RefCntAutoPtr<IBuffer>> VertexBuffers(NumBuffers);
+    for (Uint32 i = 0; i < NumBuffers; ++i)
+    {
+        const float x = -1.f + 2.f * static_cast<float>(i % 64) / 64.f;
+        const float y = -1.f + 2.f * static_cast<float>(i / 64) / 64.f;
+
+        // clang-format off
+        const Vertex Triangle[] =
+        {
+            {float4{x,          y,          0, 1}, float3{1, 0, 0}},
+            {float4{x,          y + 1/32.f, 0, 1}, float3{0, 1, 0}},
+            {float4{x + 1/32.f, y,          0, 1}, float3{0, 0, 1}}
+        };
+        // clang-format on
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name          = "VAO cache test vertex buffer";
+        BuffDesc.BindFlags     = BIND_VERTEX_BUFFER;
+        BuffDesc.uiSizeInBytes = sizeof(Triangle);
+
+        BufferData InitialData{Triangle, sizeof(Triangle)};
+        pDevice->CreateBuffer(BuffDesc, &InitialData, &VertexBuffers[i]);
+        ASSERT_NE(VertexBuffers[i], nullptr);
+    }
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    const float ClearColor[] = {0.f, 0.f, 0.f, 0.f};
+    pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    const auto NumVAOsBefore = CountVAOs();
+
+    for (Uint32 i = 0; i < NumBuffers; ++i)
+    {
+        pContext->SetPipelineState(pPSOs[i % 2]);
+
+        IBuffer* pVBs[] = {VertexBuffers[i]};
+        pContext->SetVertexBuffers(0, 1, pVBs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+
+        DrawAttribs drawAttrs{3, DRAW_FLAG_VERIFY_ALL};
+        pContext->Draw(drawAttrs);
+    }
+
+    const auto NumNewVAOs = CountVAOs() - NumVAOsBefore;
+    LOG_INFO_MESSAGE("Drew ", NumBuffers, " vertex buffers using ", NumNewVAOs, " new VAOs");
+    // All draws use the same layout
+    EXPECT_LE(NumNewVAOs, 1u);
+
+    pSwapChain->Present();
+
+    pContext->Flush();
+    pContext->InvalidateState();
+
+    pEnv->Reset();
+}
+
+// Checks that the layout VAO does not keep the buffers of the last draw
+// command bound after the buffers have been destroyed.
+TEST(VAOCacheGLTest, DestroyedBuffersAreUnbound)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceCaps().IsGLDevice())
+    {
+        GTEST_SKIP() << "This test is only applicable to OpenGL";
+    }
+    if (!GLEW_VERSION_4_3 && !GLEW_ARB_vertex_attrib_binding)
+    {
+        GTEST_SKIP() << "ARB_vertex_attrib_binding is not supported";
+    }
+
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    CreateTestPSO(pDevice, pSwapChain->GetDesc().ColorBufferFormat, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    // clang-format off
+    const float Vertices[] =
+    {
+        -1, -1, 0, 1,   1, 0, 0,
+         0,  1, 0, 1,   0, 1, 0,
+         1, -1, 0, 1,   0, 0, 1
+    };
+    // clang-format on
+    const Uint32 Indices[] = {0, 1, 2};
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name          = "VAO cache test vertex buffer";
+    BuffDesc.BindFlags     = BIND_VERTEX_BUFFER;
+    BuffDesc.uiSizeInBytes = sizeof(Vertices);
+
+    RefCntAutoPtr<IBuffer> pVB;
+    BufferData             VBData{Vertices, sizeof(Vertices)};
+    pDevice->CreateBuffer(BuffDesc, &VBData, &pVB);
+    ASSERT_NE(pVB, nullptr);
+
+    BuffDesc.Name          = "VAO cache test index buffer";
+    BuffDesc.BindFlags     = BIND_INDEX_BUFFER;
+    BuffDesc.uiSizeInBytes = sizeof(Indices);
+
+    RefCntAutoPtr<IBuffer> pIB;
+    BufferData             IBData{Indices, sizeof(Indices)};
+    pDevice->CreateBuffer(BuffDesc, &IBData, &pIB);
+    ASSERT_NE(pIB, nullptr);
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->SetPipelineState(pPSO);
+
+    IBuffer* pVBs[] = {pVB};
+    pContext->SetVertexBuffers(0, 1, pVBs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+    pContext->SetIndexBuffer(pIB, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    DrawIndexedAttribs drawAttrs{3, VT_UINT32, DRAW_FLAG_VERIFY_ALL};
+    pContext->DrawIndexed(drawAttrs);
+
+    GLint LayoutVAO = 0;
+    glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &LayoutVAO);
+    ASSERT_NE(LayoutVAO, 0);
+
+    // Release the buffers from the context and destroy them
+    pContext->InvalidateState();
+    pVB.Release();
+    pIB.Release();
+
+    pContext->FinishFrame();
+
+    glBindVertexArray(static_cast<GLuint>(LayoutVAO));
+
+    GLint BoundVB = -1;
+    glGetIntegeri_v(GL_VERTEX_BINDING_BUFFER, 0, &BoundVB);
+    EXPECT_EQ(BoundVB, 0);
+
+    GLint BoundIB = -1;
+    glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &BoundIB);
+    EXPECT_EQ(BoundIB, 0);
+
+    glBindVertexArray(0);
+    pContext->InvalidateState();
+
+    pEnv->Reset();
+}
+
+} // namespace
@@ -119,12 +119,15 @@ Uint32 TestingEnvironment::FindAdapater(const std::vector<GraphicsAdapterInfo>&
 }
 
 TestingEnvironment::TestingEnvironment(const CreateInfo& CI, const SwapChainDesc& SCDesc) :
-    m_DeviceType{CI.deviceType}
+    m_DeviceType{CI.deviceType},
+    m_GLProgramCacheDirectory{CI.GLProgramCacheDirectory != nullptr ? CI.GLProgramCacheDirectory : ""}
 {
     VERIFY(m_pTheEnvironment == nullptr, "Testing environment object has already been initialized!");
     m_pTheEnvironment = this;
 
-    Uint32 NumDeferredCtx = 0;
+    // Deferred contexts are only used by Vulkan-specific tests (secondary command lists, per-context
+    // descriptor and command pools). Other backends are tested with the immediate context only.
+    Uint32 NumDeferredCtx = CI.deviceType == RENDER_DEVICE_TYPE_VULKAN ? 4 : 0;
 
     std::vector<IDeviceContext*>     ppContexts;
     std::vector<GraphicsAdapterInfo> Adapters;
@@ -285,6 +288,7 @@ TestingEnvironment::TestingEnvironment(const CreateInfo& CI, const SwapChainDesc
             CreateInfo.CreateDebugContext        = true;
             CreateInfo.Features                  = DeviceFeatures{DEVICE_FEATURE_STATE_OPTIONAL};
             CreateInfo.ForceNonSeparablePrograms = CI.ForceNonSeparablePrograms;
+            CreateInfo.ProgramCacheDirectory     = CI.GLProgramCacheDirectory;
             if (NumDeferredCtx != 0)
             {
                 LOG_ERROR_MESSAGE("Deferred contexts are not supported in OpenGL mode");
@@ -348,6 +352,9 @@ TestingEnvironment::TestingEnvironment(const CreateInfo& CI, const SwapChainDesc
             break;
     }
     m_pDeviceContext.Attach(ppContexts[0]);
+    m_pDeferredContexts.resize(ppContexts.size() - 1);
+    for (size_t ctx = 1; ctx < ppContexts.size(); ++ctx)
+        m_pDeferredContexts[ctx - 1].Attach(ppContexts[ctx]);
 
     const auto& AdapterInfo = m_pDevice->GetDeviceCaps().AdapterInfo;
     std::string AdapterInfoStr;
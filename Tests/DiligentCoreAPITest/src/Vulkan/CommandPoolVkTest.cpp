@@ -0,0 +1,226 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+#include <vector>
+#include <algorithm>
+
+#include "TestingEnvironment.hpp"
+
+#include "DeviceContextVk.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+class CommandPoolVkTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        auto* pEnv     = TestingEnvironment::GetInstance();
+        auto* pDevice  = pEnv->GetDevice();
+        auto* pContext = pEnv->GetDeviceContext();
+        if (!pDevice->GetDeviceCaps().IsVulkanDevice())
+            return;
+
+        FenceDesc FenceCI;
+        FenceCI.Name = "Command pool test frame fence";
+        pDevice->CreateFence(FenceCI, &sm_pFrameFence);
+        ASSERT_NE(sm_pFrameFence, nullptr);
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name          = "Command pool test buffer";
+        BuffDesc.BindFlags     = BIND_UNIFORM_BUFFER;
+        BuffDesc.uiSizeInBytes = 16;
+
+        // Every context uses its own buffer
+        sm_Buffers.resize(1 + pEnv->GetNumDeferredContexts());
+        for (auto& pBuffer : sm_Buffers)
+        {
+            pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+            ASSERT_NE(pBuffer, nullptr);
+
+            // Transition buffers in the immediate context so that deferred contexts
+            // only verify the states
+            StateTransitionDesc Barrier{pBuffer, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_DEST, true};
+            pContext->TransitionResourceStates(1, &Barrier);
+        }
+        pContext->Flush();
+    }
+
+    static void TearDownTestSuite()
+    {
+        sm_Buffers.clear();
+        sm_pFrameFence.Release();
+        sm_FrameFenceValue = 0;
+
+        auto* pEnv = TestingEnvironment::GetInstance();
+        pEnv->Reset();
+    }
+
+    void SetUp() override
+    {
+        auto* pEnv = TestingEnvironment::GetInstance();
+        if (!pEnv->GetDevice()->GetDeviceCaps().IsVulkanDevice())
+        {
+            GTEST_SKIP() << "Command pool rings are specific to Vulkan backend";
+        }
+        ASSERT_NE(sm_pFrameFence, nullptr);
+    }
+
+    static CommandPoolStatisticsVk GetStatistics(IDeviceContext* pContext)
+    {
+        RefCntAutoPtr<IDeviceContextVk> pContextVk{pContext, IID_DeviceContextVk};
+        VERIFY_EXPR(pContextVk);
+
+        CommandPoolStatisticsVk Stats;
+        pContextVk->GetCommandPoolStatistics(Stats);
+        return Stats;
+    }
+
+    // Runs NumFrames frames. Every frame, the immediate context and every deferred context with index
+    // less than NumDeferredCtx record a buffer update. Similar to a swap chain, the CPU is allowed to
+    // get at most MaxFramesInFlight frames ahead of the GPU.
+    static void RunFrames(Uint32 NumFrames, Uint32 NumDeferredCtx)
+    {
+        auto* pEnv     = TestingEnvironment::GetInstance();
+        auto* pContext = pEnv->GetDeviceContext();
+
+        for (Uint32 frame = 0; frame < NumFrames; ++frame)
+        {
+            const float Data[4] = {static_cast<float>(frame)};
+            for (Uint32 ctx = 0; ctx < NumDeferredCtx; ++ctx)
+            {
+                auto* pDeferredCtx = pEnv->GetDeferredContext(ctx);
+                pDeferredCtx->UpdateBuffer(sm_Buffers[1 + ctx], 0, sizeof(Data), Data, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+
+                RefCntAutoPtr<ICommandList> pCmdList;
+                pDeferredCtx->FinishCommandList(&pCmdList);
+                ASSERT_NE(pCmdList, nullptr);
+                pContext->ExecuteCommandList(pCmdList);
+            }
+
+            pContext->UpdateBuffer(sm_Buffers[0], 0, sizeof(Data), Data, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            pContext->SignalFence(sm_pFrameFence, ++sm_FrameFenceValue);
+            pContext->Flush();
+
+            // Deferred contexts release their command pools when the frame is finished.
+            // The pools are reset once the GPU completes the frame.
+            for (Uint32 ctx = 0; ctx < NumDeferredCtx; ++ctx)
+                pEnv->GetDeferredContext(ctx)->FinishFrame();
+            pContext->FinishFrame();
+
+            if (sm_FrameFenceValue > MaxFramesInFlight)
+                pContext->WaitForFence(sm_pFrameFence, sm_FrameFenceValue - MaxFramesInFlight, false);
+        }
+    }
+
+    static constexpr Uint32 MaxFramesInFlight = 2;
+
+    static RefCntAutoPtr<IFence>               sm_pFrameFence;
+    static Uint64                              sm_FrameFenceValue;
+    static std::vector<RefCntAutoPtr<IBuffer>> sm_Buffers;
+};
+
+constexpr Uint32 CommandPoolVkTest::MaxFramesInFlight;
+
+RefCntAutoPtr<IFence>               CommandPoolVkTest::sm_pFrameFence;
+Uint64                              CommandPoolVkTest::sm_FrameFenceValue = 0;
+std::vector<RefCntAutoPtr<IBuffer>> CommandPoolVkTest::sm_Buffers;
+
+// Checks that command pools of the immediate and deferred contexts are reset and reused
+// instead of being created every frame
+TEST_F(CommandPoolVkTest, PoolReuse)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+
+    const Uint32 NumDeferredCtx = std::min(pEnv->GetNumDeferredContexts(), Uint32{2});
+
+    std::vector<IDeviceContext*> Contexts{pEnv->GetDeviceContext()};
+    for (Uint32 ctx = 0; ctx < NumDeferredCtx; ++ctx)
+        Contexts.push_back(pEnv->GetDeferredContext(ctx));
+
+    std::vector<CommandPoolStatisticsVk> StartStats;
+    for (auto* pCtx : Contexts)
+        StartStats.push_back(GetStatistics(pCtx));
+
+    constexpr Uint32 NumFrames = 32;
+    RunFrames(NumFrames, NumDeferredCtx);
+    pEnv->GetDeviceContext()->WaitForIdle();
+
+    for (size_t i = 0; i < Contexts.size(); ++i)
+    {
+        const auto& Start = StartStats[i];
+        const auto  End   = GetStatistics(Contexts[i]);
+
+        // Every frame makes one pool stale. Since the CPU never gets more than MaxFramesInFlight
+        // frames ahead of the GPU, the context needs at most MaxFramesInFlight stale pools
+        // plus the current one.
+        EXPECT_LE(End.NumPools - Start.NumPools, MaxFramesInFlight + 1) << "Context " << i;
+        EXPECT_GT(End.NumPoolResets, Start.NumPoolResets) << "Context " << i;
+        EXPECT_GE(End.NumPoolResets - Start.NumPoolResets, NumFrames - (MaxFramesInFlight + 1)) << "Context " << i;
+        EXPECT_GT(End.NumReusedBuffers, Start.NumReusedBuffers) << "Context " << i;
+
+        // All command buffers of every context are submitted to the single queue of the immediate
+        // context, so the pools are always recycled and never go through the release queues.
+        // Pools are only destroyed through the release queues when a deferred context is executed
+        // by immediate contexts that use different queues.
+        EXPECT_EQ(End.NumReleasedPools, Start.NumReleasedPools) << "Context " << i;
+    }
+}
+
+// Checks that the number of pools does not grow once the rings of all contexts have been warmed up
+TEST_F(CommandPoolVkTest, BoundedPoolCount)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+
+    const Uint32 NumDeferredCtx = std::min(pEnv->GetNumDeferredContexts(), Uint32{2});
+
+    RunFrames(8, NumDeferredCtx);
+
+    std::vector<IDeviceContext*> Contexts{pEnv->GetDeviceContext()};
+    for (Uint32 ctx = 0; ctx < NumDeferredCtx; ++ctx)
+        Contexts.push_back(pEnv->GetDeferredContext(ctx));
+
+    std::vector<Uint32> WarmPoolCounts;
+    for (auto* pCtx : Contexts)
+        WarmPoolCounts.push_back(GetStatistics(pCtx).NumPools);
+
+    RunFrames(64, NumDeferredCtx);
+    pEnv->GetDeviceContext()->WaitForIdle();
+
+    for (size_t i = 0; i < Contexts.size(); ++i)
+    {
+        // A single extra pool may be needed if the GPU happened to be slower than during the warm-up
+        EXPECT_LE(GetStatistics(Contexts[i]).NumPools, WarmPoolCounts[i] + 1) << "Context " << i;
+    }
+}
+
+} // namespace
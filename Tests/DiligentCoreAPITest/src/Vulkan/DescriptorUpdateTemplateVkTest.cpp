@@ -0,0 +1,507 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+#include <cstring>
+
+#include "TestingEnvironment.hpp"
+
+#include "BasicMath.hpp"
+#include "MapHelper.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Every dynamic resource writes its value to a separate element of the output buffer.
+// Input attachments are not tested as they can only be used in a render pass.
+const char* const DescriptorUpdateTemplateTestCS = R"(
+layout(local_size_x = 1) in;
+
+layout(std140) uniform UniformBuff    { vec4 Value; } g_UniformBuff;
+layout(std140) uniform DynamicBuff    { vec4 Value; } g_DynamicBuff;
+layout(std140) uniform UniformBuffArr { vec4 Value; } g_UniformBuffArr[2];
+
+layout(std430) readonly buffer ROStorageBuff { vec4 Value; } g_ROStorageBuff;
+
+uniform samplerBuffer g_UniformTexelBuff;
+layout(rgba32f) readonly uniform imageBuffer g_StorageTexelBuff;
+
+uniform sampler2D g_SampledImage;
+uniform texture2D g_SeparateImages[2];
+uniform sampler   g_Sampler;
+layout(rgba32f) readonly uniform image2D g_StorageImage;
+
+layout(std430) writeonly buffer Output { vec4 Values[]; } g_Output;
+
+void main()
+{
+    g_Output.Values[0]  = g_UniformBuff.Value;
+    g_Output.Values[1]  = g_DynamicBuff.Value;
+    g_Output.Values[2]  = g_UniformBuffArr[0].Value;
+    g_Output.Values[3]  = g_UniformBuffArr[1].Value;
+    g_Output.Values[4]  = g_ROStorageBuff.Value;
+    g_Output.Values[5]  = texelFetch(g_UniformTexelBuff, 0);
+    g_Output.Values[6]  = imageLoad(g_StorageTexelBuff, 0);
+    g_Output.Values[7]  = textureLod(g_SampledImage, vec2(0.5, 0.5), 0.0);
+    g_Output.Values[8]  = textureLod(sampler2D(g_SeparateImages[0], g_Sampler), vec2(0.5, 0.5), 0.0);
+    g_Output.Values[9]  = textureLod(sampler2D(g_SeparateImages[1], g_Sampler), vec2(0.5, 0.5), 0.0);
+    g_Output.Values[10] = imageLoad(g_StorageImage, ivec2(0, 0));
+}
+)";
+
+// clang-format off
+enum TEST_VALUE : Uint32
+{
+    TEST_VALUE_UNIFORM_BUFF = 0,
+    TEST_VALUE_DYNAMIC_BUFF,
+    TEST_VALUE_UNIFORM_BUFF_ARR0,
+    TEST_VALUE_UNIFORM_BUFF_ARR1,
+    TEST_VALUE_RO_STORAGE_BUFF,
+    TEST_VALUE_UNIFORM_TEXEL_BUFF,
+    TEST_VALUE_STORAGE_TEXEL_BUFF,
+    TEST_VALUE_SAMPLED_IMAGE,
+    TEST_VALUE_SEPARATE_IMAGE0,
+    TEST_VALUE_SEPARATE_IMAGE1,
+    TEST_VALUE_STORAGE_IMAGE,
+    TEST_VALUE_COUNT
+};
+// clang-format on
+
+// All values are exactly representable, so they can be compared bitwise
+float4 GetTestValue(Uint32 Value, Uint32 ResourceSet)
+{
+    return float4{static_cast<float>(Value), static_cast<float>(ResourceSet), 0.5f, 1.f};
+}
+
+// A complete set of resources that can be bound to every shader variable
+struct TestResourceSet
+{
+    Uint32 Id = 0;
+
+    RefCntAutoPtr<IBuffer>     pUniformBuff;
+    RefCntAutoPtr<IBuffer>     pDynamicBuff;
+    RefCntAutoPtr<IBuffer>     pUniformBuffArr[2];
+    RefCntAutoPtr<IBuffer>     pROStorageBuff;
+    RefCntAutoPtr<IBuffer>     pUniformTexelBuff;
+    RefCntAutoPtr<IBufferView> pUniformTexelBuffView;
+    RefCntAutoPtr<IBuffer>     pStorageTexelBuff;
+    RefCntAutoPtr<IBufferView> pStorageTexelBuffView;
+    RefCntAutoPtr<ITexture>    pSampledImage;
+    RefCntAutoPtr<ITexture>    pSeparateImages[2];
+    RefCntAutoPtr<ITexture>    pStorageImage;
+    RefCntAutoPtr<ISampler>    pSampler;
+    RefCntAutoPtr<IBuffer>     pOutputBuff;
+};
+
+class DescriptorUpdateTemplateVkTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        auto* pEnv    = TestingEnvironment::GetInstance();
+        auto* pDevice = pEnv->GetDevice();
+        if (!pDevice->GetDeviceCaps().IsVulkanDevice())
+            return;
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_GLSL;
+        ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+        ShaderCI.UseCombinedTextureSamplers = false;
+        ShaderCI.Desc.ShaderType            = SHADER_TYPE_COMPUTE;
+        ShaderCI.Desc.Name                  = "Descriptor update template test CS";
+        ShaderCI.EntryPoint                 = "main";
+        ShaderCI.Source                     = DescriptorUpdateTemplateTestCS;
+
+        RefCntAutoPtr<IShader> pCS;
+        pDevice->CreateShader(ShaderCI, &pCS);
+        ASSERT_NE(pCS, nullptr);
+
+        ComputePipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.Name         = "Descriptor update template test";
+        PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+        // All resources are written to the dynamic descriptor set when the SRB is committed
+        PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
+        PSOCreateInfo.pCS                                        = pCS;
+        pDevice->CreateComputePipelineState(PSOCreateInfo, &sm_pPSO);
+        ASSERT_NE(sm_pPSO, nullptr);
+
+        for (Uint32 i = 0; i < _countof(sm_ResourceSets); ++i)
+            CreateResourceSet(i, sm_ResourceSets[i]);
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = "Descriptor update template test staging buffer";
+        BuffDesc.Usage          = USAGE_STAGING;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+        BuffDesc.uiSizeInBytes  = sizeof(float4) * TEST_VALUE_COUNT;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &sm_pStagingBuff);
+        ASSERT_NE(sm_pStagingBuff, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        for (auto& ResSet : sm_ResourceSets)
+            ResSet = TestResourceSet{};
+        sm_pStagingBuff.Release();
+        sm_pPSO.Release();
+
+        auto* pEnv = TestingEnvironment::GetInstance();
+        pEnv->Reset();
+    }
+
+    void SetUp() override
+    {
+        auto* pEnv = TestingEnvironment::GetInstance();
+        if (!pEnv->GetDevice()->GetDeviceCaps().IsVulkanDevice())
+        {
+            GTEST_SKIP() << "Descriptor update templates are only used by Vulkan backend";
+        }
+        ASSERT_NE(sm_pPSO, nullptr);
+    }
+
+    static RefCntAutoPtr<IBuffer> CreateBuffer(const char* Name, BIND_FLAGS BindFlags, BUFFER_MODE Mode, const float4& Value, USAGE Usage = USAGE_DEFAULT)
+    {
+        auto* pDevice = TestingEnvironment::GetInstance()->GetDevice();
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name          = Name;
+        BuffDesc.Usage         = Usage;
+        BuffDesc.BindFlags     = BindFlags;
+        BuffDesc.Mode          = Mode;
+        BuffDesc.uiSizeInBytes = sizeof(float4);
+        if (Mode != BUFFER_MODE_UNDEFINED)
+            BuffDesc.ElementByteStride = sizeof(float4);
+        if (Usage == USAGE_DYNAMIC)
+            BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+
+        BufferData InitData{&Value, sizeof(Value)};
+
+        RefCntAutoPtr<IBuffer> pBuffer;
+        pDevice->CreateBuffer(BuffDesc, Usage != USAGE_DYNAMIC ? &InitData : nullptr, &pBuffer);
+        VERIFY_EXPR(pBuffer != nullptr);
+        return pBuffer;
+    }
+
+    static RefCntAutoPtr<IBufferView> CreateFormattedView(IBuffer* pBuffer, BUFFER_VIEW_TYPE ViewType)
+    {
+        BufferViewDesc ViewDesc;
+        ViewDesc.ViewType = ViewType;
+        ViewDesc.Format   = BufferFormat{VT_FLOAT32, 4};
+
+        RefCntAutoPtr<IBufferView> pView;
+        pBuffer->CreateView(ViewDesc, &pView);
+        VERIFY_EXPR(pView != nullptr);
+        return pView;
+    }
+
+    static RefCntAutoPtr<ITexture> CreateTexture(const char* Name, BIND_FLAGS BindFlags, const float4& Value)
+    {
+        auto* pDevice = TestingEnvironment::GetInstance()->GetDevice();
+
+        TextureDesc TexDesc;
+        TexDesc.Name      = Name;
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Format    = TEX_FORMAT_RGBA32_FLOAT;
+        TexDesc.BindFlags = BindFlags;
+        TexDesc.Width     = 1;
+        TexDesc.Height    = 1;
+
+        TextureSubResData SubresData{&Value, sizeof(Value)};
+        TextureData       InitData{&SubresData, 1};
+
+        RefCntAutoPtr<ITexture> pTexture;
+        pDevice->CreateTexture(TexDesc, &InitData, &pTexture);
+        VERIFY_EXPR(pTexture != nullptr);
+        return pTexture;
+    }
+
+    static void CreateResourceSet(Uint32 Id, TestResourceSet& ResSet)
+    {
+        auto* pDevice = TestingEnvironment::GetInstance()->GetDevice();
+
+        ResSet.Id = Id;
+
+        // clang-format off
+        ResSet.pUniformBuff       = CreateBuffer("Uniform buffer",          BIND_UNIFORM_BUFFER,    BUFFER_MODE_UNDEFINED,  GetTestValue(TEST_VALUE_UNIFORM_BUFF,      Id));
+        ResSet.pDynamicBuff       = CreateBuffer("Dynamic uniform buffer",  BIND_UNIFORM_BUFFER,    BUFFER_MODE_UNDEFINED,  GetTestValue(TEST_VALUE_DYNAMIC_BUFF,      Id), USAGE_DYNAMIC);
+        ResSet.pUniformBuffArr[0] = CreateBuffer("Uniform buffer array 0",  BIND_UNIFORM_BUFFER,    BUFFER_MODE_UNDEFINED,  GetTestValue(TEST_VALUE_UNIFORM_BUFF_ARR0, Id));
+        ResSet.pUniformBuffArr[1] = CreateBuffer("Uniform buffer array 1",  BIND_UNIFORM_BUFFER,    BUFFER_MODE_UNDEFINED,  GetTestValue(TEST_VALUE_UNIFORM_BUFF_ARR1, Id));
+        ResSet.pROStorageBuff     = CreateBuffer("RO storage buffer",       BIND_SHADER_RESOURCE,   BUFFER_MODE_STRUCTURED, GetTestValue(TEST_VALUE_RO_STORAGE_BUFF,   Id));
+        ResSet.pUniformTexelBuff  = CreateBuffer("Uniform texel buffer",    BIND_SHADER_RESOURCE,   BUFFER_MODE_FORMATTED,  GetTestValue(TEST_VALUE_UNIFORM_TEXEL_BUFF, Id));
+        ResSet.pStorageTexelBuff  = CreateBuffer("Storage texel buffer",    BIND_UNORDERED_ACCESS,  BUFFER_MODE_FORMATTED,  GetTestValue(TEST_VALUE_STORAGE_TEXEL_BUFF, Id));
+        ResSet.pSampledImage      = CreateTexture("Sampled image",          BIND_SHADER_RESOURCE,   GetTestValue(TEST_VALUE_SAMPLED_IMAGE,   Id));
+        ResSet.pSeparateImages[0] = CreateTexture("Separate image 0",       BIND_SHADER_RESOURCE,   GetTestValue(TEST_VALUE_SEPARATE_IMAGE0, Id));
+        ResSet.pSeparateImages[1] = CreateTexture("Separate image 1",       BIND_SHADER_RESOURCE,   GetTestValue(TEST_VALUE_SEPARATE_IMAGE1, Id));
+        ResSet.pStorageImage      = CreateTexture("Storage image",          BIND_UNORDERED_ACCESS,  GetTestValue(TEST_VALUE_STORAGE_IMAGE,   Id));
+        // clang-format on
+
+        ResSet.pUniformTexelBuffView = CreateFormattedView(ResSet.pUniformTexelBuff, BUFFER_VIEW_SHADER_RESOURCE);
+        ResSet.pStorageTexelBuffView = CreateFormattedView(ResSet.pStorageTexelBuff, BUFFER_VIEW_UNORDERED_ACCESS);
+        RecreateOutputBuffer(ResSet);
+
+        SamplerDesc SamDesc;
+        SamDesc.Name      = "Descriptor update template test sampler";
+        SamDesc.MinFilter = FILTER_TYPE_POINT;
+        SamDesc.MagFilter = FILTER_TYPE_POINT;
+        SamDesc.MipFilter = FILTER_TYPE_POINT;
+        pDevice->CreateSampler(SamDesc, &ResSet.pSampler);
+        ASSERT_NE(ResSet.pSampler, nullptr);
+        ResSet.pSampledImage->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE)->SetSampler(ResSet.pSampler);
+    }
+
+    static void RecreateOutputBuffer(TestResourceSet& ResSet)
+    {
+        auto* pDevice = TestingEnvironment::GetInstance()->GetDevice();
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name              = "Output buffer";
+        BuffDesc.BindFlags         = BIND_UNORDERED_ACCESS;
+        BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+        BuffDesc.ElementByteStride = sizeof(float4);
+        BuffDesc.uiSizeInBytes     = sizeof(float4) * TEST_VALUE_COUNT;
+
+        ResSet.pOutputBuff.Release();
+        pDevice->CreateBuffer(BuffDesc, nullptr, &ResSet.pOutputBuff);
+        ASSERT_NE(ResSet.pOutputBuff, nullptr);
+    }
+
+    static void BindResources(IShaderResourceBinding* pSRB, TestResourceSet& ResSet)
+    {
+#define SET_SRB_VAR(VarName, pObj)                                                 \
+    do                                                                             \
+    {                                                                              \
+        auto* pVar = pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, VarName);        \
+        ASSERT_NE(pVar, nullptr) << "Unable to find variable '" << VarName << "'"; \
+        pVar->Set(pObj);                                                           \
+    } while (false)
+
+#define SET_SRB_VAR_ARRAY(VarName, ppObjs, NumObjs)                                \
+    do                                                                             \
+    {                                                                              \
+        auto* pVar = pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, VarName);        \
+        ASSERT_NE(pVar, nullptr) << "Unable to find variable '" << VarName << "'"; \
+        pVar->SetArray(ppObjs, 0, NumObjs);                                        \
+    } while (false)
+
+        // clang-format off
+        IDeviceObject* pUniformBuffArr[] = {ResSet.pUniformBuffArr[0], ResSet.pUniformBuffArr[1]};
+        IDeviceObject* pSeparateImages[] =
+        {
+            ResSet.pSeparateImages[0]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE),
+            ResSet.pSeparateImages[1]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE)
+        };
+
+        SET_SRB_VAR      ("UniformBuff",            ResSet.pUniformBuff);
+        SET_SRB_VAR      ("DynamicBuff",            ResSet.pDynamicBuff);
+        SET_SRB_VAR_ARRAY("UniformBuffArr",         pUniformBuffArr, 2);
+        SET_SRB_VAR      ("ROStorageBuff",          ResSet.pROStorageBuff->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE));
+        SET_SRB_VAR      ("g_UniformTexelBuff",     ResSet.pUniformTexelBuffView);
+        SET_SRB_VAR      ("g_StorageTexelBuff",     ResSet.pStorageTexelBuffView);
+        SET_SRB_VAR      ("g_SampledImage",         ResSet.pSampledImage->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+        SET_SRB_VAR_ARRAY("g_SeparateImages",       pSeparateImages, 2);
+        SET_SRB_VAR      ("g_Sampler",              ResSet.pSampler);
+        SET_SRB_VAR      ("g_StorageImage",         ResSet.pStorageImage->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS));
+        SET_SRB_VAR      ("Output",                 ResSet.pOutputBuff->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+        // clang-format on
+
+#undef SET_SRB_VAR_ARRAY
+#undef SET_SRB_VAR
+    }
+
+    // Runs the shader with the resources currently bound to the SRB and checks that
+    // every element of the output buffer contains the value of the given resource set
+    static void DispatchAndVerify(IShaderResourceBinding* pSRB, TestResourceSet& ResSet)
+    {
+        auto* pContext = TestingEnvironment::GetInstance()->GetDeviceContext();
+
+        {
+            // Dynamic buffer gets a new memory chunk in every map, so the descriptor offset changes every time
+            MapHelper<float4> DynamicData{pContext, ResSet.pDynamicBuff, MAP_WRITE, MAP_FLAG_DISCARD};
+            *DynamicData = GetTestValue(TEST_VALUE_DYNAMIC_BUFF, ResSet.Id);
+        }
+
+        pContext->SetPipelineState(sm_pPSO);
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->DispatchCompute(DispatchComputeAttribs{1, 1, 1});
+
+        pContext->CopyBuffer(ResSet.pOutputBuff, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                             sm_pStagingBuff, 0, sizeof(float4) * TEST_VALUE_COUNT, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->WaitForIdle();
+
+        void* pData = nullptr;
+        pContext->MapBuffer(sm_pStagingBuff, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+        ASSERT_NE(pData, nullptr);
+        const auto* pValues = static_cast<const float4*>(pData);
+        for (Uint32 i = 0; i < TEST_VALUE_COUNT; ++i)
+        {
+            const auto RefValue = GetTestValue(i, ResSet.Id);
+            EXPECT_EQ(memcmp(&pValues[i], &RefValue, sizeof(float4)), 0)
+                << "Value " << i << " of resource set " << ResSet.Id << ": (" << pValues[i].x << ", " << pValues[i].y << ", " << pValues[i].z << ", " << pValues[i].w
+                << "); expected: (" << RefValue.x << ", " << RefValue.y << ", " << RefValue.z << ", " << RefValue.w << ")";
+        }
+        pContext->UnmapBuffer(sm_pStagingBuff, MAP_READ);
+    }
+
+    static RefCntAutoPtr<IPipelineState> sm_pPSO;
+    static RefCntAutoPtr<IBuffer>        sm_pStagingBuff;
+    static TestResourceSet               sm_ResourceSets[2];
+};
+
+RefCntAutoPtr<IPipelineState> DescriptorUpdateTemplateVkTest::sm_pPSO;
+RefCntAutoPtr<IBuffer>        DescriptorUpdateTemplateVkTest::sm_pStagingBuff;
+TestResourceSet               DescriptorUpdateTemplateVkTest::sm_ResourceSets[2];
+
+// Checks that every type of dynamic resource, including arrays and dynamic buffers,
+// is written to the dynamic descriptor set and reaches the shader
+TEST_F(DescriptorUpdateTemplateVkTest, AllResourceTypes)
+{
+    TestingEnvironment::ScopedReleaseResources AutoReleaseResources;
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    sm_pPSO->CreateShaderResourceBinding(&pSRB, false);
+    ASSERT_NE(pSRB, nullptr);
+
+    for (auto& ResSet : sm_ResourceSets)
+    {
+        BindResources(pSRB, ResSet);
+        DispatchAndVerify(pSRB, ResSet);
+    }
+}
+
+// Checks that rebinding dynamic variables between commits updates the descriptors
+TEST_F(DescriptorUpdateTemplateVkTest, Rebind)
+{
+    TestingEnvironment::ScopedReleaseResources AutoReleaseResources;
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    sm_pPSO->CreateShaderResourceBinding(&pSRB, false);
+    ASSERT_NE(pSRB, nullptr);
+
+    for (Uint32 i = 0; i < 4; ++i)
+    {
+        auto& ResSet = sm_ResourceSets[i % _countof(sm_ResourceSets)];
+        BindResources(pSRB, ResSet);
+        DispatchAndVerify(pSRB, ResSet);
+        // Dispatch once more without rebinding to check that the dynamic buffer offset is updated
+        DispatchAndVerify(pSRB, ResSet);
+    }
+
+    // Output buffer recreation must be picked up by the next commit
+    auto& ResSet = sm_ResourceSets[0];
+    RecreateOutputBuffer(ResSet);
+    pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "Output")->Set(ResSet.pOutputBuff->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+    DispatchAndVerify(pSRB, ResSet);
+}
+
+// Checks that a sampler assigned to a texture view after the view has been bound
+// is used by the next commit rather than the released sampler
+TEST_F(DescriptorUpdateTemplateVkTest, SamplerReplacedAfterBinding)
+{
+    auto* pDevice  = TestingEnvironment::GetInstance()->GetDevice();
+    auto* pContext = TestingEnvironment::GetInstance()->GetDeviceContext();
+
+    TestingEnvironment::ScopedReleaseResources AutoReleaseResources;
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    sm_pPSO->CreateShaderResourceBinding(&pSRB, false);
+    ASSERT_NE(pSRB, nullptr);
+
+    auto& ResSet = sm_ResourceSets[0];
+    auto* pView  = ResSet.pSampledImage->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+
+    RefCntAutoPtr<ISampler> pTmpSampler;
+    {
+        SamplerDesc SamDesc;
+        SamDesc.Name      = "Descriptor update template test temporary sampler";
+        SamDesc.MinFilter = FILTER_TYPE_LINEAR;
+        SamDesc.MagFilter = FILTER_TYPE_LINEAR;
+        SamDesc.MipFilter = FILTER_TYPE_LINEAR;
+        pDevice->CreateSampler(SamDesc, &pTmpSampler);
+        ASSERT_NE(pTmpSampler, nullptr);
+    }
+
+    pView->SetSampler(pTmpSampler);
+    BindResources(pSRB, ResSet);
+    DispatchAndVerify(pSRB, ResSet);
+
+    // Replace the sampler without rebinding the view and destroy the old one
+    pView->SetSampler(ResSet.pSampler);
+    pTmpSampler.Release();
+    pContext->Flush();
+    pContext->FinishFrame();
+    pDevice->ReleaseStaleResources();
+
+    DispatchAndVerify(pSRB, ResSet);
+}
+
+// Measures the CPU time of committing an SRB with a dynamic descriptor set
+TEST_F(DescriptorUpdateTemplateVkTest, DISABLED_CommitTime)
+{
+    auto* pContext = TestingEnvironment::GetInstance()->GetDeviceContext();
+
+    TestingEnvironment::ScopedReleaseResources AutoReleaseResources;
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    sm_pPSO->CreateShaderResourceBinding(&pSRB, false);
+    ASSERT_NE(pSRB, nullptr);
+    BindResources(pSRB, sm_ResourceSets[0]);
+
+    {
+        MapHelper<float4> DynamicData{pContext, sm_ResourceSets[0].pDynamicBuff, MAP_WRITE, MAP_FLAG_DISCARD};
+        *DynamicData = GetTestValue(TEST_VALUE_DYNAMIC_BUFF, 0);
+    }
+
+    pContext->SetPipelineState(sm_pPSO);
+    // Transition resources once so that the loop only measures descriptor set allocation and update
+    pContext->TransitionShaderResources(sm_pPSO, pSRB);
+
+    constexpr Uint32 NumFrames       = 16;
+    constexpr Uint32 CommitsPerFrame = 1024;
+
+    Timer      T;
+    const auto StartTime = T.GetElapsedTime();
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        for (Uint32 i = 0; i < CommitsPerFrame; ++i)
+            pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+        // Release dynamic descriptor sets allocated in this frame
+        pContext->Flush();
+        pContext->FinishFrame();
+    }
+    const auto CommitTime = T.GetElapsedTime() - StartTime;
+    pContext->WaitForIdle();
+
+    LOG_INFO_MESSAGE("Committed an SRB with ", pSRB->GetVariableCount(SHADER_TYPE_COMPUTE), " dynamic variables ", NumFrames * CommitsPerFrame,
+                     " times in ", CommitTime * 1000.0, " ms (", CommitTime * 1e+9 / (NumFrames * CommitsPerFrame), " ns per commit)");
+}
+
+} // namespace
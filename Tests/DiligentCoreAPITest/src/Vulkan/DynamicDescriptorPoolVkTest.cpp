@@ -0,0 +1,236 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+#include <thread>
+
+#include "TestingEnvironment.hpp"
+
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Both variables are dynamic, so every commit allocates a new descriptor set from the dynamic
+// descriptor pools of the context
+const char* const DynamicDescriptorPoolTestCS = R"(
+layout(local_size_x = 1) in;
+
+layout(std140) uniform Constants { vec4 Value; } g_Constants;
+layout(std430) writeonly buffer Output { vec4 Values[]; } g_Output;
+
+void main()
+{
+    g_Output.Values[0] = g_Constants.Value;
+}
+)";
+
+class DynamicDescriptorPoolVkTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        auto* pEnv     = TestingEnvironment::GetInstance();
+        auto* pDevice  = pEnv->GetDevice();
+        auto* pContext = pEnv->GetDeviceContext();
+        if (!pDevice->GetDeviceCaps().IsVulkanDevice() || pEnv->GetNumDeferredContexts() == 0)
+            return;
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage  = SHADER_SOURCE_LANGUAGE_GLSL;
+        ShaderCI.ShaderCompiler  = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_COMPUTE;
+        ShaderCI.Desc.Name       = "Dynamic descriptor pool test CS";
+        ShaderCI.EntryPoint      = "main";
+        ShaderCI.Source          = DynamicDescriptorPoolTestCS;
+
+        RefCntAutoPtr<IShader> pCS;
+        pDevice->CreateShader(ShaderCI, &pCS);
+        ASSERT_NE(pCS, nullptr);
+
+        ComputePipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.Name                               = "Dynamic descriptor pool test";
+        PSOCreateInfo.PSODesc.PipelineType                       = PIPELINE_TYPE_COMPUTE;
+        PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
+        PSOCreateInfo.pCS                                        = pCS;
+        pDevice->CreateComputePipelineState(PSOCreateInfo, &sm_pPSO);
+        ASSERT_NE(sm_pPSO, nullptr);
+
+        BufferDesc ConstBuffDesc;
+        ConstBuffDesc.Name          = "Dynamic descriptor pool test constants";
+        ConstBuffDesc.BindFlags     = BIND_UNIFORM_BUFFER;
+        ConstBuffDesc.uiSizeInBytes = 16;
+
+        BufferDesc OutputBuffDesc;
+        OutputBuffDesc.Name              = "Dynamic descriptor pool test output";
+        OutputBuffDesc.BindFlags         = BIND_UNORDERED_ACCESS;
+        OutputBuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+        OutputBuffDesc.ElementByteStride = 16;
+        OutputBuffDesc.uiSizeInBytes     = 16;
+
+        // Every deferred context uses its own SRB and resources
+        sm_SRBs.resize(pEnv->GetNumDeferredContexts());
+        for (auto& pSRB : sm_SRBs)
+        {
+            RefCntAutoPtr<IBuffer> pConstBuff;
+            pDevice->CreateBuffer(ConstBuffDesc, nullptr, &pConstBuff);
+            ASSERT_NE(pConstBuff, nullptr);
+
+            RefCntAutoPtr<IBuffer> pOutputBuff;
+            pDevice->CreateBuffer(OutputBuffDesc, nullptr, &pOutputBuff);
+            ASSERT_NE(pOutputBuff, nullptr);
+
+            sm_pPSO->CreateShaderResourceBinding(&pSRB);
+            ASSERT_NE(pSRB, nullptr);
+            pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "Constants")->Set(pConstBuff);
+            pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "Output")->Set(pOutputBuff->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+
+            // Transition resources in the immediate context so that deferred contexts
+            // only verify the states and do not access shared state tracking
+            pContext->TransitionShaderResources(sm_pPSO, pSRB);
+        }
+        pContext->Flush();
+    }
+
+    static void TearDownTestSuite()
+    {
+        sm_SRBs.clear();
+        sm_pPSO.Release();
+
+        auto* pEnv = TestingEnvironment::GetInstance();
+        pEnv->Reset();
+    }
+
+    void SetUp() override
+    {
+        auto* pEnv = TestingEnvironment::GetInstance();
+        if (!pEnv->GetDevice()->GetDeviceCaps().IsVulkanDevice() || pEnv->GetNumDeferredContexts() == 0)
+        {
+            GTEST_SKIP() << "Dynamic descriptor pools are specific to Vulkan backend";
+        }
+        ASSERT_NE(sm_pPSO, nullptr);
+    }
+
+    // Records NumDispatches dispatch commands using deferred context Ctx. Every dispatch commits
+    // the SRB, which allocates a new dynamic descriptor set.
+    static void RecordCommandList(Uint32 Ctx, Uint32 NumDispatches, RefCntAutoPtr<ICommandList>& pCmdList)
+    {
+        auto* pEnv     = TestingEnvironment::GetInstance();
+        auto* pContext = pEnv->GetDeferredContext(Ctx);
+
+        pContext->SetPipelineState(sm_pPSO);
+        DispatchComputeAttribs DispatchAttrs{1, 1, 1};
+        for (Uint32 i = 0; i < NumDispatches; ++i)
+        {
+            pContext->CommitShaderResources(sm_SRBs[Ctx], RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+            pContext->DispatchCompute(DispatchAttrs);
+        }
+
+        pContext->FinishCommandList(&pCmdList);
+    }
+
+    // Records command lists in NumThreads threads in parallel for NumFrames frames and executes them.
+    // Returns the total time it took to record the command lists.
+    static double RecordFrames(Uint32 NumThreads, Uint32 NumFrames, Uint32 NumDispatchesPerThread)
+    {
+        auto* pEnv     = TestingEnvironment::GetInstance();
+        auto* pContext = pEnv->GetDeviceContext();
+
+        double RecordTime = 0;
+        for (Uint32 frame = 0; frame < NumFrames; ++frame)
+        {
+            std::vector<RefCntAutoPtr<ICommandList>> CmdLists(NumThreads);
+            std::vector<std::thread>                 Threads;
+
+            Timer T;
+
+            auto StartTime = T.GetElapsedTime();
+            for (Uint32 t = 0; t < NumThreads; ++t)
+                Threads.emplace_back(RecordCommandList, t, NumDispatchesPerThread, std::ref(CmdLists[t]));
+            for (auto& Thread : Threads)
+                Thread.join();
+            RecordTime += T.GetElapsedTime() - StartTime;
+
+            for (Uint32 t = 0; t < NumThreads; ++t)
+            {
+                EXPECT_NE(CmdLists[t], nullptr);
+                pContext->ExecuteCommandList(CmdLists[t]);
+            }
+            pContext->Flush();
+
+            // Deferred contexts release their dynamic descriptor pools when the frame is finished.
+            // Pools are recycled by the context once the GPU completes the frame.
+            for (Uint32 t = 0; t < NumThreads; ++t)
+                pEnv->GetDeferredContext(t)->FinishFrame();
+            pContext->FinishFrame();
+        }
+        pContext->WaitForIdle();
+
+        return RecordTime;
+    }
+
+    static RefCntAutoPtr<IPipelineState>                      sm_pPSO;
+    static std::vector<RefCntAutoPtr<IShaderResourceBinding>> sm_SRBs;
+};
+
+RefCntAutoPtr<IPipelineState>                      DynamicDescriptorPoolVkTest::sm_pPSO;
+std::vector<RefCntAutoPtr<IShaderResourceBinding>> DynamicDescriptorPoolVkTest::sm_SRBs;
+
+// Records more frames than the contexts keep in flight, so that released pools are
+// reset and reused by the contexts that allocated them
+TEST_F(DynamicDescriptorPoolVkTest, RecycleAcrossFrames)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+
+    RecordFrames(pEnv->GetNumDeferredContexts(), 8, 1024);
+}
+
+// Measures how recording of the same number of commits with dynamic descriptor sets
+// scales with the number of threads that record command lists in deferred contexts
+TEST_F(DynamicDescriptorPoolVkTest, DISABLED_MultithreadedRecording)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+
+    constexpr Uint32 NumFrames     = 16;
+    constexpr Uint32 NumDispatches = 8192;
+    for (Uint32 NumThreads = 1; NumThreads <= pEnv->GetNumDeferredContexts(); ++NumThreads)
+    {
+        // Warm up the pool chains of all contexts so that only the steady state is measured
+        RecordFrames(NumThreads, 4, NumDispatches / NumThreads);
+
+        const auto RecordTime = RecordFrames(NumThreads, NumFrames, NumDispatches / NumThreads);
+        LOG_INFO_MESSAGE("Recorded ", NumFrames, " frames of ", NumDispatches, " dynamic SRB commits in ", NumThreads,
+                         " thread(s) in ", RecordTime * 1000.0, " ms (", RecordTime * 1000.0 / NumFrames, " ms per frame)");
+    }
+}
+
+} // namespace
@@ -0,0 +1,289 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+#include <string>
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "RenderDeviceVk.h"
+#include "EngineFactoryVk.h"
+#include "Timer.hpp"
+
+#include "volk/volk.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Layout of VK_PIPELINE_CACHE_HEADER_VERSION_ONE header
+struct PipelineCacheHeader
+{
+    uint32_t HeaderSize;
+    uint32_t HeaderVersion;
+    uint32_t VendorID;
+    uint32_t DeviceID;
+    uint8_t  PipelineCacheUUID[VK_UUID_SIZE];
+};
+
+// Every variant produces a different shader, so the driver has to compile every pipeline
+std::string GetTestComputeShader(int Variant)
+{
+    // The engine prepends the GLSL version directive
+    return std::string{
+               "layout(local_size_x = 64) in;\n"
+               "layout(std430, binding = 0) buffer Data { float data[]; } g_Data;\n"
+               "void main()\n"
+               "{\n"
+               "    uint  idx = gl_GlobalInvocationID.x;\n"
+               "    float val = g_Data.data[idx];\n"
+               "    for (int i = 0; i < "} +
+        std::to_string(4 + Variant) +
+        "; ++i)\n"
+        "        val = sin(val * float(i + " +
+        std::to_string(Variant) +
+        ")) + cos(val);\n"
+        "    g_Data.data[idx] = val;\n"
+        "}\n";
+}
+
+TEST(PipelineCacheVkTest, GetPipelineCacheData)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceCaps().IsVulkanDevice())
+    {
+        GTEST_SKIP();
+    }
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    RefCntAutoPtr<IDataBlob> pCacheData;
+    pDeviceVk->GetPipelineCacheData(&pCacheData);
+    ASSERT_NE(pCacheData, nullptr);
+    ASSERT_GE(pCacheData->GetSize(), sizeof(PipelineCacheHeader));
+
+    PipelineCacheHeader Header;
+    memcpy(&Header, pCacheData->GetConstDataPtr(), sizeof(Header));
+
+    VkPhysicalDeviceProperties DeviceProps = {};
+    vkGetPhysicalDeviceProperties(pDeviceVk->GetVkPhysicalDevice(), &DeviceProps);
+    EXPECT_EQ(Header.HeaderVersion, static_cast<uint32_t>(VK_PIPELINE_CACHE_HEADER_VERSION_ONE));
+    EXPECT_EQ(Header.VendorID, DeviceProps.vendorID);
+    EXPECT_EQ(Header.DeviceID, DeviceProps.deviceID);
+    EXPECT_EQ(memcmp(Header.PipelineCacheUUID, DeviceProps.pipelineCacheUUID, VK_UUID_SIZE), 0);
+}
+
+// Device created through the engine API with the given initial pipeline cache data
+struct PipelineCacheTestDevice
+{
+    PipelineCacheTestDevice(const void* pCacheData, size_t CacheDataSize)
+    {
+#if EXPLICITLY_LOAD_ENGINE_VK_DLL
+        auto GetEngineFactoryVk = LoadGraphicsEngineVk();
+        if (GetEngineFactoryVk == nullptr)
+            return;
+#endif
+        // Debug message callback is not set, so that the callback of the testing environment stays in place
+        EngineVkCreateInfo CreateInfo;
+        CreateInfo.EnableValidation      = true;
+        CreateInfo.pPipelineCacheData    = pCacheData;
+        CreateInfo.PipelineCacheDataSize = CacheDataSize;
+        GetEngineFactoryVk()->CreateDeviceAndContextsVk(CreateInfo, &pDevice, &pContext);
+    }
+
+    ~PipelineCacheTestDevice()
+    {
+        pContext.Release();
+        pDevice.Release();
+
+        // Every device reloads the global Vulkan entry points, so restore the
+        // entry points of the device used by the testing environment
+        RefCntAutoPtr<IRenderDeviceVk> pEnvDeviceVk{TestingEnvironment::GetInstance()->GetDevice(), IID_RenderDeviceVk};
+        volkLoadInstance(pEnvDeviceVk->GetVkInstance());
+        volkLoadDevice(pEnvDeviceVk->GetVkDevice());
+    }
+
+    RefCntAutoPtr<IDataBlob> GetPipelineCacheData()
+    {
+        RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+        RefCntAutoPtr<IDataBlob>       pCacheData;
+        pDeviceVk->GetPipelineCacheData(&pCacheData);
+        return pCacheData;
+    }
+
+    // Creates compute pipelines through the engine and returns the time it took.
+    // Shaders are created before the timer is started, so that only pipeline creation is measured.
+    double CreatePipelines(int NumPipelines)
+    {
+        std::vector<std::string>            Sources(NumPipelines);
+        std::vector<RefCntAutoPtr<IShader>> Shaders(NumPipelines);
+        for (int i = 0; i < NumPipelines; ++i)
+        {
+            Sources[i] = GetTestComputeShader(i);
+
+            ShaderCreateInfo ShaderCI;
+            ShaderCI.SourceLanguage  = SHADER_SOURCE_LANGUAGE_GLSL;
+            ShaderCI.Desc.ShaderType = SHADER_TYPE_COMPUTE;
+            ShaderCI.Desc.Name       = "Pipeline cache test CS";
+            ShaderCI.EntryPoint      = "main";
+            ShaderCI.Source          = Sources[i].c_str();
+            pDevice->CreateShader(ShaderCI, &Shaders[i]);
+            EXPECT_NE(Shaders[i], nullptr);
+        }
+
+        Timer      T;
+        const auto StartTime = T.GetElapsedTime();
+        for (int i = 0; i < NumPipelines; ++i)
+        {
+            ComputePipelineStateCreateInfo PSOCreateInfo;
+            PSOCreateInfo.PSODesc.Name         = "Pipeline cache test";
+            PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+            PSOCreateInfo.pCS                  = Shaders[i];
+
+            RefCntAutoPtr<IPipelineState> pPSO;
+            pDevice->CreateComputePipelineState(PSOCreateInfo, &pPSO);
+            EXPECT_NE(pPSO, nullptr);
+        }
+        return T.GetElapsedTime() - StartTime;
+    }
+
+    RefCntAutoPtr<IRenderDevice>  pDevice;
+    RefCntAutoPtr<IDeviceContext> pContext;
+};
+
+// Measures pipeline creation time on a device created with an empty pipeline cache (cold start)
+// and on a device created with the cache data saved by the previous device (warm start).
+TEST(PipelineCacheVkTest, DISABLED_StartupBenchmark)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceCaps().IsVulkanDevice())
+    {
+        GTEST_SKIP();
+    }
+
+    constexpr int NumPipelines = 32;
+
+    RefCntAutoPtr<IDataBlob> pCacheData;
+    double                   ColdTime = 0;
+    {
+        PipelineCacheTestDevice ColdDevice{nullptr, 0};
+        ASSERT_NE(ColdDevice.pDevice, nullptr);
+        ColdTime   = ColdDevice.CreatePipelines(NumPipelines);
+        pCacheData = ColdDevice.GetPipelineCacheData();
+    }
+    ASSERT_NE(pCacheData, nullptr);
+
+    double WarmTime = 0;
+    {
+        PipelineCacheTestDevice WarmDevice{pCacheData->GetConstDataPtr(), pCacheData->GetSize()};
+        ASSERT_NE(WarmDevice.pDevice, nullptr);
+        WarmTime = WarmDevice.CreatePipelines(NumPipelines);
+    }
+
+    LOG_INFO_MESSAGE("Created ", NumPipelines, " compute pipelines. Empty pipeline cache: ", ColdTime * 1000.0,
+                     " ms; pipeline cache initialized from ", pCacheData->GetSize(), " bytes of saved data: ", WarmTime * 1000.0, " ms");
+}
+
+// Checks that the device ignores pipeline cache data with an incompatible header
+TEST(PipelineCacheVkTest, IncompatibleCacheData)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceCaps().IsVulkanDevice())
+    {
+        GTEST_SKIP();
+    }
+
+    constexpr int NumPipelines = 8;
+
+    RefCntAutoPtr<IDataBlob> pCacheData;
+    {
+        PipelineCacheTestDevice SrcDevice{nullptr, 0};
+        ASSERT_NE(SrcDevice.pDevice, nullptr);
+        SrcDevice.CreatePipelines(NumPipelines);
+        pCacheData = SrcDevice.GetPipelineCacheData();
+    }
+    ASSERT_NE(pCacheData, nullptr);
+    ASSERT_GT(pCacheData->GetSize(), sizeof(PipelineCacheHeader));
+
+    const auto*              pSrcData = static_cast<const Uint8*>(pCacheData->GetConstDataPtr());
+    const std::vector<Uint8> SrcData(pSrcData, pSrcData + pCacheData->GetSize());
+
+    size_t LoadedCacheSize = 0;
+    {
+        PipelineCacheTestDevice Device{SrcData.data(), SrcData.size()};
+        ASSERT_NE(Device.pDevice, nullptr);
+        LoadedCacheSize = Device.GetPipelineCacheData()->GetSize();
+    }
+
+    size_t EmptyCacheSize = 0;
+    {
+        PipelineCacheTestDevice Device{nullptr, 0};
+        ASSERT_NE(Device.pDevice, nullptr);
+        EmptyCacheSize = Device.GetPipelineCacheData()->GetSize();
+    }
+    // The device created with compatible data must contain the pipelines from that data
+    ASSERT_GT(LoadedCacheSize, EmptyCacheSize);
+
+    auto TestCorruptedData = [&](const char* Corruption, std::vector<Uint8> Data) //
+    {
+        PipelineCacheTestDevice Device{Data.data(), Data.size()};
+        ASSERT_NE(Device.pDevice, nullptr) << Corruption;
+
+        // If the data were accepted, the cache would contain all pipelines from it
+        EXPECT_LT(Device.GetPipelineCacheData()->GetSize(), LoadedCacheSize) << Corruption;
+
+        // The device must still be able to create pipelines
+        Device.CreatePipelines(1);
+    };
+
+    auto ModifyHeader = [&](void (*Modify)(PipelineCacheHeader&)) //
+    {
+        auto                Data = SrcData;
+        PipelineCacheHeader Header;
+        memcpy(&Header, Data.data(), sizeof(Header));
+        Modify(Header);
+        memcpy(Data.data(), &Header, sizeof(Header));
+        return Data;
+    };
+
+    TestCorruptedData("Truncated header", std::vector<Uint8>(SrcData.begin(), SrcData.begin() + sizeof(PipelineCacheHeader) - 1));
+    TestCorruptedData("Header version", ModifyHeader([](PipelineCacheHeader& Header) { Header.HeaderVersion += 1; }));
+    TestCorruptedData("Header size", ModifyHeader([](PipelineCacheHeader& Header) { Header.HeaderSize = ~0u; }));
+    TestCorruptedData("Vendor id", ModifyHeader([](PipelineCacheHeader& Header) { Header.VendorID += 1; }));
+    TestCorruptedData("Device id", ModifyHeader([](PipelineCacheHeader& Header) { Header.DeviceID += 1; }));
+    TestCorruptedData("Pipeline cache UUID", ModifyHeader([](PipelineCacheHeader& Header) { Header.PipelineCacheUUID[0] ^= 0xFF; }));
+}
+
+} // namespace
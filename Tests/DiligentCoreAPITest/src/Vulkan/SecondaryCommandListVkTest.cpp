@@ -0,0 +1,407 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#include <vector>
+#include <thread>
+
+#include "TestingEnvironment.hpp"
+
+#include "DeviceContextVk.h"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Every deferred context draws a quad that covers its own vertical strip of the render target
+// with its own color, so that the contents of every secondary command list can be verified
+const char* const SecondaryCommandListTestVS = R"(
+cbuffer Constants
+{
+    float4 g_Rect; // x0, y0, x1, y1 in normalized device coordinates
+    float4 g_Color;
+};
+
+struct PSInput
+{
+    float4 Pos   : SV_POSITION;
+    float4 Color : COLOR;
+};
+
+void main(in  uint    VertId : SV_VertexID,
+          out PSInput PSIn)
+{
+    float2 Pos[6];
+    Pos[0] = g_Rect.xy;
+    Pos[1] = g_Rect.xw;
+    Pos[2] = g_Rect.zw;
+
+    Pos[3] = g_Rect.xy;
+    Pos[4] = g_Rect.zw;
+    Pos[5] = g_Rect.zy;
+
+    PSIn.Pos   = float4(Pos[VertId], 0.0, 1.0);
+    PSIn.Color = g_Color;
+}
+)";
+
+const char* const SecondaryCommandListTestPS = R"(
+struct PSInput
+{
+    float4 Pos   : SV_POSITION;
+    float4 Color : COLOR;
+};
+
+float4 main(in PSInput PSIn) : SV_Target
+{
+    return PSIn.Color;
+}
+)";
+
+struct SecondaryCommandListTestConstants
+{
+    float Rect[4];
+    float Color[4];
+};
+
+// Returns a unique non-black color for every context
+SecondaryCommandListTestConstants GetTestConstants(Uint32 Ctx, Uint32 NumContexts)
+{
+    SecondaryCommandListTestConstants Constants;
+
+    Constants.Rect[0] = -1.f + 2.f * static_cast<float>(Ctx) / static_cast<float>(NumContexts);
+    Constants.Rect[1] = -1.f;
+    Constants.Rect[2] = -1.f + 2.f * static_cast<float>(Ctx + 1) / static_cast<float>(NumContexts);
+    Constants.Rect[3] = +1.f;
+
+    Constants.Color[0] = static_cast<float>((Ctx + 1) & 0x01);
+    Constants.Color[1] = static_cast<float>(((Ctx + 1) >> 1) & 0x01);
+    Constants.Color[2] = static_cast<float>(((Ctx + 1) >> 2) & 0x01);
+    Constants.Color[3] = 1.f;
+
+    return Constants;
+}
+
+class SecondaryCommandListVkTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        auto* pEnv    = TestingEnvironment::GetInstance();
+        auto* pDevice = pEnv->GetDevice();
+        if (!pDevice->GetDeviceCaps().IsVulkanDevice() || pEnv->GetNumDeferredContexts() == 0)
+            return;
+
+        RenderPassAttachmentDesc Attachments[1];
+        Attachments[0].Format       = TEX_FORMAT_RGBA8_UNORM;
+        Attachments[0].InitialState = RESOURCE_STATE_RENDER_TARGET;
+        Attachments[0].FinalState   = RESOURCE_STATE_RENDER_TARGET;
+        Attachments[0].LoadOp       = ATTACHMENT_LOAD_OP_CLEAR;
+        Attachments[0].StoreOp      = ATTACHMENT_STORE_OP_STORE;
+
+        AttachmentReference RTAttachmentRef{0, RESOURCE_STATE_RENDER_TARGET};
+
+        SubpassDesc Subpass;
+        Subpass.RenderTargetAttachmentCount = 1;
+        Subpass.pRenderTargetAttachments    = &RTAttachmentRef;
+
+        RenderPassDesc RPDesc;
+        RPDesc.Name            = "Secondary command list test render pass";
+        RPDesc.AttachmentCount = _countof(Attachments);
+        RPDesc.pAttachments    = Attachments;
+        RPDesc.SubpassCount    = 1;
+        RPDesc.pSubpasses      = &Subpass;
+        pDevice->CreateRenderPass(RPDesc, &sm_pRenderPass);
+        ASSERT_NE(sm_pRenderPass, nullptr);
+
+        // Use small render target so that the benchmark measures command recording rather than fill rate
+        sm_pRenderTarget = pEnv->CreateTexture("Secondary command list test render target", TEX_FORMAT_RGBA8_UNORM, BIND_RENDER_TARGET, 64, 64);
+        ASSERT_NE(sm_pRenderTarget, nullptr);
+
+        ITextureView* pRTAttachments[] = {sm_pRenderTarget->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET)};
+
+        FramebufferDesc FBDesc;
+        FBDesc.Name            = "Secondary command list test framebuffer";
+        FBDesc.pRenderPass     = sm_pRenderPass;
+        FBDesc.AttachmentCount = _countof(pRTAttachments);
+        FBDesc.ppAttachments   = pRTAttachments;
+        pDevice->CreateFramebuffer(FBDesc, &sm_pFramebuffer);
+        ASSERT_NE(sm_pFramebuffer, nullptr);
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+        ShaderCI.UseCombinedTextureSamplers = true;
+
+        RefCntAutoPtr<IShader> pVS;
+        {
+            ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+            ShaderCI.EntryPoint      = "main";
+            ShaderCI.Desc.Name       = "Secondary command list test vertex shader";
+            ShaderCI.Source          = SecondaryCommandListTestVS;
+            pDevice->CreateShader(ShaderCI, &pVS);
+            ASSERT_NE(pVS, nullptr);
+        }
+
+        RefCntAutoPtr<IShader> pPS;
+        {
+            ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+            ShaderCI.EntryPoint      = "main";
+            ShaderCI.Desc.Name       = "Secondary command list test pixel shader";
+            ShaderCI.Source          = SecondaryCommandListTestPS;
+            pDevice->CreateShader(ShaderCI, &pPS);
+            ASSERT_NE(pPS, nullptr);
+        }
+
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+        PipelineStateDesc&              PSODesc          = PSOCreateInfo.PSODesc;
+        GraphicsPipelineDesc&           GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+        PSODesc.Name = "Secondary command list test - draw triangles";
+
+        PSODesc.PipelineType                          = PIPELINE_TYPE_GRAPHICS;
+        GraphicsPipeline.pRenderPass                  = sm_pRenderPass;
+        GraphicsPipeline.SubpassIndex                 = 0;
+        GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+        GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+        PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+
+        PSOCreateInfo.pVS = pVS;
+        PSOCreateInfo.pPS = pPS;
+
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &sm_pPSO);
+        ASSERT_NE(sm_pPSO, nullptr);
+
+        auto* pContext = pEnv->GetDeviceContext();
+
+        sm_SRBs.resize(pEnv->GetNumDeferredContexts());
+        for (Uint32 Ctx = 0; Ctx < pEnv->GetNumDeferredContexts(); ++Ctx)
+        {
+            const auto Constants = GetTestConstants(Ctx, pEnv->GetNumDeferredContexts());
+
+            BufferDesc BuffDesc;
+            BuffDesc.Name          = "Secondary command list test constants";
+            BuffDesc.Usage         = USAGE_IMMUTABLE;
+            BuffDesc.BindFlags     = BIND_UNIFORM_BUFFER;
+            BuffDesc.uiSizeInBytes = sizeof(Constants);
+
+            BufferData InitData{&Constants, sizeof(Constants)};
+
+            RefCntAutoPtr<IBuffer> pConstants;
+            pDevice->CreateBuffer(BuffDesc, &InitData, &pConstants);
+            ASSERT_NE(pConstants, nullptr);
+
+            auto& pSRB = sm_SRBs[Ctx];
+            sm_pPSO->CreateShaderResourceBinding(&pSRB);
+            ASSERT_NE(pSRB, nullptr);
+            pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "Constants")->Set(pConstants);
+
+            // State transitions are not allowed inside render pass, so transition resources in advance
+            pContext->TransitionShaderResources(sm_pPSO, pSRB);
+        }
+
+        TextureDesc StagingTexDesc    = sm_pRenderTarget->GetDesc();
+        StagingTexDesc.Name           = "Secondary command list test staging texture";
+        StagingTexDesc.Usage          = USAGE_STAGING;
+        StagingTexDesc.CPUAccessFlags = CPU_ACCESS_READ;
+        StagingTexDesc.BindFlags      = BIND_NONE;
+        pDevice->CreateTexture(StagingTexDesc, nullptr, &sm_pStagingTexture);
+        ASSERT_NE(sm_pStagingTexture, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        sm_SRBs.clear();
+        sm_pPSO.Release();
+        sm_pFramebuffer.Release();
+        sm_pRenderPass.Release();
+        sm_pRenderTarget.Release();
+        sm_pStagingTexture.Release();
+
+        auto* pEnv = TestingEnvironment::GetInstance();
+        pEnv->Reset();
+    }
+
+    void SetUp() override
+    {
+        auto* pEnv = TestingEnvironment::GetInstance();
+        if (!pEnv->GetDevice()->GetDeviceCaps().IsVulkanDevice() || pEnv->GetNumDeferredContexts() == 0)
+        {
+            GTEST_SKIP() << "Secondary command lists are only supported in Vulkan backend";
+        }
+    }
+
+    // Records NumDraws draw commands into a secondary command list using deferred context Ctx
+    static void RecordSecondaryCommandList(Uint32 Ctx, Uint32 NumDraws, RefCntAutoPtr<ICommandList>& pCmdList)
+    {
+        auto* pEnv     = TestingEnvironment::GetInstance();
+        auto* pContext = pEnv->GetDeferredContext(Ctx);
+
+        RefCntAutoPtr<IDeviceContextVk> pContextVk{pContext, IID_DeviceContextVk};
+        pContextVk->BeginSecondaryCommandList(sm_pRenderPass, 0, sm_pFramebuffer);
+
+        pContext->SetPipelineState(sm_pPSO);
+        // State transitions are not allowed inside render pass
+        pContext->CommitShaderResources(sm_SRBs[Ctx], RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+
+        DrawAttribs DrawAttrs{6, DRAW_FLAG_VERIFY_ALL};
+        for (Uint32 i = 0; i < NumDraws; ++i)
+            pContext->Draw(DrawAttrs);
+
+        pContext->FinishCommandList(&pCmdList);
+    }
+
+    // Records secondary command lists in NumThreads threads in parallel and executes them
+    // in a single render pass. Returns the time it took to record the command lists.
+    static double RenderParallel(Uint32 NumThreads, Uint32 NumDrawsPerThread)
+    {
+        auto* pEnv     = TestingEnvironment::GetInstance();
+        auto* pContext = pEnv->GetDeviceContext();
+
+        std::vector<RefCntAutoPtr<ICommandList>> CmdLists(NumThreads);
+        std::vector<std::thread>                 Threads;
+
+        Timer T;
+
+        auto StartTime = T.GetElapsedTime();
+        for (Uint32 t = 0; t < NumThreads; ++t)
+            Threads.emplace_back(RecordSecondaryCommandList, t, NumDrawsPerThread, std::ref(CmdLists[t]));
+        for (auto& Thread : Threads)
+            Thread.join();
+        const auto RecordTime = T.GetElapsedTime() - StartTime;
+
+        OptimizedClearValue ClearValue;
+        ClearValue.Color[0] = 0.25f;
+        ClearValue.Color[3] = 1.f;
+
+        BeginRenderPassAttribs RPBeginInfo;
+        RPBeginInfo.pRenderPass         = sm_pRenderPass;
+        RPBeginInfo.pFramebuffer        = sm_pFramebuffer;
+        RPBeginInfo.ClearValueCount     = 1;
+        RPBeginInfo.pClearValues        = &ClearValue;
+        RPBeginInfo.StateTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+        RPBeginInfo.SubpassContents     = SUBPASS_CONTENTS_SECONDARY_COMMAND_LISTS;
+        pContext->BeginRenderPass(RPBeginInfo);
+
+        std::vector<ICommandList*> ppCmdLists(NumThreads);
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            EXPECT_NE(CmdLists[t], nullptr);
+            ppCmdLists[t] = CmdLists[t];
+        }
+
+        RefCntAutoPtr<IDeviceContextVk> pContextVk{pContext, IID_DeviceContextVk};
+        pContextVk->ExecuteSecondaryCommandLists(NumThreads, ppCmdLists.data());
+
+        pContext->EndRenderPass();
+        pContext->Flush();
+
+        // Deferred contexts must not finish the frame until the immediate context is flushed
+        for (Uint32 t = 0; t < NumThreads; ++t)
+            pEnv->GetDeferredContext(t)->FinishFrame();
+        pContext->FinishFrame();
+
+        return RecordTime;
+    }
+
+    // Reads back the render target and checks that the center of every strip
+    // has the color of the context that draws it
+    static void VerifyRenderTarget(Uint32 NumContexts)
+    {
+        auto* pEnv     = TestingEnvironment::GetInstance();
+        auto* pContext = pEnv->GetDeviceContext();
+
+        CopyTextureAttribs CopyAttribs{sm_pRenderTarget, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, sm_pStagingTexture, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+        pContext->CopyTexture(CopyAttribs);
+        pContext->WaitForIdle();
+
+        const auto& TexDesc = sm_pRenderTarget->GetDesc();
+
+        MappedTextureSubresource MappedData;
+        pContext->MapTextureSubresource(sm_pStagingTexture, 0, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+        ASSERT_NE(MappedData.pData, nullptr);
+        for (Uint32 Ctx = 0; Ctx < NumContexts; ++Ctx)
+        {
+            const auto   Constants = GetTestConstants(Ctx, NumContexts);
+            const Uint32 x         = (TexDesc.Width * (2 * Ctx + 1)) / (2 * NumContexts);
+            const Uint32 y         = TexDesc.Height / 2;
+            const auto*  pTexel    = static_cast<const Uint8*>(MappedData.pData) + y * MappedData.Stride + x * 4;
+            for (Uint32 c = 0; c < 4; ++c)
+            {
+                EXPECT_EQ(pTexel[c], static_cast<Uint8>(Constants.Color[c] * 255.f))
+                    << "Component " << c << " of pixel (" << x << ", " << y << ") drawn by deferred context " << Ctx;
+            }
+        }
+        pContext->UnmapTextureSubresource(sm_pStagingTexture, 0, 0);
+    }
+
+    static RefCntAutoPtr<IRenderPass>                         sm_pRenderPass;
+    static RefCntAutoPtr<ITexture>                            sm_pRenderTarget;
+    static RefCntAutoPtr<ITexture>                            sm_pStagingTexture;
+    static RefCntAutoPtr<IFramebuffer>                        sm_pFramebuffer;
+    static RefCntAutoPtr<IPipelineState>                      sm_pPSO;
+    static std::vector<RefCntAutoPtr<IShaderResourceBinding>> sm_SRBs;
+};
+
+RefCntAutoPtr<IRenderPass>                         SecondaryCommandListVkTest::sm_pRenderPass;
+RefCntAutoPtr<ITexture>                            SecondaryCommandListVkTest::sm_pRenderTarget;
+RefCntAutoPtr<ITexture>                            SecondaryCommandListVkTest::sm_pStagingTexture;
+RefCntAutoPtr<IFramebuffer>                        SecondaryCommandListVkTest::sm_pFramebuffer;
+RefCntAutoPtr<IPipelineState>                      SecondaryCommandListVkTest::sm_pPSO;
+std::vector<RefCntAutoPtr<IShaderResourceBinding>> SecondaryCommandListVkTest::sm_SRBs;
+
+TEST_F(SecondaryCommandListVkTest, ExecuteInRenderPass)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+
+    // Every deferred context records one secondary command list for the same subpass
+    RenderParallel(pEnv->GetNumDeferredContexts(), 4);
+    VerifyRenderTarget(pEnv->GetNumDeferredContexts());
+}
+
+// Measures how recording of the same number of draw commands scales
+// with the number of threads that record secondary command lists
+TEST_F(SecondaryCommandListVkTest, DISABLED_RecordingScaling)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+
+    constexpr Uint32 NumDraws = 32768;
+    for (Uint32 NumThreads = 1; NumThreads <= pEnv->GetNumDeferredContexts(); ++NumThreads)
+    {
+        const auto RecordTime = RenderParallel(NumThreads, NumDraws / NumThreads);
+        LOG_INFO_MESSAGE("Recorded ", NumDraws, " draw commands in ", NumThreads, " thread(s) in ", RecordTime * 1000.0, " ms");
+    }
+}
+
+} // namespace
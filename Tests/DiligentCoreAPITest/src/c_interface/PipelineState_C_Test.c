@@ -43,6 +43,8 @@ int TestPipelineStateCInterface(struct IPipelineState* pPSO)
     Uint32 StaticVarCount = 0;
     bool   IsComptible    = false;
 
+    PIPELINE_STATE_STATUS Status = PIPELINE_STATE_STATUS_FAILED;
+
     IShaderResourceVariable* pVar = NULL;
     IShaderResourceBinding*  pSRB = NULL;
 
@@ -99,6 +101,10 @@ int TestPipelineStateCInterface(struct IPipelineState* pPSO)
     if (!IsComptible)
         ++num_errors;
 
+    Status = IPipelineState_GetStatus(pPSO, true);
+    if (Status != PIPELINE_STATE_STATUS_READY)
+        ++num_errors;
+
     return num_errors;
 }
 
@@ -82,7 +82,8 @@ int main(int argc, char** argv)
     SHADER_COMPILER                ShCompiler = SHADER_COMPILER_DEFAULT;
     for (int i = 1; i < argc; ++i)
     {
-        const std::string AdapterArgName = "--adapter=";
+        const std::string AdapterArgName        = "--adapter=";
+        const std::string GLProgramCacheArgName = "--gl_program_cache=";
 
         const auto* arg = argv[i];
         if (strcmp(arg, "--mode=d3d11") == 0)
@@ -127,6 +128,10 @@ int main(int argc, char** argv)
         {
             TestEnvCI.ForceNonSeparablePrograms = true;
         }
+        else if (GLProgramCacheArgName.compare(0, GLProgramCacheArgName.length(), arg, GLProgramCacheArgName.length()) == 0)
+        {
+            TestEnvCI.GLProgramCacheDirectory = arg + GLProgramCacheArgName.length();
+        }
     }
 
     if (TestEnvCI.deviceType == RENDER_DEVICE_TYPE_UNDEFINED)
@@ -177,6 +182,8 @@ int main(int argc, char** argv)
                 std::cout << "\n\n\n==================== Testing Diligent Core API in OpenGL mode ====================\n\n";
                 if (TestEnvCI.ForceNonSeparablePrograms)
                     std::cout << "Forcing non-separable shader programs\n";
+                if (TestEnvCI.GLProgramCacheDirectory != nullptr)
+                    std::cout << "Using program binary cache in " << TestEnvCI.GLProgramCacheDirectory << '\n';
                 pEnv = CreateTestingEnvironmentGL(TestEnvCI, SCDesc);
                 break;
 
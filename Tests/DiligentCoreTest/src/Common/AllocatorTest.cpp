@@ -26,10 +26,18 @@
  */
 
 #include <array>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <cstring>
 
 #include "DefaultRawMemoryAllocator.hpp"
 #include "FixedBlockMemoryAllocator.hpp"
 #include "LinearAllocator.hpp"
+#include "DynamicLinearAllocator.hpp"
+#include "Timer.hpp"
+#include "FastRand.hpp"
 
 #include "gtest/gtest.h"
 
@@ -123,6 +131,278 @@ TEST(Common_FixedBlockMemoryAllocator, UnalignedSize)
     }
 }
 
+TEST(Common_FixedBlockMemoryAllocator, PageSize)
+{
+    // Raw allocator that records the sizes of the pages requested by the fixed block allocator
+    class PageSizeRecorder final : public IMemoryAllocator
+    {
+    public:
+        virtual void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final
+        {
+            if (strcmp(dbgDescription, "FixedBlockMemoryAllocator page") == 0)
+                PageSizes.push_back(Size);
+            return DefaultRawMemoryAllocator::GetAllocator().Allocate(Size, dbgDescription, dbgFileName, dbgLineNumber);
+        }
+
+        virtual void Free(void* Ptr) override final
+        {
+            DefaultRawMemoryAllocator::GetAllocator().Free(Ptr);
+        }
+
+        std::vector<size_t> PageSizes;
+    };
+
+    constexpr Uint32 AllocSize             = 48;
+    constexpr Uint32 NumAllocationsPerPage = 100;
+
+    PageSizeRecorder RawAllocator;
+    {
+        FixedBlockMemoryAllocator TestAllocator{RawAllocator, AllocSize, NumAllocationsPerPage, 0};
+
+        std::vector<void*> Allocations(NumAllocationsPerPage * 3);
+        for (auto& pAlloc : Allocations)
+            pAlloc = TestAllocator.Allocate(AllocSize, "Fixed block allocator test", __FILE__, __LINE__);
+
+        // Blocks must be freed in the order that does not match the page order
+        for (size_t i = 0; i < Allocations.size(); i += 2)
+            TestAllocator.Free(Allocations[i]);
+        for (size_t i = 1; i < Allocations.size(); i += 2)
+            TestAllocator.Free(Allocations[i]);
+    }
+
+    // Pages must not be over-allocated
+    ASSERT_EQ(RawAllocator.PageSizes.size(), size_t{3});
+    for (auto PageSize : RawAllocator.PageSizes)
+        EXPECT_EQ(PageSize, size_t{AllocSize * NumAllocationsPerPage});
+}
+
+// Runs allocations from multiple threads, half of the blocks being freed by a different thread,
+// and returns the time in seconds.
+static double RunFixedBlockAllocatorStressTest(Uint32 ThreadCacheSize, Uint32 NumIterations)
+{
+    constexpr Uint32 AllocSize             = 64;
+    constexpr Uint32 NumAllocationsPerPage = 256;
+    constexpr Uint32 BatchSize             = 64;
+
+    FixedBlockMemoryAllocator TestAllocator{DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage, ThreadCacheSize};
+
+    const auto NumThreads = std::max(std::min(std::thread::hardware_concurrency(), 8u), 2u);
+
+    // Blocks that are allocated by one thread and freed by another
+    std::mutex         ExchangeMtx;
+    std::vector<void*> ExchangeBlocks;
+
+    std::atomic<Uint32> NumCorruptedBlocks{0};
+
+    // Every block is filled with a unique stamp, so that if the same block is given
+    // out twice, the stamp of one of the owners is overwritten.
+    auto WriteStamp = [](void* pBlock, Uint64 Stamp) {
+        auto* pData = reinterpret_cast<Uint64*>(pBlock);
+        for (size_t i = 0; i < AllocSize / sizeof(Uint64); ++i)
+            pData[i] = Stamp;
+    };
+    auto CheckStamp = [](const void* pBlock) {
+        const auto* pData = reinterpret_cast<const Uint64*>(pBlock);
+        for (size_t i = 1; i < AllocSize / sizeof(Uint64); ++i)
+        {
+            if (pData[i] != pData[0])
+                return false;
+        }
+        return true;
+    };
+
+    auto ThreadFunc = [&](Uint32 ThreadId) {
+        FastRandInt Rnd{static_cast<unsigned int>(ThreadId), 0, 1};
+
+        std::vector<void*>  Blocks;
+        std::vector<Uint64> Stamps;
+        std::vector<void*>  ReceivedBlocks;
+        Uint64              Counter = 0;
+        for (Uint32 iter = 0; iter < NumIterations; ++iter)
+        {
+            for (Uint32 i = 0; i < BatchSize; ++i)
+            {
+                auto* pBlock = TestAllocator.Allocate(AllocSize, "Fixed block allocator stress test", __FILE__, __LINE__);
+                auto  Stamp  = (Uint64{ThreadId} << 32u) | Counter++;
+                WriteStamp(pBlock, Stamp);
+                Blocks.push_back(pBlock);
+                Stamps.push_back(Stamp);
+            }
+
+            for (size_t i = 0; i < Blocks.size(); ++i)
+            {
+                if (*reinterpret_cast<const Uint64*>(Blocks[i]) != Stamps[i] || !CheckStamp(Blocks[i]))
+                    ++NumCorruptedBlocks;
+            }
+
+            {
+                std::lock_guard<std::mutex> Lock{ExchangeMtx};
+                ReceivedBlocks.swap(ExchangeBlocks);
+                for (auto* pBlock : Blocks)
+                {
+                    if (Rnd() != 0)
+                        ExchangeBlocks.push_back(pBlock);
+                    else
+                        ReceivedBlocks.push_back(pBlock);
+                }
+            }
+
+            for (auto* pBlock : ReceivedBlocks)
+            {
+                if (!CheckStamp(pBlock))
+                    ++NumCorruptedBlocks;
+                TestAllocator.Free(pBlock);
+            }
+            ReceivedBlocks.clear();
+            Blocks.clear();
+            Stamps.clear();
+        }
+    };
+
+    Timer T;
+
+    const auto StartTime = T.GetElapsedTime();
+
+    std::vector<std::thread> Threads;
+    for (Uint32 t = 0; t < NumThreads; ++t)
+        Threads.emplace_back(ThreadFunc, t);
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    const auto EndTime = T.GetElapsedTime();
+
+    for (auto* pBlock : ExchangeBlocks)
+        TestAllocator.Free(pBlock);
+
+    EXPECT_EQ(NumCorruptedBlocks.load(), 0u);
+
+    return EndTime - StartTime;
+}
+
+TEST(Common_FixedBlockMemoryAllocator, MultithreadedStress)
+{
+    // Thread cache size 0 makes every operation lock the shared page pool
+    RunFixedBlockAllocatorStressTest(0, 200);
+    RunFixedBlockAllocatorStressTest(FixedBlockMemoryAllocator::DefaultThreadCacheSize, 200);
+}
+
+TEST(Common_FixedBlockMemoryAllocator, DISABLED_MultithreadedBenchmark)
+{
+    const auto SharedPoolTime  = RunFixedBlockAllocatorStressTest(0, 2000);
+    const auto ThreadCacheTime = RunFixedBlockAllocatorStressTest(FixedBlockMemoryAllocator::DefaultThreadCacheSize, 2000);
+    LOG_INFO_MESSAGE("Fixed block allocator stress test: shared pool: ", SharedPoolTime * 1000, " ms; thread caches: ", ThreadCacheTime * 1000, " ms");
+}
+
+TEST(Common_DynamicLinearAllocator, Allocate)
+{
+    DynamicLinearAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator(), 256};
+
+    EXPECT_EQ(Allocator.Allocate(0, 16), nullptr);
+    EXPECT_EQ(Allocator.GetPageCount(), size_t{0});
+
+    auto* pUI8 = Allocator.Construct<uint8_t>(uint8_t{15});
+    EXPECT_EQ(*pUI8, uint8_t{15});
+
+    auto* pUI64 = Allocator.ConstructArray<uint64_t>(5, uint64_t{100});
+    EXPECT_EQ(pUI64, Align(pUI64, alignof(uint64_t)));
+    for (size_t i = 0; i < 5; ++i)
+        EXPECT_EQ(pUI64[i], uint64_t{100});
+
+    auto* pAligned = Allocator.Allocate(16, 64);
+    EXPECT_EQ(pAligned, Align(pAligned, 64));
+
+    const std::string SrcStr = "123456789";
+
+    auto* DstStr = Allocator.CopyString(SrcStr);
+    EXPECT_STREQ(DstStr, SrcStr.c_str());
+    EXPECT_EQ(Allocator.GetPageCount(), size_t{1});
+
+    // Overflow to the next page
+    auto* pData = Allocator.Allocate<uint32_t>(50);
+    EXPECT_EQ(Allocator.GetPageCount(), size_t{2});
+    for (uint32_t i = 0; i < 50; ++i)
+        pData[i] = i;
+
+    // Allocation larger than the page size
+    auto* pLarge = Allocator.Allocate(1024, 512);
+    EXPECT_EQ(pLarge, Align(pLarge, 512));
+    EXPECT_EQ(Allocator.GetPageCount(), size_t{3});
+    memset(pLarge, 0xFF, 1024);
+
+    // Previous allocations must not be affected
+    EXPECT_EQ(*pUI8, uint8_t{15});
+    EXPECT_STREQ(DstStr, SrcStr.c_str());
+    for (uint32_t i = 0; i < 50; ++i)
+        EXPECT_EQ(pData[i], i);
+}
+
+TEST(Common_DynamicLinearAllocator, Reset)
+{
+    DynamicLinearAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator(), 256};
+
+    std::vector<void*> Allocations;
+    for (size_t i = 0; i < 64; ++i)
+        Allocations.push_back(Allocator.Allocate(24, 8));
+    Allocations.push_back(Allocator.Allocate(1000, 8));
+
+    const auto PageCount    = Allocator.GetPageCount();
+    const auto ReservedSize = Allocator.GetReservedSize();
+    EXPECT_GT(PageCount, size_t{1});
+    EXPECT_GE(Allocator.GetUsedSize(), size_t{64 * 24 + 1000});
+
+    for (int frame = 0; frame < 4; ++frame)
+    {
+        Allocator.Reset();
+        EXPECT_EQ(Allocator.GetUsedSize(), size_t{0});
+
+        // The same allocation sequence must reuse the existing pages
+        for (size_t i = 0; i < 64; ++i)
+            EXPECT_EQ(Allocator.Allocate(24, 8), Allocations[i]);
+        EXPECT_EQ(Allocator.Allocate(1000, 8), Allocations.back());
+
+        EXPECT_EQ(Allocator.GetPageCount(), PageCount);
+        EXPECT_EQ(Allocator.GetReservedSize(), ReservedSize);
+    }
+
+    Allocator.Free();
+    EXPECT_EQ(Allocator.GetPageCount(), size_t{0});
+    EXPECT_EQ(Allocator.GetReservedSize(), size_t{0});
+}
+
+TEST(Common_DynamicLinearAllocator, Trim)
+{
+    constexpr Uint32 TrimPeriod = 3;
+
+    DynamicLinearAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator(), 128, TrimPeriod};
+
+    auto AllocatePages = [&](size_t NumPages) {
+        for (size_t p = 0; p < NumPages; ++p)
+            Allocator.Allocate(128, 8);
+    };
+
+    AllocatePages(8);
+    EXPECT_EQ(Allocator.GetPageCount(), size_t{8});
+    Allocator.Reset();
+    AllocatePages(2);
+    Allocator.Reset();
+    AllocatePages(3);
+    // The high-water mark of the period is 8 pages
+    Allocator.Reset();
+    EXPECT_EQ(Allocator.GetPageCount(), size_t{8});
+
+    AllocatePages(2);
+    Allocator.Reset();
+    AllocatePages(4);
+    Allocator.Reset();
+    AllocatePages(1);
+    // The high-water mark of the period is 4 pages
+    Allocator.Reset();
+    EXPECT_EQ(Allocator.GetPageCount(), size_t{4});
+
+    AllocatePages(6);
+    EXPECT_EQ(Allocator.GetPageCount(), size_t{6});
+}
+
 TEST(Common_LinearAllocator, EmptyAllocator)
 {
     LinearAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
@@ -0,0 +1,239 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+
+#include "BatchedFrustumCulling.hpp"
+#include "ThreadPool.hpp"
+#include "FastRand.hpp"
+#include "Timer.hpp"
+#include "../../../../Platforms/Basic/interface/DebugUtilities.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+struct BoxArrays
+{
+    BoxArrays(Uint32 NumBoxes, unsigned int Seed)
+    {
+        FastRandFloat CenterRnd{Seed, -100.f, +100.f};
+        FastRandFloat SizeRnd{Seed + 1, 0.f, 20.f};
+
+        for (auto* pArr : {&MinX, &MinY, &MinZ, &MaxX, &MaxY, &MaxZ})
+            pArr->resize(NumBoxes);
+
+        for (Uint32 i = 0; i < NumBoxes; ++i)
+        {
+            float3 Center{CenterRnd(), CenterRnd(), CenterRnd()};
+            float3 Size{SizeRnd(), SizeRnd(), SizeRnd()};
+            MinX[i] = Center.x - Size.x;
+            MinY[i] = Center.y - Size.y;
+            MinZ[i] = Center.z - Size.z;
+            MaxX[i] = Center.x + Size.x;
+            MaxY[i] = Center.y + Size.y;
+            MaxZ[i] = Center.z + Size.z;
+        }
+
+        SoA.MinX     = MinX.data();
+        SoA.MinY     = MinY.data();
+        SoA.MinZ     = MinZ.data();
+        SoA.MaxX     = MaxX.data();
+        SoA.MaxY     = MaxY.data();
+        SoA.MaxZ     = MaxZ.data();
+        SoA.NumBoxes = NumBoxes;
+    }
+
+    BoundBox GetBox(Uint32 i) const
+    {
+        BoundBox Box;
+        Box.Min = float3{MinX[i], MinY[i], MinZ[i]};
+        Box.Max = float3{MaxX[i], MaxY[i], MaxZ[i]};
+        return Box;
+    }
+
+    std::vector<float> MinX, MinY, MinZ, MaxX, MaxY, MaxZ;
+
+    BoundBoxSoA SoA;
+};
+
+ViewFrustumExt GetTestFrustum(float Angle)
+{
+    const auto View = float4x4::RotationY(Angle) * float4x4::RotationX(Angle * 0.5f) * float4x4::Translation(5.f, -3.f, 10.f);
+    const auto Proj = float4x4::Projection(PI_F / 3.f, 1.5f, 1.f, 80.f, false);
+
+    ViewFrustumExt Frustum;
+    ExtractViewFrustumPlanesFromMatrix(View * Proj, Frustum, false);
+    return Frustum;
+}
+
+void TestBatchedCulling(Uint32 NumBoxes, ThreadPool* pWorkerPool)
+{
+    const BoxArrays Boxes{NumBoxes, NumBoxes};
+
+    const FRUSTUM_PLANE_FLAGS TestPlaneFlags[] =
+        {
+            FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+            FRUSTUM_PLANE_FLAG_OPEN_NEAR,
+            FRUSTUM_PLANE_FLAG_LEFT_PLANE | FRUSTUM_PLANE_FLAG_RIGHT_PLANE,
+            FRUSTUM_PLANE_FLAG_NONE //
+        };
+
+    for (float Angle = 0; Angle < 2.f * PI_F; Angle += 0.7f)
+    {
+        const auto Frustum = GetTestFrustum(Angle);
+        for (auto PlaneFlags : TestPlaneFlags)
+        {
+            std::vector<Uint32> RefIndices;
+            for (Uint32 i = 0; i < NumBoxes; ++i)
+            {
+                if (GetBoxVisibility(Frustum, Boxes.GetBox(i), PlaneFlags) != BoxVisibility::Invisible)
+                    RefIndices.push_back(i);
+            }
+
+            std::vector<Uint32> Mask(GetBoxVisibilityMaskSize(NumBoxes), 0xCDCDCDCDu);
+            std::vector<Uint32> Indices(NumBoxes);
+            if (pWorkerPool != nullptr)
+                GetBoxVisibilityMaskMT(Frustum, Boxes.SoA, Mask.data(), *pWorkerPool, PlaneFlags);
+            else
+                GetBoxVisibilityMask(Frustum, Boxes.SoA, Mask.data(), PlaneFlags);
+
+            const auto NumVisible = pWorkerPool != nullptr ?
+                GetVisibleBoxIndicesMT(Frustum, Boxes.SoA, Indices.data(), *pWorkerPool, PlaneFlags) :
+                GetVisibleBoxIndices(Frustum, Boxes.SoA, Indices.data(), PlaneFlags);
+
+            ASSERT_EQ(NumVisible, RefIndices.size());
+            Indices.resize(NumVisible);
+            EXPECT_EQ(Indices, RefIndices);
+
+            std::vector<Uint32> RefMask(Mask.size());
+            for (auto Idx : RefIndices)
+                RefMask[Idx / 32] |= 1u << (Idx % 32);
+            EXPECT_EQ(Mask, RefMask);
+
+            if (PlaneFlags == FRUSTUM_PLANE_FLAG_FULL_FRUSTUM && NumBoxes > 1000)
+            {
+                // Make sure that the test is not trivial
+                EXPECT_GT(RefIndices.size(), size_t{0});
+                EXPECT_LT(RefIndices.size(), size_t{NumBoxes});
+            }
+        }
+    }
+}
+
+TEST(Common_BatchedFrustumCulling, MatchesScalar)
+{
+    for (Uint32 NumBoxes : {1u, 3u, 4u, 7u, 8u, 31u, 32u, 33u, 1037u})
+        TestBatchedCulling(NumBoxes, nullptr);
+}
+
+TEST(Common_BatchedFrustumCulling, MultithreadedMatchesScalar)
+{
+    ThreadPool WorkerPool{3};
+    for (Uint32 NumBoxes : {1037u, 20011u})
+        TestBatchedCulling(NumBoxes, &WorkerPool);
+}
+
+TEST(Common_BatchedFrustumCulling, BusyWorkerPool)
+{
+    // The only pool thread is blocked until culling completes, so the calling
+    // thread must process all ranges itself.
+    ThreadPool WorkerPool{1};
+
+    std::mutex              Mtx;
+    std::condition_variable CV;
+    bool                    CullingComplete = false;
+    WorkerPool.EnqueueTask(
+        [&]() //
+        {
+            std::unique_lock<std::mutex> Lock{Mtx};
+            CV.wait(Lock, [&]() { return CullingComplete; });
+        });
+
+    TestBatchedCulling(20011, &WorkerPool);
+
+    {
+        std::lock_guard<std::mutex> Lock{Mtx};
+        CullingComplete = true;
+    }
+    CV.notify_one();
+    WorkerPool.WaitForAllTasks();
+}
+
+TEST(Common_BatchedFrustumCulling, DISABLED_Benchmark)
+{
+    constexpr Uint32 NumBoxes      = 256 * 1024;
+    constexpr Uint32 NumIterations = 8;
+
+    const BoxArrays Boxes{NumBoxes, 0};
+    const auto      Frustum = GetTestFrustum(0.3f);
+
+    ThreadPool   WorkerPool;
+    const Uint32 NumThreads = WorkerPool.GetNumThreads() + 1;
+
+    std::vector<Uint32> Indices(NumBoxes);
+
+    Timer T;
+
+    Uint32     NumScalarVisible = 0;
+    const auto ScalarStartTime  = T.GetElapsedTime();
+    for (Uint32 iter = 0; iter < NumIterations; ++iter)
+    {
+        NumScalarVisible = 0;
+        for (Uint32 i = 0; i < NumBoxes; ++i)
+        {
+            if (GetBoxVisibility(Frustum, Boxes.GetBox(i)) != BoxVisibility::Invisible)
+                Indices[NumScalarVisible++] = i;
+        }
+    }
+    const auto ScalarTime = (T.GetElapsedTime() - ScalarStartTime) / NumIterations;
+
+    Uint32     NumBatchedVisible = 0;
+    const auto BatchedStartTime  = T.GetElapsedTime();
+    for (Uint32 iter = 0; iter < NumIterations; ++iter)
+        NumBatchedVisible = GetVisibleBoxIndices(Frustum, Boxes.SoA, Indices.data());
+    const auto BatchedTime = (T.GetElapsedTime() - BatchedStartTime) / NumIterations;
+
+    Uint32     NumMTVisible = 0;
+    const auto MTStartTime  = T.GetElapsedTime();
+    for (Uint32 iter = 0; iter < NumIterations; ++iter)
+        NumMTVisible = GetVisibleBoxIndicesMT(Frustum, Boxes.SoA, Indices.data(), WorkerPool);
+    const auto MTTime = (T.GetElapsedTime() - MTStartTime) / NumIterations;
+
+    EXPECT_EQ(NumBatchedVisible, NumScalarVisible);
+    EXPECT_EQ(NumMTVisible, NumScalarVisible);
+
+    LOG_INFO_MESSAGE("Frustum culling of ", NumBoxes, " boxes (", NumScalarVisible, " visible): scalar: ", ScalarTime * 1000,
+                     " ms; batched: ", BatchedTime * 1000, " ms; batched, ", NumThreads, " threads: ", MTTime * 1000, " ms");
+}
+
+} // namespace
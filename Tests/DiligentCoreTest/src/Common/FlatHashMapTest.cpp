@@ -0,0 +1,347 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include <unordered_map>
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "FlatHashMap.hpp"
+#include "STDAllocator.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "HashUtils.hpp"
+#include "FastRand.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(Common_FlatHashMap, Basic)
+{
+    FlatHashMap<int, std::string> Map;
+    EXPECT_TRUE(Map.empty());
+    EXPECT_EQ(Map.find(0), Map.end());
+    EXPECT_EQ(Map.begin(), Map.end());
+    EXPECT_EQ(Map.erase(0), size_t{0});
+
+    auto Ins = Map.emplace(1, "One");
+    EXPECT_TRUE(Ins.second);
+    EXPECT_EQ(Ins.first->first, 1);
+    EXPECT_EQ(Ins.first->second, "One");
+
+    Ins = Map.emplace(1, "Another one");
+    EXPECT_FALSE(Ins.second);
+    EXPECT_EQ(Ins.first->second, "One");
+
+    Map[2] = "Two";
+    EXPECT_EQ(Map.size(), size_t{2});
+    EXPECT_EQ(Map.count(2), size_t{1});
+    EXPECT_EQ(Map.count(3), size_t{0});
+    EXPECT_EQ(Map[2], "Two");
+
+    EXPECT_EQ(Map.erase(1), size_t{1});
+    EXPECT_EQ(Map.find(1), Map.end());
+    EXPECT_EQ(Map.size(), size_t{1});
+
+    Map.clear();
+    EXPECT_TRUE(Map.empty());
+    EXPECT_EQ(Map.begin(), Map.end());
+}
+
+TEST(Common_FlatHashMap, RandomOperations)
+{
+    FlatHashMap<Uint32, Uint32>        Map;
+    std::unordered_map<Uint32, Uint32> RefMap;
+
+    FastRand Rnd{0};
+    for (Uint32 i = 0; i < 100000; ++i)
+    {
+        // Use a small key range to have many hits and removals
+        const Uint32 Key = Rnd() % 4096;
+        switch (Rnd() % 4)
+        {
+            case 0:
+            case 1:
+            {
+                auto Ins    = Map.emplace(Key, i);
+                auto RefIns = RefMap.emplace(Key, i);
+                ASSERT_EQ(Ins.second, RefIns.second);
+                EXPECT_EQ(Ins.first->second, RefIns.first->second);
+                break;
+            }
+
+            case 2:
+                ASSERT_EQ(Map.erase(Key), RefMap.erase(Key));
+                break;
+
+            case 3:
+            {
+                auto It    = Map.find(Key);
+                auto RefIt = RefMap.find(Key);
+                ASSERT_EQ(It == Map.end(), RefIt == RefMap.end());
+                if (It != Map.end())
+                {
+                    EXPECT_EQ(It->second, RefIt->second);
+                }
+                break;
+            }
+        }
+        ASSERT_EQ(Map.size(), RefMap.size());
+    }
+
+    size_t NumElements = 0;
+    for (const auto& Elem : Map)
+    {
+        auto RefIt = RefMap.find(Elem.first);
+        ASSERT_NE(RefIt, RefMap.end());
+        EXPECT_EQ(Elem.second, RefIt->second);
+        ++NumElements;
+    }
+    EXPECT_EQ(NumElements, RefMap.size());
+}
+
+TEST(Common_FlatHashMap, EraseWhileIterating)
+{
+    FlatHashMap<Uint32, Uint32> Map;
+    for (Uint32 i = 0; i < 1000; ++i)
+        Map.emplace(i, i);
+
+    // Every element must be visited exactly once even though erasing shifts the elements
+    std::vector<int> VisitCount(1000);
+    for (auto It = Map.begin(); It != Map.end();)
+    {
+        ++VisitCount[It->first];
+        if (It->first % 3 != 0)
+            It = Map.erase(It);
+        else
+            ++It;
+    }
+
+    for (Uint32 i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(VisitCount[i], 1);
+        EXPECT_EQ(Map.count(i), i % 3 == 0 ? size_t{1} : size_t{0});
+    }
+}
+
+struct NonAssignableKey
+{
+    explicit NonAssignableKey(int _Val) :
+        Val{_Val}
+    {}
+
+    const int Val;
+
+    bool operator==(const NonAssignableKey& rhs) const
+    {
+        return Val == rhs.Val;
+    }
+
+    struct Hasher
+    {
+        size_t operator()(const NonAssignableKey& Key) const
+        {
+            return static_cast<size_t>(Key.Val);
+        }
+    };
+};
+
+TEST(Common_FlatHashMap, MoveOnlyAndNonAssignable)
+{
+    FlatHashMap<NonAssignableKey, std::unique_ptr<int>, NonAssignableKey::Hasher> Map;
+    for (int i = 0; i < 100; ++i)
+        Map.emplace(NonAssignableKey{i}, std::unique_ptr<int>{new int{i}});
+
+    for (int i = 0; i < 100; i += 2)
+        Map.erase(NonAssignableKey{i});
+
+    for (int i = 0; i < 100; ++i)
+    {
+        auto It = Map.find(NonAssignableKey{i});
+        if (i % 2 == 0)
+        {
+            EXPECT_EQ(It, Map.end());
+        }
+        else
+        {
+            ASSERT_NE(It, Map.end());
+            EXPECT_EQ(*It->second, i);
+        }
+    }
+
+    FlatHashMap<HashMapStringKey, int, HashMapStringKey::Hasher> StrMap;
+    StrMap.emplace(HashMapStringKey{"Key1", true}, 1);
+    StrMap.emplace(HashMapStringKey{"Key2", true}, 2);
+    EXPECT_EQ(StrMap.find("Key1")->second, 1);
+    EXPECT_EQ(StrMap.find("Key2")->second, 2);
+    EXPECT_EQ(StrMap.find("Key3"), StrMap.end());
+}
+
+struct TransparentStringHash
+{
+    using is_transparent = void;
+
+    size_t operator()(const std::string& Str) const
+    {
+        return static_cast<size_t>(ComputeHashRaw(Str.data(), Str.length()));
+    }
+
+    size_t operator()(const char* Str) const
+    {
+        return static_cast<size_t>(ComputeHashRaw(Str, strlen(Str)));
+    }
+};
+
+struct TransparentStringEqual
+{
+    using is_transparent = void;
+
+    bool operator()(const std::string& Str1, const std::string& Str2) const
+    {
+        return Str1 == Str2;
+    }
+
+    bool operator()(const std::string& Str1, const char* Str2) const
+    {
+        return Str1 == Str2;
+    }
+};
+
+TEST(Common_FlatHashMap, HeterogeneousLookup)
+{
+    FlatHashMap<std::string, int, TransparentStringHash, TransparentStringEqual> Map;
+    Map.emplace(std::string{"Key1"}, 1);
+    Map.emplace(std::string{"Key2"}, 2);
+
+    const char* Key1 = "Key1";
+    EXPECT_EQ(Map.find(Key1)->second, 1);
+    EXPECT_EQ(Map.count("Key2"), size_t{1});
+    EXPECT_EQ(Map.find("Key3"), Map.end());
+}
+
+class CountingAllocator final : public IMemoryAllocator
+{
+public:
+    virtual void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final
+    {
+        ++NumAllocations;
+        return DefaultRawMemoryAllocator::GetAllocator().Allocate(Size, dbgDescription, dbgFileName, dbgLineNumber);
+    }
+
+    virtual void Free(void* Ptr) override final
+    {
+        ++NumFrees;
+        DefaultRawMemoryAllocator::GetAllocator().Free(Ptr);
+    }
+
+    Uint32 NumAllocations = 0;
+    Uint32 NumFrees       = 0;
+};
+
+TEST(Common_FlatHashMap, STDAllocator)
+{
+    CountingAllocator Allocator;
+    {
+        using MapType = FlatHashMap<Uint32, Uint32, std::hash<Uint32>, std::equal_to<Uint32>, STDAllocatorRawMem<std::pair<Uint32, Uint32>>>;
+        MapType Map{STD_ALLOCATOR_RAW_MEM(MapType::value_type, Allocator, "Allocator for FlatHashMap<Uint32, Uint32>")};
+
+        Map.reserve(1000);
+        const auto NumAllocations = Allocator.NumAllocations;
+        EXPECT_EQ(NumAllocations, Uint32{1});
+        EXPECT_GE(Map.capacity(), size_t{1000});
+
+        // No allocations must be performed until the capacity is exhausted
+        for (Uint32 i = 0; i < 1000; ++i)
+            Map.emplace(i * 7919, i);
+        EXPECT_EQ(Allocator.NumAllocations, NumAllocations);
+
+        for (Uint32 i = 0; i < 1000; ++i)
+            EXPECT_EQ(Map.find(i * 7919)->second, i);
+    }
+    EXPECT_EQ(Allocator.NumAllocations, Allocator.NumFrees);
+}
+
+template <typename MapType>
+void MeasureLookupLatency(const char* Name, const std::vector<Uint64>& Keys, const std::vector<Uint64>& MissKeys)
+{
+    constexpr Uint32 NumLookups = 1 << 20;
+
+    MapType Map;
+    for (size_t i = 0; i < Keys.size(); ++i)
+        Map.emplace(Keys[i], static_cast<Uint32>(i));
+
+    Timer T;
+
+    Uint64     Sum       = 0;
+    const auto StartTime = T.GetElapsedTime();
+    for (Uint32 i = 0; i < NumLookups; ++i)
+        Sum += Map.find(Keys[i % Keys.size()])->second;
+    const auto HitTime = T.GetElapsedTime() - StartTime;
+
+    size_t     NumFound      = 0;
+    const auto MissStartTime = T.GetElapsedTime();
+    for (Uint32 i = 0; i < NumLookups; ++i)
+        NumFound += Map.find(MissKeys[i % MissKeys.size()]) != Map.end() ? 1 : 0;
+    const auto MissTime = T.GetElapsedTime() - MissStartTime;
+
+    EXPECT_GT(Sum, Uint64{0});
+    EXPECT_EQ(NumFound, size_t{0});
+
+    LOG_INFO_MESSAGE(Name, ", ", Keys.size(), " elements: hit: ", HitTime * 1e9 / NumLookups, " ns; miss: ", MissTime * 1e9 / NumLookups, " ns");
+}
+
+TEST(Common_FlatHashMap, DISABLED_LookupBenchmark)
+{
+    struct KeyHasher
+    {
+        size_t operator()(Uint64 Key) const
+        {
+            return static_cast<size_t>(ComputeHashRaw(&Key, sizeof(Key)));
+        }
+    };
+
+    FastRand Rnd{0};
+    for (Uint32 NumKeys : {64u, 4096u, 262144u})
+    {
+        // Even keys are present in the map, odd keys are not
+        std::vector<Uint64> Keys(NumKeys), MissKeys(NumKeys);
+        for (Uint32 i = 0; i < NumKeys; ++i)
+        {
+            Keys[i]     = ((Uint64{Rnd()} << 32) | Rnd()) & ~Uint64{1};
+            MissKeys[i] = Keys[i] | 1;
+        }
+
+        MeasureLookupLatency<std::unordered_map<Uint64, Uint32, KeyHasher>>("std::unordered_map", Keys, MissKeys);
+        MeasureLookupLatency<FlatHashMap<Uint64, Uint32, KeyHasher>>("FlatHashMap", Keys, MissKeys);
+    }
+}
+
+} // namespace
@@ -26,8 +26,13 @@
  */
 
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <string>
 
 #include "HashUtils.hpp"
+#include "FastRand.hpp"
+#include "Timer.hpp"
 
 #include "gtest/gtest.h"
 
@@ -116,4 +121,236 @@ TEST(Common_HashUtils, HashMapStringKey)
     }
 }
 
+TEST(Common_HashUtils, ComputeHashRaw)
+{
+    std::vector<Uint8> Data(256);
+    for (size_t i = 0; i < Data.size(); ++i)
+        Data[i] = static_cast<Uint8>(i * 37 + 11);
+
+    // Hashes of all prefixes must be distinct
+    std::unordered_set<Uint64> Hashes;
+    for (size_t Size = 0; Size <= 200; ++Size)
+    {
+        const auto Hash = ComputeHashRaw(Data.data(), Size);
+        EXPECT_EQ(Hash, ComputeHashRaw(Data.data(), Size));
+        EXPECT_TRUE(Hashes.insert(Hash).second) << "Size: " << Size;
+
+        // Alignment must not affect the hash
+        std::vector<Uint8> Copy(Size + 1);
+        if (Size > 0)
+            memcpy(Copy.data() + 1, Data.data(), Size);
+        EXPECT_EQ(Hash, ComputeHashRaw(Copy.data() + 1, Size));
+
+        EXPECT_NE(Hash, ComputeHashRaw(Data.data(), Size, 1));
+    }
+
+    // Flipping any bit must change the hash
+    for (size_t Size : {3, 8, 15, 16, 17, 48, 49, 100})
+    {
+        const auto Hash = ComputeHashRaw(Data.data(), Size);
+        for (size_t bit = 0; bit < Size * 8; ++bit)
+        {
+            Data[bit / 8] ^= 1 << (bit % 8);
+            EXPECT_NE(ComputeHashRaw(Data.data(), Size), Hash) << "Size: " << Size << ", bit: " << bit;
+            Data[bit / 8] ^= 1 << (bit % 8);
+        }
+    }
+}
+
+TEST(Common_HashUtils, ComputeHashPacked)
+{
+    EXPECT_EQ(ComputeHashPacked(Uint8{1}, Uint32{2}, 3.f), ComputeHashPacked(Uint8{1}, Uint32{2}, 3.f));
+    EXPECT_NE(ComputeHashPacked(Uint8{1}, Uint32{2}, 3.f), ComputeHashPacked(Uint8{1}, Uint32{3}, 3.f));
+    EXPECT_NE(ComputeHashPacked(Uint32{1}, Uint32{2}), ComputeHashPacked(Uint32{2}, Uint32{1}));
+    // +0 and -0 compare equal and must have the same hash
+    EXPECT_EQ(ComputeHashPacked(0.f, 1.f), ComputeHashPacked(-0.f, 1.f));
+
+    HashDataPacker<16> Packer;
+    Packer.Add(Uint16{1}, Uint8{2});
+    EXPECT_EQ(Packer.GetSize(), size_t{3});
+    EXPECT_EQ(Packer.GetHash(), ComputeHashPacked(Uint16{1}, Uint8{2}));
+
+    EXPECT_EQ(CStringHash<Char>{}("Test String"), CStringHash<Char>{}(std::string{"Test String"}.c_str()));
+    EXPECT_NE(CStringHash<Char>{}("Test String 1"), CStringHash<Char>{}("Test String 2"));
+}
+
+// Cache key similar to the render pass and framebuffer cache keys
+struct TestCacheKey
+{
+    Uint32 NumRenderTargets = 0;
+    Uint32 SampleCount      = 0;
+    Uint32 DSVFormat        = 0;
+    Uint32 RTVFormats[8]    = {};
+
+    bool operator==(const TestCacheKey& rhs) const
+    {
+        return NumRenderTargets == rhs.NumRenderTargets &&
+            SampleCount == rhs.SampleCount &&
+            DSVFormat == rhs.DSVFormat &&
+            memcmp(RTVFormats, rhs.RTVFormats, sizeof(RTVFormats)) == 0;
+    }
+};
+
+struct LegacyCacheKeyHasher
+{
+    size_t operator()(const TestCacheKey& Key) const
+    {
+        auto Hash = ComputeHash(Key.NumRenderTargets, Key.SampleCount, Key.DSVFormat);
+        for (Uint32 rt = 0; rt < Key.NumRenderTargets; ++rt)
+            HashCombine(Hash, Key.RTVFormats[rt]);
+        return Hash;
+    }
+};
+
+struct PackedCacheKeyHasher
+{
+    size_t operator()(const TestCacheKey& Key) const
+    {
+        HashDataPacker<sizeof(TestCacheKey)> Packer;
+        Packer.Add(Key.NumRenderTargets, Key.SampleCount, Key.DSVFormat);
+        for (Uint32 rt = 0; rt < Key.NumRenderTargets; ++rt)
+            Packer.Add(Key.RTVFormats[rt]);
+        return Packer.GetHash();
+    }
+};
+
+// Key similar to SamplerDesc
+struct TestSamplerKey
+{
+    Uint8  Filters[3]      = {};
+    Uint8  AddressModes[3] = {};
+    float  MipLODBias      = 0;
+    Uint32 MaxAnisotropy   = 0;
+    float  BorderColor[4]  = {};
+    float  MinLOD          = 0;
+    float  MaxLOD          = 0;
+
+    bool operator==(const TestSamplerKey& rhs) const
+    {
+        // clang-format off
+        return memcmp(Filters,      rhs.Filters,      sizeof(Filters))      == 0 &&
+               memcmp(AddressModes, rhs.AddressModes, sizeof(AddressModes)) == 0 &&
+               memcmp(BorderColor,  rhs.BorderColor,  sizeof(BorderColor))  == 0 &&
+               MipLODBias    == rhs.MipLODBias    &&
+               MaxAnisotropy == rhs.MaxAnisotropy &&
+               MinLOD        == rhs.MinLOD        &&
+               MaxLOD        == rhs.MaxLOD;
+        // clang-format on
+    }
+};
+
+struct LegacySamplerKeyHasher
+{
+    size_t operator()(const TestSamplerKey& Key) const
+    {
+        return ComputeHash(static_cast<int>(Key.Filters[0]), static_cast<int>(Key.Filters[1]), static_cast<int>(Key.Filters[2]),
+                           static_cast<int>(Key.AddressModes[0]), static_cast<int>(Key.AddressModes[1]), static_cast<int>(Key.AddressModes[2]),
+                           Key.MipLODBias, Key.MaxAnisotropy,
+                           Key.BorderColor[0], Key.BorderColor[1], Key.BorderColor[2], Key.BorderColor[3],
+                           Key.MinLOD, Key.MaxLOD);
+    }
+};
+
+struct PackedSamplerKeyHasher
+{
+    size_t operator()(const TestSamplerKey& Key) const
+    {
+        return ComputeHashPacked(Key.Filters[0], Key.Filters[1], Key.Filters[2],
+                                 Key.AddressModes[0], Key.AddressModes[1], Key.AddressModes[2],
+                                 Key.MipLODBias, Key.MaxAnisotropy,
+                                 Key.BorderColor[0], Key.BorderColor[1], Key.BorderColor[2], Key.BorderColor[3],
+                                 Key.MinLOD, Key.MaxLOD);
+    }
+};
+
+struct LegacyStringHasher
+{
+    size_t operator()(const std::string& Str) const
+    {
+        std::size_t Seed = 0;
+        for (auto Ch : Str)
+            Seed = Seed * 65599 + static_cast<size_t>(Ch);
+        return Seed;
+    }
+};
+
+struct RawStringHasher
+{
+    size_t operator()(const std::string& Str) const
+    {
+        return static_cast<size_t>(ComputeHashRaw(Str.data(), Str.length()));
+    }
+};
+
+template <typename KeyType, typename HasherType>
+double MeasureLookupTime(const std::vector<KeyType>& Keys, Uint32 NumLookups)
+{
+    std::unordered_map<KeyType, Uint32, HasherType> Map;
+    for (Uint32 i = 0; i < Keys.size(); ++i)
+        Map.emplace(Keys[i], i);
+
+    Timer T;
+
+    Uint32     Sum       = 0;
+    const auto StartTime = T.GetElapsedTime();
+    for (Uint32 i = 0; i < NumLookups; ++i)
+    {
+        auto it = Map.find(Keys[i % Keys.size()]);
+        Sum += it->second;
+    }
+    const auto EndTime = T.GetElapsedTime();
+
+    EXPECT_GT(Sum, Uint32{0});
+    return EndTime - StartTime;
+}
+
+TEST(Common_HashUtils, DISABLED_LookupBenchmark)
+{
+    constexpr Uint32 NumKeys    = 4096;
+    constexpr Uint32 NumLookups = 1 << 20;
+
+    FastRand Rnd{0};
+
+    std::vector<TestCacheKey> CacheKeys(NumKeys);
+    for (auto& Key : CacheKeys)
+    {
+        Key.NumRenderTargets = 1 + Rnd() % 8;
+        Key.SampleCount      = 1 << (Rnd() % 4);
+        Key.DSVFormat        = Rnd() % 100;
+        for (Uint32 rt = 0; rt < Key.NumRenderTargets; ++rt)
+            Key.RTVFormats[rt] = Rnd() % 100;
+    }
+
+    FastRandFloat               RndFloat{1, 0.f, 16.f};
+    std::vector<TestSamplerKey> SamplerKeys(NumKeys);
+    for (auto& Key : SamplerKeys)
+    {
+        for (auto& Filter : Key.Filters)
+            Filter = static_cast<Uint8>(Rnd() % 4);
+        for (auto& Mode : Key.AddressModes)
+            Mode = static_cast<Uint8>(Rnd() % 4);
+        Key.MipLODBias    = RndFloat();
+        Key.MaxAnisotropy = Rnd() % 16;
+        for (auto& Color : Key.BorderColor)
+            Color = RndFloat();
+        Key.MinLOD = RndFloat();
+        Key.MaxLOD = Key.MinLOD + RndFloat();
+    }
+
+    std::vector<std::string> StringKeys(NumKeys);
+    for (Uint32 i = 0; i < NumKeys; ++i)
+        StringKeys[i] = "g_ShaderResourceVariable_" + std::to_string(Rnd()) + "_" + std::to_string(i);
+
+    const auto LegacyKeyTime = MeasureLookupTime<TestCacheKey, LegacyCacheKeyHasher>(CacheKeys, NumLookups);
+    const auto PackedKeyTime = MeasureLookupTime<TestCacheKey, PackedCacheKeyHasher>(CacheKeys, NumLookups);
+    const auto LegacySamTime = MeasureLookupTime<TestSamplerKey, LegacySamplerKeyHasher>(SamplerKeys, NumLookups);
+    const auto PackedSamTime = MeasureLookupTime<TestSamplerKey, PackedSamplerKeyHasher>(SamplerKeys, NumLookups);
+    const auto LegacyStrTime = MeasureLookupTime<std::string, LegacyStringHasher>(StringKeys, NumLookups);
+    const auto RawStrTime    = MeasureLookupTime<std::string, RawStringHasher>(StringKeys, NumLookups);
+
+    LOG_INFO_MESSAGE(NumLookups, " lookups, HashCombine vs ComputeHashRaw: render pass keys: ", LegacyKeyTime * 1000, " ms vs ", PackedKeyTime * 1000,
+                     " ms; sampler keys: ", LegacySamTime * 1000, " ms vs ", PackedSamTime * 1000,
+                     " ms; strings (65599 hash): ", LegacyStrTime * 1000, " ms vs ", RawStrTime * 1000, " ms");
+}
+
 } // namespace
@@ -0,0 +1,173 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include <thread>
+#include <vector>
+#include <string>
+#include <atomic>
+
+#include "InternedStringPool.hpp"
+#include "HashUtils.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(Common_InternedStringPool, Basic)
+{
+    InternedStringPool Pool;
+
+    const auto& Str1 = Pool.Intern("g_Texture");
+    const auto& Str2 = Pool.Intern("g_Sampler");
+    const auto& Str3 = Pool.Intern(std::string{"g_Texture"}.c_str());
+
+    EXPECT_EQ(&Str1, &Str3);
+    EXPECT_EQ(Str1.Str, Str3.Str);
+    EXPECT_NE(Str1.Str, Str2.Str);
+    EXPECT_STREQ(Str1.Str, "g_Texture");
+    EXPECT_STREQ(Str2.Str, "g_Sampler");
+    EXPECT_EQ(Str1.Length, 9u);
+    EXPECT_EQ(Str1.Hash, CStringHash<Char>{}("g_Texture"));
+    EXPECT_EQ(Pool.GetStringCount(), 2u);
+
+    // Strings that are not null-terminated
+    const auto& Str4 = Pool.Intern("g_Texture_Array", 9);
+    EXPECT_EQ(&Str4, &Str1);
+    const auto& Str5 = Pool.Intern("g_Texture_Array", 12);
+    EXPECT_STREQ(Str5.Str, "g_Texture_Ar");
+    EXPECT_EQ(Str5.Length, 12u);
+
+    const auto& Empty = Pool.Intern("");
+    EXPECT_STREQ(Empty.Str, "");
+    EXPECT_EQ(Empty.Length, 0u);
+    EXPECT_EQ(&Pool.Intern(""), &Empty);
+
+    EXPECT_EQ(Pool.Find("g_Sampler"), &Str2);
+    EXPECT_EQ(Pool.Find("g_Buffer"), nullptr);
+    EXPECT_EQ(Pool.GetStringCount(), 4u);
+}
+
+TEST(Common_InternedStringPool, StableHandles)
+{
+    // Use small pages to make the pool allocate many of them
+    InternedStringPool Pool{DefaultRawMemoryAllocator::GetAllocator(), 64};
+
+    std::vector<const InternedString*> Handles;
+    std::vector<const Char*>           Strings;
+    for (int i = 0; i < 4096; ++i)
+    {
+        auto        Name = std::string{"Resource_"} + std::to_string(i);
+        const auto& Str  = Pool.Intern(Name.c_str());
+        Handles.push_back(&Str);
+        Strings.push_back(Str.Str);
+    }
+
+    // Strings longer than the page size
+    const std::string LongName(256, 'x');
+    const auto&       LongStr = Pool.Intern(LongName.c_str());
+    EXPECT_EQ(LongName, LongStr.Str);
+
+    for (int i = 0; i < 4096; ++i)
+    {
+        auto Name = std::string{"Resource_"} + std::to_string(i);
+        EXPECT_EQ(Handles[i], &Pool.Intern(Name.c_str()));
+        EXPECT_EQ(Handles[i]->Str, Strings[i]);
+        EXPECT_EQ(Name, Handles[i]->Str);
+    }
+    EXPECT_EQ(Pool.GetStringCount(), 4097u);
+}
+
+TEST(Common_InternedStringPool, Multithreaded)
+{
+    InternedStringPool Pool{DefaultRawMemoryAllocator::GetAllocator(), 256};
+
+    constexpr int NumThreads = 8;
+    constexpr int NumNames   = 2048;
+
+    std::vector<std::string> Names;
+    for (int i = 0; i < NumNames; ++i)
+        Names.emplace_back(std::string{"Variable_"} + std::to_string(i));
+
+    std::vector<std::vector<const InternedString*>> Handles(NumThreads);
+
+    std::atomic<int>         NumThreadsReady{0};
+    std::vector<std::thread> Threads;
+    for (int t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back(
+            [&](int Thread) //
+            {
+                auto& ThreadHandles = Handles[Thread];
+                ThreadHandles.resize(NumNames);
+
+                ++NumThreadsReady;
+                while (NumThreadsReady.load() < NumThreads)
+                    std::this_thread::yield();
+
+                // Every thread goes through the names in its own order
+                for (int i = 0; i < NumNames; ++i)
+                {
+                    auto Idx           = (i * 7 + Thread * 131) % NumNames;
+                    ThreadHandles[Idx] = &Pool.Intern(Names[Idx].c_str());
+                }
+            },
+            t);
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    EXPECT_EQ(Pool.GetStringCount(), static_cast<size_t>(NumNames));
+    for (int i = 0; i < NumNames; ++i)
+    {
+        const auto* pStr = Handles[0][i];
+        ASSERT_NE(pStr, nullptr);
+        EXPECT_EQ(Names[i], pStr->Str);
+        for (int t = 1; t < NumThreads; ++t)
+            EXPECT_EQ(Handles[t][i], pStr);
+    }
+}
+
+TEST(Common_InternedStringPool, HashMapStringKey)
+{
+    const auto& Str = InternString("g_Constants");
+    EXPECT_EQ(&Str, &InternString("g_Constants"));
+    EXPECT_EQ(&Str, InternedStringPool::GetGlobalPool().Find("g_Constants"));
+
+    HashMapStringKey InternedKey{Str};
+    HashMapStringKey Key{"g_Constants"};
+    EXPECT_EQ(InternedKey.GetHash(), Key.GetHash());
+    EXPECT_EQ(InternedKey.GetStr(), Str.Str);
+    EXPECT_TRUE(InternedKey == Key);
+    EXPECT_TRUE(InternedKey == HashMapStringKey{Str});
+    EXPECT_FALSE(InternedKey == HashMapStringKey{"g_Constants2"});
+}
+
+} // namespace
@@ -0,0 +1,207 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+
+#include "LockHelper.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace ThreadingTools;
+
+namespace
+{
+
+// Spin lock that LockHelper used before, kept for comparison
+class SpinLock
+{
+public:
+    void lock()
+    {
+        int SpinCount = 0;
+        while (!try_lock())
+        {
+            ++SpinCount;
+            if (SpinCount == 256)
+            {
+                SpinCount = 0;
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    bool try_lock()
+    {
+        Atomics::Long Expected = 0;
+        return m_Flag.compare_exchange_strong(Expected, 1);
+    }
+
+    void unlock()
+    {
+        m_Flag = 0;
+    }
+
+private:
+    std::atomic<Atomics::Long> m_Flag{0};
+};
+
+class AdaptiveLock
+{
+public:
+    void lock()
+    {
+        LockHelper::UnsafeLock(m_Flag);
+    }
+
+    void unlock()
+    {
+        LockHelper::UnsafeUnlock(m_Flag);
+    }
+
+private:
+    LockFlag m_Flag;
+};
+
+// Runs NumThreads threads that increment a shared counter under the lock and returns the time in seconds
+template <typename LockType>
+double RunLockBenchmark(Uint32 NumThreads, Uint32 NumIterationsPerThread)
+{
+    LockType Lock;
+    Uint64   Counter = 0;
+
+    std::atomic<Uint32> NumReadyThreads{0};
+    std::atomic<bool>   Start{false};
+
+    std::vector<std::thread> Threads;
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&]() {
+            ++NumReadyThreads;
+            while (!Start)
+                std::this_thread::yield();
+
+            for (Uint32 i = 0; i < NumIterationsPerThread; ++i)
+            {
+                std::lock_guard<LockType> Guard{Lock};
+                // Small critical section
+                for (int j = 0; j < 4; ++j)
+                    ++Counter;
+            }
+        });
+    }
+
+    while (NumReadyThreads < NumThreads)
+        std::this_thread::yield();
+
+    Timer T;
+
+    const auto StartTime = T.GetElapsedTime();
+    Start                = true;
+    for (auto& Thread : Threads)
+        Thread.join();
+    const auto EndTime = T.GetElapsedTime();
+
+    EXPECT_EQ(Counter, Uint64{NumThreads} * NumIterationsPerThread * 4);
+
+    return EndTime - StartTime;
+}
+
+TEST(Common_LockHelper, MutualExclusion)
+{
+    LockFlag Flag;
+
+    {
+        LockHelper Lock{Flag};
+        EXPECT_EQ(static_cast<Atomics::Long>(Flag), Atomics::Long{LockFlag::LOCK_FLAG_LOCKED});
+
+        LockHelper Lock2;
+        EXPECT_FALSE(Lock2.TryLock(Flag));
+    }
+    EXPECT_EQ(static_cast<Atomics::Long>(Flag), Atomics::Long{LockFlag::LOCK_FLAG_UNLOCKED});
+
+    const auto StartContentionCount = LockHelper::GetContentionCount();
+
+    // Hold the lock while other threads are trying to acquire it, so that they block
+    Uint64 Counter = 0;
+    {
+        LockHelper Lock{Flag};
+
+        std::vector<std::thread> Threads;
+        for (int t = 0; t < 8; ++t)
+        {
+            Threads.emplace_back([&]() {
+                for (int i = 0; i < 10000; ++i)
+                {
+                    LockHelper Lock{Flag};
+                    ++Counter;
+                }
+            });
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        Lock.Unlock();
+
+        for (auto& Thread : Threads)
+            Thread.join();
+    }
+
+    EXPECT_EQ(Counter, Uint64{8 * 10000});
+    EXPECT_EQ(static_cast<Atomics::Long>(Flag), Atomics::Long{LockFlag::LOCK_FLAG_UNLOCKED});
+    EXPECT_GT(LockHelper::GetContentionCount(), StartContentionCount);
+}
+
+TEST(Common_LockHelper, DISABLED_Benchmark)
+{
+    constexpr Uint32 TotalIterations = 64 * 1024;
+
+    for (Uint32 NumThreads = 1; NumThreads <= 64; NumThreads *= 2)
+    {
+        const auto NumIterationsPerThread = TotalIterations / NumThreads;
+
+        const auto StartContentionCount = LockHelper::GetContentionCount();
+        const auto StartWaitCount       = LockHelper::GetWaitCount();
+
+        const auto AdaptiveLockTime = RunLockBenchmark<AdaptiveLock>(NumThreads, NumIterationsPerThread);
+
+        const auto ContentionCount = LockHelper::GetContentionCount() - StartContentionCount;
+        const auto WaitCount       = LockHelper::GetWaitCount() - StartWaitCount;
+
+        const auto SpinLockTime = RunLockBenchmark<SpinLock>(NumThreads, NumIterationsPerThread);
+        const auto MutexTime    = RunLockBenchmark<std::mutex>(NumThreads, NumIterationsPerThread);
+
+        LOG_INFO_MESSAGE("Lock benchmark, ", NumThreads, " threads: adaptive lock: ", AdaptiveLockTime * 1000,
+                         " ms (", ContentionCount, " contended, ", WaitCount, " waits); spin lock: ", SpinLockTime * 1000,
+                         " ms; std::mutex: ", MutexTime * 1000, " ms");
+    }
+}
+
+} // namespace
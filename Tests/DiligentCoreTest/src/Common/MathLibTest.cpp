@@ -29,6 +29,7 @@
 
 #include "BasicMath.hpp"
 #include "AdvancedMath.hpp"
+#include "FastRand.hpp"
 
 #include "gtest/gtest.h"
 
@@ -1962,4 +1963,124 @@ TEST(Common_AdvancedMath, TransformBoundBox)
     }
 }
 
+// Compares SIMD implementations of float operations with the reference scalar implementations
+// evaluated in double precision.
+TEST(Common_BasicMath, SIMDFuzz)
+{
+    FastRandFloat Rnd{0, -10.f, 10.f};
+
+    auto RandomVector = [&]() {
+        return float4{Rnd(), Rnd(), Rnd(), Rnd()};
+    };
+    auto RandomMatrix = [&]() {
+        float4x4 m;
+        for (int i = 0; i < 16; ++i)
+            m.Data()[i] = Rnd();
+        return m;
+    };
+    auto ToDouble = [](const float4x4& m) {
+        return double4x4::MakeMatrix(m.Data());
+    };
+
+    auto ExpectNear = [](double Val, double Ref, double Scale) {
+        EXPECT_NEAR(Val, Ref, 1e-5 * std::max(Scale, 1.0));
+    };
+
+    for (int test = 0; test < 1000; ++test)
+    {
+        const auto m1 = RandomMatrix();
+        const auto m2 = RandomMatrix();
+        const auto v  = RandomVector();
+
+        const auto dm1 = ToDouble(m1);
+        const auto dm2 = ToDouble(m2);
+        const auto dv  = v.Recast<double>();
+
+        // Matrix-matrix product
+        {
+            const auto m    = m1 * m2;
+            const auto dRef = dm1 * dm2;
+            for (int i = 0; i < 4; ++i)
+                for (int j = 0; j < 4; ++j)
+                    ExpectNear(m[i][j], dRef[i][j], 400);
+
+            auto m3 = m1;
+            m3 *= m2;
+            EXPECT_EQ(m3, m);
+        }
+
+        // Vector-matrix and matrix-vector products
+        {
+            const auto v1    = v * m1;
+            const auto v2    = m1 * v;
+            const auto dRef1 = dv * dm1;
+            const auto dRef2 = dm1 * dv;
+            for (int i = 0; i < 4; ++i)
+            {
+                ExpectNear(v1[i], dRef1[i], 400);
+                ExpectNear(v2[i], dRef2[i], 400);
+            }
+        }
+
+        // Transpose
+        {
+            const auto mt = m1.Transpose();
+            for (int i = 0; i < 4; ++i)
+                for (int j = 0; j < 4; ++j)
+                    EXPECT_EQ(mt[i][j], m1[j][i]);
+        }
+
+        // Inverse
+        {
+            // Add a diagonal to keep the matrix well-conditioned
+            auto m = m1;
+            for (int i = 0; i < 4; ++i)
+                m[i][i] += m[i][i] >= 0 ? 40.f : -40.f;
+
+            const auto inv  = m.Inverse();
+            const auto dRef = ToDouble(m).Inverse();
+            for (int i = 0; i < 4; ++i)
+                for (int j = 0; j < 4; ++j)
+                    ExpectNear(inv[i][j], dRef[i][j], 0.1);
+        }
+
+        // Dot product and normalization
+        {
+            const auto v2 = RandomVector();
+            ExpectNear(dot(v, v2), dot(dv, v2.Recast<double>()), 400);
+
+            const auto n    = normalize(v);
+            const auto dRef = normalize(dv);
+            for (int i = 0; i < 4; ++i)
+                ExpectNear(n[i], dRef[i], 1);
+        }
+
+        // Cross product
+        {
+            const auto a = float3{Rnd(), Rnd(), Rnd()};
+            const auto b = float3{Rnd(), Rnd(), Rnd()};
+
+            const auto c    = cross(a, b);
+            const auto dRef = cross(a.Recast<double>(), b.Recast<double>());
+            for (int i = 0; i < 3; ++i)
+                ExpectNear(c[i], dRef[i], 200);
+        }
+    }
+
+    // Singular matrix
+    {
+        // clang-format off
+        float4x4 m
+        {
+            1,  2,   3,  4,
+            5,  6,   7,  8,
+            9, 10,  11, 12,
+            13, 14, 15, 16
+        };
+        // clang-format on
+        auto inv = m.Inverse();
+        EXPECT_FALSE(std::isfinite(inv[0][0]));
+    }
+}
+
 } // namespace
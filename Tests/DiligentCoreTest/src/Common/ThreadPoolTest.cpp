@@ -0,0 +1,86 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+#include <atomic>
+#include <vector>
+
+#include "ThreadPool.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(Common_ThreadPool, ExecuteTasks)
+{
+    constexpr Uint32 NumTasks = 1024;
+
+    ThreadPool Pool{4};
+    EXPECT_EQ(Pool.GetNumThreads(), 4u);
+
+    std::atomic<Uint32> Counter{0};
+    std::vector<Uint32> Results(NumTasks);
+    for (Uint32 i = 0; i < NumTasks; ++i)
+    {
+        Pool.EnqueueTask([&Counter, &Results, i]() {
+            Results[i] = i * i;
+            Counter.fetch_add(1);
+        });
+    }
+    Pool.WaitForAllTasks();
+
+    EXPECT_EQ(Counter.load(), NumTasks);
+    EXPECT_EQ(Pool.GetNumPendingTasks(), size_t{0});
+    for (Uint32 i = 0; i < NumTasks; ++i)
+        EXPECT_EQ(Results[i], i * i);
+}
+
+TEST(Common_ThreadPool, DefaultNumThreads)
+{
+    ThreadPool Pool;
+    EXPECT_GE(Pool.GetNumThreads(), 1u);
+}
+
+TEST(Common_ThreadPool, DestructorExecutesPendingTasks)
+{
+    constexpr Uint32 NumTasks = 256;
+
+    std::atomic<Uint32> Counter{0};
+    {
+        ThreadPool Pool{2};
+        for (Uint32 i = 0; i < NumTasks; ++i)
+        {
+            Pool.EnqueueTask([&Counter]() {
+                Counter.fetch_add(1);
+            });
+        }
+    }
+    EXPECT_EQ(Counter.load(), NumTasks);
+}
+
+} // namespace
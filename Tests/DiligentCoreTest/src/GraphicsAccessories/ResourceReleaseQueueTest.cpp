@@ -26,6 +26,9 @@
  */
 
 #include <memory>
+#include <thread>
+#include <atomic>
+#include <vector>
 
 #include "ResourceReleaseQueue.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
@@ -37,7 +40,8 @@ using namespace Diligent;
 namespace
 {
 
-TEST(GraphicsAccessories_ResourceReleaseQueue, GetFilterTypeLiteralName)
+template <typename QueueType>
+void TestReleaseQueue()
 {
     struct ResourceA
     {
@@ -53,7 +57,7 @@ TEST(GraphicsAccessories_ResourceReleaseQueue, GetFilterTypeLiteralName)
     };
 
     {
-        ResourceReleaseQueue<DynamicStaleResourceWrapper> Queue(DefaultRawMemoryAllocator::GetAllocator());
+        QueueType Queue(DefaultRawMemoryAllocator::GetAllocator());
 
         std::unique_ptr<ResourceA> res0(new ResourceA);
         std::unique_ptr<ResourceB> res1(new ResourceB);
@@ -82,17 +86,17 @@ TEST(GraphicsAccessories_ResourceReleaseQueue, GetFilterTypeLiteralName)
     }
 
     {
-        ResourceReleaseQueue<DynamicStaleResourceWrapper> Queue0(DefaultRawMemoryAllocator::GetAllocator());
-        ResourceReleaseQueue<DynamicStaleResourceWrapper> Queue1(DefaultRawMemoryAllocator::GetAllocator());
-        ResourceReleaseQueue<DynamicStaleResourceWrapper> Queue2(DefaultRawMemoryAllocator::GetAllocator());
+        QueueType Queue0(DefaultRawMemoryAllocator::GetAllocator());
+        QueueType Queue1(DefaultRawMemoryAllocator::GetAllocator());
+        QueueType Queue2(DefaultRawMemoryAllocator::GetAllocator());
 
         std::unique_ptr<ResourceA> res0(new ResourceA);
         std::unique_ptr<ResourceB> res1(new ResourceB);
         std::unique_ptr<ResourceC> res2(new ResourceC);
 
-        auto Wrapper0 = ResourceReleaseQueue<DynamicStaleResourceWrapper>::CreateWrapper(std::move(res0), 3);
-        auto Wrapper1 = ResourceReleaseQueue<DynamicStaleResourceWrapper>::CreateWrapper(std::move(res1), 3);
-        auto Wrapper2 = ResourceReleaseQueue<DynamicStaleResourceWrapper>::CreateWrapper(std::move(res2), 1);
+        auto Wrapper0 = QueueType::CreateWrapper(std::move(res0), 3);
+        auto Wrapper1 = QueueType::CreateWrapper(std::move(res1), 3);
+        auto Wrapper2 = QueueType::CreateWrapper(std::move(res2), 1);
 
         Queue0.SafeReleaseResource(Wrapper0, 0);
         Queue0.SafeReleaseResource(Wrapper1, 0);
@@ -112,13 +116,13 @@ TEST(GraphicsAccessories_ResourceReleaseQueue, GetFilterTypeLiteralName)
 
         std::unique_ptr<ResourceC> res3(new ResourceC);
 
-        auto Wrapper3 = ResourceReleaseQueue<DynamicStaleResourceWrapper>::CreateWrapper(std::move(res3), 2);
+        auto Wrapper3 = QueueType::CreateWrapper(std::move(res3), 2);
         Queue0.DiscardResource(Wrapper3, 1);
         Queue1.DiscardResource(std::move(Wrapper3), 1);
 
         std::unique_ptr<ResourceA> res4(new ResourceA);
 
-        auto Wrapper4 = ResourceReleaseQueue<DynamicStaleResourceWrapper>::CreateWrapper(std::move(res4), 1);
+        auto Wrapper4 = QueueType::CreateWrapper(std::move(res4), 1);
         Queue2.DiscardResource(Wrapper4, 1);
         Wrapper4.GiveUpOwnership();
 
@@ -128,4 +132,104 @@ TEST(GraphicsAccessories_ResourceReleaseQueue, GetFilterTypeLiteralName)
     }
 }
 
+TEST(GraphicsAccessories_ResourceReleaseQueue, GetFilterTypeLiteralName)
+{
+    TestReleaseQueue<ResourceReleaseQueue<DynamicStaleResourceWrapper>>();
+}
+
+TEST(GraphicsAccessories_MPSCResourceReleaseQueue, Basic)
+{
+    TestReleaseQueue<MPSCResourceReleaseQueue<DynamicStaleResourceWrapper>>();
+}
+
+TEST(GraphicsAccessories_MPSCResourceReleaseQueue, MultipleProducers)
+{
+    struct Resource
+    {
+        Resource(std::atomic<int>& _NumAlive, const std::atomic<Uint64>& _CompletedFence, Uint64 _Fence) :
+            pNumAlive{&_NumAlive},
+            pCompletedFence{&_CompletedFence},
+            Fence{_Fence}
+        {
+            ++*pNumAlive;
+        }
+
+        Resource(Resource&& rhs) noexcept :
+            pNumAlive{rhs.pNumAlive},
+            pCompletedFence{rhs.pCompletedFence},
+            Fence{rhs.Fence}
+        {
+            rhs.pNumAlive = nullptr;
+        }
+
+        // clang-format off
+        Resource             (const Resource&) = delete;
+        Resource& operator = (const Resource&) = delete;
+        Resource& operator = (Resource&&)      = delete;
+        // clang-format on
+
+        ~Resource()
+        {
+            if (pNumAlive != nullptr)
+            {
+                // The resource must never be destroyed before its fence has completed
+                EXPECT_LE(Fence, pCompletedFence->load());
+                --*pNumAlive;
+            }
+        }
+
+        std::atomic<int>*          pNumAlive;
+        const std::atomic<Uint64>* pCompletedFence;
+        const Uint64               Fence;
+    };
+
+    constexpr int NumProducers          = 4;
+    constexpr int NumResourcesPerThread = 5000;
+
+    std::atomic<int>    NumAlive{0};
+    std::atomic<Uint64> CmdListNumber{0};
+    std::atomic<Uint64> CompletedFence{0};
+    std::atomic<int>    NumFinishedProducers{0};
+
+    MPSCResourceReleaseQueue<DynamicStaleResourceWrapper> Queue{DefaultRawMemoryAllocator::GetAllocator()};
+
+    std::vector<std::thread> Producers;
+    for (int t = 0; t < NumProducers; ++t)
+    {
+        Producers.emplace_back([&]() {
+            for (int i = 0; i < NumResourcesPerThread; ++i)
+            {
+                // The resource may be used by the command list that will be submitted next, so its
+                // fence is at least two values ahead of the fence of the last submitted command list.
+                const auto NextCmdList = CmdListNumber.load();
+                Queue.SafeReleaseResource(Resource{NumAlive, CompletedFence, NextCmdList + 1}, NextCmdList);
+                if (i % 8 == 0)
+                    Queue.DiscardResource(Resource{NumAlive, CompletedFence, NextCmdList}, NextCmdList);
+            }
+            ++NumFinishedProducers;
+        });
+    }
+
+    // Fence value N is signaled when command list N - 1 completes
+    while (NumFinishedProducers.load() < NumProducers)
+    {
+        const auto SubmittedCmdList = CmdListNumber.fetch_add(1);
+        Queue.DiscardStaleResources(SubmittedCmdList, SubmittedCmdList + 1);
+        CompletedFence.store(SubmittedCmdList);
+        Queue.Purge(CompletedFence.load());
+    }
+
+    for (auto& Producer : Producers)
+        Producer.join();
+
+    const auto LastCmdList = CmdListNumber.fetch_add(1);
+    Queue.DiscardStaleResources(LastCmdList, LastCmdList + 1);
+    CompletedFence.store(LastCmdList + 1);
+    Queue.Purge(CompletedFence.load());
+
+    EXPECT_EQ(Queue.GetStaleResourceCount(), size_t{0});
+    EXPECT_EQ(Queue.GetPendingReleaseResourceCount(), size_t{0});
+    EXPECT_EQ(NumAlive.load(), 0);
+}
+
 } // namespace
@@ -25,9 +25,14 @@
  *  of the possibility of such damages.
  */
 
+#include <vector>
+#include <algorithm>
+
 #include "VariableSizeGPUAllocationsManager.hpp"
+#include "TLSFAllocationsManager.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
 #include "PlatformDefinitions.h"
+#include "FastRand.hpp"
 
 #include "gtest/gtest.h"
 
@@ -36,14 +41,15 @@ using namespace Diligent;
 namespace
 {
 
-TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, AllocateFree)
+template <typename AllocationsMgrType>
+void TestAllocateFree()
 {
     auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
 
-    using OffsetType = VariableSizeAllocationsManager::OffsetType;
+    using OffsetType = typename AllocationsMgrType::OffsetType;
 
     {
-        VariableSizeAllocationsManager ListMgr(128, Allocator);
+        AllocationsMgrType ListMgr(128, Allocator);
         EXPECT_EQ(ListMgr.GetNumFreeBlocks(), size_t{1});
 
         auto a1 = ListMgr.Allocate(17, 4);
@@ -130,7 +136,7 @@ TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, AllocateFree)
     }
 
     {
-        VariableSizeAllocationsManager ListMgr(128, Allocator);
+        AllocationsMgrType ListMgr(128, Allocator);
 
         auto a1 = ListMgr.Allocate(64, 1);
         EXPECT_EQ(a1.UnalignedOffset, OffsetType{0});
@@ -138,7 +144,7 @@ TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, AllocateFree)
         EXPECT_EQ(ListMgr.GetNumFreeBlocks(), size_t{1});
 
         auto a2 = ListMgr.Allocate(128, 1);
-        EXPECT_EQ(a2, VariableSizeAllocationsManager::Allocation::InvalidAllocation());
+        EXPECT_EQ(a2, AllocationsMgrType::Allocation::InvalidAllocation());
 
         ListMgr.Extend(128);
         EXPECT_EQ(ListMgr.GetNumFreeBlocks(), size_t{1});
@@ -171,10 +177,11 @@ TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, AllocateFree)
     }
 }
 
-TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, FreeOrder)
+template <typename AllocationsMgrType>
+void TestFreeOrder()
 {
     auto& Allocator  = DefaultRawMemoryAllocator::GetAllocator();
-    using OffsetType = VariableSizeAllocationsManager::OffsetType;
+    using OffsetType = typename AllocationsMgrType::OffsetType;
 
     {
         const auto NumAllocs = 6;
@@ -185,9 +192,9 @@ TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, FreeOrder)
         do
         {
             ++NumPerms;
-            VariableSizeAllocationsManager ListMgr(NumAllocs * 4, Allocator);
+            AllocationsMgrType ListMgr(NumAllocs * 4, Allocator);
 
-            VariableSizeAllocationsManager::Allocation allocs[NumAllocs];
+            typename AllocationsMgrType::Allocation allocs[NumAllocs];
             for (size_t a = 0; a < NumAllocs; ++a)
             {
                 allocs[a] = ListMgr.Allocate(4, 1);
@@ -203,6 +210,118 @@ TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, FreeOrder)
     }
 }
 
+TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, AllocateFree)
+{
+    TestAllocateFree<VariableSizeAllocationsManager>();
+}
+
+TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, FreeOrder)
+{
+    TestFreeOrder<VariableSizeAllocationsManager>();
+}
+
+TEST(GraphicsAccessories_TLSFAllocationsManager, AllocateFree)
+{
+    TestAllocateFree<TLSFAllocationsManager>();
+}
+
+TEST(GraphicsAccessories_TLSFAllocationsManager, FreeOrder)
+{
+    TestFreeOrder<TLSFAllocationsManager>();
+}
+
+// Runs the same random sequence of requests through TLSF and best-fit managers
+// and verifies that TLSF allocations are consistent
+TEST(GraphicsAccessories_TLSFAllocationsManager, CrossCheck)
+{
+    auto& Allocator  = DefaultRawMemoryAllocator::GetAllocator();
+    using OffsetType = TLSFAllocationsManager::OffsetType;
+    using Allocation = TLSFAllocationsManager::Allocation;
+
+    constexpr OffsetType MaxSize = 1 << 16;
+
+    VariableSizeAllocationsManager RefMgr{MaxSize, Allocator};
+    TLSFAllocationsManager         TLSFMgr{MaxSize, Allocator};
+
+    // Both managers always hold the same logical set of allocations
+    std::vector<std::pair<Allocation, Allocation>> Allocs;
+
+    // Bytes allocated from the TLSF manager
+    std::vector<bool> Used(MaxSize);
+
+    auto MarkUsed = [&](const Allocation& a, bool IsUsed) //
+    {
+        for (auto o = a.UnalignedOffset; o < a.UnalignedOffset + a.Size; ++o)
+        {
+            EXPECT_NE(Used[o], IsUsed) << "Allocation [" << a.UnalignedOffset << ", " << a.UnalignedOffset + a.Size << ") is corrupted";
+            Used[o] = IsUsed;
+        }
+    };
+
+    auto FreeRandom = [&](FastRandInt& Rnd) //
+    {
+        auto Idx = static_cast<size_t>(Rnd()) % Allocs.size();
+        MarkUsed(Allocs[Idx].second, false);
+        RefMgr.Free(std::move(Allocs[Idx].first));
+        TLSFMgr.Free(std::move(Allocs[Idx].second));
+        std::swap(Allocs[Idx], Allocs.back());
+        Allocs.pop_back();
+    };
+
+    FastRandInt Rnd{0, 0, 2047};
+    for (int i = 0; i < 20000; ++i)
+    {
+        if (Rnd() < 900 && !Allocs.empty())
+        {
+            FreeRandom(Rnd);
+            continue;
+        }
+
+        const OffsetType Size      = 1 + static_cast<OffsetType>(Rnd());
+        const OffsetType Alignment = OffsetType{1} << (Rnd() % 8);
+
+        auto RefAlloc  = RefMgr.Allocate(Size, Alignment);
+        auto TLSFAlloc = TLSFMgr.Allocate(Size, Alignment);
+        if (Allocs.empty())
+        {
+            // Both managers are in the same initial state
+            EXPECT_EQ(RefAlloc, TLSFAlloc);
+        }
+
+        if (TLSFAlloc.IsValid())
+        {
+            ASSERT_LE(TLSFAlloc.UnalignedOffset + TLSFAlloc.Size, MaxSize);
+            EXPECT_LE(Align(TLSFAlloc.UnalignedOffset, Alignment) + Size, TLSFAlloc.UnalignedOffset + TLSFAlloc.Size);
+        }
+
+        if (RefAlloc.IsValid() && TLSFAlloc.IsValid())
+        {
+            MarkUsed(TLSFAlloc, true);
+            Allocs.emplace_back(RefAlloc, TLSFAlloc);
+        }
+        else
+        {
+            // Managers place allocations differently, so one may fail while the other succeeds
+            if (RefAlloc.IsValid())
+                RefMgr.Free(std::move(RefAlloc));
+            if (TLSFAlloc.IsValid())
+                TLSFMgr.Free(std::move(TLSFAlloc));
+        }
+
+        OffsetType TLSFUsedSize = 0;
+        for (const auto& a : Allocs)
+            TLSFUsedSize += a.second.Size;
+        EXPECT_EQ(TLSFMgr.GetUsedSize(), TLSFUsedSize);
+    }
+
+    while (!Allocs.empty())
+        FreeRandom(Rnd);
+
+    EXPECT_TRUE(RefMgr.IsEmpty());
+    EXPECT_TRUE(TLSFMgr.IsEmpty());
+    EXPECT_EQ(TLSFMgr.GetNumFreeBlocks(), size_t{1});
+}
+
 TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, Free)
 {
     auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
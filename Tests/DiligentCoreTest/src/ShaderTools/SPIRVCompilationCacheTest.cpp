@@ -0,0 +1,289 @@
+/*
+ *  Copyright 2019-2020 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <thread>
+
+#include "SPIRVCompilationCache.hpp"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "DataBlobImpl.hpp"
+#include "MemoryFileStream.hpp"
+#include "FileSystem.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+class TestSourceStreamFactory final : public ObjectBase<IShaderSourceInputStreamFactory>
+{
+public:
+    TestSourceStreamFactory(IReferenceCounters* pRefCounters) :
+        ObjectBase<IShaderSourceInputStreamFactory>{pRefCounters}
+    {}
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream(const Char* Name, IFileStream** ppStream) override final
+    {
+        CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, ppStream);
+    }
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream2(const Char*                             Name,
+                                                       CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                                       IFileStream**                           ppStream) override final
+    {
+        auto it = Files.find(Name);
+        if (it == Files.end())
+            return;
+
+        RefCntAutoPtr<DataBlobImpl> pData{MakeNewRCObj<DataBlobImpl>{}(it->second.length())};
+        memcpy(pData->GetDataPtr(), it->second.data(), it->second.length());
+        RefCntAutoPtr<MemoryFileStream> pStream{MakeNewRCObj<MemoryFileStream>{}(pData)};
+        pStream->QueryInterface(IID_FileStream, reinterpret_cast<IObject**>(ppStream));
+    }
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_IShaderSourceInputStreamFactory, ObjectBase<IShaderSourceInputStreamFactory>);
+
+    std::unordered_map<std::string, std::string> Files;
+};
+
+std::vector<uint32_t> MakeBytecode(size_t Size, uint32_t Value)
+{
+    return std::vector<uint32_t>(Size, Value);
+}
+
+TEST(ShaderTools_SPIRVCompilationCache, ComputeKey)
+{
+    const ShaderMacro Macros[] = {{"MACRO", "1"}, {}};
+
+    SPIRVCompilationCache::KeyAttribs Attribs;
+    Attribs.Source         = "void main(){}";
+    Attribs.Macros         = Macros;
+    Attribs.EntryPoint     = "main";
+    Attribs.ShaderType     = SHADER_TYPE_PIXEL;
+    Attribs.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+
+    const auto RefKey = SPIRVCompilationCache::ComputeKey(Attribs);
+    EXPECT_EQ(RefKey, SPIRVCompilationCache::ComputeKey(Attribs));
+    EXPECT_EQ(RefKey.ToString().length(), size_t{32});
+
+    {
+        auto Attribs2   = Attribs;
+        Attribs2.Source = "void main(){ }";
+        EXPECT_FALSE(RefKey == SPIRVCompilationCache::ComputeKey(Attribs2));
+    }
+    {
+        const ShaderMacro Macros2[] = {{"MACRO", "2"}, {}};
+        auto              Attribs2  = Attribs;
+        Attribs2.Macros             = Macros2;
+        EXPECT_FALSE(RefKey == SPIRVCompilationCache::ComputeKey(Attribs2));
+    }
+    {
+        // Macro boundaries must be unambiguous
+        const ShaderMacro Macros2[] = {{"MACRO1", ""}, {}};
+        auto              Attribs2  = Attribs;
+        Attribs2.Macros             = Macros2;
+        EXPECT_FALSE(RefKey == SPIRVCompilationCache::ComputeKey(Attribs2));
+    }
+    {
+        auto Attribs2       = Attribs;
+        Attribs2.EntryPoint = "main2";
+        EXPECT_FALSE(RefKey == SPIRVCompilationCache::ComputeKey(Attribs2));
+    }
+    {
+        auto Attribs2       = Attribs;
+        Attribs2.ShaderType = SHADER_TYPE_VERTEX;
+        EXPECT_FALSE(RefKey == SPIRVCompilationCache::ComputeKey(Attribs2));
+    }
+    {
+        auto Attribs2           = Attribs;
+        Attribs2.ShaderCompiler = SHADER_COMPILER_DXC;
+        EXPECT_FALSE(RefKey == SPIRVCompilationCache::ComputeKey(Attribs2));
+    }
+    {
+        auto Attribs2            = Attribs;
+        Attribs2.CompilerVersion = 1;
+        EXPECT_FALSE(RefKey == SPIRVCompilationCache::ComputeKey(Attribs2));
+    }
+    {
+        auto Attribs2                  = Attribs;
+        Attribs2.CompilerVersionString = "glslang 11.1.0";
+        EXPECT_FALSE(RefKey == SPIRVCompilationCache::ComputeKey(Attribs2));
+    }
+}
+
+TEST(ShaderTools_SPIRVCompilationCache, IncludedFiles)
+{
+    RefCntAutoPtr<TestSourceStreamFactory> pFactory{MakeNewRCObj<TestSourceStreamFactory>{}()};
+    pFactory->Files["main.psh"]   = "#include \"common.fxh\"\nvoid main(){}";
+    pFactory->Files["common.fxh"] = "#  include <inner.fxh>\n#include \"common.fxh\"\n";
+    pFactory->Files["inner.fxh"]  = "#define VALUE 1\n";
+
+    SPIRVCompilationCache::KeyAttribs Attribs;
+    Attribs.FilePath                   = "main.psh";
+    Attribs.pShaderSourceStreamFactory = pFactory;
+    Attribs.ShaderType                 = SHADER_TYPE_PIXEL;
+
+    const auto RefKey = SPIRVCompilationCache::ComputeKey(Attribs);
+    EXPECT_EQ(RefKey, SPIRVCompilationCache::ComputeKey(Attribs));
+
+    // Changing a file that is included indirectly must change the key
+    pFactory->Files["inner.fxh"] = "#define VALUE 2\n";
+    const auto Key2              = SPIRVCompilationCache::ComputeKey(Attribs);
+    EXPECT_FALSE(RefKey == Key2);
+
+    // Missing include files do not prevent key computation
+    pFactory->Files["inner.fxh"] = "#include \"missing.fxh\"\n";
+    EXPECT_FALSE(Key2 == SPIRVCompilationCache::ComputeKey(Attribs));
+}
+
+TEST(ShaderTools_SPIRVCompilationCache, MemoryLRU)
+{
+    constexpr size_t BytecodeSize = 16;
+
+    SPIRVCompilationCache Cache{3 * BytecodeSize * sizeof(uint32_t)};
+    EXPECT_FALSE(Cache.IsDiskCacheEnabled());
+
+    SPIRVCompilationCache::Key Keys[4];
+    for (Uint32 i = 0; i < _countof(Keys); ++i)
+        Keys[i].Hash[0] = Keys[i].Hash[1] = i + 1;
+
+    std::vector<uint32_t> SPIRV;
+    EXPECT_FALSE(Cache.Find(Keys[0], SPIRV));
+
+    for (Uint32 i = 0; i < 3; ++i)
+        Cache.Add(Keys[i], MakeBytecode(BytecodeSize, i));
+
+    // Touch the first entry so that the second one becomes the least recently used
+    ASSERT_TRUE(Cache.Find(Keys[0], SPIRV));
+    EXPECT_EQ(SPIRV, MakeBytecode(BytecodeSize, 0));
+
+    Cache.Add(Keys[3], MakeBytecode(BytecodeSize, 3));
+
+    EXPECT_TRUE(Cache.Find(Keys[0], SPIRV));
+    EXPECT_FALSE(Cache.Find(Keys[1], SPIRV));
+    EXPECT_TRUE(Cache.Find(Keys[2], SPIRV));
+    EXPECT_EQ(SPIRV, MakeBytecode(BytecodeSize, 2));
+    EXPECT_TRUE(Cache.Find(Keys[3], SPIRV));
+
+    // Bytecode that exceeds the cache capacity is not added
+    Cache.Add(Keys[1], MakeBytecode(BytecodeSize * 4, 1));
+    EXPECT_FALSE(Cache.Find(Keys[1], SPIRV));
+
+    const auto Stats = Cache.GetStatistics();
+    EXPECT_EQ(Stats.MemoryHits, 4u);
+    EXPECT_EQ(Stats.DiskHits, 0u);
+    EXPECT_EQ(Stats.Misses, 3u);
+    EXPECT_EQ(Stats.Evictions, 1u);
+    EXPECT_EQ(Stats.NumEntries, 3u);
+    EXPECT_EQ(Stats.MemorySize, 3 * BytecodeSize * sizeof(uint32_t));
+}
+
+TEST(ShaderTools_SPIRVCompilationCache, DiskCache)
+{
+    const char* CacheDir = "SPIRVCompilationCacheTest";
+    if (FileSystem::PathExists(CacheDir))
+        FileSystem::DeleteDirectory(CacheDir);
+
+    SPIRVCompilationCache::Key CacheKey;
+    CacheKey.Hash[0] = 0x0123456789ABCDEFull;
+    CacheKey.Hash[1] = 0xFEDCBA9876543210ull;
+
+    const auto Bytecode = MakeBytecode(64, 0x07230203);
+    {
+        SPIRVCompilationCache Cache{1024, CacheDir};
+        ASSERT_TRUE(Cache.IsDiskCacheEnabled());
+        Cache.Add(CacheKey, Bytecode);
+    }
+
+    {
+        // New cache instance with an empty memory tier
+        SPIRVCompilationCache Cache{1024, CacheDir};
+
+        std::vector<uint32_t> SPIRV;
+        ASSERT_TRUE(Cache.Find(CacheKey, SPIRV));
+        EXPECT_EQ(SPIRV, Bytecode);
+        ASSERT_TRUE(Cache.Find(CacheKey, SPIRV));
+        EXPECT_EQ(SPIRV, Bytecode);
+
+        const auto Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.DiskHits, 1u);
+        EXPECT_EQ(Stats.MemoryHits, 1u);
+        EXPECT_EQ(Stats.Misses, 0u);
+    }
+
+    const auto FilePath = std::string{CacheDir} + FileSystem::GetSlashSymbol() + CacheKey.ToString() + ".spv";
+    EXPECT_TRUE(FileSystem::FileExists(FilePath.c_str()));
+
+    FileSystem::DeleteDirectory(CacheDir);
+    EXPECT_FALSE(FileSystem::PathExists(CacheDir));
+}
+
+TEST(ShaderTools_SPIRVCompilationCache, ConcurrentDiskWrites)
+{
+    const char* CacheDir = "SPIRVCompilationCacheConcurrencyTest";
+    if (FileSystem::PathExists(CacheDir))
+        FileSystem::DeleteDirectory(CacheDir);
+
+    SPIRVCompilationCache::Key CacheKey;
+    CacheKey.Hash[0] = 0x0F1E2D3C4B5A6978ull;
+    CacheKey.Hash[1] = 0x8796A5B4C3D2E1F0ull;
+
+    const auto Bytecode = MakeBytecode(1024, 0x07230203);
+
+    // Separate cache instances emulate different processes writing the same entry
+    constexpr Uint32         NumThreads = 4;
+    std::vector<std::thread> Threads;
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back(
+            [&]() //
+            {
+                SPIRVCompilationCache Cache{0, CacheDir};
+                for (Uint32 i = 0; i < 4; ++i)
+                    Cache.Add(CacheKey, Bytecode);
+            });
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    {
+        SPIRVCompilationCache Cache{0, CacheDir};
+
+        std::vector<uint32_t> SPIRV;
+        ASSERT_TRUE(Cache.Find(CacheKey, SPIRV));
+        EXPECT_EQ(SPIRV, Bytecode);
+    }
+
+    FileSystem::DeleteDirectory(CacheDir);
+    EXPECT_FALSE(FileSystem::PathExists(CacheDir));
+}
+
+} // namespace
@@ -32,4 +32,7 @@ void TestDeviceContextGL_CInterface(IDeviceContextGL* pCtxGL)
     bool res = IDeviceContextGL_UpdateCurrentGLContext(pCtxGL);
     (void)res;
     IDeviceContextGL_SetSwapChain(pCtxGL, (struct ISwapChainGL*)NULL);
+
+    BindingStatisticsGL LastFrameStats, TotalStats;
+    IDeviceContextGL_GetBindingStatistics(pCtxGL, &LastFrameStats, &TotalStats);
 }
@@ -37,4 +37,7 @@ void TestDeviceContextVk_CInterface(IDeviceContextVk* pCtx)
     (void)pVkCmdQueue;
 
     IDeviceContextVk_UnlockCommandQueue(pCtx);
+
+    CommandPoolStatisticsVk Stats;
+    IDeviceContextVk_GetCommandPoolStatistics(pCtx, &Stats);
 }